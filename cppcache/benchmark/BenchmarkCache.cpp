@@ -0,0 +1,57 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <mutex>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "BenchmarkCache.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+std::mutex g_benchmarkCacheMutex;
+
+}  // namespace
+
+Cache& getBenchmarkCache() {
+  static std::shared_ptr<Cache> cache = [] {
+    return CacheFactory::createCacheFactory()
+        ->set("log-level", "none")
+        ->set("statistic-sampling-enabled", "false")
+        ->create();
+  }();
+  return *cache;
+}
+
+std::shared_ptr<Region> getBenchmarkRegion(const char* name,
+                                           uint32_t lruEntriesLimit) {
+  std::lock_guard<std::mutex> guard(g_benchmarkCacheMutex);
+  auto& cache = getBenchmarkCache();
+  auto region = cache.getRegion(name);
+  if (region == nullptr) {
+    auto regionFactory = cache.createRegionFactory(RegionShortcut::LOCAL);
+    if (lruEntriesLimit != 0) {
+      regionFactory.setLruEntriesLimit(lruEntriesLimit);
+    }
+    region = regionFactory.create(name);
+  }
+  return region;
+}
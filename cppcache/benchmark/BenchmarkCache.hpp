@@ -0,0 +1,43 @@
+#pragma once
+
+#ifndef GEODE_BENCHMARKCACHE_H_
+#define GEODE_BENCHMARKCACHE_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include <geode/Cache.hpp>
+#include <geode/Region.hpp>
+
+/**
+ * Returns the cache shared by all benchmarks, created on first use with
+ * logging and statistics sampling disabled so neither shows up in the
+ * measurements.
+ */
+apache::geode::client::Cache& getBenchmarkCache();
+
+/**
+ * Returns the local region <code>name</code> of the benchmark cache, creating
+ * it on first use. A non-zero <code>lruEntriesLimit</code> creates the region
+ * with an LRU entries map.
+ */
+std::shared_ptr<apache::geode::client::Region> getBenchmarkRegion(
+    const char* name, uint32_t lruEntriesLimit = 0);
+
+#endif  // GEODE_BENCHMARKCACHE_H_
@@ -0,0 +1,193 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <geode/CacheableString.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+
+#include "BenchmarkCache.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+// Number of values written or read per iteration, large enough that the
+// per-iteration overhead of the harness does not dominate.
+const int32_t VALUES_PER_ITERATION = 1024;
+
+std::string makeString(int64_t length) {
+  std::string value;
+  for (int64_t i = 0; i < length; i++) {
+    value += static_cast<char>('a' + i % 26);
+  }
+  return value;
+}
+
+template <typename T>
+void DataOutput_WriteInt(benchmark::State& state) {
+  auto output = getBenchmarkCache().createDataOutput();
+  while (state.KeepRunning()) {
+    output->reset();
+    for (int32_t i = 0; i < VALUES_PER_ITERATION; i++) {
+      output->writeInt(static_cast<T>(i));
+    }
+    benchmark::DoNotOptimize(output->getBuffer());
+  }
+  state.SetItemsProcessed(state.iterations() * VALUES_PER_ITERATION);
+  state.SetBytesProcessed(state.iterations() * VALUES_PER_ITERATION *
+                          sizeof(T));
+}
+BENCHMARK_TEMPLATE(DataOutput_WriteInt, int32_t);
+BENCHMARK_TEMPLATE(DataOutput_WriteInt, int64_t);
+
+void DataOutput_WriteDouble(benchmark::State& state) {
+  auto output = getBenchmarkCache().createDataOutput();
+  while (state.KeepRunning()) {
+    output->reset();
+    for (int32_t i = 0; i < VALUES_PER_ITERATION; i++) {
+      output->writeDouble(i * 1.5);
+    }
+    benchmark::DoNotOptimize(output->getBuffer());
+  }
+  state.SetItemsProcessed(state.iterations() * VALUES_PER_ITERATION);
+}
+BENCHMARK(DataOutput_WriteDouble);
+
+void DataOutput_WriteUTF(benchmark::State& state) {
+  auto output = getBenchmarkCache().createDataOutput();
+  auto value = makeString(state.range(0));
+  while (state.KeepRunning()) {
+    output->reset();
+    output->writeUTF(value.c_str(), static_cast<uint32_t>(value.length()));
+    benchmark::DoNotOptimize(output->getBuffer());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DataOutput_WriteUTF)->Range(16, 16 << 10);
+
+void DataOutput_WriteASCII(benchmark::State& state) {
+  auto output = getBenchmarkCache().createDataOutput();
+  auto value = makeString(state.range(0));
+  while (state.KeepRunning()) {
+    output->reset();
+    output->writeASCII(value.c_str(), static_cast<uint32_t>(value.length()));
+    benchmark::DoNotOptimize(output->getBuffer());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DataOutput_WriteASCII)->Range(16, 16 << 10);
+
+void DataOutput_WriteCacheableString(benchmark::State& state) {
+  auto output = getBenchmarkCache().createDataOutput();
+  auto value = CacheableString::create(makeString(state.range(0)).c_str());
+  while (state.KeepRunning()) {
+    output->reset();
+    output->writeObject(value);
+    benchmark::DoNotOptimize(output->getBuffer());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DataOutput_WriteCacheableString)->Range(16, 16 << 10);
+
+template <typename T>
+std::vector<uint8_t> serialize(const T& write) {
+  auto output = getBenchmarkCache().createDataOutput();
+  write(*output);
+  uint32_t length = 0;
+  auto buffer = output->getBuffer(&length);
+  return std::vector<uint8_t>(buffer, buffer + length);
+}
+
+void DataInput_ReadInt32(benchmark::State& state) {
+  auto bytes = serialize([](DataOutput& output) {
+    for (int32_t i = 0; i < VALUES_PER_ITERATION; i++) {
+      output.writeInt(i);
+    }
+  });
+  auto input = getBenchmarkCache().createDataInput(
+      bytes.data(), static_cast<int32_t>(bytes.size()));
+  while (state.KeepRunning()) {
+    input->reset();
+    for (int32_t i = 0; i < VALUES_PER_ITERATION; i++) {
+      benchmark::DoNotOptimize(input->readInt32());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * VALUES_PER_ITERATION);
+  state.SetBytesProcessed(state.iterations() * VALUES_PER_ITERATION *
+                          sizeof(int32_t));
+}
+BENCHMARK(DataInput_ReadInt32);
+
+void DataInput_ReadInt64(benchmark::State& state) {
+  auto bytes = serialize([](DataOutput& output) {
+    for (int32_t i = 0; i < VALUES_PER_ITERATION; i++) {
+      output.writeInt(static_cast<int64_t>(i));
+    }
+  });
+  auto input = getBenchmarkCache().createDataInput(
+      bytes.data(), static_cast<int32_t>(bytes.size()));
+  while (state.KeepRunning()) {
+    input->reset();
+    for (int32_t i = 0; i < VALUES_PER_ITERATION; i++) {
+      benchmark::DoNotOptimize(input->readInt64());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * VALUES_PER_ITERATION);
+  state.SetBytesProcessed(state.iterations() * VALUES_PER_ITERATION *
+                          sizeof(int64_t));
+}
+BENCHMARK(DataInput_ReadInt64);
+
+void DataInput_ReadUTF(benchmark::State& state) {
+  auto value = makeString(state.range(0));
+  auto bytes = serialize([&value](DataOutput& output) {
+    output.writeUTF(value.c_str(), static_cast<uint32_t>(value.length()));
+  });
+  auto input = getBenchmarkCache().createDataInput(
+      bytes.data(), static_cast<int32_t>(bytes.size()));
+  while (state.KeepRunning()) {
+    input->reset();
+    char* result = nullptr;
+    input->readUTF(&result);
+    benchmark::DoNotOptimize(result);
+    DataInput::freeUTFMemory(result);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DataInput_ReadUTF)->Range(16, 16 << 10);
+
+void DataInput_ReadCacheableString(benchmark::State& state) {
+  auto value = CacheableString::create(makeString(state.range(0)).c_str());
+  auto bytes =
+      serialize([&value](DataOutput& output) { output.writeObject(value); });
+  auto input = getBenchmarkCache().createDataInput(
+      bytes.data(), static_cast<int32_t>(bytes.size()));
+  while (state.KeepRunning()) {
+    input->reset();
+    auto result = input->readObject<CacheableString>();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(DataInput_ReadCacheableString)->Range(16, 16 << 10);
+
+}  // namespace
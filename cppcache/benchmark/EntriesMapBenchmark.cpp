@@ -0,0 +1,226 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "BenchmarkCache.hpp"
+#include "ConcurrentEntriesMap.hpp"
+#include "EntriesMap.hpp"
+#include "EntriesMapFactory.hpp"
+#include "RegionInternal.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+// Larger than any of the benchmarked key counts so nothing is evicted; the
+// LRU benchmarks measure the bookkeeping on the put and get paths.
+const uint32_t LRU_ENTRIES_LIMIT = 1 << 20;
+
+/**
+ * An entries map created by EntriesMapFactory for a local region of the
+ * benchmark cache, with <code>size</code> keys to put and get.
+ */
+class BenchmarkEntriesMap {
+ public:
+  BenchmarkEntriesMap(const char* regionName, uint32_t lruEntriesLimit,
+                      int64_t size)
+      : BenchmarkEntriesMap(getBenchmarkRegion(regionName, lruEntriesLimit),
+                            size) {}
+
+  BenchmarkEntriesMap(const std::shared_ptr<Region>& region, int64_t size) {
+    m_map.reset(EntriesMapFactory::createMap(
+        dynamic_cast<RegionInternal*>(region.get()), region->getAttributes()));
+    for (int64_t i = 0; i < size; i++) {
+      m_keys.push_back(CacheableInt32::create(static_cast<int32_t>(i)));
+      m_values.push_back(CacheableString::create("value"));
+    }
+  }
+
+  ~BenchmarkEntriesMap() { m_map->close(); }
+
+  void put(size_t index) {
+    std::shared_ptr<MapEntryImpl> entry;
+    std::shared_ptr<Cacheable> oldValue;
+    m_map->put(m_keys[index], m_values[index], entry, oldValue, -1, 0,
+               nullptr);
+  }
+
+  void putAll() {
+    for (size_t i = 0; i < m_keys.size(); i++) {
+      put(i);
+    }
+  }
+
+  bool get(size_t index) {
+    std::shared_ptr<MapEntryImpl> entry;
+    std::shared_ptr<Cacheable> value;
+    return m_map->get(m_keys[index], value, entry);
+  }
+
+  size_t size() const { return m_keys.size(); }
+
+  size_t getReservedBytes() const {
+    return dynamic_cast<ConcurrentEntriesMap*>(m_map.get())
+        ->getReservedBytes();
+  }
+
+ private:
+  std::unique_ptr<EntriesMap> m_map;
+  std::vector<std::shared_ptr<CacheableKey>> m_keys;
+  std::vector<std::shared_ptr<Cacheable>> m_values;
+};
+
+void putEntries(benchmark::State& state, const char* regionName,
+                uint32_t lruEntriesLimit) {
+  BenchmarkEntriesMap map(regionName, lruEntriesLimit, state.range(0));
+  size_t index = 0;
+  while (state.KeepRunning()) {
+    map.put(index);
+    if (++index == map.size()) {
+      index = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void getEntries(benchmark::State& state, const char* regionName,
+                uint32_t lruEntriesLimit) {
+  // All threads share one map, set up by the first thread before the
+  // measurement starts and torn down after it ends.
+  static std::unique_ptr<BenchmarkEntriesMap> map;
+  if (state.thread_index == 0) {
+    map.reset(
+        new BenchmarkEntriesMap(regionName, lruEntriesLimit, state.range(0)));
+    map->putAll();
+  }
+  size_t index = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(map->get(index));
+    if (++index == map->size()) {
+      index = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index == 0) {
+    map.reset();
+  }
+}
+
+void ConcurrentEntriesMap_Put(benchmark::State& state) {
+  putEntries(state, "ConcurrentEntriesMapBenchmark", 0);
+}
+BENCHMARK(ConcurrentEntriesMap_Put)->Range(1 << 10, 1 << 16);
+
+void ConcurrentEntriesMap_Get(benchmark::State& state) {
+  getEntries(state, "ConcurrentEntriesMapBenchmark", 0);
+}
+BENCHMARK(ConcurrentEntriesMap_Get)->Range(1 << 10, 1 << 16)->ThreadRange(1, 8);
+
+void LRUEntriesMap_Put(benchmark::State& state) {
+  putEntries(state, "LRUEntriesMapBenchmark", LRU_ENTRIES_LIMIT);
+}
+BENCHMARK(LRUEntriesMap_Put)->Range(1 << 10, 1 << 16);
+
+void LRUEntriesMap_Get(benchmark::State& state) {
+  getEntries(state, "LRUEntriesMapBenchmark", LRU_ENTRIES_LIMIT);
+}
+BENCHMARK(LRUEntriesMap_Get)->Range(1 << 10, 1 << 16)->ThreadRange(1, 8);
+
+/**
+ * Returns a local region whose entries map uses one of the entry layouts.
+ * The idle timeout is long enough that nothing expires while measuring.
+ */
+std::shared_ptr<Region> getLayoutRegion(const char* name,
+                                        bool concurrencyChecksEnabled,
+                                        uint32_t lruEntriesLimit,
+                                        bool expiring) {
+  auto& cache = getBenchmarkCache();
+  auto region = cache.getRegion(name);
+  if (region == nullptr) {
+    auto regionFactory = cache.createRegionFactory(RegionShortcut::LOCAL);
+    regionFactory.setConcurrencyChecksEnabled(concurrencyChecksEnabled);
+    if (lruEntriesLimit != 0) {
+      regionFactory.setLruEntriesLimit(lruEntriesLimit);
+    }
+    if (expiring) {
+      regionFactory.setEntryIdleTimeout(ExpirationAction::LOCAL_INVALIDATE,
+                                        std::chrono::hours(1));
+    }
+    region = regionFactory.create(name);
+  }
+  return region;
+}
+
+// Reports the bytes an entry takes in the arenas of its map: the entry with
+// its reference count, and the node of the hash map, plus a share of the
+// unused end of the last slab of each segment. Keys and values belong to
+// the application and are not counted.
+void memoryPerEntry(benchmark::State& state,
+                    const std::shared_ptr<Region>& region) {
+  size_t reservedBytes = 0;
+  while (state.KeepRunning()) {
+    BenchmarkEntriesMap map(region, state.range(0));
+    map.putAll();
+    reservedBytes = map.getReservedBytes();
+  }
+  state.counters["bytes_per_entry"] =
+      static_cast<double>(reservedBytes) / state.range(0);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void EntriesMap_MemoryPerEntry_Plain(benchmark::State& state) {
+  memoryPerEntry(state, getLayoutRegion("PlainEntriesBenchmark", false, 0,
+                                        false));
+}
+BENCHMARK(EntriesMap_MemoryPerEntry_Plain)->Arg(1 << 19);
+
+void EntriesMap_MemoryPerEntry_Versioned(benchmark::State& state) {
+  memoryPerEntry(state, getLayoutRegion("VersionedEntriesBenchmark", true, 0,
+                                        false));
+}
+BENCHMARK(EntriesMap_MemoryPerEntry_Versioned)->Arg(1 << 19);
+
+void EntriesMap_MemoryPerEntry_Expiring(benchmark::State& state) {
+  memoryPerEntry(state, getLayoutRegion("ExpiringEntriesBenchmark", true, 0,
+                                        true));
+}
+BENCHMARK(EntriesMap_MemoryPerEntry_Expiring)->Arg(1 << 19);
+
+void EntriesMap_MemoryPerEntry_LRU(benchmark::State& state) {
+  memoryPerEntry(state, getLayoutRegion("LRUEntriesBenchmark", true,
+                                        LRU_ENTRIES_LIMIT, false));
+}
+BENCHMARK(EntriesMap_MemoryPerEntry_LRU)->Arg(1 << 19);
+
+void EntriesMap_MemoryPerEntry_LRUExpiring(benchmark::State& state) {
+  memoryPerEntry(state, getLayoutRegion("LRUExpiringEntriesBenchmark", true,
+                                        LRU_ENTRIES_LIMIT, true));
+}
+BENCHMARK(EntriesMap_MemoryPerEntry_LRUExpiring)->Arg(1 << 19);
+
+}  // namespace
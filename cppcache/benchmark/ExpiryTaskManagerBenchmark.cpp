@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <vector>
+
+#include <ace/Event_Handler.h>
+
+#include <benchmark/benchmark.h>
+
+#include "ExpiryTaskManager.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+/**
+ * An expiry task that never fires during a benchmark.
+ */
+class NoopExpiryHandler : public ACE_Event_Handler {
+ public:
+  int handle_timeout(const ACE_Time_Value&, const void*) override {
+    return 0;
+  }
+};
+
+const std::chrono::hours EXPIRY(1);
+
+/**
+ * Schedules <code>count</code> tasks so the benchmarked operations work on a
+ * timer queue of the size a region with that many expiring entries has.
+ */
+std::vector<ExpiryTaskManager::id_type> schedulePending(
+    ExpiryTaskManager& manager, ACE_Event_Handler* handler, int64_t count) {
+  std::vector<ExpiryTaskManager::id_type> ids;
+  for (int64_t i = 0; i < count; i++) {
+    ids.push_back(manager.scheduleExpiryTask(handler,
+                                             EXPIRY + std::chrono::seconds(i),
+                                             std::chrono::seconds::zero()));
+  }
+  return ids;
+}
+
+void cancelAll(ExpiryTaskManager& manager,
+               const std::vector<ExpiryTaskManager::id_type>& ids) {
+  for (auto id : ids) {
+    manager.cancelTask(id);
+  }
+}
+
+void ExpiryTaskManager_ScheduleAndCancel(benchmark::State& state) {
+  NoopExpiryHandler handler;
+  ExpiryTaskManager manager;
+  manager.begin();
+  auto pending = schedulePending(manager, &handler, state.range(0));
+  while (state.KeepRunning()) {
+    auto id = manager.scheduleExpiryTask(&handler, EXPIRY,
+                                         std::chrono::seconds::zero());
+    manager.cancelTask(id);
+  }
+  state.SetItemsProcessed(state.iterations());
+  cancelAll(manager, pending);
+}
+BENCHMARK(ExpiryTaskManager_ScheduleAndCancel)
+    ->Arg(0)
+    ->Range(1 << 10, 1 << 16);
+
+void ExpiryTaskManager_Reset(benchmark::State& state) {
+  NoopExpiryHandler handler;
+  ExpiryTaskManager manager;
+  manager.begin();
+  auto pending = schedulePending(manager, &handler, state.range(0));
+  size_t index = 0;
+  while (state.KeepRunning()) {
+    manager.resetTask(pending[index], EXPIRY);
+    if (++index == pending.size()) {
+      index = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  cancelAll(manager, pending);
+}
+BENCHMARK(ExpiryTaskManager_Reset)->Range(1 << 10, 1 << 16);
+
+}  // namespace
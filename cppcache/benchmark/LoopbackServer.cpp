@@ -0,0 +1,353 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+
+#include <ace/INET_Addr.h>
+#include <ace/OS_NS_sys_socket.h>
+#include <ace/os_include/netinet/os_tcp.h>
+
+#include <geode/CacheableString.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "GeodeTypeIdsImpl.hpp"
+#include "LoopbackServer.hpp"
+#include "TcrConnection.hpp"
+#include "TcrMessage.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+const int32_t HEADER_LENGTH = 17;
+
+// ClientProxyMembershipID::LONER_DM_TYPE
+const int8_t LONER_DM_TYPE = 13;
+
+// flags of a VersionedObjectPartList
+const int8_t HAS_OBJECTS = 0x02;
+const int8_t HAS_VERSION_TAGS = 0x04;
+
+bool receive(ACE_SOCK_Stream& stream, void* buffer, size_t length) {
+  return stream.recv_n(buffer, length) == static_cast<ssize_t>(length);
+}
+
+bool send(ACE_SOCK_Stream& stream, const DataOutput& output) {
+  uint32_t length = 0;
+  auto buffer = output.getBuffer(&length);
+  return stream.send_n(buffer, length) == static_cast<ssize_t>(length);
+}
+
+/**
+ * Reads the length header written by DataOutput::writeArrayLen.
+ */
+bool receiveArrayLength(Cache& cache, ACE_SOCK_Stream& stream,
+                        int32_t& length) {
+  int8_t code = 0;
+  if (!receive(stream, &code, 1)) {
+    return false;
+  }
+  if (code == -2 || code == -3) {
+    uint8_t bytes[4];
+    const auto size = code == -2 ? 2 : 4;
+    if (!receive(stream, bytes, size)) {
+      return false;
+    }
+    auto input = cache.createDataInput(bytes, size);
+    length = code == -2 ? static_cast<uint16_t>(input->readInt16())
+                        : input->readInt32();
+  } else {
+    length = static_cast<uint8_t>(code);
+  }
+  return true;
+}
+
+void writeUnsignedVL(DataOutput& output, int64_t value) {
+  while ((value & ~0x7F) != 0) {
+    output.write(static_cast<uint8_t>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  output.write(static_cast<uint8_t>(value));
+}
+
+void writeBytesPart(DataOutput& output, const std::vector<uint8_t>& bytes,
+                    bool isObject) {
+  output.writeInt(static_cast<int32_t>(bytes.size()));
+  output.write(static_cast<int8_t>(isObject ? 1 : 0));
+  output.writeBytesOnly(bytes.data(), static_cast<uint32_t>(bytes.size()));
+}
+
+void writeIntPart(DataOutput& output, int32_t value) {
+  output.writeInt(static_cast<int32_t>(4));
+  output.write(static_cast<int8_t>(0));
+  output.writeInt(value);
+}
+
+/**
+ * Writes the part a server sends first in most replies: the single-hop
+ * metadata version, which never changes here.
+ */
+void writeOkPart(DataOutput& output) {
+  writeBytesPart(output, std::vector<uint8_t>(1, 0), false);
+}
+
+void writeHeader(DataOutput& output, int32_t msgType, int32_t txId,
+                 int32_t numParts, const DataOutput& parts) {
+  output.writeInt(msgType);
+  output.writeInt(static_cast<int32_t>(parts.getBufferLength()));
+  output.writeInt(numParts);
+  output.writeInt(txId);
+  output.write(static_cast<int8_t>(0));
+  output.writeBytesOnly(parts.getBuffer(), parts.getBufferLength());
+}
+
+/**
+ * Writes a reply sent as a single, last chunk.
+ */
+void writeChunkedHeader(DataOutput& output, int32_t msgType, int32_t txId,
+                        int32_t numParts, const DataOutput& parts) {
+  output.writeInt(msgType);
+  output.writeInt(numParts);
+  output.writeInt(txId);
+  output.writeInt(static_cast<int32_t>(parts.getBufferLength()));
+  output.write(static_cast<int8_t>(1));  // last chunk
+  output.writeBytesOnly(parts.getBuffer(), parts.getBufferLength());
+}
+
+/**
+ * Returns the number of keys of a GET_ALL_70 request: the second part is an
+ * object array of the keys.
+ */
+int32_t readGetAllKeyCount(Cache& cache, const std::vector<uint8_t>& request) {
+  auto input = cache.createDataInput(request.data(),
+                                     static_cast<int32_t>(request.size()));
+  const auto regionLength = input->readInt32();
+  input->advanceCursor(1 + regionLength);
+  input->readInt32();  // part length
+  input->read();       // is object
+  input->read();       // CacheableObjectArray
+  return input->readArrayLen();
+}
+
+}  // namespace
+
+LoopbackServer::LoopbackServer(Cache& cache,
+                               const std::shared_ptr<Cacheable>& value)
+    : m_cache(cache), m_running(true) {
+  auto valueOutput = cache.createDataOutput();
+  valueOutput->writeObject(value);
+  m_value.assign(valueOutput->getBuffer(),
+                 valueOutput->getBuffer() + valueOutput->getBufferLength());
+
+  auto handshakeReply = createHandshakeReply();
+  m_handshakeReply.assign(
+      handshakeReply->getBuffer(),
+      handshakeReply->getBuffer() + handshakeReply->getBufferLength());
+
+  ACE_INET_Addr address(static_cast<u_short>(0), "127.0.0.1");
+  if (m_acceptor.open(address, 1) == -1) {
+    throw IllegalStateException(
+        "LoopbackServer: could not listen on the loopback interface");
+  }
+  ACE_INET_Addr localAddress;
+  m_acceptor.get_local_addr(localAddress);
+  m_port = localAddress.get_port_number();
+
+  m_acceptThread = std::thread(&LoopbackServer::acceptConnections, this);
+}
+
+LoopbackServer::~LoopbackServer() {
+  m_running = false;
+  m_acceptThread.join();
+  m_acceptor.close();
+  // unblock the connection threads still waiting for a request
+  for (auto& stream : m_streams) {
+    ACE_OS::shutdown(stream->get_handle(), ACE_SHUTDOWN_BOTH);
+  }
+  for (auto& thread : m_connectionThreads) {
+    thread.join();
+  }
+  for (auto& stream : m_streams) {
+    stream->close();
+  }
+}
+
+void LoopbackServer::acceptConnections() {
+  // poll so the destructor does not have to wake up a blocked accept
+  const ACE_Time_Value timeout(0, 100 * 1000);
+  while (m_running) {
+    std::unique_ptr<ACE_SOCK_Stream> stream(new ACE_SOCK_Stream());
+    if (m_acceptor.accept(*stream, nullptr, &timeout) == -1) {
+      continue;
+    }
+    int noDelay = 1;
+    stream->set_option(ACE_IPPROTO_TCP, TCP_NODELAY, &noDelay,
+                       sizeof(noDelay));
+    m_connectionThreads.emplace_back(&LoopbackServer::serveConnection, this,
+                                     std::ref(*stream));
+    m_streams.push_back(std::move(stream));
+  }
+}
+
+void LoopbackServer::serveConnection(ACE_SOCK_Stream& stream) {
+  if (!handshake(stream)) {
+    return;
+  }
+  uint8_t header[HEADER_LENGTH];
+  std::vector<uint8_t> request;
+  while (receive(stream, header, HEADER_LENGTH)) {
+    auto input = m_cache.createDataInput(header, HEADER_LENGTH);
+    const auto msgType = input->readInt32();
+    const auto msgLength = input->readInt32();
+    input->readInt32();  // number of parts
+    const auto txId = input->readInt32();
+    request.resize(msgLength);
+    if (msgLength > 0 && !receive(stream, request.data(), msgLength)) {
+      return;
+    }
+    if (msgType == TcrMessage::CLOSE_CONNECTION) {
+      return;
+    }
+    if (!send(stream, *createReply(msgType, txId, request))) {
+      return;
+    }
+  }
+}
+
+bool LoopbackServer::handshake(ACE_SOCK_Stream& stream) {
+  // connection kind, version ordinal, REPLY_OK, read timeout and the
+  // DSFID header of the client's membership id
+  uint8_t header[9];
+  if (!receive(stream, header, sizeof(header)) ||
+      header[0] != CLIENT_TO_SERVER) {
+    return false;
+  }
+  int32_t memberIdLength = 0;
+  if (!receiveArrayLength(m_cache, stream, memberIdLength)) {
+    return false;
+  }
+  std::vector<uint8_t> memberId(memberIdLength);
+  // followed by the int 1, overrides and the security mode
+  uint8_t trailer[6];
+  if ((memberIdLength > 0 &&
+       !receive(stream, memberId.data(), memberIdLength)) ||
+      !receive(stream, trailer, sizeof(trailer)) ||
+      trailer[5] != SECURITY_CREDENTIALS_NONE) {
+    return false;
+  }
+  return stream.send_n(m_handshakeReply.data(), m_handshakeReply.size()) ==
+         static_cast<ssize_t>(m_handshakeReply.size());
+}
+
+std::unique_ptr<DataOutput> LoopbackServer::createHandshakeReply() {
+  // The server's own member id, in the form ClientProxyMembershipID::fromData
+  // reads it.
+  auto member = m_cache.createDataOutput();
+  member->write(static_cast<int8_t>(GeodeTypeIdsImpl::FixedIDByte));
+  member->write(
+      static_cast<int8_t>(GeodeTypeIdsImpl::InternalDistributedMember));
+  member->writeArrayLen(4);
+  member->write(static_cast<uint8_t>(127));
+  member->write(static_cast<uint8_t>(0));
+  member->write(static_cast<uint8_t>(0));
+  member->write(static_cast<uint8_t>(1));
+  member->writeInt(static_cast<int32_t>(0));  // port
+  member->writeObject(CacheableString::create("localhost"));
+  member->write(static_cast<int8_t>(0));      // flags, no version
+  member->writeInt(static_cast<int32_t>(0));  // direct channel port
+  member->writeInt(static_cast<int32_t>(0));  // process id
+  member->write(LONER_DM_TYPE);
+  member->writeArrayLen(0);  // roles
+  member->writeObject(CacheableString::create("loopback"));  // name
+  member->writeObject(CacheableString::create("loopback"));  // unique tag
+  member->writeObject(CacheableString::create(""));  // durable client id
+  member->writeInt(static_cast<int32_t>(0));         // durable timeout
+  for (int i = 0; i < 17; i++) {
+    member->write(static_cast<int8_t>(0));  // UUID and weight
+  }
+
+  auto reply = m_cache.createDataOutput();
+  reply->write(static_cast<int8_t>(REPLY_OK));
+  reply->write(static_cast<int8_t>(0));       // no subscription queue
+  reply->writeInt(static_cast<int32_t>(0));  // queue size
+  reply->writeBytes(member->getBuffer(),
+                    static_cast<int32_t>(member->getBufferLength()));
+  reply->writeInt(static_cast<int16_t>(0));  // no message
+  reply->writeBoolean(false);                // delta propagation
+  return reply;
+}
+
+std::unique_ptr<DataOutput> LoopbackServer::createReply(
+    int32_t msgType, int32_t txId, const std::vector<uint8_t>& request) {
+  auto parts = m_cache.createDataOutput();
+  auto reply = m_cache.createDataOutput();
+  switch (msgType) {
+    case TcrMessage::REQUEST: {
+      writeBytesPart(*parts, m_value, true);
+      writeIntPart(*parts, 0);  // no callback argument or version tag
+      writeHeader(*reply, TcrMessage::RESPONSE, txId, 2, *parts);
+      break;
+    }
+    case TcrMessage::PUT: {
+      writeOkPart(*parts);
+      writeIntPart(*parts, 0);  // no old value or version tag
+      writeHeader(*reply, TcrMessage::REPLY, txId, 2, *parts);
+      break;
+    }
+    case TcrMessage::GET_ALL_70:
+    case TcrMessage::GET_ALL_WITH_CALLBACK: {
+      const auto count = readGetAllKeyCount(m_cache, request);
+      // a VersionedObjectPartList with the value of every requested key in
+      // request order and no version tags
+      auto list = m_cache.createDataOutput();
+      list->write(static_cast<int8_t>(GeodeTypeIdsImpl::FixedIDByte));
+      list->write(
+          static_cast<int8_t>(GeodeTypeIdsImpl::VersionedObjectPartList));
+      list->write(static_cast<int8_t>(HAS_OBJECTS | HAS_VERSION_TAGS));
+      writeUnsignedVL(*list, count);
+      for (int32_t i = 0; i < count; i++) {
+        list->write(static_cast<int8_t>(0));  // a value, not an exception
+        list->writeBytesOnly(m_value.data(),
+                             static_cast<uint32_t>(m_value.size()));
+      }
+      writeUnsignedVL(*list, count);
+      for (int32_t i = 0; i < count; i++) {
+        list->write(static_cast<int8_t>(0));  // no version tag
+      }
+      parts->writeInt(static_cast<int32_t>(list->getBufferLength()));
+      parts->write(static_cast<int8_t>(1));
+      parts->writeBytesOnly(list->getBuffer(), list->getBufferLength());
+      writeChunkedHeader(*reply, TcrMessage::RESPONSE, txId, 1, *parts);
+      break;
+    }
+    case TcrMessage::PUTALL:
+    case TcrMessage::PUT_ALL_WITH_CALLBACK: {
+      // an empty part: the server has no version tags to return
+      parts->writeInt(static_cast<int32_t>(0));
+      parts->write(static_cast<int8_t>(0));
+      writeChunkedHeader(*reply, TcrMessage::RESPONSE, txId, 1, *parts);
+      break;
+    }
+    default: {
+      writeOkPart(*parts);
+      writeHeader(*reply, TcrMessage::REPLY, txId, 1, *parts);
+      break;
+    }
+  }
+  return reply;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#ifndef GEODE_LOOPBACKSERVER_H_
+#define GEODE_LOOPBACKSERVER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <ace/SOCK_Acceptor.h>
+#include <ace/SOCK_Stream.h>
+
+#include <geode/Cache.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/Serializable.hpp>
+
+/**
+ * A stand-in for a cache server listening on the loopback interface, so the
+ * client side of a request -- pool, connection, message encoding and reply
+ * decoding -- can be benchmarked without a JVM in the way.
+ *
+ * The server accepts unsecured client connections and answers gets and
+ * getAlls with a canned value and acknowledges puts and putAlls without
+ * storing anything. Pings and any other request get an empty reply. Each
+ * connection is served by its own thread.
+ */
+class LoopbackServer {
+ public:
+  /**
+   * Starts a server on an ephemeral port that returns <code>value</code> for
+   * every key. <code>cache</code> is only used to serialize messages.
+   */
+  LoopbackServer(apache::geode::client::Cache& cache,
+                 const std::shared_ptr<apache::geode::client::Cacheable>& value);
+
+  /**
+   * Stops accepting connections, closes the open ones and waits for all the
+   * server threads to end.
+   */
+  ~LoopbackServer();
+
+  LoopbackServer(const LoopbackServer&) = delete;
+  LoopbackServer& operator=(const LoopbackServer&) = delete;
+
+  /** Returns the port the server listens on. */
+  uint16_t getPort() const { return m_port; }
+
+ private:
+  void acceptConnections();
+  void serveConnection(ACE_SOCK_Stream& stream);
+  bool handshake(ACE_SOCK_Stream& stream);
+  std::unique_ptr<apache::geode::client::DataOutput> createReply(
+      int32_t msgType, int32_t txId, const std::vector<uint8_t>& request);
+  std::unique_ptr<apache::geode::client::DataOutput> createHandshakeReply();
+
+  apache::geode::client::Cache& m_cache;
+  std::vector<uint8_t> m_value;
+  std::vector<uint8_t> m_handshakeReply;
+  ACE_SOCK_Acceptor m_acceptor;
+  uint16_t m_port;
+  std::atomic<bool> m_running;
+  std::thread m_acceptThread;
+  // only touched by the accept thread until it has been joined
+  std::vector<std::unique_ptr<ACE_SOCK_Stream>> m_streams;
+  std::vector<std::thread> m_connectionThreads;
+};
+
+#endif  // GEODE_LOOPBACKSERVER_H_
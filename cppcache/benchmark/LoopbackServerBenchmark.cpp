@@ -0,0 +1,150 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/PoolManager.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "BenchmarkCache.hpp"
+#include "LoopbackServer.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+const char* POOL_NAME = "LoopbackPool";
+const char* REGION_NAME = "LoopbackRegion";
+
+// keys are reused round robin; the server does not store anything anyway
+const int32_t KEY_COUNT = 1024;
+
+std::shared_ptr<CacheableString> makeValue(int64_t length) {
+  return CacheableString::create(std::string(length, 'v').c_str());
+}
+
+/**
+ * A loopback server and a proxy region of the benchmark cache whose pool
+ * connects to it. Single-hop is disabled since the server has no buckets to
+ * describe.
+ */
+class LoopbackClient {
+ public:
+  explicit LoopbackClient(int64_t valueLength)
+      : m_server(getBenchmarkCache(), makeValue(valueLength)) {
+    auto& cache = getBenchmarkCache();
+    cache.getPoolManager()
+        .createFactory()
+        ->addServer("127.0.0.1", m_server.getPort())
+        .setPRSingleHopEnabled(false)
+        .setSubscriptionEnabled(false)
+        .create(POOL_NAME);
+    m_region = cache.createRegionFactory(RegionShortcut::PROXY)
+                   .setPoolName(POOL_NAME)
+                   .create(REGION_NAME);
+    for (int32_t i = 0; i < KEY_COUNT; i++) {
+      m_keys.push_back(CacheableInt32::create(i));
+    }
+  }
+
+  ~LoopbackClient() {
+    m_region->localDestroyRegion();
+    getBenchmarkCache().getPoolManager().find(POOL_NAME)->destroy();
+  }
+
+  Region& getRegion() { return *m_region; }
+
+  const std::shared_ptr<CacheableKey>& getKey(size_t index) const {
+    return m_keys[index % m_keys.size()];
+  }
+
+  std::vector<std::shared_ptr<CacheableKey>> getKeys(int64_t count) const {
+    return std::vector<std::shared_ptr<CacheableKey>>(m_keys.begin(),
+                                                      m_keys.begin() + count);
+  }
+
+ private:
+  LoopbackServer m_server;
+  std::shared_ptr<Region> m_region;
+  std::vector<std::shared_ptr<CacheableKey>> m_keys;
+};
+
+void Loopback_Put(benchmark::State& state) {
+  LoopbackClient client(0);
+  auto value = makeValue(state.range(0));
+  size_t index = 0;
+  while (state.KeepRunning()) {
+    client.getRegion().put(client.getKey(index++), value);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Loopback_Put)->Range(16, 16 << 10)->UseRealTime();
+
+void Loopback_Get(benchmark::State& state) {
+  // All threads share one pool, set up by the first thread before the
+  // measurement starts and torn down after it ends.
+  static std::unique_ptr<LoopbackClient> client;
+  if (state.thread_index == 0) {
+    client.reset(new LoopbackClient(state.range(0)));
+  }
+  size_t index = state.thread_index;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(client->getRegion().get(client->getKey(index++)));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  if (state.thread_index == 0) {
+    client.reset();
+  }
+}
+BENCHMARK(Loopback_Get)
+    ->Range(16, 16 << 10)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+void Loopback_GetAll(benchmark::State& state) {
+  LoopbackClient client(64);
+  auto keys = client.getKeys(state.range(0));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(client.getRegion().getAll(keys));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Loopback_GetAll)->Range(1, KEY_COUNT)->UseRealTime();
+
+void Loopback_PutAll(benchmark::State& state) {
+  LoopbackClient client(0);
+  HashMapOfCacheable map;
+  for (const auto& key : client.getKeys(state.range(0))) {
+    map.emplace(key, makeValue(64));
+  }
+  while (state.KeepRunning()) {
+    client.getRegion().putAll(map);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Loopback_PutAll)->Range(1, KEY_COUNT)->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,114 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <mutex>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/TypeRegistry.hpp>
+
+#include "BenchmarkCache.hpp"
+#include "CacheRegionHelper.hpp"
+#include "CacheImpl.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+#include "PortfolioPdx.hpp"
+
+using namespace apache::geode::client;
+using testobject::PortfolioPdx;
+using testobject::PositionPdx;
+
+namespace {
+
+/**
+ * Registers the PDX type of <code>object</code> with <code>typeId</code>.
+ * Without a server there is nobody to hand out type ids, so the type is
+ * collected and registered locally, the same way PdxHelper does on the first
+ * serialization of a class.
+ */
+void registerPdxType(Cache& cache,
+                     const std::shared_ptr<PdxSerializable>& object,
+                     int32_t typeId) {
+  auto pdxTypeRegistry =
+      CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+  auto output = cache.createDataOutput();
+  auto writer = std::make_shared<PdxWriterWithTypeCollector>(
+      *output, object->getClassName(), pdxTypeRegistry);
+  object->toData(writer);
+  auto pdxType = writer->getPdxLocalType();
+  pdxType->InitializeType();
+  pdxType->setTypeId(typeId);
+  writer->endObjectWriting();
+  pdxTypeRegistry->addLocalPdxType(object->getClassName(), pdxType);
+  pdxTypeRegistry->addPdxType(typeId, pdxType);
+}
+
+Cache& getPdxCache() {
+  static std::once_flag registered;
+  auto& cache = getBenchmarkCache();
+  std::call_once(registered, [&cache] {
+    cache.getTypeRegistry().registerPdxType(PositionPdx::createDeserializable);
+    cache.getTypeRegistry().registerPdxType(
+        PortfolioPdx::createDeserializable);
+    // positions are nested in portfolios, so their type has to be known first
+    registerPdxType(cache, std::make_shared<PositionPdx>("SUN", 1000), 1);
+    registerPdxType(cache, std::make_shared<PortfolioPdx>(1), 2);
+  });
+  return cache;
+}
+
+void PDX_SerializePortfolio(benchmark::State& state) {
+  auto& cache = getPdxCache();
+  auto portfolio =
+      std::make_shared<PortfolioPdx>(1, static_cast<int32_t>(state.range(0)));
+  auto output = cache.createDataOutput();
+  while (state.KeepRunning()) {
+    output->reset();
+    output->writeObject(portfolio);
+    benchmark::DoNotOptimize(output->getBuffer());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * output->getBufferLength());
+}
+BENCHMARK(PDX_SerializePortfolio)->Arg(0)->Arg(1024);
+
+void PDX_DeserializePortfolio(benchmark::State& state) {
+  auto& cache = getPdxCache();
+  auto portfolio =
+      std::make_shared<PortfolioPdx>(1, static_cast<int32_t>(state.range(0)));
+  auto output = cache.createDataOutput();
+  output->writeObject(portfolio);
+  uint32_t length = 0;
+  auto buffer = output->getBuffer(&length);
+  std::vector<uint8_t> bytes(buffer, buffer + length);
+
+  auto input =
+      cache.createDataInput(bytes.data(), static_cast<int32_t>(bytes.size()));
+  while (state.KeepRunning()) {
+    input->reset();
+    auto result = input->readObject<PortfolioPdx>();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(PDX_DeserializePortfolio)->Arg(0)->Arg(1024);
+
+}  // namespace
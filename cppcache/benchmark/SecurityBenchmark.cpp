@@ -0,0 +1,125 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Properties.hpp>
+
+#include "BenchmarkCache.hpp"
+#include "CacheImpl.hpp"
+#include "DiffieHellman.hpp"
+#include "TcrMessage.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+/**
+ * Two ends of a Diffie-Hellman exchange done in process, so that one holds
+ * the shared key a secured connection would.
+ */
+struct SecuredPeers {
+  DiffieHellman client;
+  DiffieHellman server;
+
+  SecuredPeers() {
+    auto props = Properties::create();
+    props->insert(SecurityClientDhAlgo, "AES:128");
+    client.initDhKeys(props);
+    server.initDhKeys(props);
+    client.setPublicKeyOther(server.getPublicKey());
+    server.setPublicKeyOther(client.getPublicKey());
+    client.computeSharedSecret();
+    server.computeSharedSecret();
+  }
+
+  ~SecuredPeers() {
+    client.clearDhKeys();
+    server.clearDhKeys();
+  }
+};
+
+/**
+ * Encodes a put, and with an argument of 1 also encrypts the connection and
+ * unique ids every message of a secured connection carries, to show what
+ * security adds per message.
+ */
+void Security_EncodePut(benchmark::State& state) {
+  std::unique_ptr<SecuredPeers> peers;
+  if (state.range(0) != 0) {
+    try {
+      DiffieHellman::initOpenSSLFuncPtrs();
+      peers.reset(new SecuredPeers());
+    } catch (const Exception& ex) {
+      state.SkipWithError(ex.what());
+      return;
+    }
+  }
+
+  auto& cache = getBenchmarkCache();
+  auto key = CacheableString::create("key");
+  auto value = CacheableString::create(std::string(64, 'v').c_str());
+  uint8_t cleartext[16] = {};
+  uint8_t ciphertext[64];
+  while (state.KeepRunning()) {
+    TcrMessagePut message(cache.createDataOutput(), nullptr, key, value,
+                          nullptr, false, nullptr, false, false, "region");
+    benchmark::DoNotOptimize(message.getMsgData());
+    if (peers) {
+      benchmark::DoNotOptimize(peers->client.encrypt(
+          cleartext, sizeof(cleartext), ciphertext, sizeof(ciphertext)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Security_EncodePut)->Arg(0)->Arg(1);
+
+/**
+ * Decrypts a security part the way a secured connection reads the ids back
+ * from the server's replies.
+ */
+void Security_DecryptId(benchmark::State& state) {
+  std::unique_ptr<SecuredPeers> peers;
+  try {
+    DiffieHellman::initOpenSSLFuncPtrs();
+    peers.reset(new SecuredPeers());
+  } catch (const Exception& ex) {
+    state.SkipWithError(ex.what());
+    return;
+  }
+
+  uint8_t cleartext[16] = {};
+  uint8_t ciphertext[64];
+  auto cipherLen = peers->server.encrypt(cleartext, sizeof(cleartext),
+                                         ciphertext, sizeof(ciphertext));
+  uint8_t decrypted[64];
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(peers->client.decrypt(
+        ciphertext, cipherLen, decrypted, sizeof(decrypted)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Security_DecryptId);
+
+}  // namespace
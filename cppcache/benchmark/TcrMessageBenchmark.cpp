@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+
+#include "BenchmarkCache.hpp"
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "TcrMessage.hpp"
+#include "ThinClientBaseDM.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+/**
+ * A distribution manager that never sends anything. Replies need one to
+ * reach the cache while decoding.
+ */
+class BenchmarkDM : public ThinClientBaseDM {
+ public:
+  explicit BenchmarkDM(TcrConnectionManager& connManager)
+      : ThinClientBaseDM(connManager, nullptr) {}
+
+  GfErrType sendSyncRequest(TcrMessage&, TcrMessageReply&, bool,
+                            bool) override {
+    return GF_NOERR;
+  }
+
+  GfErrType sendRequestToEP(const TcrMessage&, TcrMessageReply&,
+                            TcrEndpoint*) override {
+    return GF_NOERR;
+  }
+};
+
+std::shared_ptr<CacheableString> makeValue(int64_t length) {
+  return CacheableString::create(std::string(length, 'v').c_str());
+}
+
+void TcrMessage_EncodePut(benchmark::State& state) {
+  auto& cache = getBenchmarkCache();
+  auto key = CacheableString::create("key");
+  auto value = makeValue(state.range(0));
+  while (state.KeepRunning()) {
+    TcrMessagePut message(cache.createDataOutput(), nullptr, key, value,
+                          nullptr, false, nullptr, false, false, "region");
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(TcrMessage_EncodePut)->Range(16, 16 << 10);
+
+void TcrMessage_EncodeGet(benchmark::State& state) {
+  auto& cache = getBenchmarkCache();
+  auto key = CacheableString::create("key");
+  while (state.KeepRunning()) {
+    TcrMessageRequest message(cache.createDataOutput(), nullptr, key, nullptr,
+                              nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(TcrMessage_EncodeGet);
+
+void TcrMessage_EncodePutAll(benchmark::State& state) {
+  auto& cache = getBenchmarkCache();
+  auto region = getBenchmarkRegion("TcrMessageBenchmark");
+  HashMapOfCacheable map;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    map.emplace(CacheableInt32::create(static_cast<int32_t>(i)),
+                makeValue(64));
+  }
+  while (state.KeepRunning()) {
+    TcrMessagePutAll message(cache.createDataOutput(), region.get(), map,
+                             std::chrono::milliseconds(-1), nullptr, nullptr);
+    benchmark::DoNotOptimize(message.getMsgData());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(TcrMessage_EncodePutAll)->Range(1, 16 << 10);
+
+/**
+ * Returns the reply a server sends for a get of a key whose value is
+ * <code>value</code>: the value part followed by an int part with no flags.
+ */
+std::vector<char> makeGetResponse(Cache& cache,
+                                  const std::shared_ptr<Cacheable>& value) {
+  auto valueOutput = cache.createDataOutput();
+  valueOutput->writeObject(value);
+  uint32_t valueLength = 0;
+  auto valueBytes = valueOutput->getBuffer(&valueLength);
+
+  auto output = cache.createDataOutput();
+  output->writeInt(static_cast<int32_t>(TcrMessage::RESPONSE));
+  output->writeInt(static_cast<int32_t>(valueLength + 5 + 4 + 5));
+  output->writeInt(static_cast<int32_t>(2));  // number of parts
+  output->writeInt(static_cast<int32_t>(1));  // transaction id
+  output->write(static_cast<int8_t>(0));  // flags
+  output->writeInt(static_cast<int32_t>(valueLength));
+  output->write(static_cast<int8_t>(1));  // is object
+  output->writeBytesOnly(valueBytes, valueLength);
+  output->writeInt(static_cast<int32_t>(4));
+  output->write(static_cast<int8_t>(0));
+  output->writeInt(static_cast<int32_t>(0));  // no flags
+  uint32_t length = 0;
+  auto bytes = reinterpret_cast<const char*>(output->getBuffer(&length));
+  return std::vector<char>(bytes, bytes + length);
+}
+
+void TcrMessage_DecodeGetResponse(benchmark::State& state) {
+  auto& cache = getBenchmarkCache();
+  auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache);
+  BenchmarkDM dm(cacheImpl->tcrConnectionManager());
+  auto serializationRegistry = cacheImpl->getSerializationRegistry();
+  auto memberList = cacheImpl->getMemberListForVersionStamp();
+  auto response = makeGetResponse(cache, makeValue(state.range(0)));
+  while (state.KeepRunning()) {
+    // the reply takes ownership of the bytes, as it does of a socket read
+    auto bytes = new char[response.size()];
+    std::memcpy(bytes, response.data(), response.size());
+    TcrMessageReply reply(true, &dm);
+    reply.setMessageTypeRequest(TcrMessage::REQUEST);
+    reply.setData(bytes, static_cast<int32_t>(response.size()), 0,
+                  *serializationRegistry, *memberList);
+    benchmark::DoNotOptimize(reply.getValue());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * response.size());
+}
+BENCHMARK(TcrMessage_DecodeGetResponse)->Range(16, 16 << 10);
+
+}  // namespace
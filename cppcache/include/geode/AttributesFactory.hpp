@@ -29,6 +29,7 @@
 #include "CacheWriter.hpp"
 #include "CacheListener.hpp"
 #include "PartitionResolver.hpp"
+#include "Compressor.hpp"
 #include "RegionAttributes.hpp"
 #include "DiskPolicyType.hpp"
 #include "Pool.hpp"
@@ -249,6 +250,24 @@ class CPPCACHE_EXPORT AttributesFactory {
   AttributesFactory& setPartitionResolver(const char* libpath,
                                           const char* factoryFuncName);
 
+  /**
+   * Sets the Compressor for the values cached by the next
+   * <code>RegionAttributes</code> created. A compressor cannot be combined
+   * with overflow to disk.
+   * @param compressor the compressor, nullptr to cache values uncompressed
+   * @return a reference to <code>this</code>
+   */
+  AttributesFactory& setCompressor(
+      const std::shared_ptr<Compressor>& compressor);
+
+  /**
+   * Sets the library path for the library that will be invoked for the
+   * compressor of the region.
+   * @return a reference to <code>this</code>
+   */
+  AttributesFactory& setCompressor(const char* libpath,
+                                   const char* factoryFuncName);
+
   // EXPIRATION ATTRIBUTES
 
   /**
@@ -423,6 +442,68 @@ class CPPCACHE_EXPORT AttributesFactory {
    */
   AttributesFactory& setConcurrencyChecksEnabled(bool concurrencyChecksEnabled);
 
+  /**
+   * Sets the number of threads that deliver entry events to the
+   * <code>CacheListener</code>. With one or more threads, events are queued
+   * and the thread that applied a change, such as the subscription thread
+   * receiving server notifications, does not wait for the listener. Events
+   * for the same key are delivered in order; events for different keys may be
+   * delivered in any order. Region events are delivered once the entry
+   * events queued before them have been, and exceptions thrown by the
+   * listener for queued events are only logged.
+   * @param threads the number of dispatch threads, 0 (the default) to invoke
+   * the listener on the thread applying the change
+   * @return a reference to <code>this</code>
+   * @see RegionAttributes#getListenerDispatchThreads()
+   */
+  AttributesFactory& setListenerDispatchThreads(uint32_t threads);
+
+  /**
+   * Sets how many entry events each listener dispatch thread may have
+   * queued. Once a queue is full, threads applying changes wait for the
+   * listener to catch up. The default is 10000.
+   * @param capacity the number of events, which must be greater than zero
+   * @return a reference to <code>this</code>
+   * @see RegionAttributes#getListenerQueueCapacity()
+   */
+  AttributesFactory& setListenerQueueCapacity(uint32_t capacity);
+
+  /**
+   * Enables or disables conflation of the events queued for the
+   * <code>CacheListener</code>. With conflation, an update replaces an update
+   * of the same key that is still queued, so a listener that falls behind
+   * sees only the latest value of a key. Has no effect unless listener
+   * dispatch threads are set.
+   * @param conflationEnabled whether to conflate queued updates
+   * @return a reference to <code>this</code>
+   * @see RegionAttributes#getListenerConflationEnabled()
+   */
+  AttributesFactory& setListenerConflationEnabled(bool conflationEnabled);
+
+  /**
+   * Sets whether values received from the servers, in subscription updates
+   * and register interest results, are cached in their serialized form.
+   * They are then deserialized when they are read, or handed to a
+   * <code>CacheListener</code>, rather than when they arrive, so updates
+   * that are never read cost no deserialization. Has no effect unless
+   * caching is enabled, and cannot be combined with overflow to disk.
+   * @param storeSerialized whether to cache received values serialized
+   * @return a reference to <code>this</code>
+   * @see RegionAttributes#getStoreSerialized()
+   */
+  AttributesFactory& setStoreSerialized(bool storeSerialized);
+
+  /**
+   * Sets whether a value cached in serialized form is replaced by its
+   * deserialized form the first time it is read, so later reads return the
+   * same object instead of deserializing it again. Without it, every read
+   * returns a fresh object, like with a <code>Compressor</code>.
+   * @param keepDeserialized whether to keep values once deserialized
+   * @return a reference to <code>this</code>
+   * @see RegionAttributes#getKeepDeserialized()
+   */
+  AttributesFactory& setKeepDeserialized(bool keepDeserialized);
+
   // FACTORY METHOD
 
   /**
@@ -27,11 +27,13 @@
 #include "Region.hpp"
 #include "DistributedSystem.hpp"
 #include "QueryService.hpp"
+#include "LocalQueryService.hpp"
 #include "PoolFactory.hpp"
 #include "RegionShortcut.hpp"
 #include "RegionFactory.hpp"
 #include "InternalCacheTransactionManager2PC.hpp"
 #include "statistics/StatisticsFactory.hpp"
+#include "statistics/StatisticsSnapshot.hpp"
 #include "geode/TypeRegistry.hpp"
 /**
  * @file
@@ -165,6 +167,13 @@ class CPPCACHE_EXPORT Cache : public GeodeCache,
    */
   virtual std::shared_ptr<QueryService> getQueryService(const char* poolName);
 
+  /**
+   * Gets the LocalQueryService, which runs queries against the entries
+   * cached by the regions of this cache without going to a server.
+   * @returns A smart pointer to the LocalQueryService.
+   */
+  virtual std::shared_ptr<LocalQueryService> getLocalQueryService();
+
   /**
    * Send the "client ready" message to the server from a durable client.
    */
@@ -230,6 +239,13 @@ class CPPCACHE_EXPORT Cache : public GeodeCache,
 
   virtual statistics::StatisticsFactory* getStatisticsFactory() const;
 
+  /**
+   * Returns a point in time copy of all the statistics of this cache. The
+   * deltas of the snapshot are relative to the snapshot returned by the
+   * previous call of this method.
+   */
+  virtual statistics::StatisticsSnapshot getStatisticsSnapshot() const;
+
   virtual std::unique_ptr<DataInput> createDataInput(const uint8_t* m_buffer,
                                                      int32_t len) const;
   virtual std::unique_ptr<DataOutput> createDataOutput() const;
@@ -0,0 +1,72 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COMPRESSOR_H_
+#define GEODE_COMPRESSOR_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class Compressor Compressor.hpp
+ * A Compressor set on a region makes its local cache keep values in
+ * serialized and compressed form. Values are compressed when they are put
+ * into the cache and decompressed and deserialized each time they are read,
+ * trading CPU for memory. Eviction by heap size sees the compressed size.
+ *
+ * A Compressor may be used by several threads at once.
+ *
+ * @see AttributesFactory::setCompressor
+ * @see DeflateCompressor
+ */
+class CPPCACHE_EXPORT Compressor {
+ public:
+  virtual ~Compressor() = default;
+
+  /**
+   * Compresses <code>length</code> bytes of serialized value.
+   */
+  virtual std::vector<uint8_t> compress(const uint8_t* input,
+                                        size_t length) = 0;
+
+  /**
+   * Restores bytes produced by {@link #compress}.
+   *
+   * @throws IllegalArgumentException if the input is not valid compressed
+   * data.
+   */
+  virtual std::vector<uint8_t> decompress(const uint8_t* input,
+                                          size_t length) = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COMPRESSOR_H_
@@ -0,0 +1,74 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_DEFLATECOMPRESSOR_H_
+#define GEODE_DEFLATECOMPRESSOR_H_
+
+#include "geode_globals.hpp"
+#include "Compressor.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class DeflateCompressor DeflateCompressor.hpp
+ * A Compressor using zlib's deflate format. It is only available when the
+ * library has been built with zlib.
+ *
+ * In cache.xml it is set with the factory function
+ * <code>createDeflateCompressor</code> of this library:
+ * <pre>
+ * &lt;compressor library-name="apache-geode"
+ *             library-function-name="createDeflateCompressor"/&gt;
+ * </pre>
+ */
+class CPPCACHE_EXPORT DeflateCompressor : public Compressor {
+ public:
+  static const int DEFAULT_LEVEL = 1;
+
+  /**
+   * @param level the zlib compression level, from 1 (fastest) to 9 (smallest)
+   * @throws IllegalArgumentException if the level is out of range
+   * @throws UnsupportedOperationException if the library has been built
+   * without zlib
+   */
+  explicit DeflateCompressor(int level = DEFAULT_LEVEL);
+
+  virtual ~DeflateCompressor() = default;
+
+  virtual std::vector<uint8_t> compress(const uint8_t* input,
+                                        size_t length) override;
+
+  virtual std::vector<uint8_t> decompress(const uint8_t* input,
+                                          size_t length) override;
+
+ private:
+  int m_level;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_DEFLATECOMPRESSOR_H_
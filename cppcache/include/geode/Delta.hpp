@@ -86,7 +86,8 @@ class CPPCACHE_EXPORT Delta {
    * The default implementation of this method creates an object clone by first
    * serializing the object into
    * a buffer, then deserializing from the buffer thus creating a clone of the
-   * original.
+   * original. Classes with a copy constructor should derive from
+   * <code>CopyableDelta</code> instead, which clones without serializing.
    */
   virtual std::shared_ptr<Delta> clone();
 
@@ -96,6 +97,34 @@ class CPPCACHE_EXPORT Delta {
   Delta(Cache* cache);
   Cache* m_cache;
 };
+
+/**
+ * A <code>Delta</code> that is cloned with the copy constructor of
+ * <code>T</code> rather than by serializing and deserializing the whole
+ * object, so applying a delta in a region with cloning enabled costs little
+ * more than the delta itself. An application class derives from it in place
+ * of <code>Delta</code>:
+ * <pre>
+ * class Portfolio : public Cacheable, public CopyableDelta<Portfolio> {
+ *  public:
+ *   Portfolio(Cache* cache) : CopyableDelta<Portfolio>(cache) {}
+ *   ...
+ * };
+ * </pre>
+ * The copy may share members that <code>fromDelta( )</code> replaces rather
+ * than modifies, but anything the delta changes in place must be copied
+ * deeply, or applying it would change the value still held by the cache.
+ */
+template <class T>
+class CopyableDelta : public Delta {
+ public:
+  virtual std::shared_ptr<Delta> clone() override {
+    return std::make_shared<T>(static_cast<const T&>(*this));
+  }
+
+ protected:
+  CopyableDelta(Cache* cache) : Delta(cache) {}
+};
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -0,0 +1,121 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LOCALQUERYSERVICE_H_
+#define GEODE_LOCALQUERYSERVICE_H_
+
+#include <string>
+#include <vector>
+
+#include "geode_globals.hpp"
+#include "QueryService.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class LocalQueryService LocalQueryService.hpp
+ * A LocalQueryService runs queries against the entries a region holds in the
+ * client cache, without going to a server. It is obtained from
+ * {@link Cache#getLocalQueryService} and is useful for regions that cache all
+ * the entries they need, such as a CACHING_PROXY region registered for all
+ * keys.
+ *
+ * Local queries support a subset of OQL:
+ * <pre>
+ * SELECT * | alias | field [AS name], ...
+ * FROM /regionPath [[AS] alias]
+ * [WHERE condition]
+ * [ORDER BY field [ASC | DESC], ...]
+ * [LIMIT n]
+ * </pre>
+ * A condition compares fields, the value itself (through the alias), string,
+ * numeric, boolean and null literals and bind parameters ($1, $2, ...) with
+ * =, !=, <>, <, <=, > and >=, and combines comparisons with AND, OR, NOT and
+ * parentheses. Fields are read from PDX values, whether they are PdxInstance
+ * objects or PdxSerializable objects, and may be of scalar, String, Date or
+ * object type.
+ *
+ * Selecting the value or a single field returns a ResultSet, selecting several
+ * fields a StructSet. Entries whose value is invalid are not queried.
+ *
+ * Queries comparing a field for equality can be answered from a hash index on
+ * that field, and queries comparing it for equality or order from a range
+ * index. Indexes are kept up to date as entries are put, invalidated and
+ * destroyed in the region.
+ *
+ * Continuous queries are not supported by a LocalQueryService.
+ */
+class CPPCACHE_EXPORT LocalQueryService : public QueryService {
+ public:
+  /**
+   * The kinds of index a LocalQueryService can maintain.
+   */
+  enum IndexType {
+    /** Answers equality comparisons. */
+    HASH,
+    /** Answers equality and order comparisons. */
+    RANGE
+  };
+
+  /**
+   * Creates an index on a field of the values of a region. The index is
+   * populated from the entries the region holds and kept up to date from then
+   * on.
+   *
+   * @param name the name of the index, unique within the region
+   * @param type the kind of index
+   * @param fieldName the PDX field to index
+   * @param regionPath the full path of the region
+   * @throws IllegalArgumentException if the region does not exist or does not
+   *         cache its entries, or the region already has an index with this
+   *         name
+   */
+  virtual void createIndex(const char* name, IndexType type,
+                           const char* fieldName, const char* regionPath) = 0;
+
+  /**
+   * Removes an index from a region.
+   *
+   * @param name the name of the index
+   * @param regionPath the full path of the region
+   * @returns false if the region has no index with this name
+   */
+  virtual bool removeIndex(const char* name, const char* regionPath) = 0;
+
+  /**
+   * Returns the names of the indexes of a region.
+   *
+   * @param regionPath the full path of the region
+   */
+  virtual std::vector<std::string> getIndexes(const char* regionPath) = 0;
+
+  virtual ~LocalQueryService() {}
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALQUERYSERVICE_H_
@@ -98,6 +98,13 @@ class CPPCACHE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   int getMaxConnections() const;
 
+  /**
+   * Gets the number of connections this pool establishes in parallel when
+   * restoring its minimum.
+   * @see PoolFactory#setConnectionWarmUpConcurrency(int)
+   */
+  int getConnectionWarmUpConcurrency() const;
+
   /**
    * Gets the idle connection timeout for this pool.
    * @see PoolFactory#setIdleTimeout(long)
@@ -141,6 +148,13 @@ class CPPCACHE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   int getSubscriptionRedundancy() const;
 
+  /**
+   * Returns the number of threads this pool uses to recover its interest and
+   * CQs on a subscription server.
+   * @see PoolFactory#setSubscriptionRecoveryConcurrency(int)
+   */
+  int getSubscriptionRecoveryConcurrency() const;
+
   /**
    * Returns the subscription message tracking timeout of this pool.
    * @see PoolFactory#setSubscriptionMessageTrackingTimeout
@@ -226,6 +240,22 @@ class CPPCACHE_EXPORT Pool : public std::enable_shared_from_this<Pool> {
    */
   virtual bool isDestroyed() const = 0;
 
+  /**
+   * Opens connections until the pool holds its minimum number of connections
+   * and returns once they are established, so that an application can fill
+   * the pool before it starts taking traffic. Up to
+   * {@link #getConnectionWarmUpConcurrency} connections are established in
+   * parallel.
+   *
+   * @throws IllegalStateException
+   *                 if the pool has been destroyed.
+   * @throws NotConnectedException
+   *                 if fewer than the minimum number of connections could be
+   *                 opened.
+   * @see PoolFactory#setMinConnections(int)
+   */
+  virtual void prewarm() = 0;
+
   /**
    * Returns the QueryService for this Pool.
    * The query operations performed using this QueryService will be executed
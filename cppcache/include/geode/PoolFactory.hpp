@@ -106,6 +106,13 @@ class CPPCACHE_EXPORT PoolFactory {
    */
   static const int DEFAULT_MAX_CONNECTIONS = -1;
 
+  /**
+   * The default number of connections to establish at the same time when
+   * bringing the pool up to its minimum.
+   * <p>Current value: <code>4</code>.
+   */
+  static const int DEFAULT_CONNECTION_WARM_UP_CONCURRENCY = 4;
+
   /**
    * The default amount of time in to wait for a connection to become idle.
    * <p>Current value: <code>5s</code>.
@@ -151,6 +158,13 @@ class CPPCACHE_EXPORT PoolFactory {
    */
   static const int DEFAULT_SUBSCRIPTION_REDUNDANCY = 0;
 
+  /**
+   * The default number of threads recovering interest and CQs on a
+   * subscription server.
+   * <p>Current value: <code>4</code>.
+   */
+  static const int DEFAULT_SUBSCRIPTION_RECOVERY_CONCURRENCY = 4;
+
   /**
    * The default amount of time that messages sent from a  server to a client
    * will be tracked. The tracking is done to minimize duplicate events.
@@ -304,6 +318,21 @@ class CPPCACHE_EXPORT PoolFactory {
    */
   PoolFactory& setMaxConnections(int maxConnections);
 
+  /**
+   * Sets how many connections the pool establishes at the same time when it
+   * restores its minimum number of connections, for instance after a server
+   * restarted, or when {@link Pool#prewarm} is called. Connections are spread
+   * over the available servers, so the handshakes with them overlap instead
+   * of running one after the other.
+   *
+   * @param concurrency is the number of connections to establish in parallel.
+   * <code>1</code> creates them one at a time.
+   * @return a reference to <code>this</code>
+   * @throws std::invalid_argument if <code>concurrency</code>
+   * is less than <code>1</code>.
+   */
+  PoolFactory& setConnectionWarmUpConcurrency(int concurrency);
+
   /**
    * Sets the amount of time a connection can be idle before expiring the
    * connection. If the pool size is greater than the minimum specified by
@@ -446,6 +475,21 @@ class CPPCACHE_EXPORT PoolFactory {
    */
   PoolFactory& setSubscriptionRedundancy(int redundancy);
 
+  /**
+   * Sets how many threads register the interest and execute the CQs of this
+   * pool on a subscription server that replaces a lost one. Each thread works
+   * on its own regions and CQs over a connection of its own, so the requests
+   * overlap instead of running one after the other. A secondary server that
+   * is promoted to primary already holds them and needs no recovery.
+   *
+   * @param concurrency is the number of threads recovering subscriptions.
+   * <code>1</code> recovers them one at a time.
+   * @return a reference to <code>this</code>
+   * @throws std::invalid_argument if <code>concurrency</code>
+   * is less than <code>1</code>.
+   */
+  PoolFactory& setSubscriptionRecoveryConcurrency(int concurrency);
+
   /**
    * Sets the messageTrackingTimeout attribute which is the time-to-live period
    * for subscription events the client has received from the server. It is used
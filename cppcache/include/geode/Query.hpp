@@ -25,6 +25,7 @@
 #include "geode_globals.hpp"
 
 #include "SelectResults.hpp"
+#include "QueryResultStream.hpp"
 
 /**
  * @file
@@ -89,6 +90,46 @@ class CPPCACHE_EXPORT Query {
   virtual std::shared_ptr<SelectResults> execute(
       std::shared_ptr<CacheableVector> paramList,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the OQL Query on the cache server and returns a stream of its
+   * results, which can be read as they arrive instead of once the whole
+   * result has been received.
+   *
+   * @param timeout The time to wait for each response from the server,
+   * optional.
+   * @param capacity The number of results buffered ahead of the reader before
+   * the client stops reading from the server, optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms or
+   * capacity is 0.
+   * @returns A stream over the results. Errors while running the query are
+   * thrown when reading the stream.
+   */
+  virtual std::shared_ptr<QueryResultStream> stream(
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t capacity = QueryResultStream::DEFAULT_CAPACITY) = 0;
+
+  /**
+   * Executes the parameterized OQL Query on the cache server and returns a
+   * stream of its results.
+   *
+   * @param paramList The query parameters list
+   * @param timeout The time to wait for each response from the server,
+   * optional.
+   * @param capacity The number of results buffered ahead of the reader before
+   * the client stops reading from the server, optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms or
+   * capacity is 0.
+   * @returns A stream over the results.
+   * @see #stream(std::chrono::milliseconds, size_t)
+   */
+  virtual std::shared_ptr<QueryResultStream> stream(
+      std::shared_ptr<CacheableVector> paramList,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t capacity = QueryResultStream::DEFAULT_CAPACITY) = 0;
+
   /**
    * Get the query string provided when a new Query was created from a
    * QueryService.
@@ -0,0 +1,88 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERYRESULTSTREAM_H_
+#define GEODE_QUERYRESULTSTREAM_H_
+
+#include <memory>
+
+#include "geode_globals.hpp"
+#include "Serializable.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class QueryResultStream QueryResultStream.hpp
+ * A QueryResultStream is obtained by streaming a Query. It hands out the
+ * results of the query in the order the server sends them, while the rest
+ * are still arriving, so a large result never has to be held by the client
+ * as a whole.
+ *
+ * Results that have arrived but not yet been read are buffered up to the
+ * capacity given when streaming the query. Once the buffer is full the
+ * client stops reading from the server until results are consumed, so a
+ * slow reader holds a pool connection for as long as the query takes to
+ * drain.
+ *
+ * Results of queries that select several fields are Struct instances, which
+ * look up their field names through the stream and so must not outlive it.
+ * This class is not thread-safe; a stream should be read by one thread.
+ */
+class CPPCACHE_EXPORT QueryResultStream {
+ public:
+  /**
+   * The default number of results buffered ahead of the reader.
+   */
+  static const size_t DEFAULT_CAPACITY = 1024;
+
+  /**
+   * Waits for the next result of the query.
+   *
+   * @param result set to the next result, which may be nullptr if the query
+   *        selected a null value.
+   * @returns false once all the results of the query have been read, or the
+   *          stream has been closed.
+   * @throws QueryException if some query error occurred at the server.
+   * @throws IllegalStateException if the query had to be retried on another
+   *         server after some of its results had been read.
+   * @throws NotConnectedException if no java cache server is available.
+   */
+  virtual bool next(std::shared_ptr<Serializable>& result) = 0;
+
+  /**
+   * Stops reading the results. Results still to arrive from the server are
+   * discarded. Destroying a stream closes it and waits for the server to
+   * finish sending.
+   */
+  virtual void close() = 0;
+
+  virtual ~QueryResultStream() = default;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERYRESULTSTREAM_H_
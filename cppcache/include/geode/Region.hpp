@@ -22,6 +22,9 @@
 
 //#### Warning: DO NOT directly include Region.hpp, include Cache.hpp instead.
 
+#include <functional>
+#include <mutex>
+
 #include "geode_globals.hpp"
 #include "CacheableKey.hpp"
 #include "CacheableString.hpp"
@@ -35,6 +38,8 @@
  */
 
 #include "RegionEntry.hpp"
+#include "RegionEntryCursor.hpp"
+#include "RegionMemoryFootprint.hpp"
 #include "CacheListener.hpp"
 #include "PartitionResolver.hpp"
 #include "CacheWriter.hpp"
@@ -1020,6 +1025,88 @@ class CPPCACHE_EXPORT Region : public std::enable_shared_from_this<Region> {
 
   virtual std::vector<std::shared_ptr<RegionEntry>> entries(bool recursive) = 0;
 
+  /**
+   * Returns a cursor over the entries in the local process for this region.
+   * Unlike {@link #entries} it holds only a segment of the region at a time,
+   * which keeps walking a large region from allocating a copy of it.
+   * Entries of subregions are not visited.
+   */
+  virtual std::unique_ptr<RegionEntryCursor> entryCursor() = 0;
+
+  /**
+   * Visits the entries in the local process for this region on several
+   * threads. <code>scan</code> is called once on each of up to
+   * <code>parallelism</code> threads, the calling thread and threads of the
+   * cache's thread pool, with a cursor over a share of the entries; together
+   * the cursors visit every entry once. Returns when all the calls have
+   * returned, rethrowing the exception thrown by one of them, if any. As it
+   * may wait for the thread pool, <code>scan</code> should not start another
+   * scan itself.
+   * @param scan called with each cursor, possibly at the same time
+   * @param parallelism the most threads to visit the region with, 0 for the
+   *        number of hardware threads
+   */
+  virtual void parallelScan(
+      const std::function<void(RegionEntryCursor&)>& scan,
+      uint32_t parallelism = 0) = 0;
+
+  /**
+   * Calls <code>visitor(key, value)</code> for every entry in the local
+   * process for this region, on up to <code>parallelism</code> threads.
+   * @see #parallelScan
+   */
+  template <class VISITOR>
+  inline void forEachEntry(VISITOR visitor, uint32_t parallelism = 0) {
+    parallelScan(
+        [&visitor](RegionEntryCursor& cursor) {
+          std::shared_ptr<CacheableKey> key;
+          std::shared_ptr<Cacheable> value;
+          while (cursor.next(key, value)) {
+            visitor(key, value);
+          }
+        },
+        parallelism);
+  }
+
+  /**
+   * Folds the entries in the local process for this region into a single
+   * value on up to <code>parallelism</code> threads. Each thread folds its
+   * share of the entries with <code>accumulate(partial, key, value)</code>,
+   * starting from <code>identity</code>, and the partial results are then
+   * merged with <code>combine(result, partial)</code> in no particular order.
+   * @see #parallelScan
+   */
+  template <class T, class ACCUMULATOR, class COMBINER>
+  inline T reduceEntries(const T& identity, ACCUMULATOR accumulate,
+                         COMBINER combine, uint32_t parallelism = 0) {
+    T result = identity;
+    std::mutex mutex;
+    parallelScan(
+        [&](RegionEntryCursor& cursor) {
+          T partial = identity;
+          std::shared_ptr<CacheableKey> key;
+          std::shared_ptr<Cacheable> value;
+          while (cursor.next(key, value)) {
+            partial = accumulate(partial, key, value);
+          }
+          std::lock_guard<std::mutex> lock(mutex);
+          result = combine(result, partial);
+        },
+        parallelism);
+    return result;
+  }
+
+  /**
+   * Measures the memory held by the entries of this region in the local
+   * process. Parts that are not tracked as entries change are measured by
+   * walking the entries, so the cost grows with the size of the region;
+   * this is meant for occasional inspection rather than frequent polling.
+   * The figures are also published to the footprint statistics of the
+   * region, which change only when this is called.
+   * @throws RegionDestroyedException if the region has been destroyed
+   */
+  virtual RegionMemoryFootprint getMemoryFootprint() = 0;
+
   /**
    * Returns the <code>cache</code> associated with this region.
    * @return the cache
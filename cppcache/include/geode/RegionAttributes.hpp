@@ -32,6 +32,7 @@
 #include "CacheWriter.hpp"
 #include "CacheListener.hpp"
 #include "PartitionResolver.hpp"
+#include "Compressor.hpp"
 #include "Properties.hpp"
 #include "Serializable.hpp"
 #include "DiskPolicyType.hpp"
@@ -306,6 +307,24 @@ class CPPCACHE_EXPORT RegionAttributes : public Serializable {
    */
   std::shared_ptr<PersistenceManager> getPersistenceManager();
 
+  /** Gets the compressor for the region's cached values.
+   * @return  a pointer that points to the region's
+   * <code>Compressor</code>, nullptr if values are not compressed.
+   */
+  std::shared_ptr<Compressor> getCompressor();
+
+  /**
+   * This method returns the path of the library from which
+   * the compressor factory function will be invoked.
+   */
+  const char* getCompressorLibrary();
+
+  /**
+   * This method returns the symbol name of the factory function from which
+   * the compressor will be created.
+   */
+  const char* getCompressorFactory();
+
   /** TODO
    * Returns the name of the {@link Pool} that this region
    * will use to communicate with servers, if any.
@@ -320,6 +339,37 @@ class CPPCACHE_EXPORT RegionAttributes : public Serializable {
    * @return true if concurrent update checks are turned on
    */
   bool getConcurrencyChecksEnabled() { return m_isConcurrencyChecksEnabled; }
+
+  /**
+   * Returns the number of threads that deliver entry events to the region's
+   * <code>CacheListener</code>. Zero, the default, means the listener is
+   * invoked by the thread that applied the change.
+   */
+  uint32_t getListenerDispatchThreads() { return m_listenerDispatchThreads; }
+
+  /**
+   * Returns how many entry events each listener dispatch thread may have
+   * queued before the threads applying changes wait for it.
+   */
+  uint32_t getListenerQueueCapacity() { return m_listenerQueueCapacity; }
+
+  /**
+   * Returns true if an update queued for the <code>CacheListener</code> is
+   * replaced by a later update of the same key.
+   */
+  bool getListenerConflationEnabled() { return m_listenerConflation; }
+
+  /**
+   * Returns true if values received from the servers are cached in their
+   * serialized form and only deserialized when they are read.
+   */
+  bool getStoreSerialized() { return m_storeSerialized; }
+
+  /**
+   * Returns true if a value cached in serialized form is replaced by its
+   * deserialized form the first time it is read.
+   */
+  bool getKeepDeserialized() { return m_keepDeserialized; }
   const RegionAttributes& operator=(const RegionAttributes&) = delete;
 
  private:
@@ -336,6 +386,7 @@ class CPPCACHE_EXPORT RegionAttributes : public Serializable {
   void setCacheLoader(const char* libpath, const char* factoryFuncName);
   void setCacheWriter(const char* libpath, const char* factoryFuncName);
   void setPartitionResolver(const char* libpath, const char* factoryFuncName);
+  void setCompressor(const char* libpath, const char* factoryFuncName);
   void setPersistenceManager(const char* lib, const char* func,
                              const std::shared_ptr<Properties>& config);
   void setEndpoints(const char* endpoints);
@@ -393,9 +444,17 @@ class CPPCACHE_EXPORT RegionAttributes : public Serializable {
   char* m_persistenceFactory;
   std::shared_ptr<Properties> m_persistenceProperties;
   std::shared_ptr<PersistenceManager> m_persistenceManager;
+  std::shared_ptr<Compressor> m_compressor;
+  char* m_compressorLibrary;
+  char* m_compressorFactory;
   char* m_poolName;
   bool m_isClonable;
   bool m_isConcurrencyChecksEnabled;
+  uint32_t m_listenerDispatchThreads;
+  uint32_t m_listenerQueueCapacity;
+  bool m_listenerConflation;
+  bool m_storeSerialized;
+  bool m_keepDeserialized;
   friend class AttributesFactory;
   friend class AttributesMutator;
   friend class Cache;
@@ -0,0 +1,70 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_REGIONENTRYCURSOR_H_
+#define GEODE_REGIONENTRYCURSOR_H_
+
+#include <memory>
+
+#include "geode_globals.hpp"
+#include "Cacheable.hpp"
+#include "CacheableKey.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class RegionEntryCursor RegionEntryCursor.hpp
+ * A RegionEntryCursor walks the entries of a region in the local process
+ * without copying all of them first. It takes a snapshot of one segment of
+ * the region at a time, so at most a segment's worth of entries is held
+ * while the region is being visited.
+ *
+ * Entries changed while the cursor is open are seen as they were when their
+ * segment was reached. An entry is never visited twice, but one created
+ * after its segment has been visited is not visited at all.
+ * This class is not thread-safe; a cursor should be used by one thread.
+ */
+class CPPCACHE_EXPORT RegionEntryCursor {
+ public:
+  /**
+   * Moves to the next entry of the region.
+   *
+   * @param key set to the key of the entry
+   * @param value set to the value of the entry, nullptr if it is invalid
+   * @returns false once all the entries have been visited
+   * @throws RegionDestroyedException if the region was destroyed while it
+   *         was being visited
+   */
+  virtual bool next(std::shared_ptr<CacheableKey>& key,
+                    std::shared_ptr<Cacheable>& value) = 0;
+
+  virtual ~RegionEntryCursor() = default;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_REGIONENTRYCURSOR_H_
@@ -112,6 +112,20 @@ class CPPCACHE_EXPORT RegionFactory {
   RegionFactory& setPartitionResolver(const char* libpath,
                                       const char* factoryFuncName);
 
+  /** Sets the Compressor for the values cached by the region.
+   * @param compressor the compressor, nullptr to cache values uncompressed
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setCompressor(const std::shared_ptr<Compressor>& compressor);
+
+  /**
+   * Sets the library path for the library that will be invoked for the
+   * compressor of the region.
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setCompressor(const char* libpath,
+                               const char* factoryFuncName);
+
   // EXPIRATION ATTRIBUTES
 
   /** Sets the idleTimeout expiration attributes for region entries for the next
@@ -256,6 +270,46 @@ class CPPCACHE_EXPORT RegionFactory {
    */
   RegionFactory& setConcurrencyChecksEnabled(bool enable);
 
+  /**
+   * Sets the number of threads that deliver entry events to the
+   * <code>CacheListener</code>, 0 to invoke the listener on the thread
+   * applying the change.
+   * @see AttributesFactory#setListenerDispatchThreads
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setListenerDispatchThreads(uint32_t threads);
+
+  /**
+   * Sets how many entry events each listener dispatch thread may have queued.
+   * @see AttributesFactory#setListenerQueueCapacity
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setListenerQueueCapacity(uint32_t capacity);
+
+  /**
+   * Enables or disables conflation of the events queued for the
+   * <code>CacheListener</code>.
+   * @see AttributesFactory#setListenerConflationEnabled
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setListenerConflationEnabled(bool conflationEnabled);
+
+  /**
+   * Sets whether values received from the servers are cached in their
+   * serialized form and deserialized when read.
+   * @see AttributesFactory#setStoreSerialized
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setStoreSerialized(bool storeSerialized);
+
+  /**
+   * Sets whether a value cached in serialized form is kept deserialized once
+   * it has been read.
+   * @see AttributesFactory#setKeepDeserialized
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setKeepDeserialized(bool keepDeserialized);
+
  private:
   RegionFactory(apache::geode::client::RegionShortcut preDefinedRegion,
                 CacheImpl* cacheImpl);
@@ -0,0 +1,145 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_REGIONMEMORYFOOTPRINT_H_
+#define GEODE_REGIONMEMORYFOOTPRINT_H_
+
+#include <cstdint>
+
+#include "geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class LocalRegion;
+class MapSegment;
+class LRUEntriesMap;
+
+/**
+ * @class RegionMemoryFootprint RegionMemoryFootprint.hpp
+ *
+ * Breaks down the memory held by the entries of a region in the local
+ * process. Sizes of keys and values are those reported by
+ * Serializable::objectSize; the memory taken by the bookkeeping around them
+ * is estimated from the sizes of the structures involved, so the figures
+ * are approximate. Entries of subregions are not included.
+ *
+ * @see Region::getMemoryFootprint
+ */
+class CPPCACHE_EXPORT RegionMemoryFootprint {
+ public:
+  RegionMemoryFootprint()
+      : m_entries(0),
+        m_keyBytes(0),
+        m_valueBytes(0),
+        m_entryOverheadBytes(0),
+        m_tombstones(0),
+        m_tombstoneBytes(0),
+        m_expiryTasks(0),
+        m_expiryTaskBytes(0),
+        m_lruListBytes(0),
+        m_pooledBytes(0),
+        m_heapLRUEstimateBytes(0) {}
+
+  /** Returns the number of entries, not counting tombstones. */
+  inline int64_t getEntryCount() const { return m_entries; }
+
+  /** Returns the size of the keys of the entries. */
+  inline int64_t getKeyBytes() const { return m_keyBytes; }
+
+  /**
+   * Returns the size of the values of the entries. Values overflowed to disk
+   * are not counted, and values of regions with a Compressor are counted
+   * compressed.
+   */
+  inline int64_t getValueBytes() const { return m_valueBytes; }
+
+  /**
+   * Returns the memory taken by the entries themselves and by the hash map
+   * holding them, besides their keys and values.
+   */
+  inline int64_t getEntryOverheadBytes() const { return m_entryOverheadBytes; }
+
+  /** Returns the number of tombstones of destroyed entries. */
+  inline int64_t getTombstoneCount() const { return m_tombstones; }
+
+  /** Returns the memory taken by the tombstones, including their keys. */
+  inline int64_t getTombstoneBytes() const { return m_tombstoneBytes; }
+
+  /**
+   * Returns the number of expiry tasks scheduled for entries and tombstones.
+   */
+  inline int64_t getExpiryTaskCount() const { return m_expiryTasks; }
+
+  /** Returns the memory taken by the expiry tasks. */
+  inline int64_t getExpiryTaskBytes() const { return m_expiryTaskBytes; }
+
+  /** Returns the memory taken by the LRU list, if the region has one. */
+  inline int64_t getLRUListBytes() const { return m_lruListBytes; }
+
+  /**
+   * Returns the memory set aside for entries and hash map nodes that is not
+   * in use, kept for reuse by later entries.
+   */
+  inline int64_t getPooledBytes() const { return m_pooledBytes; }
+
+  /**
+   * Returns the size of the region as estimated by heap LRU, which is kept
+   * up to date as entries change rather than measured. Zero unless the
+   * region is subject to heap LRU.
+   */
+  inline int64_t getHeapLRUEstimateBytes() const {
+    return m_heapLRUEstimateBytes;
+  }
+
+  /** Returns the memory held by the region in all. */
+  inline int64_t getTotalBytes() const {
+    return m_keyBytes + m_valueBytes + m_entryOverheadBytes + m_tombstoneBytes +
+           m_expiryTaskBytes + m_lruListBytes + m_pooledBytes;
+  }
+
+ private:
+  int64_t m_entries;
+  int64_t m_keyBytes;
+  int64_t m_valueBytes;
+  int64_t m_entryOverheadBytes;
+  int64_t m_tombstones;
+  int64_t m_tombstoneBytes;
+  int64_t m_expiryTasks;
+  int64_t m_expiryTaskBytes;
+  int64_t m_lruListBytes;
+  int64_t m_pooledBytes;
+  int64_t m_heapLRUEstimateBytes;
+
+  friend class LocalRegion;
+  friend class MapSegment;
+  friend class LRUEntriesMap;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_REGIONMEMORYFOOTPRINT_H_
@@ -0,0 +1,176 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STREAMINGRESULTCOLLECTOR_H_
+#define GEODE_STREAMINGRESULTCOLLECTOR_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "geode_globals.hpp"
+
+#include "CacheableBuiltins.hpp"
+#include "ResultCollector.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class StreamingResultCollector StreamingResultCollector.hpp
+ * A ResultCollector that makes the results of a function available as they
+ * arrive from the servers, rather than once all of them have been received.
+ * Results are added without taking the lock the execution otherwise holds
+ * around a collector, so servers answering at the same time do not contend.
+ *
+ * A collector works in one of three ways:
+ * <ul>
+ * <li>created with the default constructor, it queues the results. They are
+ * read with {@link #next}, typically by a thread other than the one
+ * executing the function:
+ * <pre>
+ * auto rc = std::make_shared<StreamingResultCollector>();
+ * auto done = std::async(std::launch::async, [&] {
+ *   execution->withCollector(rc)->execute("MyFunction");
+ * });
+ * std::shared_ptr<Cacheable> result;
+ * while (rc->next(result)) {
+ *   process(result);
+ * }
+ * </pre></li>
+ * <li>created with {@link #withListener}, it hands each result to a
+ * listener as soon as it has been received and keeps none of them.</li>
+ * <li>created with {@link #withReducer}, it folds the results into a single
+ * value, which is the only element of {@link #getResult}.</li>
+ * </ul>
+ *
+ * When a function is executed again after a failure, results of the failed
+ * attempt that are still queued are discarded, but results already read,
+ * handed to a listener or reduced cannot be taken back.
+ */
+class CPPCACHE_EXPORT StreamingResultCollector : public ResultCollector {
+ public:
+  /**
+   * Receives the results one at a time. It may be called by several threads
+   * at once.
+   */
+  typedef std::function<void(const std::shared_ptr<Cacheable>&)> Listener;
+
+  /**
+   * Combines two partial results into one. Results are reduced in the order
+   * they arrive on each of several threads and the partial results are then
+   * combined, so the reducer has to be associative and commutative.
+   */
+  typedef std::function<std::shared_ptr<Cacheable>(
+      const std::shared_ptr<Cacheable>&, const std::shared_ptr<Cacheable>&)>
+      Reducer;
+
+  /** Creates a collector whose results are read with {@link #next}. */
+  StreamingResultCollector();
+
+  virtual ~StreamingResultCollector() noexcept;
+
+  /** Creates a collector that hands each result to <code>listener</code>. */
+  static std::shared_ptr<StreamingResultCollector> withListener(
+      Listener listener);
+
+  /** Creates a collector that reduces the results with <code>reducer</code>.
+   */
+  static std::shared_ptr<StreamingResultCollector> withReducer(
+      Reducer reducer);
+
+  /**
+   * Waits for the next result. Only one thread may read the results.
+   *
+   * @param result set to the next result
+   * @param timeout how long to wait for a result to arrive
+   * @return false once the function has completed and all its results have
+   * been read
+   * @throws FunctionExecutionException if no result arrived in time
+   * @throws IllegalStateException if the collector has a listener or reducer
+   */
+  bool next(std::shared_ptr<Cacheable>& result,
+            std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
+
+  /**
+   * Waits for the function to complete and returns the results that have
+   * not been read with {@link #next}, none if the collector has a listener,
+   * or the reduced result if it has a reducer.
+   */
+  virtual std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  virtual void addResult(
+      const std::shared_ptr<Cacheable>& resultOfSingleExecution) override;
+
+  virtual void endResults() override;
+
+  virtual void clearResults() override;
+
+ private:
+  // a node of the lock-free queue of results; results are pushed by any
+  // number of threads and popped by the single reading thread
+  struct Node {
+    std::shared_ptr<Cacheable> result;
+    bool clear;
+    std::atomic<Node*> next;
+  };
+
+  struct Partial {
+    std::mutex mutex;
+    std::shared_ptr<Cacheable> value;
+    bool hasValue = false;
+  };
+
+  static const size_t PARTIALS = 16;
+
+  void push(Node* node);
+  bool pop(std::shared_ptr<Cacheable>& result);
+  bool waitForEnd(std::chrono::milliseconds timeout);
+
+  Listener m_listener;
+  Reducer m_reducer;
+
+  std::atomic<Node*> m_head;
+  Node* m_tail;
+  std::atomic<int> m_pendingClears;
+
+  std::array<Partial, PARTIALS> m_partials;
+
+  std::atomic<int> m_waiters;
+  bool m_ended;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STREAMINGRESULTCOLLECTOR_H_
@@ -53,6 +53,13 @@ class CPPCACHE_EXPORT Struct : public Serializable {
   Struct(StructSet* ssPtr,
          std::vector<std::shared_ptr<Serializable>>& fieldValues);
 
+  /**
+   * Constructor - meant only for internal use. The Struct keeps its parent
+   * alive, for results handed out one at a time rather than in the set.
+   */
+  Struct(const std::shared_ptr<StructSet>& ssPtr,
+         std::vector<std::shared_ptr<Serializable>>& fieldValues);
+
   /**
    * Factory function for registration of <code>Struct</code>.
    */
@@ -157,6 +164,7 @@ class CPPCACHE_EXPORT Struct : public Serializable {
   std::vector<std::shared_ptr<Serializable>> m_fieldValues;
 
   StructSet* m_parent;
+  std::shared_ptr<StructSet> m_parentOwner;
 
   int32_t m_lastAccessIndex;
 };
@@ -65,6 +65,12 @@ class CPPCACHE_EXPORT SystemProperties {
 
   const uint32_t threadPoolSize() const { return m_threadPoolSize; }
 
+  /**
+   * Returns the maximum number of threads a cache runs the background work
+   * of its pools on, such as pinging servers and managing connections.
+   */
+  const uint32_t backgroundThreads() const { return m_backgroundThreads; }
+
   /**
    * Returns the sampling interval of the sampling thread.
    * This would be how often the statistics thread writes to disk.
@@ -112,6 +118,19 @@ class CPPCACHE_EXPORT SystemProperties {
    */
   const char* statisticsArchiveFile() const { return m_statisticsArchiveFile; }
 
+  /**
+   * Returns the name of the file into which statistics are exported in the
+   * OpenMetrics text format every sample interval, or an empty string if
+   * they are not exported to a file.
+   */
+  const char* statisticsMetricsFile() const { return m_statisticsMetricsFile; }
+
+  /**
+   * Returns the loopback port on which statistics are served in the
+   * OpenMetrics text format, or 0 if they are not served.
+   */
+  uint16_t statisticsMetricsPort() const { return m_statisticsMetricsPort; }
+
   /**
    * Returns the name of the filename into which logging would
    * be done.
@@ -281,6 +300,12 @@ class CPPCACHE_EXPORT SystemProperties {
     m_disableChunkHandlerThread = set;
   }
 
+  /**
+   * Returns the number of threads each pool processes the chunks of its
+   * responses on. Chunks of different responses are processed in parallel.
+   */
+  const uint32_t chunkHandlerThreads() const { return m_chunkHandlerThreads; }
+
   /**
    * returns true if app want to clear pdx type ids when client disconnect.
    * deafult is false.
@@ -392,6 +417,10 @@ class CPPCACHE_EXPORT SystemProperties {
 
   char* m_statisticsArchiveFile;
 
+  char* m_statisticsMetricsFile;
+
+  uint16_t m_statisticsMetricsPort;
+
   char* m_logFilename;
 
   Log::LogLevel m_logLevel;
@@ -452,9 +481,11 @@ class CPPCACHE_EXPORT SystemProperties {
   char* m_conflateEvents;
 
   uint32_t m_threadPoolSize;
+  uint32_t m_backgroundThreads;
   std::chrono::seconds m_suspendedTxTimeout;
   std::chrono::milliseconds m_tombstoneTimeout;
   bool m_disableChunkHandlerThread;
+  uint32_t m_chunkHandlerThreads;
   bool m_onClientDisconnectClearPdxTypeIds;
 
  private:
@@ -518,6 +518,61 @@ class CPPCACHE_EXPORT Statistics {
    */
   virtual double incDouble(char* name, double delta) = 0;
 
+  ////////////////////////  record() Methods  ////////////////////////
+
+  /**
+   * Records a sample value in the identified statistic of type
+   * <code>histogram</code>.
+   *
+   * @param id a statistic id obtained with {@link #nameToId}
+   * or {@link StatisticsType#nameToId}.
+   * @param value sample to be recorded, for example a latency in nanoseconds
+   *
+   * @throws IllegalArgumentException
+   *         If the id is invalid.
+   */
+  virtual void recordValue(int32_t id, int64_t value) = 0;
+
+  /**
+   * Records a sample value in the described statistic of type
+   * <code>histogram</code>.
+   *
+   * @param descriptor a statistic descriptor obtained with {@link
+   * #nameToDescriptor}
+   * or {@link StatisticsType#nameToDescriptor}.
+   * @param value sample to be recorded, for example a latency in nanoseconds
+   *
+   * @throws IllegalArgumentException
+   *         If no statistic exists with the given <code>descriptor</code> or
+   *         if the described statistic is not of
+   *         type <code>histogram</code>.
+   */
+  virtual void recordValue(StatisticDescriptor* descriptor, int64_t value) = 0;
+
+  /**
+   * Returns the number of samples recorded so far in the identified
+   * statistic of type <code>histogram</code>.
+   *
+   * @param id a statistic id obtained with {@link #nameToId}
+   * or {@link StatisticsType#nameToId}.
+   * @throws IllegalArgumentException
+   *         If the id is invalid.
+   */
+  virtual int64_t getHistogramCount(int32_t id) = 0;
+
+  /**
+   * Returns the value below which the given fraction (0.0 - 1.0) of the
+   * samples recorded so far in the identified statistic of type
+   * <code>histogram</code> fall.
+   *
+   * @param id a statistic id obtained with {@link #nameToId}
+   * or {@link StatisticsType#nameToId}.
+   * @param fraction the requested percentile, for example 0.99
+   * @throws IllegalArgumentException
+   *         If the id is invalid.
+   */
+  virtual int64_t getHistogramPercentile(int32_t id, double fraction) = 0;
+
  protected:
   /**
   *  Destructor is protected to prevent direct deletion. Use close().
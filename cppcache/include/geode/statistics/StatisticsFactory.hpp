@@ -122,6 +122,17 @@ class CPPCACHE_EXPORT StatisticsFactory {
                                                  const char* units,
                                                  bool largerBetter = false) = 0;
 
+  /**
+   * Creates and returns a long histogram {@link StatisticDescriptor}
+   * with the given <code>name</code>, <code>description</code>,
+   * <code>units</code>,  and with smaller values indicating better performance.
+   * Samples are added with {@link Statistics#recordValue}; archives record
+   * the count, max and percentiles of each sample interval.
+   */
+  virtual StatisticDescriptor* createLongHistogram(
+      const char* name, const char* description, const char* units,
+      bool largerBetter = false) = 0;
+
   /**
    * Creates  and returns a {@link StatisticsType}
    * with the given <code>name</code>, <code>description</code>,
@@ -0,0 +1,154 @@
+#pragma once
+
+#ifndef GEODE_STATISTICS_STATISTICSSNAPSHOT_H_
+#define GEODE_STATISTICS_STATISTICSSNAPSHOT_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+
+/** @file
+ */
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+class StatisticsManager;
+
+/**
+ * A point in time copy of the values of all the statistics of a cache,
+ * together with how much each value changed since the previous snapshot.
+ *
+ * <P>
+ * To get an instance of this class use {@link
+ * apache::geode::client::Cache::getStatisticsSnapshot}.
+ */
+class CPPCACHE_EXPORT StatisticsSnapshot {
+ public:
+  /**
+   * The value of one statistic of a statistics instance.
+   */
+  class CPPCACHE_EXPORT Value {
+   public:
+    enum Kind { GAUGE, COUNTER, HISTOGRAM };
+
+    const std::string& getName() const { return m_name; }
+    const std::string& getDescription() const { return m_description; }
+    const std::string& getUnit() const { return m_unit; }
+    Kind getKind() const { return m_kind; }
+
+    /**
+     * Returns the value of the statistic. For a histogram this is the number
+     * of values it recorded.
+     */
+    double getValue() const { return m_value; }
+
+    /**
+     * Returns how much the value changed since the previous snapshot, or
+     * the value itself if the statistic was not in the previous snapshot.
+     */
+    double getDelta() const { return m_delta; }
+
+    /**
+     * Returns the sum of all the values a histogram recorded, or 0 for other
+     * statistics.
+     */
+    double getSum() const { return m_sum; }
+
+    /**
+     * Returns (fraction, value) pairs of the percentiles of the values a
+     * histogram recorded, or an empty vector for other statistics.
+     */
+    const std::vector<std::pair<double, double>>& getPercentiles() const {
+      return m_percentiles;
+    }
+
+   private:
+    std::string m_name;
+    std::string m_description;
+    std::string m_unit;
+    Kind m_kind;
+    double m_value;
+    double m_delta;
+    double m_sum;
+    std::vector<std::pair<double, double>> m_percentiles;
+
+    friend class StatisticsManager;
+  };
+
+  /**
+   * The values of one statistics instance.
+   */
+  class CPPCACHE_EXPORT Instance {
+   public:
+    const std::string& getTypeName() const { return m_typeName; }
+    const std::string& getTextId() const { return m_textId; }
+    int64_t getNumericId() const { return m_numericId; }
+    int64_t getUniqueId() const { return m_uniqueId; }
+    const std::vector<Value>& getValues() const { return m_values; }
+
+   private:
+    std::string m_typeName;
+    std::string m_textId;
+    int64_t m_numericId;
+    int64_t m_uniqueId;
+    std::vector<Value> m_values;
+
+    friend class StatisticsManager;
+  };
+
+  StatisticsSnapshot() : m_interval(std::chrono::nanoseconds::zero()) {}
+
+  /**
+   * Returns the time the snapshot was taken.
+   */
+  std::chrono::system_clock::time_point getTimestamp() const {
+    return m_timestamp;
+  }
+
+  /**
+   * Returns the time since the previous snapshot, or zero for the first one.
+   */
+  std::chrono::nanoseconds getInterval() const { return m_interval; }
+
+  /**
+   * Returns the statistics instances that were open when the snapshot was
+   * taken, in the order they were created.
+   */
+  const std::vector<Instance>& getInstances() const { return m_instances; }
+
+ private:
+  std::chrono::system_clock::time_point m_timestamp;
+  std::chrono::steady_clock::time_point m_steadyTimestamp;
+  std::chrono::nanoseconds m_interval;
+  std::vector<Instance> m_instances;
+
+  friend class StatisticsManager;
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_STATISTICSSNAPSHOT_H_
@@ -84,6 +84,18 @@ AttributesFactory& AttributesFactory::setPartitionResolver(const char* lib,
   return *this;
 }
 
+AttributesFactory& AttributesFactory::setCompressor(
+    const std::shared_ptr<Compressor>& compressor) {
+  m_regionAttributes.m_compressor = compressor;
+  return *this;
+}
+
+AttributesFactory& AttributesFactory::setCompressor(const char* lib,
+                                                    const char* func) {
+  m_regionAttributes.setCompressor(lib, func);
+  return *this;
+}
+
 AttributesFactory& AttributesFactory::setEntryIdleTimeout(
     ExpirationAction::Action action, std::chrono::seconds idleTimeout) {
   m_regionAttributes.m_entryIdleTimeout = idleTimeout;
@@ -173,6 +185,21 @@ void AttributesFactory::validateAttributes(RegionAttributes& attrs) {
       throw IllegalStateException(
           "LRU entries limit cannot be zero if DiskPolicy is OVERFLOWS");
     }
+    if (attrs.m_compressor != nullptr || attrs.m_compressorLibrary != nullptr) {
+      throw IllegalStateException(
+          "Compressor use is incompatible with DiskPolicy OVERFLOWS");
+    }
+    if (attrs.m_storeSerialized) {
+      throw IllegalStateException(
+          "Storing values serialized is incompatible with DiskPolicy "
+          "OVERFLOWS");
+    }
+  }
+  if (attrs.m_listenerDispatchThreads != 0 &&
+      attrs.m_listenerQueueCapacity == 0) {
+    throw IllegalStateException(
+        "Listener queue capacity cannot be zero with listener dispatch "
+        "threads");
   }
 }
 
@@ -225,6 +252,36 @@ AttributesFactory& AttributesFactory::setConcurrencyChecksEnabled(bool enable) {
   return *this;
 }
 
+AttributesFactory& AttributesFactory::setListenerDispatchThreads(
+    uint32_t threads) {
+  m_regionAttributes.m_listenerDispatchThreads = threads;
+  return *this;
+}
+
+AttributesFactory& AttributesFactory::setListenerQueueCapacity(
+    uint32_t capacity) {
+  m_regionAttributes.m_listenerQueueCapacity = capacity;
+  return *this;
+}
+
+AttributesFactory& AttributesFactory::setListenerConflationEnabled(
+    bool conflationEnabled) {
+  m_regionAttributes.m_listenerConflation = conflationEnabled;
+  return *this;
+}
+
+AttributesFactory& AttributesFactory::setStoreSerialized(
+    bool storeSerialized) {
+  m_regionAttributes.m_storeSerialized = storeSerialized;
+  return *this;
+}
+
+AttributesFactory& AttributesFactory::setKeepDeserialized(
+    bool keepDeserialized) {
+  m_regionAttributes.m_keepDeserialized = keepDeserialized;
+  return *this;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -0,0 +1,176 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <geode/ExceptionTypes.hpp>
+
+#include "BackgroundExecutor.hpp"
+#include "DistributedSystemImpl.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+const char* NC_Background_Thread = "NC Background";
+}
+
+BackgroundTask::BackgroundTask(BackgroundExecutor& executor,
+                               Operation operation, const char* name)
+    : m_executor(executor),
+      m_operation(std::move(operation)),
+      m_name(name),
+      m_running(false),
+      m_started(false),
+      m_stopped(false),
+      m_queued(false),
+      m_executing(false),
+      m_signalled(false) {}
+
+void BackgroundTask::start() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_started || m_stopped) {
+    return;
+  }
+  m_started = true;
+  m_running = true;
+  if (m_signalled) {
+    m_signalled = false;
+    m_queued = true;
+    m_executor.submit(shared_from_this());
+  }
+}
+
+void BackgroundTask::signal() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_stopped || m_queued) {
+    return;
+  }
+  if (m_started && !m_executing) {
+    m_queued = true;
+    m_executor.submit(shared_from_this());
+  } else {
+    // run once started, or once more after the run in progress
+    m_signalled = true;
+  }
+}
+
+void BackgroundTask::stop() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_stopped = true;
+  m_running = false;
+  if (m_executingThread != std::this_thread::get_id()) {
+    m_idle.wait(lock, [this] { return !m_executing; });
+  }
+}
+
+void BackgroundTask::run() {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_queued = false;
+    if (m_stopped) {
+      return;
+    }
+    m_executing = true;
+    m_signalled = false;
+    m_executingThread = std::this_thread::get_id();
+  }
+  try {
+    m_operation(m_running);
+  } catch (const Exception& ex) {
+    LOGERROR("Background task %s failed: %s: %s", m_name, ex.getName(),
+             ex.what());
+  } catch (const std::exception& ex) {
+    LOGERROR("Background task %s failed: %s", m_name, ex.what());
+  } catch (...) {
+    LOGERROR("Background task %s failed with an unknown exception", m_name);
+  }
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_executing = false;
+  m_executingThread = std::thread::id();
+  if (m_signalled && !m_stopped) {
+    m_signalled = false;
+    m_queued = true;
+    m_executor.submit(shared_from_this());
+  }
+  m_idle.notify_all();
+}
+
+BackgroundExecutor::BackgroundExecutor(uint32_t maxThreads)
+    : m_maxThreads(maxThreads > 0 ? maxThreads : 1),
+      m_idleThreads(0),
+      m_stopped(false) {}
+
+BackgroundExecutor::~BackgroundExecutor() { stop(); }
+
+std::shared_ptr<BackgroundTask> BackgroundExecutor::createTask(
+    BackgroundTask::Operation operation, const char* name) {
+  return std::make_shared<BackgroundTask>(*this, std::move(operation), name);
+}
+
+void BackgroundExecutor::stop() {
+  std::vector<std::thread> threads;
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_stopped = true;
+    threads.swap(m_threads);
+  }
+  m_available.notify_all();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void BackgroundExecutor::submit(std::shared_ptr<BackgroundTask> task) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_stopped) {
+    LOGFINE("Background task %s not run since the cache is closing",
+            task->getName());
+    return;
+  }
+  m_queue.push_back(std::move(task));
+  if (m_idleThreads == 0 && m_threads.size() < m_maxThreads) {
+    m_threads.emplace_back(&BackgroundExecutor::work, this);
+  } else {
+    m_available.notify_one();
+  }
+}
+
+void BackgroundExecutor::work() {
+  DistributedSystemImpl::setThreadName(NC_Background_Thread);
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    if (m_queue.empty()) {
+      if (m_stopped) {
+        return;
+      }
+      ++m_idleThreads;
+      m_available.wait(lock, [this] { return m_stopped || !m_queue.empty(); });
+      --m_idleThreads;
+      continue;
+    }
+    auto task = std::move(m_queue.front());
+    m_queue.pop_front();
+    lock.unlock();
+    task->run();
+    task = nullptr;
+    lock.lock();
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
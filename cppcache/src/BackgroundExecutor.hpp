@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_BACKGROUNDEXECUTOR_H_
+#define GEODE_BACKGROUNDEXECUTOR_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class BackgroundExecutor;
+
+/**
+ * Periodic or on-demand work of a pool, run on the threads of the cache's
+ * BackgroundExecutor rather than on a thread of its own. This replaces a
+ * Task thread blocked on a semaphore: signal() stands for releasing the
+ * semaphore, and signals that arrive while the task is queued are folded
+ * into a single run. A task never runs on two threads at once.
+ */
+class CPPCACHE_EXPORT BackgroundTask
+    : public std::enable_shared_from_this<BackgroundTask> {
+ public:
+  /** The work; isRunning turns false once the task is being stopped. */
+  typedef std::function<void(volatile bool& isRunning)> Operation;
+
+  BackgroundTask(BackgroundExecutor& executor, Operation operation,
+                 const char* name);
+
+  /** Lets the task run; a signal received before it started runs it now. */
+  void start();
+
+  /** Has the task run once more, as soon as a thread is free. */
+  void signal();
+
+  /**
+   * Keeps the task from running again and waits for a run in progress,
+   * unless called from that run.
+   */
+  void stop();
+
+  inline const char* getName() const { return m_name; }
+
+ private:
+  friend class BackgroundExecutor;
+
+  void run();
+
+  BackgroundExecutor& m_executor;
+  Operation m_operation;
+  const char* m_name;
+
+  std::mutex m_mutex;
+  std::condition_variable m_idle;
+  volatile bool m_running;
+  bool m_started;
+  bool m_stopped;
+  bool m_queued;
+  bool m_executing;
+  bool m_signalled;
+  std::thread::id m_executingThread;
+};
+
+/**
+ * The threads a cache runs the background work of its pools on, such as
+ * pinging servers, refreshing the locator list, managing connections and
+ * acknowledging subscription events. Threads are started as work arrives,
+ * up to the number set by the max-bg-threads system property, so a client
+ * with many pools no longer keeps several mostly idle threads per pool.
+ *
+ * The timing of periodic work stays with the ExpiryTaskManager, whose
+ * handlers only signal the tasks.
+ */
+class CPPCACHE_EXPORT BackgroundExecutor {
+ public:
+  explicit BackgroundExecutor(uint32_t maxThreads);
+
+  ~BackgroundExecutor();
+
+  std::shared_ptr<BackgroundTask> createTask(
+      BackgroundTask::Operation operation, const char* name);
+
+  /** Stops the threads once they have run the tasks already queued. */
+  void stop();
+
+  inline uint32_t getMaxThreads() const { return m_maxThreads; }
+
+ private:
+  friend class BackgroundTask;
+
+  void submit(std::shared_ptr<BackgroundTask> task);
+  void work();
+
+  const uint32_t m_maxThreads;
+  std::mutex m_mutex;
+  std::condition_variable m_available;
+  std::deque<std::shared_ptr<BackgroundTask>> m_queue;
+  std::vector<std::thread> m_threads;
+  uint32_t m_idleThreads;
+  bool m_stopped;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_BACKGROUNDEXECUTOR_H_
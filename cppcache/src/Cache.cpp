@@ -128,6 +128,9 @@ RegionFactory Cache::createRegionFactory(RegionShortcut preDefinedRegion) {
  std::shared_ptr<QueryService> Cache::getQueryService(const char* poolName) {
    return m_cacheImpl->getQueryService(poolName);
  }
+ std::shared_ptr<LocalQueryService> Cache::getLocalQueryService() {
+   return m_cacheImpl->getLocalQueryService();
+ }
  std::shared_ptr<CacheTransactionManager> Cache::getCacheTransactionManager() {
    return m_cacheImpl->getCacheTransactionManager();
  }
@@ -236,6 +239,12 @@ StatisticsFactory* Cache::getStatisticsFactory() const {
       ->getStatisticsFactory();
 }
 
+statistics::StatisticsSnapshot Cache::getStatisticsSnapshot() const {
+  return m_cacheImpl->getDistributedSystem()
+      .getStatisticsManager()
+      ->getSnapshot();
+}
+
 PoolManager& Cache::getPoolManager() const {
   return m_cacheImpl->getPoolManager();
 }
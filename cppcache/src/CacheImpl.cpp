@@ -14,6 +14,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cstring>
 #include <string>
 #include <string>
 
@@ -43,6 +44,7 @@
 #include "PdxTypeRegistry.hpp"
 #include "SerializationRegistry.hpp"
 #include "ThreadPool.hpp"
+#include "BackgroundExecutor.hpp"
 
 using namespace apache::geode::client;
 
@@ -63,6 +65,7 @@ CacheImpl::CacheImpl(Cache* c, const std::string& name,
       m_evictionControllerPtr(nullptr),
       m_tcrConnectionManager(nullptr),
       m_remoteQueryServicePtr(nullptr),
+      m_localQueryService(std::make_shared<LocalQueryServiceImpl>(this)),
       m_destroyPending(false),
       m_initDone(false),
       m_adminRegion(nullptr),
@@ -75,6 +78,8 @@ CacheImpl::CacheImpl(Cache* c, const std::string& name,
       m_clientProxyMembershipIDFactory(m_distributedSystem->getName()),
       m_threadPool(new ThreadPool(
           m_distributedSystem->getSystemProperties().threadPoolSize())),
+      m_backgroundExecutor(new BackgroundExecutor(
+          m_distributedSystem->getSystemProperties().backgroundThreads())),
       m_authInitialize(authInitialize) {
   m_cacheTXManager = std::shared_ptr<InternalCacheTransactionManager2PC>(
       new InternalCacheTransactionManager2PCImpl(c));
@@ -175,6 +180,10 @@ int CacheImpl::removeRegion(const char* name) {
   MapOfRegionGuard guard(m_regions->mutex());
   return m_regions->unbind(name);
 }
+std::shared_ptr<LocalQueryService> CacheImpl::getLocalQueryService() {
+  return m_localQueryService;
+}
+
 std::shared_ptr<QueryService> CacheImpl::getQueryService(bool noInit) {
   if (m_defaultPool != nullptr) {
     if (m_defaultPool->isDestroyed()) {
@@ -317,12 +326,14 @@ void CacheImpl::close(bool keepalive) {
   }
 
   m_regions->unbind_all();
+  m_regionRegistry.clear();
   LOGDEBUG("CacheImpl::close( ): destroyed regions.");
 
   GF_SAFE_DELETE(m_tcrConnectionManager);
   m_cacheTXManager = nullptr;
 
   m_expiryTaskManager->stopExpiryTaskManager();
+  m_backgroundExecutor->stop();
 
   m_closed = true;
 
@@ -448,6 +459,7 @@ std::shared_ptr<RegionInternal> rpImpl = nullptr;
 
     rpImpl->acquireReadLock();
     m_regions->bind(regionPtr->getName(), regionPtr);
+    m_regionRegistry.add(regionPtr);
 
     // When region is created, added that region name in client meta data
     // service to fetch its
@@ -494,46 +506,19 @@ std::shared_ptr<RegionInternal> rpImpl = nullptr;
  */
 
 void CacheImpl::getRegion(const char* path, std::shared_ptr<Region>& rptr) {
-  TryReadGuard guardCacheDestroy(m_destroyCacheMutex, m_destroyPending);
   if (m_destroyPending) {
     rptr = nullptr;
     return;
   }
 
-  MapOfRegionGuard guard(m_regions->mutex());
-  std::string pathstr;
-  if (path != nullptr) {
-    pathstr = path;
-  }
-  rptr = nullptr;
-  std::string slash("/");
-  if ((path == (void*)nullptr) || (pathstr == slash) ||
-      (pathstr.length() < 1)) {
-    LOGERROR("Cache::getRegion: path [%s] is not valid.", pathstr.c_str());
+  size_t length = path == nullptr ? 0 : std::strlen(path);
+  if (length == 0 || (length == 1 && path[0] == '/')) {
+    LOGERROR("Cache::getRegion: path [%s] is not valid.",
+             path == nullptr ? "" : path);
     throw IllegalArgumentException("Cache::getRegion: path is null or a /");
   }
-  std::string fullname = pathstr;
-  if (fullname.substr(0, 1) == slash) {
-    fullname = pathstr.substr(1);
-  }
-  // find second separator
-  uint32_t idx = static_cast<uint32_t>(fullname.find('/'));
-  std::string stepname = fullname.substr(0, idx);
-  std::shared_ptr<Region> region;
-  if (0 == m_regions->find(stepname, region)) {
-    if (stepname == fullname) {
-      // done...
-      rptr = region;
-      return;
-    }
-    std::string remainder = fullname.substr(stepname.length() + 1);
-    if (region != nullptr) {
-      rptr = region->getSubregion(remainder.c_str());
-    } else {
-      rptr = nullptr;
-      return;  // Return null if the parent region was not found.
-    }
-  }
+  // looked up by full path in the registry, which takes no lock
+  rptr = m_regionRegistry.find(path, length);
 }
 
 std::shared_ptr<RegionInternal> CacheImpl::createRegion_internal(
@@ -729,7 +714,7 @@ void CacheImpl::processMarker() {
 int CacheImpl::getPoolSize(const char* poolName) {
   if (const auto pool = getCache()->getPoolManager().find(poolName)) {
     if (const auto dm = std::dynamic_pointer_cast<ThinClientPoolDM>(pool)) {
-      return dm->m_poolSize;
+      return dm->m_poolSize.established();
     }
   }
   return -1;
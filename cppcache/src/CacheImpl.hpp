@@ -37,11 +37,13 @@
 #include "TcrConnectionManager.hpp"
 #include "EvictionController.hpp"
 #include "RemoteQueryService.hpp"
+#include "LocalQueryServiceImpl.hpp"
 #include "AdminRegion.hpp"
 #include "CachePerfStats.hpp"
 #include "PdxTypeRegistry.hpp"
 #include "MemberListForVersionStamp.hpp"
 #include "ClientProxyMembershipIDFactory.hpp"
+#include "RegionRegistry.hpp"
 
 #include <string>
 #include <string>
@@ -61,6 +63,7 @@ namespace geode {
 namespace client {
 
 class ThreadPool;
+class BackgroundExecutor;
 class CacheFactory;
 class ExpiryTaskManager;
 class PdxTypeRegistry;
@@ -222,6 +225,8 @@ class CPPCACHE_EXPORT CacheImpl : private NonCopyable, private NonAssignable {
 
   ExpiryTaskManager& getExpiryTaskManager() { return *m_expiryTaskManager; }
 
+  RegionRegistry& getRegionRegistry() { return m_regionRegistry; }
+
   ClientProxyMembershipIDFactory& getClientProxyMembershipIDFactory() {
     return m_clientProxyMembershipIDFactory;
   }
@@ -237,6 +242,8 @@ class CPPCACHE_EXPORT CacheImpl : private NonCopyable, private NonAssignable {
 
   std::shared_ptr<QueryService> getQueryService(const char* poolName);
 
+  std::shared_ptr<LocalQueryService> getLocalQueryService();
+
   std::shared_ptr<RegionInternal> createRegion_internal(
       const std::string& name,
       const std::shared_ptr<RegionInternal>& rootRegion,
@@ -281,6 +288,10 @@ class CPPCACHE_EXPORT CacheImpl : private NonCopyable, private NonAssignable {
 
   ThreadPool* getThreadPool();
 
+  inline BackgroundExecutor& getBackgroundExecutor() {
+    return *m_backgroundExecutor;
+  }
+
   inline const std::shared_ptr<AuthInitialize>& getAuthInitialize() {
     return m_authInitialize;
   }
@@ -328,6 +339,7 @@ class CPPCACHE_EXPORT CacheImpl : private NonCopyable, private NonAssignable {
   std::unique_ptr<DistributedSystem> m_distributedSystem;
   ClientProxyMembershipIDFactory m_clientProxyMembershipIDFactory;
   MapOfRegionWithLock* m_regions;
+  RegionRegistry m_regionRegistry;
   Cache* m_implementee;
   ACE_Recursive_Thread_Mutex m_mutex;
   Condition m_cond;
@@ -335,6 +347,7 @@ class CPPCACHE_EXPORT CacheImpl : private NonCopyable, private NonAssignable {
   EvictionController* m_evictionControllerPtr;
   TcrConnectionManager* m_tcrConnectionManager;
   std::shared_ptr<RemoteQueryService> m_remoteQueryServicePtr;
+  std::shared_ptr<LocalQueryServiceImpl> m_localQueryService;
   ACE_RW_Thread_Mutex m_destroyCacheMutex;
   volatile bool m_destroyPending;
   volatile bool m_initDone;
@@ -346,6 +359,7 @@ class CPPCACHE_EXPORT CacheImpl : private NonCopyable, private NonAssignable {
   std::shared_ptr<SerializationRegistry> m_serializationRegistry;
   std::shared_ptr<PdxTypeRegistry> m_pdxTypeRegistry;
   ThreadPool* m_threadPool;
+  std::unique_ptr<BackgroundExecutor> m_backgroundExecutor;
   const std::shared_ptr<AuthInitialize> m_authInitialize;
 
   friend class CacheFactory;
@@ -0,0 +1,181 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "CacheListenerDispatcher.hpp"
+#include "DistributedSystemImpl.hpp"
+#include "RegionStats.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+const char* NC_Listener_Thread = "NC Listener";
+}
+
+CacheListenerDispatcher::CacheListenerDispatcher(uint32_t threads,
+                                                 uint32_t capacity,
+                                                 bool conflate,
+                                                 RegionStats* stats)
+    : m_capacity(capacity), m_conflate(conflate), m_stats(stats) {
+  for (uint32_t i = 0; i < threads; i++) {
+    auto worker = std::make_shared<Worker>();
+    worker->thread = std::thread([worker, stats]() {
+      DistributedSystemImpl::setThreadName(NC_Listener_Thread);
+      worker->run(stats);
+    });
+    m_threadIds.push_back(worker->thread.get_id());
+    m_workers.push_back(std::move(worker));
+  }
+}
+
+CacheListenerDispatcher::~CacheListenerDispatcher() { stop(); }
+
+void CacheListenerDispatcher::dispatch(
+    const std::shared_ptr<CacheableKey>& key,
+    std::function<void()> listenerCall, bool isUpdate) {
+  auto& worker = *m_workers[static_cast<uint32_t>(key->hashcode()) %
+                            m_workers.size()];
+  std::unique_lock<std::mutex> lock(worker.mutex);
+  if (m_conflate) {
+    auto update = worker.updates.find(key);
+    if (update != worker.updates.end()) {
+      if (isUpdate) {
+        update->second->listenerCall = std::move(listenerCall);
+        if (m_stats != nullptr) {
+          m_stats->incListenerEventsConflated();
+        }
+        return;
+      }
+      // a later update must not overtake this event
+      worker.updates.erase(update);
+    }
+  }
+
+  // a listener changing the region must not wait for its own queue to drain
+  if (!onDispatchThread()) {
+    worker.dequeued.wait(lock, [this, &worker] {
+      return worker.queue.size() < m_capacity || worker.stopped;
+    });
+  }
+  if (worker.stopped) {
+    return;
+  }
+  auto event = std::make_shared<Event>();
+  event->key = key;
+  event->listenerCall = std::move(listenerCall);
+  worker.queue.push_back(event);
+  if (m_conflate && isUpdate) {
+    worker.updates[key] = event;
+  }
+  if (m_stats != nullptr) {
+    m_stats->incListenerQueueSize(1);
+  }
+  worker.queued.notify_one();
+}
+
+void CacheListenerDispatcher::flush() {
+  if (onDispatchThread()) {
+    return;
+  }
+  for (auto& worker : m_workers) {
+    std::unique_lock<std::mutex> lock(worker->mutex);
+    worker->dequeued.wait(lock, [&worker] {
+      return (worker->queue.empty() && !worker->busy) || worker->stopped;
+    });
+  }
+}
+
+void CacheListenerDispatcher::stop() {
+  for (auto& worker : m_workers) {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    if (!worker->stopped) {
+      worker->stopped = true;
+      if (m_stats != nullptr) {
+        m_stats->incListenerQueueSize(
+            -static_cast<int32_t>(worker->queue.size()));
+      }
+      worker->queue.clear();
+      worker->updates.clear();
+    }
+    worker->queued.notify_all();
+    worker->dequeued.notify_all();
+  }
+  for (auto& worker : m_workers) {
+    if (!worker->thread.joinable()) {
+      continue;
+    }
+    if (worker->thread.get_id() == std::this_thread::get_id()) {
+      worker->thread.detach();
+    } else {
+      worker->thread.join();
+    }
+  }
+}
+
+bool CacheListenerDispatcher::onDispatchThread() const {
+  auto self = std::this_thread::get_id();
+  for (const auto& id : m_threadIds) {
+    if (id == self) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void CacheListenerDispatcher::Worker::run(RegionStats* stats) {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    queued.wait(lock, [this] { return !queue.empty() || stopped; });
+    if (stopped) {
+      break;
+    }
+    auto event = std::move(queue.front());
+    queue.pop_front();
+    auto update = updates.find(event->key);
+    if (update != updates.end() && update->second == event) {
+      updates.erase(update);
+    }
+    busy = true;
+    if (stats != nullptr) {
+      stats->incListenerQueueSize(-1);
+    }
+    dequeued.notify_all();
+    lock.unlock();
+
+    try {
+      event->listenerCall();
+    } catch (const Exception& ex) {
+      LOGERROR("Exception dispatching CacheListener event: %s: %s",
+               ex.getName(), ex.what());
+    } catch (...) {
+      LOGERROR("Unknown exception dispatching CacheListener event");
+    }
+    event = nullptr;
+
+    lock.lock();
+    busy = false;
+    dequeued.notify_all();
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,122 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_CACHELISTENERDISPATCHER_H_
+#define GEODE_CACHELISTENERDISPATCHER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/CacheableKey.hpp>
+
+#include "util/functional.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class RegionStats;
+
+/**
+ * Delivers the entry events of a region to its CacheListener on threads of
+ * its own, so the thread that applied a change does not wait for the
+ * listener. Each key is always dispatched by the same thread, which keeps the
+ * events of a key in order. The queue of each thread is bounded; once it is
+ * full, dispatching waits for the listener to catch up.
+ */
+class CPPCACHE_EXPORT CacheListenerDispatcher {
+ public:
+  /**
+   * @param threads the number of dispatching threads
+   * @param capacity how many events each thread may have queued
+   * @param conflate whether an update replaces a queued update of its key
+   * @param stats the statistics of the region, may be nullptr
+   */
+  CacheListenerDispatcher(uint32_t threads, uint32_t capacity, bool conflate,
+                          RegionStats* stats);
+
+  /** Stops the threads, discarding the events still queued. */
+  ~CacheListenerDispatcher();
+
+  /**
+   * Queues <code>listenerCall</code> to be run after the calls queued
+   * earlier for <code>key</code>. An update may be conflated: while it is
+   * queued, a later update of the same key takes its place.
+   */
+  void dispatch(const std::shared_ptr<CacheableKey>& key,
+                std::function<void()> listenerCall, bool isUpdate);
+
+  /**
+   * Waits until all the events queued so far have been delivered. Returns
+   * at once when called by the listener itself.
+   */
+  void flush();
+
+  /**
+   * Stops the threads once the calls in progress complete. Events still
+   * queued are discarded and later ones are ignored.
+   */
+  void stop();
+
+ private:
+  struct Event {
+    std::shared_ptr<CacheableKey> key;
+    std::function<void()> listenerCall;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::condition_variable queued;
+    std::condition_variable dequeued;
+    std::deque<std::shared_ptr<Event>> queue;
+    // the queued updates that a later update of their key may replace
+    std::unordered_map<std::shared_ptr<CacheableKey>, std::shared_ptr<Event>,
+                       dereference_hash<std::shared_ptr<CacheableKey>>,
+                       dereference_equal_to<std::shared_ptr<CacheableKey>>>
+        updates;
+    bool busy = false;
+    bool stopped = false;
+    std::thread thread;
+
+    void run(RegionStats* stats);
+  };
+
+  bool onDispatchThread() const;
+
+  const uint32_t m_capacity;
+  const bool m_conflate;
+  RegionStats* m_stats;
+  // workers are shared with their threads, which may outlive the dispatcher
+  // when the last reference to the region is released by a listener call
+  std::vector<std::shared_ptr<Worker>> m_workers;
+  std::vector<std::thread::id> m_threadIds;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_CACHELISTENERDISPATCHER_H_
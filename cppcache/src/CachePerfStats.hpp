@@ -40,7 +40,7 @@ class CPPCACHE_EXPORT CachePerfStats {
 
     if (statsType == nullptr) {
       const bool largerIsBetter = true;
-      StatisticDescriptor** statDescArr = new StatisticDescriptor*[24];
+      StatisticDescriptor** statDescArr = new StatisticDescriptor*[28];
 
       statDescArr[0] = factory->createIntCounter(
           "creates", "The total number of cache creates", "entries",
@@ -134,10 +134,26 @@ class CPPCACHE_EXPORT CachePerfStats {
           "pdxDeserializedBytes",
           "Total number of bytes read by pdx deserialization.", "entries",
           !largerIsBetter);
+      statDescArr[24] = factory->createLongHistogram(
+          "getLatency", "Distribution of get operation times for all regions",
+          "nanoseconds", !largerIsBetter);
+      statDescArr[25] = factory->createLongHistogram(
+          "putLatency", "Distribution of put operation times for all regions",
+          "nanoseconds", !largerIsBetter);
+      statDescArr[26] = factory->createIntCounter(
+          "deltaClones",
+          "Total number of values cloned to apply a delta received from the "
+          "server in regions with cloning enabled",
+          "operations", largerIsBetter);
+      statDescArr[27] = factory->createLongCounter(
+          "deltaCloneTime",
+          "Total amount of time, in nanoseconds, spent cloning values to apply "
+          "a delta received from the server",
+          "nanoseconds", !largerIsBetter);
 
       statsType = factory->createType("CachePerfStats",
                                       "Statistics about native client cache",
-                                      statDescArr, 24);
+                                      statDescArr, 28);
     }
     GF_D_ASSERT(statsType != nullptr);
     // Create Statistics object
@@ -172,6 +188,10 @@ class CPPCACHE_EXPORT CachePerfStats {
     m_pdxSerializedBytesId = statsType->nameToId("pdxSerializedBytes");
     m_pdxDeserializationsId = statsType->nameToId("pdxDeserializations");
     m_pdxDeserializedBytesId = statsType->nameToId("pdxDeserializedBytes");
+    m_getLatencyId = statsType->nameToId("getLatency");
+    m_putLatencyId = statsType->nameToId("putLatency");
+    m_deltaClonesId = statsType->nameToId("deltaClones");
+    m_deltaCloneTimeId = statsType->nameToId("deltaCloneTime");
 
     // Set initial value
     m_cachePerfStats->setInt(m_destroysId, 0);
@@ -198,6 +218,8 @@ class CPPCACHE_EXPORT CachePerfStats {
     m_cachePerfStats->setLong(m_pdxSerializedBytesId, 0);
     m_cachePerfStats->setInt(m_pdxDeserializationsId, 0);
     m_cachePerfStats->setLong(m_pdxDeserializedBytesId, 0);
+    m_cachePerfStats->setInt(m_deltaClonesId, 0);
+    m_cachePerfStats->setLong(m_deltaCloneTimeId, 0);
   }
 
   virtual ~CachePerfStats() { m_cachePerfStats = nullptr; }
@@ -214,9 +236,13 @@ class CPPCACHE_EXPORT CachePerfStats {
 
   inline void incDestroys() { m_cachePerfStats->incInt(m_destroysId, 1); }
 
-  inline void incCreates() { m_cachePerfStats->incInt(m_createsId, 1); }
+  inline void incCreates(int32_t count = 1) {
+    m_cachePerfStats->incInt(m_createsId, count);
+  }
 
-  inline void incPuts() { m_cachePerfStats->incInt(m_putsId, 1); }
+  inline void incPuts(int32_t count = 1) {
+    m_cachePerfStats->incInt(m_putsId, count);
+  }
 
   inline void incGets() { m_cachePerfStats->incInt(m_getsId, 1); }
 
@@ -250,6 +276,11 @@ class CPPCACHE_EXPORT CachePerfStats {
     m_cachePerfStats->incInt(m_processedDeltaMessagesTime, time);
   }
 
+  inline void incDeltaClone(int64_t nanos) {
+    m_cachePerfStats->incInt(m_deltaClonesId, 1);
+    m_cachePerfStats->incLong(m_deltaCloneTimeId, nanos);
+  }
+
   inline void incTombstoneCount() {
     m_cachePerfStats->incInt(m_tombstoneCount, 1);
   }
@@ -329,6 +360,14 @@ class CPPCACHE_EXPORT CachePerfStats {
     return m_cachePerfStats->getLong(m_pdxDeserializedBytesId);
   }
 
+  inline void recordGetLatency(int64_t nanos) {
+    m_cachePerfStats->recordValue(m_getLatencyId, nanos);
+  }
+
+  inline void recordPutLatency(int64_t nanos) {
+    m_cachePerfStats->recordValue(m_putLatencyId, nanos);
+  }
+
  private:
   Statistics* m_cachePerfStats;
 
@@ -356,6 +395,10 @@ class CPPCACHE_EXPORT CachePerfStats {
   int32_t m_pdxSerializedBytesId;
   int32_t m_pdxDeserializationsId;
   int32_t m_pdxDeserializedBytesId;
+  int32_t m_getLatencyId;
+  int32_t m_putLatencyId;
+  int32_t m_deltaClonesId;
+  int32_t m_deltaCloneTimeId;
 };
 }  // namespace client
 }  // namespace geode
@@ -70,6 +70,9 @@ CacheXml::CacheXml() {
   /** The name of the <code>partition-resolver</code> element */
   PARTITION_RESOLVER = "partition-resolver";
 
+  /** The name of the <code>compressor</code> element */
+  COMPRESSOR = "compressor";
+
   LIBRARY_NAME = "library-name";
 
   LIBRARY_FUNCTION_NAME = "library-function-name";
@@ -147,6 +150,11 @@ CacheXml::CacheXml() {
   PROPERTY = "property";
 
   CONCURRENCY_CHECKS_ENABLED = "concurrency-checks-enabled";
+  LISTENER_DISPATCH_THREADS = "listener-dispatch-threads";
+  LISTENER_QUEUE_CAPACITY = "listener-queue-capacity";
+  LISTENER_CONFLATION_ENABLED = "listener-conflation-enabled";
+  STORE_SERIALIZED = "store-serialized";
+  KEEP_DESERIALIZED = "keep-deserialized";
 
   TOMBSTONE_TIMEOUT = "tombstone-timeout";
 
@@ -167,6 +175,7 @@ CacheXml::CacheXml() {
   LOAD_CONDITIONING_INTERVAL = "load-conditioning-interval";
   MAX_CONNECTIONS = "max-connections";
   MIN_CONNECTIONS = "min-connections";
+  CONNECTION_WARM_UP_CONCURRENCY = "connection-warm-up-concurrency";
   PING_INTERVAL = "ping-interval";
   UPDATE_LOCATOR_LIST_INTERVAL = "update-locator-list-interval";
   READ_TIMEOUT = "read-timeout";
@@ -178,6 +187,7 @@ CacheXml::CacheXml() {
   SUBSCRIPTION_ENABLED = "subscription-enabled";
   SUBSCRIPTION_MTT = "subscription-message-tracking-timeout";
   SUBSCRIPTION_REDUNDANCY = "subscription-redundancy";
+  SUBSCRIPTION_RECOVERY_CONCURRENCY = "subscription-recovery-concurrency";
   THREAD_LOCAL_CONNECTIONS = "thread-local-connections";
   CLONING_ENABLED = "cloning-enabled";
   ID = "id";
@@ -87,6 +87,9 @@ class CPPCACHE_EXPORT CacheXml {
   /** The name of the <code>partition-resolver</code> element */
   const char* PARTITION_RESOLVER;
 
+  /** The name of the <code>compressor</code> element */
+  const char* COMPRESSOR;
+
   const char* LIBRARY_NAME;
 
   const char* LIBRARY_FUNCTION_NAME;
@@ -186,6 +189,7 @@ class CPPCACHE_EXPORT CacheXml {
   const char* LOAD_CONDITIONING_INTERVAL;
   const char* MAX_CONNECTIONS;
   const char* MIN_CONNECTIONS;
+  const char* CONNECTION_WARM_UP_CONCURRENCY;
   const char* PING_INTERVAL;
   const char* UPDATE_LOCATOR_LIST_INTERVAL;
   const char* READ_TIMEOUT;
@@ -197,11 +201,17 @@ class CPPCACHE_EXPORT CacheXml {
   const char* SUBSCRIPTION_ENABLED;
   const char* SUBSCRIPTION_MTT;
   const char* SUBSCRIPTION_REDUNDANCY;
+  const char* SUBSCRIPTION_RECOVERY_CONCURRENCY;
   const char* THREAD_LOCAL_CONNECTIONS;
   const char* CLONING_ENABLED;
   const char* MULTIUSER_SECURE_MODE;
   const char* PR_SINGLE_HOP_ENABLED;
   const char* CONCURRENCY_CHECKS_ENABLED;
+  const char* LISTENER_DISPATCH_THREADS;
+  const char* LISTENER_QUEUE_CAPACITY;
+  const char* LISTENER_CONFLATION_ENABLED;
+  const char* STORE_SERIALIZED;
+  const char* KEEP_DESERIALIZED;
   const char* TOMBSTONE_TIMEOUT;
 
   /** Name of the named region attributes */
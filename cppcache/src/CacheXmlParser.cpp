@@ -115,6 +115,8 @@ extern "C" void startElementSAX2Function(void* ctx, const xmlChar* name,
         parser->startCacheListener(atts);
       } else if (strcmp((char*)name, parser->PARTITION_RESOLVER) == 0) {
         parser->startPartitionResolver(atts);
+      } else if (strcmp((char*)name, parser->COMPRESSOR) == 0) {
+        parser->startCompressor(atts);
       } else if (strcmp((char*)name, parser->PERSISTENCE_MANAGER) == 0) {
         parser->startPersistenceManager(atts);
       } else if (strcmp((char*)name, parser->PROPERTIES) == 0) {
@@ -187,6 +189,7 @@ extern "C" void endElementSAX2Function(void* ctx, const xmlChar* name) {
       } else if (strcmp((char*)name, parser->CACHE_WRITER) == 0) {
       } else if (strcmp((char*)name, parser->CACHE_LISTENER) == 0) {
       } else if (strcmp((char*)name, parser->PARTITION_RESOLVER) == 0) {
+      } else if (strcmp((char*)name, parser->COMPRESSOR) == 0) {
       } else if (strcmp((char*)name, parser->PERSISTENCE_MANAGER) == 0) {
         parser->endPersistenceManager();
       } else if (strcmp((char*)name, parser->PROPERTIES) == 0) {
@@ -660,6 +663,8 @@ void CacheXmlParser::setPoolInfo(PoolFactory* factory, const char* name,
     factory->setMaxConnections(atoi(value));
   } else if (strcmp(name, MIN_CONNECTIONS) == 0) {
     factory->setMinConnections(atoi(value));
+  } else if (strcmp(name, CONNECTION_WARM_UP_CONCURRENCY) == 0) {
+    factory->setConnectionWarmUpConcurrency(atoi(value));
   } else if (strcmp(name, PING_INTERVAL) == 0) {
     factory->setPingInterval(
         util::chrono::duration::from_string<std::chrono::milliseconds>(
@@ -698,6 +703,8 @@ void CacheXmlParser::setPoolInfo(PoolFactory* factory, const char* name,
             std::string(value)));
   } else if (strcmp(name, SUBSCRIPTION_REDUNDANCY) == 0) {
     factory->setSubscriptionRedundancy(atoi(value));
+  } else if (strcmp(name, SUBSCRIPTION_RECOVERY_CONCURRENCY) == 0) {
+    factory->setSubscriptionRecoveryConcurrency(atoi(value));
   } else if (strcmp(name, THREAD_LOCAL_CONNECTIONS) == 0) {
     if (ACE_OS::strcasecmp(value, "true") == 0) {
       factory->setThreadLocalConnections(true);
@@ -1009,6 +1016,73 @@ void CacheXmlParser::startRegionAttributes(const xmlChar** atts) {
           throw CacheXmlException(s.c_str());
         }
         attrsFactory->setConcurrencyChecksEnabled(flag);
+      } else if (strcmp(LISTENER_DISPATCH_THREADS, (char*)atts[i]) == 0) {
+        i++;
+        char* dispatchThreads = (char*)atts[i];
+        attrsFactory->setListenerDispatchThreads(
+            static_cast<uint32_t>(atoi(dispatchThreads)));
+      } else if (strcmp(LISTENER_QUEUE_CAPACITY, (char*)atts[i]) == 0) {
+        i++;
+        char* queueCapacity = (char*)atts[i];
+        attrsFactory->setListenerQueueCapacity(
+            static_cast<uint32_t>(atoi(queueCapacity)));
+      } else if (strcmp(LISTENER_CONFLATION_ENABLED, (char*)atts[i]) == 0) {
+        bool flag = false;
+        i++;
+        char* conflationEnabled = (char*)atts[i];
+        if (strcmp("true", conflationEnabled) == 0 ||
+            strcmp("TRUE", conflationEnabled) == 0) {
+          flag = true;
+        } else if (strcmp("false", conflationEnabled) == 0 ||
+                   strcmp("FALSE", conflationEnabled) == 0) {
+          flag = false;
+        } else {
+          char* name = (char*)atts[i];
+          std::string temp(name);
+          std::string s = "XML: " + temp +
+                          " is not a valid value for the attribute "
+                          "<listener-conflation-enabled>";
+          throw CacheXmlException(s.c_str());
+        }
+        attrsFactory->setListenerConflationEnabled(flag);
+      } else if (strcmp(STORE_SERIALIZED, (char*)atts[i]) == 0) {
+        bool flag = false;
+        i++;
+        char* storeSerialized = (char*)atts[i];
+        if (strcmp("true", storeSerialized) == 0 ||
+            strcmp("TRUE", storeSerialized) == 0) {
+          flag = true;
+        } else if (strcmp("false", storeSerialized) == 0 ||
+                   strcmp("FALSE", storeSerialized) == 0) {
+          flag = false;
+        } else {
+          char* name = (char*)atts[i];
+          std::string temp(name);
+          std::string s = "XML: " + temp +
+                          " is not a valid value for the attribute "
+                          "<store-serialized>";
+          throw CacheXmlException(s.c_str());
+        }
+        attrsFactory->setStoreSerialized(flag);
+      } else if (strcmp(KEEP_DESERIALIZED, (char*)atts[i]) == 0) {
+        bool flag = false;
+        i++;
+        char* keepDeserialized = (char*)atts[i];
+        if (strcmp("true", keepDeserialized) == 0 ||
+            strcmp("TRUE", keepDeserialized) == 0) {
+          flag = true;
+        } else if (strcmp("false", keepDeserialized) == 0 ||
+                   strcmp("FALSE", keepDeserialized) == 0) {
+          flag = false;
+        } else {
+          char* name = (char*)atts[i];
+          std::string temp(name);
+          std::string s = "XML: " + temp +
+                          " is not a valid value for the attribute "
+                          "<keep-deserialized>";
+          throw CacheXmlException(s.c_str());
+        }
+        attrsFactory->setKeepDeserialized(flag);
       }
     }  // for loop
   }    // atts is nullptr
@@ -1487,6 +1561,65 @@ void CacheXmlParser::startPartitionResolver(const xmlChar** atts) {
   attrsFactory->setPartitionResolver(libraryName, libraryFunctionName);
 }
 
+void CacheXmlParser::startCompressor(const xmlChar** atts) {
+  char* libraryName = nullptr;
+  char* libraryFunctionName = nullptr;
+  int attrsCount = 0;
+  if (!atts) {
+    std::string s = "XML:No attributes provided for <compressor> ";
+    throw CacheXmlException(s.c_str());
+  }
+  while (atts[attrsCount] != nullptr) ++attrsCount;
+  if (attrsCount > 4) {
+    std::string s =
+        "XML:Incorrect number of attributes provided for <compressor>";
+    throw CacheXmlException(s.c_str());
+  }
+
+  for (int i = 0; (atts[i] != nullptr); i++) {
+    if (strcmp(LIBRARY_NAME, (char*)atts[i]) == 0) {
+      i++;
+      libraryName = (char*)atts[i];
+      if (libraryName == nullptr || strcmp(libraryName, "") == 0) {
+        std::string s =
+            "XML:The attribute <library-name> of the <compressor> tag "
+            "cannot be set to an empty string. It should either have a value "
+            "or the attribute should be removed. In the latter case the "
+            "default value will be set";
+        throw CacheXmlException(s.c_str());
+      }
+    } else if (strcmp(LIBRARY_FUNCTION_NAME, (char*)atts[i]) == 0) {
+      i++;
+      libraryFunctionName = (char*)atts[i];
+      if (libraryFunctionName == nullptr ||
+          strcmp(libraryFunctionName, "") == 0) {
+        std::string s =
+            "XML:Value for <library-function-name> needs to be provided";
+        throw CacheXmlException(s.c_str());
+      }
+    } else {
+      char* name = (char*)atts[i];
+      std::string temp(name);
+      std::string s =
+          "XML:Incorrect attribute name specified in <compressor> : " + temp;
+      throw CacheXmlException(s.c_str());
+    }
+  }
+  if (libraryFunctionName == nullptr || strcmp(libraryFunctionName, "") == 0) {
+    std::string s = "XML:Library function name not specified in <compressor> ";
+    throw CacheXmlException(s.c_str());
+  }
+
+  try {
+    getFactoryFunc(libraryName, libraryFunctionName);
+  } catch (IllegalArgumentException& ex) {
+    throw CacheXmlException(ex.what());
+  }
+
+  auto attrsFactory = std::static_pointer_cast<AttributesFactory>(_stack.top());
+  attrsFactory->setCompressor(libraryName, libraryFunctionName);
+}
+
 void CacheXmlParser::startCacheWriter(const xmlChar** atts) {
   char* libraryName = nullptr;
   char* libraryFunctionName = nullptr;
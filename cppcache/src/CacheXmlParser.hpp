@@ -101,6 +101,7 @@ class CPPCACHE_EXPORT CacheXmlParser : public CacheXml {
   void startCacheLoader(const xmlChar** atts);
   void startCacheListener(const xmlChar** atts);
   void startPartitionResolver(const xmlChar** atts);
+  void startCompressor(const xmlChar** atts);
   void startCacheWriter(const xmlChar** atts);
   void endEntryIdleTime();
   void endEntryTimeToLive();
@@ -0,0 +1,120 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+
+#include "ChunkProcessor.hpp"
+#include "DistributedSystemImpl.hpp"
+#include "PoolStatistics.hpp"
+#include "TcrChunkedContext.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+const char* NC_ProcessChunk = "NC ProcessChunk";
+}
+
+ChunkProcessor::ChunkProcessor(uint32_t threads, PoolStats* stats)
+    : m_stats(stats) {
+  if (threads == 0) {
+    threads = 1;
+  }
+  for (uint32_t i = 0; i < threads; i++) {
+    std::unique_ptr<Worker> worker(new Worker());
+    auto workerPtr = worker.get();
+    worker->thread = std::thread([workerPtr, stats]() {
+      DistributedSystemImpl::setThreadName(NC_ProcessChunk);
+      workerPtr->run(stats);
+    });
+    m_workers.push_back(std::move(worker));
+  }
+}
+
+ChunkProcessor::~ChunkProcessor() { stop(); }
+
+bool ChunkProcessor::queue(TcrChunkedContext* chunk) {
+  // responses are spread by the address of their result; the low bits are
+  // the same for all heap objects
+  auto address = reinterpret_cast<uintptr_t>(chunk->getResult());
+  auto& worker = *m_workers[(address >> 4) % m_workers.size()];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.stopped) {
+      return false;
+    }
+    worker.queue.push_back(chunk);
+  }
+  if (m_stats != nullptr) {
+    m_stats->incChunkBacklog(1);
+  }
+  worker.queued.notify_one();
+  return true;
+}
+
+void ChunkProcessor::stop() {
+  for (auto& worker : m_workers) {
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->stopped = true;
+    }
+    worker->queued.notify_one();
+  }
+  for (auto& worker : m_workers) {
+    if (worker->thread.joinable()) {
+      worker->thread.join();
+    }
+  }
+}
+
+void ChunkProcessor::Worker::run(PoolStats* stats) {
+  LOGFINE("Starting chunk process thread");
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    queued.wait(lock, [this] { return !queue.empty() || stopped; });
+    // chunks queued before the stop are still processed, so that no
+    // requesting thread is left waiting for the end of its response
+    if (queue.empty()) {
+      break;
+    }
+    auto chunk = queue.front();
+    queue.pop_front();
+    lock.unlock();
+
+    if (stats != nullptr) {
+      stats->incChunkBacklog(-1);
+      auto start = std::chrono::steady_clock::now();
+      chunk->handleChunk(false);
+      stats->incChunksProcessed(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count());
+    } else {
+      chunk->handleChunk(false);
+    }
+    delete chunk;
+
+    lock.lock();
+  }
+  LOGFINE("Ending chunk process thread");
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
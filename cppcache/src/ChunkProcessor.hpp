@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_CHUNKPROCESSOR_H_
+#define GEODE_CHUNKPROCESSOR_H_
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class PoolStats;
+class TcrChunkedContext;
+
+/**
+ * Processes the chunks of chunked responses, such as those of getAll,
+ * queries, function execution and register interest, on threads of its own
+ * so that the thread reading a connection does not wait for a chunk to be
+ * deserialized. The chunks of a response are always processed by the same
+ * thread, in the order they were read, while the chunks of different
+ * responses are processed in parallel. A thread waits for chunks without
+ * polling.
+ */
+class CPPCACHE_EXPORT ChunkProcessor {
+ public:
+  /**
+   * @param threads the number of processing threads
+   * @param stats the statistics of the pool, may be nullptr
+   */
+  ChunkProcessor(uint32_t threads, PoolStats* stats);
+
+  /** Stops the threads once they have processed the chunks queued. */
+  ~ChunkProcessor();
+
+  /**
+   * Queues <code>chunk</code> to be processed after the chunks of its
+   * response queued earlier, and takes ownership of it. Returns false,
+   * leaving the chunk with the caller, once the processor is stopped.
+   */
+  bool queue(TcrChunkedContext* chunk);
+
+  /** Stops the threads once they have processed the chunks queued. */
+  void stop();
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::condition_variable queued;
+    std::deque<TcrChunkedContext*> queue;
+    bool stopped = false;
+    std::thread thread;
+
+    void run(PoolStats* stats);
+  };
+
+  PoolStats* m_stats;
+  std::vector<std::unique_ptr<Worker>> m_workers;
+
+  // disabled
+  ChunkProcessor(const ChunkProcessor&);
+  ChunkProcessor& operator=(const ChunkProcessor&);
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_CHUNKPROCESSOR_H_
@@ -0,0 +1,316 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/Cache.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/Delta.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "CompressedEntriesMap.hpp"
+#include "CacheImpl.hpp"
+#include "CacheableToken.hpp"
+#include "LRUEntriesMap.hpp"
+#include "RegionInternal.hpp"
+#include "SerializedValue.hpp"
+#include "Utils.hpp"
+
+using namespace apache::geode::client;
+
+void CompressedValue::toData(DataOutput& output) const {
+  throw UnsupportedOperationException(
+      "CompressedValue: compressed cache values are never serialized");
+}
+
+void CompressedValue::fromData(DataInput& input) {
+  throw UnsupportedOperationException(
+      "CompressedValue: compressed cache values are never serialized");
+}
+
+CompressedEntriesMap::CompressedEntriesMap(
+    EntriesMap* entries, RegionInternal* region,
+    const std::shared_ptr<Compressor>& compressor, bool keepDeserialized)
+    : EntriesMap(std::unique_ptr<EntryFactory>()),
+      m_entries(entries),
+      m_region(region),
+      m_compressor(compressor),
+      m_keepDeserialized(keepDeserialized) {
+  GF_DEV_ASSERT(entries != nullptr);
+}
+
+CompressedEntriesMap::~CompressedEntriesMap() { delete m_entries; }
+
+std::shared_ptr<Cacheable> CompressedEntriesMap::compress(
+    const std::shared_ptr<Cacheable>& value) const {
+  if (value == nullptr || CacheableToken::isToken(value) ||
+      m_compressor == nullptr) {
+    return value;
+  }
+  if (auto serialized = std::dynamic_pointer_cast<SerializedValue>(value)) {
+    const auto& bytes = serialized->getBytes();
+    return std::make_shared<CompressedValue>(
+        m_compressor->compress(bytes.data(), bytes.size()));
+  }
+  auto output = m_region->getCacheImpl()->getCache()->createDataOutput();
+  output->setPoolName(m_region->getAttributes()->getPoolName());
+  output->writeObject(value);
+  return std::make_shared<CompressedValue>(m_compressor->compress(
+      output->getBuffer(), output->getBufferLength()));
+}
+
+std::shared_ptr<Cacheable> CompressedEntriesMap::decompress(
+    const std::shared_ptr<Cacheable>& value) const {
+  auto compressed = std::dynamic_pointer_cast<CompressedValue>(value);
+  if (compressed == nullptr) {
+    return SerializedValue::toObject(value,
+                                     *m_region->getCacheImpl()->getCache(),
+                                     m_region->getAttributes()->getPoolName());
+  }
+  const auto& bytes = compressed->getBytes();
+  auto serialized = m_compressor->decompress(bytes.data(), bytes.size());
+  auto input = m_region->getCacheImpl()->getCache()->createDataInput(
+      serialized.data(), static_cast<int32_t>(serialized.size()));
+  input->setPoolName(m_region->getAttributes()->getPoolName());
+  std::shared_ptr<Cacheable> result;
+  input->readObject(result);
+  return result;
+}
+
+void CompressedEntriesMap::open(uint32_t initialCapacity) {
+  m_entries->open(initialCapacity);
+  m_entries->setValueCodec(this);
+}
+
+void CompressedEntriesMap::close() { m_entries->close(); }
+
+GfErrType CompressedEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
+                                    const std::shared_ptr<Cacheable>& newValue,
+                                    std::shared_ptr<MapEntryImpl>& me,
+                                    std::shared_ptr<Cacheable>& oldValue,
+                                    int updateCount, int destroyTracker,
+                                    std::shared_ptr<VersionTag> versionTag,
+                                    bool& isUpdate, DataInput* delta) {
+  GfErrType err;
+  if (delta != nullptr) {
+    // the segment applies the delta to the decoded value under its lock, and
+    // hands back the value it stored, which the event needs decoded
+    err = m_entries->put(key, newValue, me, oldValue, updateCount,
+                         destroyTracker, versionTag, isUpdate, delta);
+    if (err == GF_NOERR) {
+      auto& newValue1 = const_cast<std::shared_ptr<Cacheable>&>(newValue);
+      newValue1 = decompress(newValue);
+    }
+  } else {
+    err = m_entries->put(key, compress(newValue), me, oldValue, updateCount,
+                         destroyTracker, versionTag, isUpdate, nullptr);
+  }
+  // a serialized old value is left for the region to deserialize, which it
+  // only does for a listener
+  if (std::dynamic_pointer_cast<SerializedValue>(oldValue) == nullptr) {
+    oldValue = decompress(oldValue);
+  }
+  return err;
+}
+
+void CompressedEntriesMap::putBatch(BatchPutEntries& entries,
+                                    int destroyTracker) {
+  std::vector<std::shared_ptr<Cacheable>> values;
+  values.reserve(entries.size());
+  for (auto& entry : entries) {
+    values.push_back(entry.value);
+    entry.value = compress(entry.value);
+  }
+  m_entries->putBatch(entries, destroyTracker);
+  for (size_t index = 0; index < entries.size(); ++index) {
+    entries[index].value = std::move(values[index]);
+    entries[index].oldValue = decompress(entries[index].oldValue);
+  }
+}
+
+GfErrType CompressedEntriesMap::invalidate(
+    const std::shared_ptr<CacheableKey>& key, std::shared_ptr<MapEntryImpl>& me,
+    std::shared_ptr<Cacheable>& oldValue,
+    std::shared_ptr<VersionTag> versionTag) {
+  GfErrType err = m_entries->invalidate(key, me, oldValue, versionTag);
+  oldValue = decompress(oldValue);
+  return err;
+}
+
+GfErrType CompressedEntriesMap::create(
+    const std::shared_ptr<CacheableKey>& key,
+    const std::shared_ptr<Cacheable>& newValue,
+    std::shared_ptr<MapEntryImpl>& me, std::shared_ptr<Cacheable>& oldValue,
+    int updateCount, int destroyTracker,
+    std::shared_ptr<VersionTag> versionTag) {
+  GfErrType err = m_entries->create(key, compress(newValue), me, oldValue,
+                                    updateCount, destroyTracker, versionTag);
+  oldValue = decompress(oldValue);
+  return err;
+}
+
+bool CompressedEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
+                               std::shared_ptr<Cacheable>& value,
+                               std::shared_ptr<MapEntryImpl>& me) {
+  bool found = m_entries->get(key, value, me);
+  auto stored = value;
+  value = decompress(value);
+  if (m_keepDeserialized && value != stored &&
+      std::dynamic_pointer_cast<SerializedValue>(stored) != nullptr) {
+    keepDeserialized(key, stored, value);
+  }
+  return found;
+}
+
+void CompressedEntriesMap::keepDeserialized(
+    const std::shared_ptr<CacheableKey>& key,
+    const std::shared_ptr<Cacheable>& stored,
+    const std::shared_ptr<Cacheable>& value) {
+  // unless the entry has been updated meanwhile
+  if (!m_entries->segmentFor(key)->replaceValue(key, stored, value)) {
+    return;
+  }
+  if (auto lruMap = dynamic_cast<LRUEntriesMap*>(m_entries)) {
+    lruMap->updateMapSize(
+        static_cast<int64_t>(Utils::checkAndGetObjectSize(value)) -
+        static_cast<int64_t>(stored->objectSize()));
+  }
+}
+
+void CompressedEntriesMap::getEntry(const std::shared_ptr<CacheableKey>& key,
+                                    std::shared_ptr<MapEntryImpl>& result,
+                                    std::shared_ptr<Cacheable>& value) const {
+  m_entries->getEntry(key, result, value);
+  value = decompress(value);
+}
+
+void CompressedEntriesMap::clear() { m_entries->clear(); }
+
+GfErrType CompressedEntriesMap::remove(const std::shared_ptr<CacheableKey>& key,
+                                       std::shared_ptr<Cacheable>& result,
+                                       std::shared_ptr<MapEntryImpl>& me,
+                                       int updateCount,
+                                       std::shared_ptr<VersionTag> versionTag,
+                                       bool afterRemote) {
+  GfErrType err =
+      m_entries->remove(key, result, me, updateCount, versionTag, afterRemote);
+  result = decompress(result);
+  return err;
+}
+
+bool CompressedEntriesMap::containsKey(
+    const std::shared_ptr<CacheableKey>& key) const {
+  return m_entries->containsKey(key);
+}
+
+void CompressedEntriesMap::getKeys(
+    std::vector<std::shared_ptr<CacheableKey>>& result) const {
+  m_entries->getKeys(result);
+}
+
+void CompressedEntriesMap::getEntries(
+    std::vector<std::shared_ptr<RegionEntry>>& result) const {
+  auto start = result.size();
+  m_entries->getEntries(result);
+  for (auto i = start; i < result.size(); ++i) {
+    auto value = result[i]->getValue();
+    auto decoded = decompress(value);
+    if (decoded != value) {
+      result[i] = m_region->createRegionEntry(result[i]->getKey(), decoded);
+    }
+  }
+}
+
+void CompressedEntriesMap::getValues(
+    std::vector<std::shared_ptr<Cacheable>>& result) const {
+  auto start = result.size();
+  m_entries->getValues(result);
+  for (auto i = start; i < result.size(); ++i) {
+    result[i] = decompress(result[i]);
+  }
+}
+
+uint32_t CompressedEntriesMap::segmentCount() const {
+  return m_entries->segmentCount();
+}
+
+void CompressedEntriesMap::getSegmentEntries(uint32_t segment,
+                                             KeyValuePairs& result) const {
+  auto start = result.size();
+  m_entries->getSegmentEntries(segment, result);
+  for (auto i = start; i < result.size(); ++i) {
+    result[i].second = decompress(result[i].second);
+  }
+}
+
+uint32_t CompressedEntriesMap::size() const { return m_entries->size(); }
+
+void CompressedEntriesMap::addMemoryFootprint(
+    RegionMemoryFootprint& footprint) const {
+  m_entries->addMemoryFootprint(footprint);
+}
+
+int CompressedEntriesMap::addTrackerForEntry(
+    const std::shared_ptr<CacheableKey>& key,
+    std::shared_ptr<Cacheable>& oldValue, bool addIfAbsent, bool failIfPresent,
+    bool incUpdateCount) {
+  int updateCount = m_entries->addTrackerForEntry(
+      key, oldValue, addIfAbsent, failIfPresent, incUpdateCount);
+  oldValue = decompress(oldValue);
+  return updateCount;
+}
+
+void CompressedEntriesMap::removeTrackerForEntry(
+    const std::shared_ptr<CacheableKey>& key) {
+  m_entries->removeTrackerForEntry(key);
+}
+
+int CompressedEntriesMap::addTrackerForAllEntries(
+    MapOfUpdateCounters& updateCounterMap, bool addDestroyTracking) {
+  return m_entries->addTrackerForAllEntries(updateCounterMap,
+                                            addDestroyTracking);
+}
+
+void CompressedEntriesMap::removeDestroyTracking() {
+  m_entries->removeDestroyTracking();
+}
+
+MapSegment* CompressedEntriesMap::segmentFor(
+    const std::shared_ptr<CacheableKey>& key) const {
+  return m_entries->segmentFor(key);
+}
+
+std::shared_ptr<Cacheable> CompressedEntriesMap::getFromDisk(
+    const std::shared_ptr<CacheableKey>& key,
+    std::shared_ptr<MapEntryImpl>& me) const {
+  return decompress(m_entries->getFromDisk(key, me));
+}
+
+void CompressedEntriesMap::reapTombstones(
+    std::map<uint16_t, int64_t>& gcVersions) {
+  m_entries->reapTombstones(gcVersions);
+}
+
+void CompressedEntriesMap::reapTombstones(
+    std::shared_ptr<CacheableHashSet> removedKeys) {
+  m_entries->reapTombstones(removedKeys);
+}
+
+GfErrType CompressedEntriesMap::isTombstone(std::shared_ptr<CacheableKey>& key,
+                                            std::shared_ptr<MapEntryImpl>& me,
+                                            bool& result) {
+  return m_entries->isTombstone(key, me, result);
+}
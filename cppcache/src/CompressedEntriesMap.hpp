@@ -0,0 +1,182 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COMPRESSEDENTRIESMAP_H_
+#define GEODE_COMPRESSEDENTRIESMAP_H_
+
+#include <memory>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/Compressor.hpp>
+
+#include "EntriesMap.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+class RegionInternal;
+
+/**
+ * @brief The serialized and compressed form of a value kept in the cache of
+ * a region with a Compressor. It only ever lives inside the entries map.
+ */
+class CPPCACHE_EXPORT CompressedValue : public Cacheable {
+ public:
+  explicit CompressedValue(std::vector<uint8_t> bytes)
+      : m_bytes(std::move(bytes)) {}
+
+  virtual ~CompressedValue() {}
+
+  inline const std::vector<uint8_t>& getBytes() const { return m_bytes; }
+
+  virtual void toData(DataOutput& output) const;
+
+  virtual void fromData(DataInput& input);
+
+  virtual int32_t classId() const { return 0; }
+
+  virtual uint32_t objectSize() const {
+    return static_cast<uint32_t>(sizeof(CompressedValue) + m_bytes.capacity());
+  }
+
+ private:
+  std::vector<uint8_t> m_bytes;
+};
+
+/**
+ * @brief Entries map of a region with a Compressor, or that stores values
+ * received from the servers serialized. It wraps the map that would
+ * otherwise be used, storing values compressed or serialized and handing
+ * them out deserialized, so LRU and heap accounting see the stored values.
+ *
+ * A SerializedValue is compressed as it is, without deserializing it. With
+ * no compressor it is stored as it is and, if the region keeps values
+ * deserialized, replaced by its deserialized form on the first get.
+ *
+ * Deltas are applied by the segment, under its lock, to a deserialized copy
+ * of the current value, which is then compressed again. The old value handed
+ * back by put() may still be a SerializedValue.
+ */
+class CPPCACHE_EXPORT CompressedEntriesMap : public EntriesMap,
+                                             private ValueCodec {
+ public:
+  /**
+   * @brief takes ownership of entries. compressor may be nullptr.
+   */
+  CompressedEntriesMap(EntriesMap* entries, RegionInternal* region,
+                       const std::shared_ptr<Compressor>& compressor,
+                       bool keepDeserialized = false);
+
+  virtual ~CompressedEntriesMap();
+
+  /** @brief return the wrapped map. */
+  inline EntriesMap* getEntriesMap() const { return m_entries; }
+
+  virtual void open(uint32_t initialCapacity);
+
+  virtual void close();
+
+  virtual GfErrType put(const std::shared_ptr<CacheableKey>& key,
+                        const std::shared_ptr<Cacheable>& newValue,
+                        std::shared_ptr<MapEntryImpl>& me,
+                        std::shared_ptr<Cacheable>& oldValue, int updateCount,
+                        int destroyTracker,
+                        std::shared_ptr<VersionTag> versionTag,
+                        bool& isUpdate = EntriesMap::boolVal,
+                        DataInput* delta = nullptr);
+  virtual void putBatch(BatchPutEntries& entries, int destroyTracker);
+  virtual GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
+                               std::shared_ptr<MapEntryImpl>& me,
+                               std::shared_ptr<Cacheable>& oldValue,
+                               std::shared_ptr<VersionTag> versionTag);
+  virtual GfErrType create(const std::shared_ptr<CacheableKey>& key,
+                           const std::shared_ptr<Cacheable>& newValue,
+                           std::shared_ptr<MapEntryImpl>& me,
+                           std::shared_ptr<Cacheable>& oldValue,
+                           int updateCount, int destroyTracker,
+                           std::shared_ptr<VersionTag> versionTag);
+  virtual bool get(const std::shared_ptr<CacheableKey>& key,
+                   std::shared_ptr<Cacheable>& value,
+                   std::shared_ptr<MapEntryImpl>& me);
+  virtual void getEntry(const std::shared_ptr<CacheableKey>& key,
+                        std::shared_ptr<MapEntryImpl>& result,
+                        std::shared_ptr<Cacheable>& value) const;
+  virtual void clear();
+  virtual GfErrType remove(const std::shared_ptr<CacheableKey>& key,
+                           std::shared_ptr<Cacheable>& result,
+                           std::shared_ptr<MapEntryImpl>& me, int updateCount,
+                           std::shared_ptr<VersionTag> versionTag,
+                           bool afterRemote);
+  virtual bool containsKey(const std::shared_ptr<CacheableKey>& key) const;
+  virtual void getKeys(std::vector<std::shared_ptr<CacheableKey>>& result) const;
+  virtual void getEntries(
+      std::vector<std::shared_ptr<RegionEntry>>& result) const;
+  virtual void getValues(std::vector<std::shared_ptr<Cacheable>>& result) const;
+  virtual uint32_t segmentCount() const;
+  virtual void getSegmentEntries(uint32_t segment,
+                                 KeyValuePairs& result) const;
+  virtual uint32_t size() const;
+  virtual void addMemoryFootprint(RegionMemoryFootprint& footprint) const;
+  virtual int addTrackerForEntry(const std::shared_ptr<CacheableKey>& key,
+                                 std::shared_ptr<Cacheable>& oldValue,
+                                 bool addIfAbsent, bool failIfPresent,
+                                 bool incUpdateCount);
+  virtual void removeTrackerForEntry(const std::shared_ptr<CacheableKey>& key);
+  virtual int addTrackerForAllEntries(MapOfUpdateCounters& updateCounterMap,
+                                      bool addDestroyTracking);
+  virtual void removeDestroyTracking();
+  virtual MapSegment* segmentFor(
+      const std::shared_ptr<CacheableKey>& key) const;
+  virtual std::shared_ptr<Cacheable> getFromDisk(
+      const std::shared_ptr<CacheableKey>& key,
+      std::shared_ptr<MapEntryImpl>& me) const;
+  virtual void reapTombstones(std::map<uint16_t, int64_t>& gcVersions);
+  virtual void reapTombstones(std::shared_ptr<CacheableHashSet> removedKeys);
+  virtual GfErrType isTombstone(std::shared_ptr<CacheableKey>& key,
+                                std::shared_ptr<MapEntryImpl>& me,
+                                bool& result);
+
+ private:
+  std::shared_ptr<Cacheable> compress(
+      const std::shared_ptr<Cacheable>& value) const;
+  std::shared_ptr<Cacheable> decompress(
+      const std::shared_ptr<Cacheable>& value) const;
+  virtual std::shared_ptr<Cacheable> decode(
+      const std::shared_ptr<Cacheable>& stored) const {
+    return decompress(stored);
+  }
+  virtual std::shared_ptr<Cacheable> encode(
+      const std::shared_ptr<Cacheable>& value) const {
+    return compress(value);
+  }
+  void keepDeserialized(const std::shared_ptr<CacheableKey>& key,
+                        const std::shared_ptr<Cacheable>& stored,
+                        const std::shared_ptr<Cacheable>& value);
+
+  EntriesMap* m_entries;
+  RegionInternal* m_region;
+  std::shared_ptr<Compressor> m_compressor;
+  bool m_keepDeserialized;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COMPRESSEDENTRIESMAP_H_
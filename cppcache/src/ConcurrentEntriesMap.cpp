@@ -56,6 +56,12 @@ void ConcurrentEntriesMap::open(uint32_t initialCapacity) {
   }
 }
 
+void ConcurrentEntriesMap::setValueCodec(const ValueCodec* codec) {
+  for (int index = 0; index < m_concurrency; ++index) {
+    m_segments[index].setValueCodec(codec);
+  }
+}
+
 void ConcurrentEntriesMap::close() {
   for (int index = 0; index < m_concurrency; ++index) {
     m_segments[index].close();
@@ -117,6 +123,25 @@ GfErrType ConcurrentEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
   return err;
 }
 
+void ConcurrentEntriesMap::putBatch(BatchPutEntries& entries,
+                                    int destroyTracker) {
+  std::vector<std::vector<BatchPutEntry*>> segmentEntries(m_concurrency);
+  for (auto& entry : entries) {
+    segmentEntries[segmentIdx(entry.key)].push_back(&entry);
+  }
+  for (int index = 0; index < m_concurrency; ++index) {
+    if (segmentEntries[index].empty()) {
+      continue;
+    }
+    m_segments[index].putBatch(segmentEntries[index], destroyTracker);
+    for (const auto entry : segmentEntries[index]) {
+      if (entry->err == GF_NOERR && !entry->isUpdate) {
+        ++m_size;
+      }
+    }
+  }
+}
+
 bool ConcurrentEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<Cacheable>& value,
                                std::shared_ptr<MapEntryImpl>& me) {
@@ -167,6 +192,11 @@ void ConcurrentEntriesMap::getEntries(
   }
 }
 
+void ConcurrentEntriesMap::getSegmentEntries(uint32_t segment,
+                                             KeyValuePairs& result) const {
+  m_segments[segment].getKeyValues(result);
+}
+
 void ConcurrentEntriesMap::getValues(
     std::vector<std::shared_ptr<Cacheable>>& result) const {
   result.reserve(this->size());
@@ -177,6 +207,21 @@ void ConcurrentEntriesMap::getValues(
 
 uint32_t ConcurrentEntriesMap::size() const { return m_size; }
 
+size_t ConcurrentEntriesMap::getReservedBytes() const {
+  size_t reservedBytes = 0;
+  for (int index = 0; index < m_concurrency; ++index) {
+    reservedBytes += m_segments[index].getReservedBytes();
+  }
+  return reservedBytes;
+}
+
+void ConcurrentEntriesMap::addMemoryFootprint(
+    RegionMemoryFootprint& footprint) const {
+  for (int index = 0; index < m_concurrency; ++index) {
+    m_segments[index].addMemoryFootprint(footprint);
+  }
+}
+
 int ConcurrentEntriesMap::addTrackerForEntry(
     const std::shared_ptr<CacheableKey>& key,
     std::shared_ptr<Cacheable>& oldValue, bool addIfAbsent, bool failIfPresent,
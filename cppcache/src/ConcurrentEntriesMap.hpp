@@ -84,6 +84,8 @@ class CPPCACHE_EXPORT ConcurrentEntriesMap : public EntriesMap {
 
   virtual void close();
 
+  virtual void setValueCodec(const ValueCodec* codec);
+
   virtual ~ConcurrentEntriesMap();
 
   virtual void clear();
@@ -96,6 +98,12 @@ class CPPCACHE_EXPORT ConcurrentEntriesMap : public EntriesMap {
                         std::shared_ptr<VersionTag> versionTag,
                         bool& isUpdate = EntriesMap::boolVal,
                         DataInput* delta = nullptr);
+
+  /**
+   * @brief put a batch of values, a segment at a time.
+   */
+  virtual void putBatch(BatchPutEntries& entries, int destroyTracker);
+
   virtual GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& me,
                                std::shared_ptr<Cacheable>& oldValue,
@@ -144,6 +152,14 @@ class CPPCACHE_EXPORT ConcurrentEntriesMap : public EntriesMap {
   virtual void getEntries(
       std::vector<std::shared_ptr<RegionEntry>>& result) const;
 
+  virtual uint32_t segmentCount() const { return m_concurrency; }
+
+  /**
+   * @brief return the keys and values of the entries in one segment.
+   */
+  virtual void getSegmentEntries(uint32_t segment,
+                                 KeyValuePairs& result) const;
+
   /**
    * @brief return all values in a list.
    */
@@ -154,6 +170,14 @@ class CPPCACHE_EXPORT ConcurrentEntriesMap : public EntriesMap {
    */
   virtual uint32_t size() const;
 
+  /**
+   * @brief return the bytes taken by the arenas that hold the entries and
+   * the nodes of the segments.
+   */
+  size_t getReservedBytes() const;
+
+  virtual void addMemoryFootprint(RegionMemoryFootprint& footprint) const;
+
   virtual int addTrackerForEntry(const std::shared_ptr<CacheableKey>& key,
                                  std::shared_ptr<Cacheable>& oldValue,
                                  bool addIfAbsent, bool failIfPresent,
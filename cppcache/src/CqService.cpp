@@ -26,6 +26,7 @@
 #include "CqEventImpl.hpp"
 #include <geode/CqServiceStatistics.hpp>
 #include "ThinClientPoolDM.hpp"
+#include "ThinClientPoolHADM.hpp"
 #include <geode/CqStatusListener.hpp>
 using namespace apache::geode::client;
 
@@ -229,15 +230,25 @@ GfErrType CqService::executeCqs(query_container_type& cqs,
     return GF_NOERR;
   }
 
-  GfErrType err = GF_NOERR;
-  GfErrType opErr = GF_NOERR;
-
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks;
   for (auto& cq : cqs) {
     if (!cq->isClosed() && cq->isRunning()) {
-      opErr = std::static_pointer_cast<CqQueryImpl>(cq)->execute(endpoint);
-      if (err == GF_NOERR) {
-        err = opErr;
-      }
+      auto cqImpl = std::static_pointer_cast<CqQueryImpl>(cq);
+      tasks.push_back([cqImpl, endpoint]() {
+        return cqImpl->execute(endpoint);
+      });
+    }
+  }
+
+  // a pool with subscription redundancy may execute them concurrently
+  if (auto poolHADM = dynamic_cast<ThinClientPoolHADM*>(m_tccdm)) {
+    return poolHADM->runRecoveryTasks(tasks);
+  }
+  GfErrType err = GF_NOERR;
+  for (const auto& task : tasks) {
+    GfErrType opErr = task();
+    if (err == GF_NOERR) {
+      err = opErr;
     }
   }
   return err;
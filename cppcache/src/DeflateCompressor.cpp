@@ -0,0 +1,90 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <geode/DeflateCompressor.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+using namespace apache::geode::client;
+
+namespace {
+// compressed values start with the length of the uncompressed bytes
+const size_t LENGTH_PREFIX = 4;
+}  // namespace
+
+DeflateCompressor::DeflateCompressor(int level) : m_level(level) {
+#ifndef HAVE_ZLIB
+  throw UnsupportedOperationException(
+      "DeflateCompressor: the library was built without zlib");
+#endif
+  if (level < 1 || level > 9) {
+    throw IllegalArgumentException(
+        "DeflateCompressor: level must be between 1 and 9");
+  }
+}
+
+std::vector<uint8_t> DeflateCompressor::compress(const uint8_t* input,
+                                                 size_t length) {
+  std::vector<uint8_t> output;
+#ifdef HAVE_ZLIB
+  auto bound = compressBound(static_cast<uLong>(length));
+  output.resize(LENGTH_PREFIX + bound);
+  output[0] = static_cast<uint8_t>(length >> 24);
+  output[1] = static_cast<uint8_t>(length >> 16);
+  output[2] = static_cast<uint8_t>(length >> 8);
+  output[3] = static_cast<uint8_t>(length);
+  uLongf compressedLength = bound;
+  if (compress2(output.data() + LENGTH_PREFIX, &compressedLength, input,
+                static_cast<uLong>(length), m_level) != Z_OK) {
+    throw OutOfMemoryException("DeflateCompressor: could not compress value");
+  }
+  output.resize(LENGTH_PREFIX + compressedLength);
+  output.shrink_to_fit();
+#endif
+  return output;
+}
+
+std::vector<uint8_t> DeflateCompressor::decompress(const uint8_t* input,
+                                                   size_t length) {
+  std::vector<uint8_t> output;
+#ifdef HAVE_ZLIB
+  if (length < LENGTH_PREFIX) {
+    throw IllegalArgumentException("DeflateCompressor: truncated value");
+  }
+  uLongf uncompressedLength = (static_cast<uLongf>(input[0]) << 24) |
+                              (static_cast<uLongf>(input[1]) << 16) |
+                              (static_cast<uLongf>(input[2]) << 8) |
+                              static_cast<uLongf>(input[3]);
+  output.resize(uncompressedLength);
+  auto expected = uncompressedLength;
+  if (uncompress(output.data(), &uncompressedLength, input + LENGTH_PREFIX,
+                 static_cast<uLong>(length - LENGTH_PREFIX)) != Z_OK ||
+      uncompressedLength != expected) {
+    throw IllegalArgumentException("DeflateCompressor: corrupt value");
+  }
+#endif
+  return output;
+}
+
+extern "C" CPPCACHE_EXPORT Compressor* createDeflateCompressor() {
+  return new DeflateCompressor();
+}
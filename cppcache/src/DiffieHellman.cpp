@@ -36,6 +36,8 @@ INIT_DH_FUNC_PTR(gf_setPublicKeyOther)
 INIT_DH_FUNC_PTR(gf_computeSharedSecret)
 INIT_DH_FUNC_PTR(gf_encryptDH)
 INIT_DH_FUNC_PTR(gf_decryptDH)
+INIT_DH_FUNC_PTR(gf_encryptDHInto)
+INIT_DH_FUNC_PTR(gf_decryptDHInto)
 INIT_DH_FUNC_PTR(gf_verifyDH)
 
 void* DiffieHellman::getOpenSSLFuncPtr(const char* function_name) {
@@ -76,6 +78,8 @@ void DiffieHellman::initOpenSSLFuncPtrs() {
   ASSIGN_DH_FUNC_PTR(gf_computeSharedSecret)
   ASSIGN_DH_FUNC_PTR(gf_encryptDH)
   ASSIGN_DH_FUNC_PTR(gf_decryptDH)
+  ASSIGN_DH_FUNC_PTR(gf_encryptDHInto)
+  ASSIGN_DH_FUNC_PTR(gf_decryptDHInto)
   ASSIGN_DH_FUNC_PTR(gf_verifyDH)
 
   inited = true;
@@ -158,6 +162,26 @@ std::shared_ptr<CacheableBytes> DiffieHellman::decrypt(const uint8_t* cleartext,
   return CacheableBytes::createNoCopy(ciphertextPtr, cipherLen);
 }
 
+int DiffieHellman::encrypt(const uint8_t* cleartext, int len,
+                           uint8_t* ciphertext, int capacity) {
+  int cipherLen =
+      gf_encryptDHInto_Ptr(m_dhCtx, cleartext, len, ciphertext, capacity);
+  if (cipherLen < 0) {
+    throw IllegalStateException("DiffieHellman::encrypt: encryption failed");
+  }
+  return cipherLen;
+}
+
+int DiffieHellman::decrypt(const uint8_t* ciphertext, int len,
+                           uint8_t* cleartext, int capacity) {
+  int clearLen =
+      gf_decryptDHInto_Ptr(m_dhCtx, ciphertext, len, cleartext, capacity);
+  if (clearLen < 0) {
+    throw IllegalStateException("DiffieHellman::decrypt: decryption failed");
+  }
+  return clearLen;
+}
+
 bool DiffieHellman::verify(const std::shared_ptr<CacheableString>& subject,
                            const std::shared_ptr<CacheableBytes>& challenge,
                            const std::shared_ptr<CacheableBytes>& response) {
@@ -53,6 +53,18 @@ class DiffieHellman {
   std::shared_ptr<CacheableBytes> decrypt(
       const std::shared_ptr<CacheableBytes>& cleartext);
   std::shared_ptr<CacheableBytes> decrypt(const uint8_t* cleartext, int len);
+
+  /**
+   * Encrypts into a buffer of the caller's, which needs room for the
+   * cleartext and a block of padding, and returns the length written.
+   * Unlike the methods above, nothing is allocated.
+   */
+  int encrypt(const uint8_t* cleartext, int len, uint8_t* ciphertext,
+              int capacity);
+
+  /** Decrypts into a buffer of the caller's, returning the length written. */
+  int decrypt(const uint8_t* ciphertext, int len, uint8_t* cleartext,
+              int capacity);
   bool verify(const std::shared_ptr<CacheableString>& subject,
               const std::shared_ptr<CacheableBytes>& challenge,
               const std::shared_ptr<CacheableBytes>& response);
@@ -82,6 +94,14 @@ class DiffieHellman {
   typedef unsigned char* (*gf_decryptDH_Type)(void* dhCtx,
                                               const unsigned char* cleartext,
                                               int len, int* retLen);
+  typedef int (*gf_encryptDHInto_Type)(void* dhCtx,
+                                       const unsigned char* cleartext,
+                                       int len, unsigned char* ciphertext,
+                                       int capacity);
+  typedef int (*gf_decryptDHInto_Type)(void* dhCtx,
+                                       const unsigned char* ciphertext,
+                                       int len, unsigned char* cleartext,
+                                       int capacity);
   typedef bool (*gf_verifyDH_Type)(void* dhCtx, const char* subject,
                                    const unsigned char* challenge,
                                    int challengeLen,
@@ -97,6 +117,8 @@ class DiffieHellman {
   DECLARE_DH_FUNC_PTR(gf_computeSharedSecret)
   DECLARE_DH_FUNC_PTR(gf_encryptDH)
   DECLARE_DH_FUNC_PTR(gf_decryptDH)
+  DECLARE_DH_FUNC_PTR(gf_encryptDHInto)
+  DECLARE_DH_FUNC_PTR(gf_decryptDHInto)
   DECLARE_DH_FUNC_PTR(gf_verifyDH)
 
   static ACE_DLL m_dll;
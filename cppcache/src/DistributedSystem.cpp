@@ -202,6 +202,8 @@ std::unique_ptr<DistributedSystem> DistributedSystem::create(
         sysProps->statisticsEnabled(), cache, sysProps->durableClientId(),
         sysProps->durableTimeout(), sysProps->statsFileSizeLimit(),
         sysProps->statsDiskSpaceLimit()));
+    statMngr->startMetricsExporter(sysProps->statisticsMetricsFile(),
+                                   sysProps->statisticsMetricsPort());
   } catch (const NullPointerException&) {
     Log::close();
     throw;
@@ -64,6 +64,20 @@ class CPPCACHE_EXPORT EntriesMap {
                         std::shared_ptr<VersionTag> versionTag,
                         bool& isUpdate = EntriesMap::boolVal,
                         DataInput* delta = nullptr) = 0;
+
+  /**
+   * @brief put a batch of values without update tracking, as when loading
+   * the initial image of a region. The outcome of each put is left in its
+   * entry. By default the values are put one at a time.
+   */
+  virtual void putBatch(BatchPutEntries& entries, int destroyTracker) {
+    for (auto& entry : entries) {
+      entry.isUpdate = true;
+      entry.err = put(entry.key, entry.value, entry.entry, entry.oldValue, -1,
+                      destroyTracker, entry.versionTag, entry.isUpdate);
+    }
+  }
+
   virtual GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& me,
                                std::shared_ptr<Cacheable>& oldValue,
@@ -118,6 +132,19 @@ class CPPCACHE_EXPORT EntriesMap {
   virtual void getEntries(
       std::vector<std::shared_ptr<RegionEntry>>& result) const = 0;
 
+  /**
+   * @brief return the number of segments the entries are spread over.
+   */
+  virtual uint32_t segmentCount() const = 0;
+
+  /**
+   * @brief append the keys and values of the entries in one segment, so the
+   * map can be visited a segment at a time. Invalid entries have a nullptr
+   * value.
+   */
+  virtual void getSegmentEntries(uint32_t segment,
+                                 KeyValuePairs& result) const = 0;
+
   /**
    * @brief return all values in a vector.
    */
@@ -127,6 +154,11 @@ class CPPCACHE_EXPORT EntriesMap {
   /** @brief return the number of entries in the map. */
   virtual uint32_t size() const = 0;
 
+  /**
+   * @brief add the memory held by the entries to <code>footprint</code>.
+   */
+  virtual void addMemoryFootprint(RegionMemoryFootprint& footprint) const = 0;
+
   /**
    * Add a watch for updates for the given entry. If the entry is present in
    * the cache then the current update counter for the entry is returned,
@@ -173,6 +205,12 @@ class CPPCACHE_EXPORT EntriesMap {
     return nullptr;
   }
 
+  /**
+   * @brief set the codec of the values stored in the segments of an open
+   * map. By default the map has no segments of its own.
+   */
+  virtual void setValueCodec(const ValueCodec* codec) {}
+
   virtual void reapTombstones(std::map<uint16_t, int64_t>& gcVersions) = 0;
 
   virtual void reapTombstones(
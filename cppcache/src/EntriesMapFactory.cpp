@@ -18,6 +18,7 @@
 #include <geode/Cache.hpp>
 #include "EntriesMapFactory.hpp"
 #include "LRUEntriesMap.hpp"
+#include "CompressedEntriesMap.hpp"
 #include "ExpMapEntry.hpp"
 #include "LRUExpMapEntry.hpp"
 #include <geode/DiskPolicyType.hpp>
@@ -28,7 +29,8 @@ using namespace apache::geode::client;
 
 /**
  * @brief Return a ConcurrentEntriesMap if no LRU, otherwise return a
- * LRUEntriesMap.
+ * LRUEntriesMap, wrapped in a CompressedEntriesMap if the region has a
+ * Compressor or stores values serialized.
  * In the future, a EntriesMap facade can be put over the SharedRegionData to
  * support shared regions directly.
  */
@@ -90,6 +92,11 @@ EntriesMap* EntriesMapFactory::createMap(
             new EntryFactory(concurrencyChecksEnabled)),
         concurrencyChecksEnabled, region, concurrency);
   }
+  auto compressor = attrs->getCompressor();
+  if (compressor != nullptr || attrs->getStoreSerialized()) {
+    result = new CompressedEntriesMap(result, region, compressor,
+                                      attrs->getKeepDeserialized());
+  }
   result->open(initialCapacity);
   return result;
 }
@@ -15,155 +15,183 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#include <geode/DistributedSystem.hpp>
+
 #include "EvictionController.hpp"
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
+#include "DistributedSystemImpl.hpp"
 #include "RegionInternal.hpp"
-#include <geode/DistributedSystem.hpp>
 #include "ReadWriteLock.hpp"
-#include <string>
 
 namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+// the stripe of the pending heap deltas the calling thread adds to
+size_t deltaStripe() {
+  static std::atomic<size_t> nextStripe(0);
+  static thread_local size_t stripe = nextStripe++;
+  return stripe;
+}
+
+}  // namespace
+
 const char* EvictionController::NC_EC_Thread = "NC EC Thread";
 EvictionController::EvictionController(size_t maxHeapSize,
                                        int32_t heapSizeDelta, CacheImpl* cache)
     : m_run(false),
+      m_overLimit(false),
       m_maxHeapSize(maxHeapSize * 1024 * 1024),
       m_heapSizeDelta(heapSizeDelta),
       m_cacheImpl(cache),
-      m_currentHeapSize(0) {
-  evictionThreadPtr = new EvictionThread(this);
+      m_currentHeapSize(0),
+      m_clock(1) {
+  for (auto& pending : m_pendingDeltas) {
+    pending.bytes = 0;
+  }
   LOGINFO("Maximum heap size for Heap LRU set to %ld bytes", m_maxHeapSize);
-  //  m_currentHeapSize =
-  //  DistributedSystem::getSystemProperties()->gfHighWaterMark(),
-  //  DistributedSystem::getSystemProperties()->gfMessageSize();
 }
 
-EvictionController::~EvictionController() { GF_SAFE_DELETE(evictionThreadPtr); }
+EvictionController::~EvictionController() {}
 
 void EvictionController::updateRegionHeapInfo(int64_t info) {
-  // LOGINFO("updateRegionHeapInfo is %d", info);
-  m_queue.put(info);
-  // We could block here if we wanted to prevent any further memory use
-  // until the evictions had been completed.
+  auto& pending = m_pendingDeltas[deltaStripe() % DELTA_STRIPES].bytes;
+  auto bytes = pending.fetch_add(info, std::memory_order_relaxed) + info;
+  if (bytes < DELTA_BATCH && bytes > -DELTA_BATCH) {
+    return;
+  }
+  bytes = pending.exchange(0, std::memory_order_relaxed);
+  if (m_currentHeapSize.fetch_add(bytes) + bytes > m_maxHeapSize) {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_overLimit = true;
+    }
+    m_condition.notify_one();
+  }
 }
 
 int EvictionController::svc() {
   DistributedSystemImpl::setThreadName(NC_EC_Thread);
-  int64_t pendingEvictions = 0;
+  std::unique_lock<std::mutex> lock(m_mutex);
   while (m_run) {
-    int64_t readInfo = 0;
-    readInfo = m_queue.get(1500);
-    if (readInfo == 0) continue;
-
-    processHeapInfo(readInfo, pendingEvictions);
-  }
-  int32_t size = m_queue.size();
-  for (int i = 0; i < size; i++) {
-    int64_t readInfo = 0;
-    readInfo = m_queue.get();
-    if (readInfo == 0) continue;
-    processHeapInfo(readInfo, pendingEvictions);
+    m_condition.wait_for(lock,
+                         std::chrono::milliseconds(CLOCK_TICK_MILLIS),
+                         [this] { return !m_run || m_overLimit; });
+    if (!m_run) {
+      break;
+    }
+    m_overLimit = false;
+    lock.unlock();
+    ++m_clock;
+    collectHeapDeltas();
+    checkHeapSize();
+    lock.lock();
   }
   return 1;
 }
 
-void EvictionController::processHeapInfo(int64_t& readInfo,
-                                         int64_t& pendingEvictions) {
-  m_currentHeapSize += readInfo;
-
-  // Waiting for evictions to catch up.Negative numbers
-  // are attributed to evictions that were triggered by the
-  // EvictionController
-  int64_t sizeToCompare = 0;
-  if (readInfo < 0 && pendingEvictions > 0) {
-    pendingEvictions += readInfo;
-    if (pendingEvictions < 0) pendingEvictions = 0;
-    return;  // as long as you are still evicting, don't do the rest of the work
-  } else {
-    sizeToCompare = m_currentHeapSize - pendingEvictions;
+void EvictionController::collectHeapDeltas() {
+  for (auto& pending : m_pendingDeltas) {
+    if (pending.bytes.load(std::memory_order_relaxed) != 0) {
+      m_currentHeapSize += pending.bytes.exchange(0, std::memory_order_relaxed);
+    }
   }
+}
 
-  if (sizeToCompare > m_maxHeapSize) {
-    // Check if overflow is above the delta
-    int64_t sizeOverflow = sizeToCompare - m_maxHeapSize;
-
-    // Calculate the percentage that we are over the limit.
-    int32_t fractionalOverflow =
-        static_cast<int32_t>(((sizeOverflow * 100) % m_maxHeapSize) > 0) ? 1
-                                                                         : 0;
-    int32_t percentage =
-        static_cast<int32_t>((sizeOverflow * 100) / m_maxHeapSize) +
-        fractionalOverflow;
-    // need to evict
-    int32_t evictionPercentage =
-        static_cast<int32_t>(percentage + m_heapSizeDelta);
-    int32_t bytesToEvict =
-        static_cast<int32_t>((sizeToCompare * evictionPercentage) / 100);
-    pendingEvictions += bytesToEvict;
-    if (evictionPercentage > 100) evictionPercentage = 100;
-    orderEvictions(evictionPercentage);
+void EvictionController::checkHeapSize() {
+  int64_t heapSize = m_currentHeapSize;
+  if (heapSize <= m_maxHeapSize) {
+    return;
   }
+  // free the overflow and heap-lru-delta percent of the heap besides
+  int64_t bytesToEvict =
+      heapSize - m_maxHeapSize + (heapSize * m_heapSizeDelta) / 100;
+  evict(bytesToEvict);
+  collectHeapDeltas();
 }
 
-void EvictionController::registerRegion(std::string& name) {
+void EvictionController::registerRegion(const std::string& fullPath) {
   WriteGuard guard(m_regionLock);
-  m_regions.push_back(name);
+  m_regions.push_back(fullPath);
   LOGFINE("Registered region with Heap LRU eviction controller: name is %s",
-          name.c_str());
+          fullPath.c_str());
 }
 
-void EvictionController::deregisterRegion(std::string& name) {
+void EvictionController::deregisterRegion(const std::string& fullPath) {
   // Iterate over regions vector and remove the one that we need to remove
   WriteGuard guard(m_regionLock);
   for (size_t i = 0; i < m_regions.size(); i++) {
-    std::string str = m_regions.at(i);
-    if (str == name) {
-      std::vector<std::string>::iterator iter = m_regions.begin();
-      m_regions.erase(iter + i);
+    if (m_regions[i] == fullPath) {
+      m_regions.erase(m_regions.begin() + i);
       LOGFINE(
           "Deregistered region with Heap LRU eviction controller: name is %s",
-          name.c_str());
+          fullPath.c_str());
       break;
     }
   }
 }
 
-void EvictionController::orderEvictions(int32_t percentage) {
-  evictionThreadPtr->putEvictionInfo(percentage);
+size_t EvictionController::selectVictim(
+    const std::vector<Candidate>& candidates, uint32_t now) {
+  // the entries unused for longest, for the most memory, go first; ticks
+  // wrap around, so the age is taken modulo the clock
+  size_t victim = 0;
+  double victimScore = -1;
+  for (size_t i = 0; i < candidates.size(); i++) {
+    auto age = static_cast<double>(now - candidates[i].lastAccess) + 1;
+    auto score = age * static_cast<double>(candidates[i].entrySize);
+    if (score > victimScore) {
+      victim = i;
+      victimScore = score;
+    }
+  }
+  return victim;
 }
 
-void EvictionController::evict(int32_t percentage) {
-  // TODO:  Shouldn't we take the CacheImpl::m_regions
-  // lock here? Otherwise we might invoke eviction on a region
-  // that has been destroyed or is being destroyed.
-  // Its important to not hold this lock for too long
-  // because it prevents new regions from getting created or destroyed
-  // On the flip side, this requires a copy of the registered region list
-  // every time eviction is ordered and that might not be cheap
-  //@TODO: Discuss with team
+void EvictionController::evict(int64_t bytes) {
   VectorOfString regionTmpVector;
   {
     ReadGuard guard(m_regionLock);
-    for (size_t i = 0; i < m_regions.size(); i++) {
-      regionTmpVector.push_back(m_regions.at(i));
-    }
+    regionTmpVector = m_regions;
   }
 
-  for (size_t i = 0; i < regionTmpVector.size(); i++) {
-    std::string str = regionTmpVector.at(i);
+  // holding the regions keeps them from going away while evicting; one
+  // destroyed meanwhile has nothing left to sample
+  std::vector<Candidate> candidates;
+  for (const auto& path : regionTmpVector) {
     std::shared_ptr<Region> rptr;
-    m_cacheImpl->getRegion(str.c_str(), rptr);
-    if (rptr != nullptr) {
-      RegionInternal* rimpl = dynamic_cast<RegionInternal*>(rptr.get());
-      if (rimpl != nullptr) {
-        rimpl->evict(percentage);
-      }
+    m_cacheImpl->getRegion(path.c_str(), rptr);
+    auto rimpl = dynamic_cast<RegionInternal*>(rptr.get());
+    Candidate candidate{rptr, 0, 0};
+    if (rimpl != nullptr &&
+        rimpl->sampleLRU(candidate.lastAccess, candidate.entrySize)) {
+      candidates.push_back(candidate);
+    }
+  }
+
+  auto now = getClock();
+  int64_t evicted = 0;
+  while (evicted < bytes && !candidates.empty()) {
+    auto victim = selectVictim(candidates, now);
+    auto& candidate = candidates[victim];
+    auto rimpl = static_cast<RegionInternal*>(candidate.region.get());
+    int64_t freed = rimpl->evict(std::min(
+        bytes - evicted, candidate.entrySize * EVICTION_BATCH));
+    evicted += freed;
+    if (freed <= 0 ||
+        !rimpl->sampleLRU(candidate.lastAccess, candidate.entrySize)) {
+      candidates.erase(candidates.begin() + victim);
     }
   }
+  LOGFINE("Heap LRU evicted %lld of %lld bytes",
+          static_cast<long long>(evicted), static_cast<long long>(bytes));
 }
 }  // namespace client
 }  // namespace geode
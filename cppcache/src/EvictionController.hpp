@@ -20,54 +20,55 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include <ace/ACE.h>
 #include <ace/OS.h>
-#include <ace/Singleton.h>
-#include <ace/Thread_Mutex.h>
 #include <ace/Task.h>
-#include <geode/DataOutput.hpp>
+#include <ace/RW_Thread_Mutex.h>
+
+#include <geode/geode_globals.hpp>
+
 #include "util/Log.hpp"
-#include <memory>
-#include "IntQueue.hpp"
-#include "EvictionThread.hpp"
-#include <string>
-#include <vector>
 
 /**
  * This class ensures that the cache consumes only as much memory as
- * specified by the heap-lru-limit. Every region that is created in the
- * system registers with the EvictionController. Everytime there is any
- * activity that changes the memory usage in the region, it puts a message
- * into a queue that the EvictionController waits on. The message contains
- * the full region name, the total size of the region (inclusive of keys and
- * values) and the total number of entries.The EvictionController thread picks
- * up the message, updates the total memory size as well as the size of the
- * region in question. It determines whether memory usage is within limits.
- * If so, it goes back to waiting on the queue. If memory usage is out of bounds
- * it does the following.
- *  1> Figures out the delta between specified and actual
- *  2> Determines the size percentage that needs to be evicted
- *  3> Determines the nmber of entries per region (based on size per entry) that
-       needs to be evicted. This is a slice of the total eviction that is
- needed.
-    4> Invokes a method on each region to trigger eviction of entries.The evict
-       method on the region will return the total size evicted for the entries.
-    5> Goes back and checks queue size and recalculates the heap size usage
+ * specified by the heap-lru-limit. Every region with heap LRU registers with
+ * the EvictionController. Every time an operation changes the memory used by
+ * a region, the change is added to a counter of the thread's own; a thread
+ * passes its changes on to the heap size only once they add up to a batch,
+ * so operations do not contend on, or queue messages for, a shared counter.
  *
+ * The EvictionController thread gathers the batches on a short period, or
+ * as soon as a batch takes the heap size over the limit. When over the
+ * limit, it frees the overflow plus heap-lru-delta percent of the heap,
+ * choosing where to evict from across all the regions rather than taking
+ * the same share from each:
+ *  1> Each region reports the access time of the least recently used of a
+ *     few entries at the head of its LRU list, and its average entry size.
+ *  2> The region whose sampled entries have gone unused the longest, weighed
+ *     by their size, evicts a batch of entries.
+ *  3> That region is sampled again, and this repeats until enough has been
+ *     freed.
+ * Access times are ticks of a clock the EvictionController advances on each
+ * period, and are stamped on entries as they are created, updated or read.
  *
- * When a region is destroyed, it deregisters itself with the EvictionController
- * Format of object that is put into the region map (int size, int numEntries)
+ * When a region is destroyed, it deregisters itself with the
+ * EvictionController.
  */
 namespace apache {
 namespace geode {
 namespace client {
 
-typedef IntQueue<int64_t> HeapSizeInfoQueue;
 typedef std::vector<std::string> VectorOfString;
 
-class EvictionController;
-class EvictionThread;
 class CacheImpl;
+class Region;
 
 class CPPCACHE_EXPORT EvictionController : public ACE_Task_Base {
  public:
@@ -78,17 +79,18 @@ class CPPCACHE_EXPORT EvictionController : public ACE_Task_Base {
 
   inline void start() {
     m_run = true;
-    evictionThreadPtr->start();
     this->activate();
     LOGFINE("Eviction Controller started");
   }
 
   inline void stop() {
-    m_run = false;
-    evictionThreadPtr->stop();
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_run = false;
+    }
+    m_condition.notify_one();
     this->wait();
     m_regions.clear();
-    m_queue.clear();
 
     LOGFINE("Eviction controller stopped");
   }
@@ -96,24 +98,61 @@ class CPPCACHE_EXPORT EvictionController : public ACE_Task_Base {
   int svc(void);
 
   void updateRegionHeapInfo(int64_t info);
-  void registerRegion(std::string& name);
-  void deregisterRegion(std::string& name);
-  void evict(int32_t percentage);
+  void registerRegion(const std::string& fullPath);
+  void deregisterRegion(const std::string& fullPath);
 
- private:
-  void orderEvictions(int32_t percentage);
-  void processHeapInfo(int64_t& readInfo, int64_t& pendingEvictions);
+  /** Evicts entries across the registered regions to free the bytes. */
+  void evict(int64_t bytes);
+
+  /** Returns the tick of the clock stamped on entries when accessed. */
+  inline uint32_t getClock() const {
+    return m_clock.load(std::memory_order_relaxed);
+  }
+
+  /** The most entries a region evicts at a time before it is sampled again. */
+  static const int32_t EVICTION_BATCH = 32;
+
+  /** A region to evict from, as last sampled. */
+  struct Candidate {
+    std::shared_ptr<Region> region;
+    uint32_t lastAccess;
+    int64_t entrySize;
+  };
+
+  /**
+   * Returns the index of the candidate whose sampled entries have gone
+   * unused the longest at the tick <code>now</code>, weighed by their size.
+   * There must be at least one candidate.
+   */
+  static size_t selectVictim(const std::vector<Candidate>& candidates,
+                             uint32_t now);
 
  private:
+  // a thread's changes to the heap size not yet added to the total, kept
+  // on a cache line of its own
+  struct alignas(64) PendingDelta {
+    std::atomic<int64_t> bytes;
+  };
+
+  static const int64_t DELTA_BATCH = 64 * 1024;
+  static const size_t DELTA_STRIPES = 16;
+  static const int32_t CLOCK_TICK_MILLIS = 100;
+
+  void collectHeapDeltas();
+  void checkHeapSize();
+
   bool m_run;
+  bool m_overLimit;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
   int64_t m_maxHeapSize;
   int64_t m_heapSizeDelta;
   CacheImpl* m_cacheImpl;
-  int64_t m_currentHeapSize;
-  HeapSizeInfoQueue m_queue;
+  std::atomic<int64_t> m_currentHeapSize;
+  PendingDelta m_pendingDeltas[DELTA_STRIPES];
+  std::atomic<uint32_t> m_clock;
   VectorOfString m_regions;
   mutable ACE_RW_Thread_Mutex m_regionLock;
-  EvictionThread* evictionThreadPtr;
   static const char* NC_EC_Thread;
 };
 }  // namespace client
@@ -25,6 +25,50 @@
 #include "ThinClientPoolDM.hpp"
 #include "NoResult.hpp"
 #include "UserAttributes.hpp"
+#include "CacheImpl.hpp"
+#include "Utils.hpp"
+
+namespace {
+
+/**
+ * Records the time spent in a function execution in the statistics of the
+ * pool it runs on when time statistics are enabled. An execution on a region
+ * runs on the pool of the region.
+ */
+class FunctionExecutionTimer {
+ public:
+  FunctionExecutionTimer(const std::shared_ptr<Pool>& pool,
+                         const std::shared_ptr<Region>& region)
+      : m_poolDM(dynamic_cast<ThinClientPoolDM*>(pool.get())), m_start(0) {
+    if (m_poolDM == nullptr) {
+      if (auto tcRegion = dynamic_cast<ThinClientRegion*>(region.get())) {
+        m_poolDM = dynamic_cast<ThinClientPoolDM*>(tcRegion->getDistMgr());
+      }
+    }
+    if (m_poolDM != nullptr && m_poolDM->getConnectionManager()
+                                   .getCacheImpl()
+                                   ->getDistributedSystem()
+                                   .getSystemProperties()
+                                   .getEnableTimeStatistics()) {
+      m_start = Utils::startStatOpTime();
+    } else {
+      m_poolDM = nullptr;
+    }
+  }
+
+  ~FunctionExecutionTimer() {
+    if (m_poolDM != nullptr) {
+      m_poolDM->getStats().recordFunctionExecutionLatency(
+          Utils::startStatOpTime() - m_start);
+    }
+  }
+
+ private:
+  ThinClientPoolDM* m_poolDM;
+  int64_t m_start;
+};
+
+}  // namespace
 
 FunctionToFunctionAttributes ExecutionImpl::m_func_attrs;
 ACE_Recursive_Thread_Mutex ExecutionImpl::m_func_attrs_lock;
@@ -87,6 +131,7 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
     const char* fn, std::chrono::milliseconds timeout) {
   std::string func = fn;
   LOGDEBUG("ExecutionImpl::execute: ");
+  FunctionExecutionTimer executionTimer(m_pool, m_region);
   GuardUserAttribures gua;
   if (m_proxyCache != nullptr) {
     LOGDEBUG("ExecutionImpl::execute function on proxy cache");
@@ -22,14 +22,13 @@ namespace apache {
 namespace geode {
 namespace client {
 
-void ExpEntryFactory::newMapEntry(ExpiryTaskManager* expiryTaskManager,
+void ExpEntryFactory::newMapEntry(SlabArena* arena,
                                   const std::shared_ptr<CacheableKey>& key,
                                   std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result =
-        MapEntryT<VersionedExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result = MapEntryT<VersionedExpMapEntry, 0, 0>::create(arena, key);
   } else {
-    result = MapEntryT<ExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result = MapEntryT<ExpMapEntry, 0, 0>::create(arena, key);
   }
 }
 
@@ -38,9 +38,10 @@ class CPPCACHE_EXPORT ExpMapEntry : public MapEntryImpl,
 
   virtual ExpEntryProperties& getExpProperties() { return *this; }
 
-  virtual void cleanup(const CacheEventFlags eventFlags) {
+  virtual void cleanup(const CacheEventFlags eventFlags,
+                       ExpiryTaskManager& expiryTaskManager) {
     if (!eventFlags.isExpiration()) {
-      cancelExpiryTaskId(m_key);
+      cancelExpiryTaskId(m_key, expiryTaskManager);
     }
   }
 
@@ -49,9 +50,8 @@ class CPPCACHE_EXPORT ExpMapEntry : public MapEntryImpl,
   inline explicit ExpMapEntry(bool noInit)
       : MapEntryImpl(true), ExpEntryProperties(true) {}
 
-  inline ExpMapEntry(ExpiryTaskManager* expiryTaskManager,
-                     const std::shared_ptr<CacheableKey>& key)
-      : MapEntryImpl(key), ExpEntryProperties(expiryTaskManager) {}
+  inline ExpMapEntry(const std::shared_ptr<CacheableKey>& key)
+      : MapEntryImpl(key), ExpEntryProperties() {}
 
  private:
   // disabled
@@ -69,9 +69,8 @@ class CPPCACHE_EXPORT VersionedExpMapEntry : public ExpMapEntry,
  protected:
   inline explicit VersionedExpMapEntry(bool noInit) : ExpMapEntry(true) {}
 
-  inline VersionedExpMapEntry(ExpiryTaskManager* expiryTaskManager,
-                              const std::shared_ptr<CacheableKey>& key)
-      : ExpMapEntry(expiryTaskManager, key) {}
+  inline VersionedExpMapEntry(const std::shared_ptr<CacheableKey>& key)
+      : ExpMapEntry(key) {}
 
  private:
   // disabled
@@ -85,9 +84,11 @@ class CPPCACHE_EXPORT ExpEntryFactory : public EntryFactory {
 
   virtual ~ExpEntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  virtual void newMapEntry(SlabArena* arena,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
+
+  virtual bool withExpiry() const { return true; }
 };
 }  // namespace client
 }  // namespace geode
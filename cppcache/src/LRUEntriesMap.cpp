@@ -19,6 +19,7 @@
 #include "ExpiryTaskManager.hpp"
 #include "MapSegment.hpp"
 #include "CacheImpl.hpp"
+#include "EvictionController.hpp"
 
 #include <mutex>
 #include "util/concurrent/spinlock_mutex.hpp"
@@ -72,7 +73,7 @@ LRUEntriesMap::LRUEntriesMap(ExpiryTaskManager* expiryTaskManager,
   // translate action type to an instance.
   if (region) {
     m_action = LRUAction::newLRUAction(lruAction, region, this);
-    m_name = region->getName();
+    m_name = region->getFullPath();
     CacheImpl* cImpl = region->getCacheImpl();
     if (cImpl != nullptr) {
       m_evictionControllerPtr = cImpl->getEvictionController();
@@ -102,6 +103,12 @@ void LRUEntriesMap::clear() {
 
 LRUEntriesMap::~LRUEntriesMap() { delete m_action; }
 
+inline void LRUEntriesMap::touch(LRUEntryProperties& lruProps) const {
+  if (m_evictionControllerPtr != nullptr) {
+    lruProps.setLastAccess(m_evictionControllerPtr->getClock());
+  }
+}
+
 /**
  * @brief put an item in the map... if it is a new entry, then the LRU may
  * need to be consulted.
@@ -135,6 +142,7 @@ GfErrType LRUEntriesMap::create(const std::shared_ptr<CacheableKey>& key,
     if (mePtr == nullptr) {
       return err;
     }
+    touch(mePtr->getLRUProperties());
     m_lruList.appendEntry(mePtr);
     me = mePtr;
   }
@@ -182,17 +190,46 @@ GfErrType LRUEntriesMap::evictionHelper() {
   return err;
 }
 
-void LRUEntriesMap::processLRU(int32_t numEntriesToEvict) {
-  int32_t evicted = 0;
-  for (int32_t i = 0; i < numEntriesToEvict; i++) {
-    if (m_validEntries > 0 && size() > 0) {
-      if (evictionHelper() == GF_NOERR) {
-        evicted++;
-      }
-    } else {
+int64_t LRUEntriesMap::evictBytes(int64_t bytes, int32_t& entries) {
+  // the map size falls as each entry is evicted; other threads changing it
+  // meanwhile only make the count approximate
+  int64_t startSize = getCurrentMapSize();
+  int64_t freed = 0;
+  entries = 0;
+  while (freed < bytes && entries < EvictionController::EVICTION_BATCH &&
+         m_validEntries > 0 && size() > 0) {
+    if (evictionHelper() != GF_NOERR) {
       break;
     }
+    ++entries;
+    freed = startSize - getCurrentMapSize();
   }
+  return freed;
+}
+
+bool LRUEntriesMap::sampleLRU(uint32_t& lastAccess, int64_t& entrySize) {
+  if (m_validEntries == 0 || !m_lruList.sampleHead(lastAccess, LRU_SAMPLES)) {
+    return false;
+  }
+  uint32_t entries = size();
+  int64_t mapSize = getCurrentMapSize();
+  entrySize = entries > 0 && mapSize > 0 ? mapSize / entries : 1;
+  return true;
+}
+
+void LRUEntriesMap::addMemoryFootprint(
+    RegionMemoryFootprint& footprint) const {
+  ConcurrentEntriesMap::addMemoryFootprint(footprint);
+  footprint.m_lruListBytes += m_lruList.getNodeBytes();
+  if (m_heapLRUEnabled) {
+    std::lock_guard<spinlock_mutex> __guard(m_mapInfoLock);
+    footprint.m_heapLRUEstimateBytes += m_currentMapSize;
+  }
+}
+
+int64_t LRUEntriesMap::getCurrentMapSize() {
+  std::lock_guard<spinlock_mutex> __guard(m_mapInfoLock);
+  return m_currentMapSize;
 }
 
 GfErrType LRUEntriesMap::invalidate(const std::shared_ptr<CacheableKey>& key,
@@ -332,6 +369,9 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
         me = mePtr;
       }
     }
+    if (me != nullptr) {
+      touch(me->getLRUProperties());
+    }
   }
   if (m_evictionControllerPtr != nullptr) {
     int64_t newSize =
@@ -433,6 +473,7 @@ bool LRUEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
     me = mePtr;
     // lruProps.clearEvicted();
     lruProps.setRecentlyUsed();
+    touch(lruProps);
     if (doProcessLRU) {
       GfErrType IsProcessLru = processLRU();
       if ((IsProcessLru != GF_NOERR)) {
@@ -67,11 +67,13 @@ class CPPCACHE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap,
   std::shared_ptr<PersistenceManager> m_pmPtr;
   EvictionController* m_evictionControllerPtr;
   int64_t m_currentMapSize;
-  spinlock_mutex m_mapInfoLock;
+  mutable spinlock_mutex m_mapInfoLock;
   std::string m_name;
   std::atomic<uint32_t> m_validEntries;
   bool m_heapLRUEnabled;
 
+  static const int32_t LRU_SAMPLES = 8;
+
  public:
   LRUEntriesMap(ExpiryTaskManager* expiryTaskManager,
                 std::unique_ptr<EntryFactory> entryFactory,
@@ -89,6 +91,10 @@ class CPPCACHE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap,
                         std::shared_ptr<VersionTag> versionTag,
                         bool& isUpdate = EntriesMap::boolVal,
                         DataInput* delta = nullptr);
+  /** @brief put the values one at a time, to keep the LRU list in order. */
+  virtual void putBatch(BatchPutEntries& entries, int destroyTracker) {
+    EntriesMap::putBatch(entries, destroyTracker);
+  }
   virtual GfErrType invalidate(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& me,
                                std::shared_ptr<Cacheable>& oldValue,
@@ -106,9 +112,29 @@ class CPPCACHE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap,
       const std::shared_ptr<CacheableKey>& key,
       std::shared_ptr<MapEntryImpl>& me) const;
   GfErrType processLRU();
-  void processLRU(int32_t numEntriesToEvict);
   GfErrType evictionHelper();
   void updateMapSize(int64_t size);
+  int64_t getCurrentMapSize();
+
+  /**
+   * @brief for heap LRU, evicts entries until at least <code>bytes</code>
+   * have been freed or EvictionController::EVICTION_BATCH entries have been
+   * evicted. Returns the bytes freed and sets <code>entries</code> to the
+   * entries evicted.
+   */
+  int64_t evictBytes(int64_t bytes, int32_t& entries);
+
+  /**
+   * @brief for heap LRU, samples the entries at the head of the LRU list;
+   * see RegionInternal::sampleLRU.
+   */
+  bool sampleLRU(uint32_t& lastAccess, int64_t& entrySize);
+
+  /**
+   * @brief adds the LRU list and, for heap LRU, the size of the map as
+   * tracked for eviction.
+   */
+  virtual void addMemoryFootprint(RegionMemoryFootprint& footprint) const;
   inline void setPersistenceManager(
       std::shared_ptr<PersistenceManager>& pmPtr) {
     m_pmPtr = pmPtr;
@@ -141,6 +167,9 @@ class CPPCACHE_EXPORT LRUEntriesMap : public ConcurrentEntriesMap,
 
   inline uint32_t validEntriesSize() const { return m_validEntries; }
 
+  /** @brief stamps the entry with the heap LRU clock, if there is one. */
+  void touch(LRUEntryProperties& lruProps) const;
+
   inline void adjustLimit(uint32_t limit) { m_limit = limit; }
 
   virtual void clear();
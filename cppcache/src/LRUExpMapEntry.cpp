@@ -23,14 +23,12 @@ namespace geode {
 namespace client {
 
 void LRUExpEntryFactory::newMapEntry(
-    ExpiryTaskManager* expiryTaskManager,
-    const std::shared_ptr<CacheableKey>& key,
+    SlabArena* arena, const std::shared_ptr<CacheableKey>& key,
     std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result = MapEntryT<VersionedLRUExpMapEntry, 0, 0>::create(expiryTaskManager,
-                                                              key);
+    result = MapEntryT<VersionedLRUExpMapEntry, 0, 0>::create(arena, key);
   } else {
-    result = MapEntryT<LRUExpMapEntry, 0, 0>::create(expiryTaskManager, key);
+    result = MapEntryT<LRUExpMapEntry, 0, 0>::create(arena, key);
   }
 }
 
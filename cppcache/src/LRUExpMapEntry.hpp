@@ -41,9 +41,10 @@ class CPPCACHE_EXPORT LRUExpMapEntry : public MapEntryImpl,
 
   virtual ExpEntryProperties& getExpProperties() { return *this; }
 
-  virtual void cleanup(const CacheEventFlags eventFlags) {
+  virtual void cleanup(const CacheEventFlags eventFlags,
+                       ExpiryTaskManager& expiryTaskManager) {
     if (!eventFlags.isExpiration()) {
-      cancelExpiryTaskId(m_key);
+      cancelExpiryTaskId(m_key, expiryTaskManager);
     }
   }
 
@@ -53,9 +54,8 @@ class CPPCACHE_EXPORT LRUExpMapEntry : public MapEntryImpl,
         LRUEntryProperties(true),
         ExpEntryProperties(true) {}
 
-  inline LRUExpMapEntry(ExpiryTaskManager* expiryTaskManager,
-                        const std::shared_ptr<CacheableKey>& key)
-      : MapEntryImpl(key), ExpEntryProperties(expiryTaskManager) {}
+  inline LRUExpMapEntry(const std::shared_ptr<CacheableKey>& key)
+      : MapEntryImpl(key), ExpEntryProperties() {}
 
  private:
   // disabled
@@ -73,9 +73,8 @@ class CPPCACHE_EXPORT VersionedLRUExpMapEntry : public LRUExpMapEntry,
  protected:
   inline explicit VersionedLRUExpMapEntry(bool noInit) : LRUExpMapEntry(true) {}
 
-  inline VersionedLRUExpMapEntry(ExpiryTaskManager* expiryTaskManager,
-                                 const std::shared_ptr<CacheableKey>& key)
-      : LRUExpMapEntry(expiryTaskManager, key) {}
+  inline VersionedLRUExpMapEntry(const std::shared_ptr<CacheableKey>& key)
+      : LRUExpMapEntry(key) {}
 
  private:
   // disabled
@@ -89,9 +88,11 @@ class CPPCACHE_EXPORT LRUExpEntryFactory : public EntryFactory {
 
   virtual ~LRUExpEntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  virtual void newMapEntry(SlabArena* arena,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
+
+  virtual bool withExpiry() const { return true; }
 };
 }  // namespace client
 }  // namespace geode
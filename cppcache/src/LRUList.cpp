@@ -26,7 +26,8 @@ namespace client {
 using util::concurrent::spinlock_mutex;
 
 template <typename TEntry, typename TCreateEntry>
-LRUList<TEntry, TCreateEntry>::LRUList() : m_headLock(), m_tailLock() {
+LRUList<TEntry, TCreateEntry>::LRUList()
+    : m_headLock(), m_tailLock(), m_nodes(1) {
   std::shared_ptr<TEntry> headEntry(TCreateEntry::create(nullptr));
   headEntry->getLRUProperties().setEvicted();  // create empty evicted entry.
   m_headNode = new LRUListNode(headEntry);
@@ -50,6 +51,7 @@ void LRUList<TEntry, TCreateEntry>::appendEntry(
   std::lock_guard<spinlock_mutex> lk(m_tailLock);
 
   LRUListNode* aNode = new LRUListNode(entry);
+  m_nodes.fetch_add(1, std::memory_order_relaxed);
   m_tailNode->setNextLRUListNode(aNode);
   m_tailNode = aNode;
 }
@@ -89,16 +91,51 @@ void LRUList<TEntry, TCreateEntry>::getLRUEntry(
         appendNode(aNode);
         // now try again.
       } else {
-        delete aNode;
+        deleteNode(aNode);
         break;  // found unused entry
       }
     } else {
       result = nullptr;  // remove the reference to entry
-      delete aNode;      // drop the entry to the floor ...
+      deleteNode(aNode);  // drop the entry to the floor ...
     }
   }
 }
 
+template <typename TEntry, typename TCreateEntry>
+void LRUList<TEntry, TCreateEntry>::deleteNode(LRUListNode* aNode) {
+  m_nodes.fetch_sub(1, std::memory_order_relaxed);
+  delete aNode;
+}
+
+template <typename TEntry, typename TCreateEntry>
+bool LRUList<TEntry, TCreateEntry>::sampleHead(uint32_t& lastAccess,
+                                               int32_t samples) {
+  std::lock_guard<spinlock_mutex> lk(m_headLock);
+  std::lock_guard<spinlock_mutex> tailLk(m_tailLock);
+
+  bool found = false;
+  std::shared_ptr<TEntry> entry;
+  // evicted entries yet to be dropped are skipped, but only so many
+  int32_t visits = samples * 4;
+  for (LRUListNode* aNode = m_headNode;
+       aNode != nullptr && samples > 0 && visits-- > 0;
+       aNode = aNode->getNextLRUListNode()) {
+    aNode->getEntry(entry);
+    const LRUEntryProperties& lruProps = entry->getLRUProperties();
+    if (lruProps.testEvicted()) {
+      continue;
+    }
+    uint32_t tick = lruProps.getLastAccess();
+    // ticks wrap around, so the older of two is the one further behind
+    if (!found || static_cast<int32_t>(tick - lastAccess) < 0) {
+      lastAccess = tick;
+      found = true;
+    }
+    --samples;
+  }
+  return found;
+}
+
 template <typename TEntry, typename TCreateEntry>
 typename LRUList<TEntry, TCreateEntry>::LRUListNode*
 LRUList<TEntry, TCreateEntry>::getHeadNode(bool& isLast) {
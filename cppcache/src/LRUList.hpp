@@ -41,7 +41,8 @@ namespace client {
  */
 class CPPCACHE_EXPORT LRUEntryProperties {
  public:
-  inline LRUEntryProperties() : m_bits(0), m_persistenceInfo(nullptr) {}
+  inline LRUEntryProperties()
+      : m_bits(0), m_lastAccess(0), m_persistenceInfo(nullptr) {}
 
   inline void setRecentlyUsed() { m_bits |= RECENTLY_USED_BITS; }
 
@@ -59,6 +60,15 @@ class CPPCACHE_EXPORT LRUEntryProperties {
 
   inline void clearEvicted() { m_bits &= ~EVICTED_BITS; }
 
+  /** Records the clock tick of the last access, for heap LRU. */
+  inline void setLastAccess(uint32_t tick) {
+    m_lastAccess.store(tick, std::memory_order_relaxed);
+  }
+
+  inline uint32_t getLastAccess() const {
+    return m_lastAccess.load(std::memory_order_relaxed);
+  }
+
   inline void* getPersistenceInfo() const { return m_persistenceInfo; }
 
   inline void setPersistenceInfo(void* persistenceInfo) {
@@ -71,6 +81,8 @@ class CPPCACHE_EXPORT LRUEntryProperties {
 
  private:
   std::atomic<uint32_t> m_bits;
+  // takes the padding after m_bits on 64-bit platforms
+  std::atomic<uint32_t> m_lastAccess;
   void* m_persistenceInfo;
 };
 
@@ -130,6 +142,18 @@ class LRUList {
    */
   void getLRUEntry(std::shared_ptr<TEntry>& result);
 
+  /**
+   * @brief looks at up to <code>samples</code> entries at the head of the
+   * list and sets <code>lastAccess</code> to the least recent access among
+   * those not evicted. Returns false if there are none.
+   */
+  bool sampleHead(uint32_t& lastAccess, int32_t samples);
+
+  /** @brief return the bytes taken by the nodes of the list. */
+  inline size_t getNodeBytes() const {
+    return m_nodes.load(std::memory_order_relaxed) * sizeof(LRUListNode);
+  }
+
  private:
   /**
    * @brief add a node to the tail of the list.
@@ -142,11 +166,18 @@ class LRUList {
    */
   LRUListNode* getHeadNode(bool& isLast);
 
+  /**
+   * @brief delete a node taken off the list.
+   */
+  void deleteNode(LRUListNode* aNode);
+
   spinlock_mutex m_headLock;
   spinlock_mutex m_tailLock;
 
   LRUListNode* m_headNode;
   LRUListNode* m_tailNode;
+  // nodes are counted rather than the list walked to size it
+  std::atomic<size_t> m_nodes;
 
 };  // LRUList
 }  // namespace client
@@ -22,13 +22,13 @@ namespace apache {
 namespace geode {
 namespace client {
 
-void LRUEntryFactory::newMapEntry(ExpiryTaskManager* expiryTaskManager,
+void LRUEntryFactory::newMapEntry(SlabArena* arena,
                                   const std::shared_ptr<CacheableKey>& key,
                                   std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result = MapEntryT<VersionedLRUMapEntry, 0, 0>::create(key);
+    result = MapEntryT<VersionedLRUMapEntry, 0, 0>::create(arena, key);
   } else {
-    result = MapEntryT<LRUMapEntry, 0, 0>::create(key);
+    result = MapEntryT<LRUMapEntry, 0, 0>::create(arena, key);
   }
 }
 
@@ -66,7 +66,8 @@ class CPPCACHE_EXPORT LRUMapEntry : public MapEntryImpl,
 
   virtual LRUEntryProperties& getLRUProperties() { return *this; }
 
-  virtual void cleanup(const CacheEventFlags eventFlags) {
+  virtual void cleanup(const CacheEventFlags eventFlags,
+                       ExpiryTaskManager& expiryTaskManager) {
     if (!eventFlags.isEviction()) {
       // TODO:  this needs an implementation of doubly-linked list
       // to remove from the list; also add this to LRUExpMapEntry since MI
@@ -111,7 +112,7 @@ class CPPCACHE_EXPORT LRUEntryFactory : public EntryFactory {
 
   virtual ~LRUEntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  virtual void newMapEntry(SlabArena* arena,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
 };
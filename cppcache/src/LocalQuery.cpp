@@ -0,0 +1,294 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "LocalQuery.hpp"
+#include "CacheImpl.hpp"
+#include "LocalRegion.hpp"
+#include "ResultSetImpl.hpp"
+#include "StructSetImpl.hpp"
+#include "QueryResultStreamImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+// the scan checks for the timeout and the limit after this many entries
+const uint32_t CHECK_INTERVAL = 256;
+}  // namespace
+
+LocalQuery::LocalQuery(const char* querystr, CacheImpl* cache)
+    : m_queryString(querystr != nullptr ? querystr : ""), m_cache(cache) {}
+
+std::shared_ptr<SelectResults> LocalQuery::execute(
+    std::chrono::milliseconds timeout) {
+  return execute(nullptr, timeout);
+}
+
+std::shared_ptr<SelectResults> LocalQuery::execute(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout) {
+  std::shared_ptr<const LocalQueryPlan> plan;
+  auto rows = run(paramList, timeout, plan);
+
+  const auto& projections = plan->getProjections();
+  auto values = CacheableVector::create();
+  values->reserve(rows.size() * projections.size());
+  for (const auto& row : rows) {
+    for (const auto& projection : projections) {
+      values->push_back(project(projection, row));
+    }
+  }
+  if (!plan->selectsStruct()) {
+    return std::make_shared<ResultSetImpl>(values);
+  }
+  std::vector<std::shared_ptr<CacheableString>> fieldNames;
+  for (const auto& projection : projections) {
+    fieldNames.push_back(CacheableString::create(projection.name.c_str()));
+  }
+  return std::make_shared<StructSetImpl>(values, fieldNames);
+}
+
+std::shared_ptr<QueryResultStream> LocalQuery::stream(
+    std::chrono::milliseconds timeout, size_t capacity) {
+  return stream(nullptr, timeout, capacity);
+}
+
+std::shared_ptr<QueryResultStream> LocalQuery::stream(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout, size_t capacity) {
+  auto resultStream = std::make_shared<QueryResultStreamImpl>(capacity);
+  auto query = shared_from_this();
+  auto streamPtr = resultStream.get();
+  // the stream joins the thread before it goes away
+  resultStream->start([query, streamPtr, timeout, paramList]() {
+    std::shared_ptr<const LocalQueryPlan> plan;
+    auto rows = query->run(paramList, timeout, plan);
+    const auto& projections = plan->getProjections();
+    if (plan->selectsStruct()) {
+      std::vector<std::shared_ptr<CacheableString>> fieldNames;
+      for (const auto& projection : projections) {
+        fieldNames.push_back(CacheableString::create(projection.name.c_str()));
+      }
+      streamPtr->setFieldNames(fieldNames);
+    }
+    for (const auto& row : rows) {
+      for (const auto& projection : projections) {
+        streamPtr->add(project(projection, row));
+      }
+    }
+  });
+  return resultStream;
+}
+
+const char* LocalQuery::getQueryString() const {
+  return m_queryString.c_str();
+}
+
+void LocalQuery::compile() { getPlan(); }
+
+bool LocalQuery::isCompiled() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_plan != nullptr;
+}
+
+std::shared_ptr<const LocalQueryPlan> LocalQuery::getPlan() {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_plan == nullptr) {
+    m_plan = std::make_shared<LocalQueryPlan>(m_queryString);
+  }
+  return m_plan;
+}
+
+std::vector<LocalQueryRow> LocalQuery::run(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout,
+    std::shared_ptr<const LocalQueryPlan>& plan) {
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  plan = getPlan();
+
+  std::shared_ptr<Region> region;
+  m_cache->getRegion(plan->getRegionPath().c_str(), region);
+  auto localRegion = std::dynamic_pointer_cast<LocalRegion>(region);
+  if (localRegion == nullptr) {
+    throw QueryException("Region " + plan->getRegionPath() +
+                         " not found for local query");
+  }
+  if (!localRegion->getAttributes()->getCachingEnabled()) {
+    throw QueryException("Region " + plan->getRegionPath() +
+                         " does not cache entries and cannot be queried "
+                         "locally");
+  }
+
+  std::vector<LocalQueryValue> params;
+  if (paramList != nullptr) {
+    for (const auto& param : *paramList) {
+      params.push_back(LocalQueryValue::fromCacheable(param));
+    }
+  }
+  if (params.size() < plan->getParameterCount()) {
+    throw QueryException("Local query expects " +
+                         std::to_string(plan->getParameterCount()) +
+                         " parameters but was given " +
+                         std::to_string(params.size()));
+  }
+
+  std::vector<LocalQueryRow> rows;
+  if (!fetchIndexed(*localRegion, *plan, params, rows)) {
+    scan(*localRegion, *plan, params, deadline, rows);
+  }
+
+  if (!plan->getOrderings().empty()) {
+    const auto& ordering = *plan;
+    std::stable_sort(rows.begin(), rows.end(),
+                     [&ordering](const LocalQueryRow& a,
+                                 const LocalQueryRow& b) {
+                       return ordering.orderedBefore(a, b);
+                     });
+  }
+  auto limit = plan->getLimit();
+  if (limit >= 0 && rows.size() > static_cast<size_t>(limit)) {
+    rows.resize(static_cast<size_t>(limit));
+  }
+  return rows;
+}
+
+bool LocalQuery::fetchIndexed(LocalRegion& region, const LocalQueryPlan& plan,
+                              const std::vector<LocalQueryValue>& params,
+                              std::vector<LocalQueryRow>& rows) {
+  auto indexes = region.getQueryIndexes();
+  if (indexes.empty() || plan.getCondition() == nullptr) {
+    return false;
+  }
+
+  // only comparisons every matching row has to satisfy can pick the rows
+  std::vector<const LocalQueryCondition*> conjuncts;
+  std::vector<const LocalQueryCondition*> pending(1, plan.getCondition());
+  while (!pending.empty()) {
+    auto condition = pending.back();
+    pending.pop_back();
+    if (condition->op == LocalQueryCondition::AND) {
+      pending.push_back(condition->right.get());
+      pending.push_back(condition->left.get());
+    } else if (condition->isComparison() &&
+               condition->op != LocalQueryCondition::NE) {
+      conjuncts.push_back(condition);
+    }
+  }
+
+  // equality narrows the rows the most, so it is tried first
+  for (int pass = 0; pass < 2; pass++) {
+    for (auto condition : conjuncts) {
+      if ((condition->op == LocalQueryCondition::EQ) != (pass == 0)) {
+        continue;
+      }
+      const LocalQueryOperand* field = &condition->lhs;
+      const LocalQueryOperand* constant = &condition->rhs;
+      auto op = condition->op;
+      if (field->kind != LocalQueryOperand::FIELD) {
+        std::swap(field, constant);
+        op = LocalQueryCondition::reverse(op);
+      }
+      if (field->kind != LocalQueryOperand::FIELD ||
+          (constant->kind != LocalQueryOperand::LITERAL &&
+           constant->kind != LocalQueryOperand::PARAMETER)) {
+        continue;
+      }
+      auto value = constant->evaluate(LocalQueryRow(), params);
+      if (value.isNull()) {
+        continue;
+      }
+      const auto& fieldName = plan.getFields()[field->index];
+      for (const auto& index : indexes) {
+        std::vector<std::shared_ptr<CacheableKey>> keys;
+        if (index->getFieldName() != fieldName ||
+            !index->lookup(op, value, keys)) {
+          continue;
+        }
+        KeyValuePairs entries;
+        region.getLocalEntries(keys, entries);
+        for (const auto& entry : entries) {
+          LocalQueryRow row;
+          row.key = entry.first;
+          row.value = entry.second;
+          plan.readFields(row);
+          // the index may be a step behind the entry, and the rest of the
+          // condition still has to hold
+          if (plan.matches(row, params)) {
+            rows.push_back(std::move(row));
+          }
+        }
+        LOGFINEST("LocalQuery: answered query [%s] from index %s",
+                  m_queryString.c_str(), index->getName().c_str());
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void LocalQuery::scan(LocalRegion& region, const LocalQueryPlan& plan,
+                      const std::vector<LocalQueryValue>& params,
+                      std::chrono::steady_clock::time_point deadline,
+                      std::vector<LocalQueryRow>& rows) {
+  // without an ORDER BY any rows will do, so the scan stops at the limit
+  int64_t limit = plan.getOrderings().empty() ? plan.getLimit() : -1;
+  std::atomic<int64_t> matched(0);
+  std::mutex rowsMutex;
+  region.parallelScan([&](RegionEntryCursor& cursor) {
+    std::vector<LocalQueryRow> found;
+    LocalQueryRow row;
+    uint32_t visited = 0;
+    while (cursor.next(row.key, row.value)) {
+      if (++visited % CHECK_INTERVAL == 0) {
+        if (std::chrono::steady_clock::now() > deadline) {
+          throw TimeoutException("Local query [" + m_queryString +
+                                 "] timed out");
+        }
+        if (limit >= 0 && matched.load() >= limit) {
+          break;
+        }
+      }
+      if (row.value == nullptr) {
+        continue;
+      }
+      plan.readFields(row);
+      if (plan.matches(row, params)) {
+        found.push_back(row);
+        if (++matched == limit) {
+          break;
+        }
+      }
+    }
+    std::lock_guard<std::mutex> guard(rowsMutex);
+    std::move(found.begin(), found.end(), std::back_inserter(rows));
+  });
+}
+
+std::shared_ptr<Cacheable> LocalQuery::project(
+    const LocalQueryPlan::Projection& projection, const LocalQueryRow& row) {
+  return projection.selectsValue ? row.value : row.fields[projection.field];
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
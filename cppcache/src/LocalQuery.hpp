@@ -0,0 +1,113 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_LOCALQUERY_H_
+#define GEODE_LOCALQUERY_H_
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/Query.hpp>
+#include <geode/SelectResults.hpp>
+
+#include "LocalQueryPlan.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+class LocalRegion;
+class QueryResultStreamImpl;
+
+/**
+ * A query run by a LocalQueryService against the entries cached by a region.
+ * The query string is parsed into a LocalQueryPlan when the query is compiled
+ * or first executed.
+ */
+class CPPCACHE_EXPORT LocalQuery
+    : public Query,
+      public std::enable_shared_from_this<LocalQuery> {
+ public:
+  LocalQuery(const char* querystr, CacheImpl* cache);
+
+  std::shared_ptr<SelectResults> execute(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  std::shared_ptr<SelectResults> execute(
+      std::shared_ptr<CacheableVector> paramList,
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  std::shared_ptr<QueryResultStream> stream(
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t capacity = QueryResultStream::DEFAULT_CAPACITY) override;
+
+  std::shared_ptr<QueryResultStream> stream(
+      std::shared_ptr<CacheableVector> paramList,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t capacity = QueryResultStream::DEFAULT_CAPACITY) override;
+
+  const char* getQueryString() const override;
+
+  void compile() override;
+
+  bool isCompiled() override;
+
+ private:
+  std::shared_ptr<const LocalQueryPlan> getPlan();
+
+  // the rows of the region that satisfy the query, ordered and limited
+  std::vector<LocalQueryRow> run(std::shared_ptr<CacheableVector> paramList,
+                                 std::chrono::milliseconds timeout,
+                                 std::shared_ptr<const LocalQueryPlan>& plan);
+
+  // fetches candidate entries through an index on a field the condition
+  // compares with a constant; returns false if no index applies
+  bool fetchIndexed(LocalRegion& region, const LocalQueryPlan& plan,
+                    const std::vector<LocalQueryValue>& params,
+                    std::vector<LocalQueryRow>& rows);
+
+  void scan(LocalRegion& region, const LocalQueryPlan& plan,
+            const std::vector<LocalQueryValue>& params,
+            std::chrono::steady_clock::time_point deadline,
+            std::vector<LocalQueryRow>& rows);
+
+  static std::shared_ptr<Cacheable> project(
+      const LocalQueryPlan::Projection& projection, const LocalQueryRow& row);
+
+  std::string m_queryString;
+  CacheImpl* m_cache;
+  std::mutex m_mutex;
+  std::shared_ptr<const LocalQueryPlan> m_plan;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALQUERY_H_
@@ -0,0 +1,169 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "LocalQueryIndex.hpp"
+#include "PdxFieldExtractor.hpp"
+#include "Utils.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+LocalQueryIndex::LocalQueryIndex(const std::string& name,
+                                 LocalQueryService::IndexType type,
+                                 const std::string& fieldName)
+    : m_name(name), m_type(type), m_fieldName(1, fieldName) {}
+
+bool LocalQueryIndex::indexes(const LocalQueryValue& value) const {
+  return m_type == LocalQueryService::HASH
+             ? value.isHashable()
+             : value.kind() != LocalQueryValue::OBJECT;
+}
+
+void LocalQueryIndex::refresh(const std::shared_ptr<CacheableKey>& key,
+                              const ValueReader& reader) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  refreshLocked(key, reader);
+}
+
+void LocalQueryIndex::refreshAll(const ValueReader& reader) {
+  std::lock_guard<std::mutex> guard(m_mutex);
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  keys.reserve(m_keyValues.size());
+  for (const auto& keyValue : m_keyValues) {
+    keys.push_back(keyValue.first);
+  }
+  for (const auto& key : keys) {
+    refreshLocked(key, reader);
+  }
+}
+
+void LocalQueryIndex::refreshLocked(const std::shared_ptr<CacheableKey>& key,
+                                    const ValueReader& reader) {
+  remove(key);
+  auto value = reader(key);
+  if (value == nullptr) {
+    return;
+  }
+  // the field of a value that is not PDX is null, as it is for queries
+  std::vector<std::shared_ptr<Cacheable>> field;
+  try {
+    PdxFieldExtractor::extract(value, m_fieldName, field);
+  } catch (const Exception& ex) {
+    LOGDEBUG("LocalQueryIndex: index %s skips key [%s]: %s", m_name.c_str(),
+             Utils::getCacheableKeyString(key)->asChar(), ex.what());
+    return;
+  }
+  auto indexed = LocalQueryValue::fromCacheable(field[0]);
+  if (!indexes(indexed)) {
+    return;
+  }
+  if (m_type == LocalQueryService::HASH) {
+    m_hashIndex[indexed].insert(key);
+  } else {
+    m_rangeIndex[indexed].insert(key);
+  }
+  m_keyValues.emplace(key, std::move(indexed));
+}
+
+void LocalQueryIndex::remove(const std::shared_ptr<CacheableKey>& key) {
+  auto keyValue = m_keyValues.find(key);
+  if (keyValue == m_keyValues.end()) {
+    return;
+  }
+  if (m_type == LocalQueryService::HASH) {
+    auto iter = m_hashIndex.find(keyValue->second);
+    iter->second.erase(key);
+    if (iter->second.empty()) {
+      m_hashIndex.erase(iter);
+    }
+  } else {
+    auto iter = m_rangeIndex.find(keyValue->second);
+    iter->second.erase(key);
+    if (iter->second.empty()) {
+      m_rangeIndex.erase(iter);
+    }
+  }
+  m_keyValues.erase(keyValue);
+}
+
+bool LocalQueryIndex::lookup(
+    LocalQueryCondition::Op op, const LocalQueryValue& value,
+    std::vector<std::shared_ptr<CacheableKey>>& keys) const {
+  if (!indexes(value)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> guard(m_mutex);
+  if (m_type == LocalQueryService::HASH) {
+    if (op != LocalQueryCondition::EQ) {
+      return false;
+    }
+    auto iter = m_hashIndex.find(value);
+    if (iter != m_hashIndex.end()) {
+      keys.insert(keys.end(), iter->second.begin(), iter->second.end());
+    }
+    return true;
+  }
+
+  // only values of the same kind as the bound are ordered with it, and
+  // they are next to each other in the index
+  auto add = [&keys](const KeySet& keySet) {
+    keys.insert(keys.end(), keySet.begin(), keySet.end());
+  };
+  switch (op) {
+    case LocalQueryCondition::EQ: {
+      auto range = m_rangeIndex.equal_range(value);
+      for (auto iter = range.first; iter != range.second; ++iter) {
+        add(iter->second);
+      }
+      return true;
+    }
+    case LocalQueryCondition::LT:
+    case LocalQueryCondition::LE: {
+      auto iter = op == LocalQueryCondition::LT
+                      ? m_rangeIndex.lower_bound(value)
+                      : m_rangeIndex.upper_bound(value);
+      while (iter != m_rangeIndex.begin()) {
+        --iter;
+        if (!iter->first.isOrderedWith(value)) {
+          break;
+        }
+        add(iter->second);
+      }
+      return true;
+    }
+    case LocalQueryCondition::GT:
+    case LocalQueryCondition::GE: {
+      auto iter = op == LocalQueryCondition::GT
+                      ? m_rangeIndex.upper_bound(value)
+                      : m_rangeIndex.lower_bound(value);
+      for (; iter != m_rangeIndex.end() && iter->first.isOrderedWith(value);
+           ++iter) {
+        add(iter->second);
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
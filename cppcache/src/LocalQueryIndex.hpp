@@ -0,0 +1,133 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LOCALQUERYINDEX_H_
+#define GEODE_LOCALQUERYINDEX_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/LocalQueryService.hpp>
+
+#include "LocalQueryPlan.hpp"
+#include "util/functional.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * A secondary index of a region for local queries, mapping the values of one
+ * field to the keys of the entries having them.
+ *
+ * The index is brought up to date for a key by re-reading the current value
+ * of the entry under the index lock, so updates of the same key racing each
+ * other always leave the index with the value the entry ended up with. An
+ * index may hold keys whose entry has gone or changed; queries check the
+ * entries they find through an index, so that only costs a lookup.
+ */
+class CPPCACHE_EXPORT LocalQueryIndex {
+ public:
+  /** Reads the current value of an entry; nullptr if there is none. */
+  typedef std::function<std::shared_ptr<Cacheable>(
+      const std::shared_ptr<CacheableKey>&)>
+      ValueReader;
+
+  LocalQueryIndex(const std::string& name, LocalQueryService::IndexType type,
+                  const std::string& fieldName);
+
+  inline const std::string& getName() const { return m_name; }
+
+  inline LocalQueryService::IndexType getType() const { return m_type; }
+
+  inline const std::string& getFieldName() const { return m_fieldName[0]; }
+
+  /** Indexes the current value of the entry for key. */
+  void refresh(const std::shared_ptr<CacheableKey>& key,
+               const ValueReader& reader);
+
+  /** Re-reads the value of every entry the index holds. */
+  void refreshAll(const ValueReader& reader);
+
+  /**
+   * Adds the keys of the entries whose field compares with value as op asks.
+   *
+   * @returns false if the index cannot answer the comparison
+   */
+  bool lookup(LocalQueryCondition::Op op, const LocalQueryValue& value,
+              std::vector<std::shared_ptr<CacheableKey>>& keys) const;
+
+ private:
+  typedef std::unordered_set<
+      std::shared_ptr<CacheableKey>,
+      dereference_hash<std::shared_ptr<CacheableKey>>,
+      dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      KeySet;
+
+  struct ValueHash {
+    size_t operator()(const LocalQueryValue& value) const {
+      return value.hash();
+    }
+  };
+
+  struct ValueEqual {
+    bool operator()(const LocalQueryValue& first,
+                    const LocalQueryValue& second) const {
+      return first.equals(second);
+    }
+  };
+
+  struct ValueLess {
+    bool operator()(const LocalQueryValue& first,
+                    const LocalQueryValue& second) const {
+      return first.compareTo(second) < 0;
+    }
+  };
+
+  void refreshLocked(const std::shared_ptr<CacheableKey>& key,
+                     const ValueReader& reader);
+  void remove(const std::shared_ptr<CacheableKey>& key);
+  bool indexes(const LocalQueryValue& value) const;
+
+  const std::string m_name;
+  const LocalQueryService::IndexType m_type;
+  const std::vector<std::string> m_fieldName;
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<LocalQueryValue, KeySet, ValueHash, ValueEqual>
+      m_hashIndex;
+  std::map<LocalQueryValue, KeySet, ValueLess> m_rangeIndex;
+  std::unordered_map<std::shared_ptr<CacheableKey>, LocalQueryValue,
+                     dereference_hash<std::shared_ptr<CacheableKey>>,
+                     dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      m_keyValues;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALQUERYINDEX_H_
@@ -0,0 +1,758 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <functional>
+
+#include <geode/CacheableDate.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/GeodeTypeIds.hpp>
+
+#include "LocalQueryPlan.hpp"
+#include "PdxFieldExtractor.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+std::string toUtf8(const wchar_t* value, uint32_t length) {
+  std::string result;
+  result.reserve(length);
+  for (uint32_t i = 0; i < length; i++) {
+    auto c = static_cast<uint32_t>(value[i]);
+    if (c < 0x80) {
+      result += static_cast<char>(c);
+    } else if (c < 0x800) {
+      result += static_cast<char>(0xC0 | (c >> 6));
+      result += static_cast<char>(0x80 | (c & 0x3F));
+    } else if (c < 0x10000) {
+      result += static_cast<char>(0xE0 | (c >> 12));
+      result += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+      result += static_cast<char>(0x80 | (c & 0x3F));
+    } else {
+      result += static_cast<char>(0xF0 | (c >> 18));
+      result += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+      result += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+      result += static_cast<char>(0x80 | (c & 0x3F));
+    }
+  }
+  return result;
+}
+
+template <typename T>
+int compareValues(const T& first, const T& second) {
+  return first < second ? -1 : (second < first ? 1 : 0);
+}
+
+}  // namespace
+
+LocalQueryValue LocalQueryValue::fromCacheable(
+    const std::shared_ptr<Cacheable>& value) {
+  if (value == nullptr) {
+    return LocalQueryValue();
+  }
+  switch (value->typeId()) {
+    case GeodeTypeIds::CacheableASCIIString:
+    case GeodeTypeIds::CacheableASCIIStringHuge:
+    case GeodeTypeIds::CacheableString:
+    case GeodeTypeIds::CacheableStringHuge: {
+      const auto& string = static_cast<const CacheableString&>(*value);
+      if (string.isWideString()) {
+        return fromString(toUtf8(string.asWChar(), string.length()));
+      }
+      return fromString(std::string(string.asChar(), string.length()));
+    }
+    case GeodeTypeIds::CacheableNullString:
+      return LocalQueryValue();
+    case GeodeTypeIds::CacheableBoolean:
+      return fromBoolean(static_cast<const CacheableBoolean&>(*value).value());
+    case GeodeTypeIds::CacheableByte:
+      // PDX bytes are signed
+      return fromInteger(static_cast<int8_t>(
+          static_cast<const CacheableByte&>(*value).value()));
+    case GeodeTypeIds::CacheableCharacter:
+      return fromInteger(
+          static_cast<const CacheableCharacter&>(*value).value());
+    case GeodeTypeIds::CacheableInt16:
+      return fromInteger(static_cast<const CacheableInt16&>(*value).value());
+    case GeodeTypeIds::CacheableInt32:
+      return fromInteger(static_cast<const CacheableInt32&>(*value).value());
+    case GeodeTypeIds::CacheableInt64:
+      return fromInteger(static_cast<const CacheableInt64&>(*value).value());
+    case GeodeTypeIds::CacheableFloat:
+      return fromReal(static_cast<const CacheableFloat&>(*value).value());
+    case GeodeTypeIds::CacheableDouble:
+      return fromReal(static_cast<const CacheableDouble&>(*value).value());
+    case GeodeTypeIds::CacheableDate:
+      return fromInteger(
+          static_cast<const CacheableDate&>(*value).milliseconds());
+    default: {
+      LocalQueryValue result;
+      result.m_kind = OBJECT;
+      result.m_object = value;
+      return result;
+    }
+  }
+}
+
+LocalQueryValue LocalQueryValue::fromBoolean(bool value) {
+  LocalQueryValue result;
+  result.m_kind = BOOLEAN;
+  result.m_integer = value ? 1 : 0;
+  return result;
+}
+
+LocalQueryValue LocalQueryValue::fromInteger(int64_t value) {
+  LocalQueryValue result;
+  result.m_kind = INTEGER;
+  result.m_integer = value;
+  return result;
+}
+
+LocalQueryValue LocalQueryValue::fromReal(double value) {
+  LocalQueryValue result;
+  result.m_kind = REAL;
+  result.m_real = value;
+  return result;
+}
+
+LocalQueryValue LocalQueryValue::fromString(std::string value) {
+  LocalQueryValue result;
+  result.m_kind = STRING;
+  result.m_string = std::move(value);
+  return result;
+}
+
+int LocalQueryValue::rank() const {
+  switch (m_kind) {
+    case NIL:
+      return 0;
+    case BOOLEAN:
+      return 1;
+    case INTEGER:
+    case REAL:
+      return 2;
+    case STRING:
+      return 3;
+    default:
+      return 4;
+  }
+}
+
+bool LocalQueryValue::isHashable() const {
+  return m_kind != OBJECT ||
+         std::dynamic_pointer_cast<CacheableKey>(m_object) != nullptr;
+}
+
+bool LocalQueryValue::isOrderedWith(const LocalQueryValue& other) const {
+  auto r = rank();
+  return r == other.rank() && r != 0 && r != 4;
+}
+
+bool LocalQueryValue::equals(const LocalQueryValue& other) const {
+  if (m_kind == OBJECT || other.m_kind == OBJECT) {
+    auto key = std::dynamic_pointer_cast<CacheableKey>(m_object);
+    auto otherKey = std::dynamic_pointer_cast<CacheableKey>(other.m_object);
+    return key != nullptr && otherKey != nullptr && *key == *otherKey;
+  }
+  return rank() == other.rank() && compareTo(other) == 0;
+}
+
+size_t LocalQueryValue::hash() const {
+  switch (m_kind) {
+    case NIL:
+      return 0;
+    case BOOLEAN:
+      return static_cast<size_t>(m_integer) + 1;
+    case INTEGER:
+      // integers and reals that are equal hash alike
+      return std::hash<double>()(static_cast<double>(m_integer));
+    case REAL:
+      return std::hash<double>()(m_real);
+    case STRING:
+      return std::hash<std::string>()(m_string);
+    default: {
+      auto key = std::dynamic_pointer_cast<CacheableKey>(m_object);
+      return key == nullptr ? 0 : static_cast<size_t>(key->hashcode());
+    }
+  }
+}
+
+int LocalQueryValue::compareTo(const LocalQueryValue& other) const {
+  int r = rank();
+  if (r != other.rank()) {
+    return r < other.rank() ? -1 : 1;
+  }
+  switch (r) {
+    case 1:
+      return compareValues(m_integer, other.m_integer);
+    case 2:
+      if (m_kind == INTEGER && other.m_kind == INTEGER) {
+        return compareValues(m_integer, other.m_integer);
+      }
+      // long double holds any int64_t exactly
+      return compareValues(
+          m_kind == INTEGER ? static_cast<long double>(m_integer)
+                            : static_cast<long double>(m_real),
+          other.m_kind == INTEGER ? static_cast<long double>(other.m_integer)
+                                  : static_cast<long double>(other.m_real));
+    case 3:
+      return m_string.compare(other.m_string) < 0
+                 ? -1
+                 : (m_string == other.m_string ? 0 : 1);
+    default:
+      return 0;
+  }
+}
+
+LocalQueryValue LocalQueryOperand::evaluate(
+    const LocalQueryRow& row,
+    const std::vector<LocalQueryValue>& params) const {
+  switch (kind) {
+    case FIELD:
+      return LocalQueryValue::fromCacheable(row.fields[index]);
+    case VALUE:
+      return LocalQueryValue::fromCacheable(row.value);
+    case PARAMETER:
+      return params[index];
+    default:
+      return literal;
+  }
+}
+
+bool LocalQueryCondition::evaluate(
+    const LocalQueryRow& row,
+    const std::vector<LocalQueryValue>& params) const {
+  switch (op) {
+    case AND:
+      return left->evaluate(row, params) && right->evaluate(row, params);
+    case OR:
+      return left->evaluate(row, params) || right->evaluate(row, params);
+    case NOT:
+      return !left->evaluate(row, params);
+    default:
+      return compare(op, lhs.evaluate(row, params), rhs.evaluate(row, params));
+  }
+}
+
+LocalQueryCondition::Op LocalQueryCondition::reverse(Op op) {
+  switch (op) {
+    case LT:
+      return GT;
+    case LE:
+      return GE;
+    case GT:
+      return LT;
+    case GE:
+      return LE;
+    default:
+      return op;
+  }
+}
+
+bool LocalQueryCondition::compare(Op op, const LocalQueryValue& lhs,
+                                  const LocalQueryValue& rhs) {
+  switch (op) {
+    case EQ:
+      return lhs.equals(rhs);
+    case NE:
+      return !lhs.equals(rhs);
+    default:
+      break;
+  }
+  if (!lhs.isOrderedWith(rhs)) {
+    return false;
+  }
+  int result = lhs.compareTo(rhs);
+  switch (op) {
+    case LT:
+      return result < 0;
+    case LE:
+      return result <= 0;
+    case GT:
+      return result > 0;
+    default:
+      return result >= 0;
+  }
+}
+
+/**
+ * A recursive descent parser for the OQL subset of local queries.
+ */
+class LocalQueryParser {
+ public:
+  LocalQueryParser(const std::string& queryString, LocalQueryPlan& plan)
+      : m_query(queryString), m_plan(plan), m_pos(0) {
+    tokenize();
+  }
+
+  void parse() {
+    expectKeyword("SELECT");
+    if (isKeyword("DISTINCT")) {
+      fail("DISTINCT is not supported by local queries");
+    }
+    // the projections may name the alias declared by the FROM clause
+    size_t selectStart = m_pos;
+    size_t from = selectStart;
+    while (m_tokens[from].type != Token::END && !isKeyword(from, "FROM")) {
+      from++;
+    }
+    m_pos = from;
+    expectKeyword("FROM");
+    parseFrom();
+    size_t afterFrom = m_pos;
+    m_pos = selectStart;
+    parseProjections(from);
+    m_pos = afterFrom;
+
+    if (acceptKeyword("WHERE")) {
+      m_plan.m_condition = parseOr();
+    }
+    if (acceptKeyword("ORDER")) {
+      expectKeyword("BY");
+      do {
+        LocalQueryPlan::Ordering ordering;
+        std::string name;
+        parsePath(ordering.field, ordering.selectsValue, name);
+        ordering.descending = false;
+        if (acceptKeyword("DESC")) {
+          ordering.descending = true;
+        } else {
+          acceptKeyword("ASC");
+        }
+        m_plan.m_orderings.push_back(ordering);
+      } while (acceptSymbol(","));
+    }
+    if (acceptKeyword("LIMIT")) {
+      const Token& token = current();
+      if (token.type != Token::NUMBER ||
+          token.text.find_first_not_of("0123456789") != std::string::npos) {
+        fail("LIMIT must be a non-negative integer");
+      }
+      m_plan.m_limit = std::strtoll(token.text.c_str(), nullptr, 10);
+      m_pos++;
+    }
+    if (current().type != Token::END) {
+      fail("unexpected '" + current().text + "'");
+    }
+  }
+
+ private:
+  struct Token {
+    enum Type { END, IDENTIFIER, NUMBER, STRING, PARAMETER, PATH, SYMBOL };
+    Type type;
+    std::string text;
+    size_t column;
+  };
+
+  static bool isIdentifierChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+  }
+
+  void tokenize() {
+    size_t i = 0;
+    const size_t length = m_query.length();
+    while (true) {
+      while (i < length &&
+             std::isspace(static_cast<unsigned char>(m_query[i]))) {
+        i++;
+      }
+      Token token;
+      token.column = i + 1;
+      if (i == length) {
+        token.type = Token::END;
+        m_tokens.push_back(token);
+        return;
+      }
+      char c = m_query[i];
+      size_t start = i;
+      if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+        while (i < length && isIdentifierChar(m_query[i])) {
+          i++;
+        }
+        token.type = Token::IDENTIFIER;
+        token.text = m_query.substr(start, i - start);
+      } else if (std::isdigit(static_cast<unsigned char>(c)) ||
+                 (c == '.' && i + 1 < length &&
+                  std::isdigit(static_cast<unsigned char>(m_query[i + 1])))) {
+        while (i < length && (isIdentifierChar(m_query[i]) ||
+                              m_query[i] == '.' ||
+                              ((m_query[i] == '+' || m_query[i] == '-') &&
+                               (m_query[i - 1] == 'e' ||
+                                m_query[i - 1] == 'E')))) {
+          i++;
+        }
+        token.type = Token::NUMBER;
+        token.text = m_query.substr(start, i - start);
+      } else if (c == '\'') {
+        token.type = Token::STRING;
+        i++;
+        while (true) {
+          if (i == length) {
+            m_pos = m_tokens.size();
+            m_tokens.push_back(token);
+            fail("unterminated string literal");
+          }
+          if (m_query[i] == '\'') {
+            if (i + 1 < length && m_query[i + 1] == '\'') {
+              token.text += '\'';
+              i += 2;
+              continue;
+            }
+            i++;
+            break;
+          }
+          token.text += m_query[i++];
+        }
+      } else if (c == '$') {
+        i++;
+        while (i < length &&
+               std::isdigit(static_cast<unsigned char>(m_query[i]))) {
+          i++;
+        }
+        token.type = Token::PARAMETER;
+        token.text = m_query.substr(start, i - start);
+      } else if (c == '/') {
+        i++;
+        while (i < length && (isIdentifierChar(m_query[i]) ||
+                              m_query[i] == '/' || m_query[i] == '-')) {
+          i++;
+        }
+        token.type = Token::PATH;
+        token.text = m_query.substr(start, i - start);
+      } else {
+        token.type = Token::SYMBOL;
+        i++;
+        if (i < length &&
+            ((c == '<' && (m_query[i] == '=' || m_query[i] == '>')) ||
+             ((c == '>' || c == '!') && m_query[i] == '='))) {
+          i++;
+        }
+        token.text = m_query.substr(start, i - start);
+      }
+      m_tokens.push_back(token);
+    }
+  }
+
+  [[noreturn]] void fail(const std::string& message) const {
+    throw QueryException("Local query syntax error at column " +
+                         std::to_string(current().column) + ": " + message);
+  }
+
+  const Token& current() const { return m_tokens[m_pos]; }
+
+  static bool equalsIgnoreCase(const std::string& text, const char* keyword) {
+    size_t i = 0;
+    for (; i < text.length() && keyword[i] != '\0'; i++) {
+      if (std::toupper(static_cast<unsigned char>(text[i])) != keyword[i]) {
+        return false;
+      }
+    }
+    return i == text.length() && keyword[i] == '\0';
+  }
+
+  bool isKeyword(size_t pos, const char* keyword) const {
+    return m_tokens[pos].type == Token::IDENTIFIER &&
+           equalsIgnoreCase(m_tokens[pos].text, keyword);
+  }
+
+  bool isKeyword(const char* keyword) const {
+    return isKeyword(m_pos, keyword);
+  }
+
+  bool isReserved(const std::string& text) const {
+    static const char* reserved[] = {
+        "SELECT", "DISTINCT", "FROM", "WHERE", "AND",  "OR",   "NOT",  "ORDER",
+        "BY",     "ASC",      "DESC", "LIMIT", "AS",   "TRUE", "FALSE", "NULL"};
+    for (auto keyword : reserved) {
+      if (equalsIgnoreCase(text, keyword)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool acceptKeyword(const char* keyword) {
+    if (isKeyword(keyword)) {
+      m_pos++;
+      return true;
+    }
+    return false;
+  }
+
+  void expectKeyword(const char* keyword) {
+    if (!acceptKeyword(keyword)) {
+      fail(std::string(keyword) + " expected");
+    }
+  }
+
+  bool isSymbol(const char* symbol) const {
+    return current().type == Token::SYMBOL && current().text == symbol;
+  }
+
+  bool acceptSymbol(const char* symbol) {
+    if (isSymbol(symbol)) {
+      m_pos++;
+      return true;
+    }
+    return false;
+  }
+
+  void expectSymbol(const char* symbol) {
+    if (!acceptSymbol(symbol)) {
+      fail(std::string("'") + symbol + "' expected");
+    }
+  }
+
+  std::string expectIdentifier() {
+    if (current().type != Token::IDENTIFIER || isReserved(current().text)) {
+      fail("identifier expected");
+    }
+    return m_tokens[m_pos++].text;
+  }
+
+  void parseFrom() {
+    if (current().type != Token::PATH || current().text.length() < 2) {
+      fail("region path expected");
+    }
+    m_plan.m_regionPath = m_tokens[m_pos++].text;
+    if (acceptKeyword("AS") ||
+        (current().type == Token::IDENTIFIER && !isReserved(current().text))) {
+      m_alias = expectIdentifier();
+    }
+  }
+
+  void parseProjections(size_t end) {
+    if (acceptSymbol("*")) {
+      m_plan.m_projections.push_back(
+          {0, true, m_alias.empty() ? std::string("value") : m_alias});
+    } else {
+      do {
+        LocalQueryPlan::Projection projection;
+        parsePath(projection.field, projection.selectsValue, projection.name);
+        if (acceptKeyword("AS")) {
+          projection.name = expectIdentifier();
+        }
+        m_plan.m_projections.push_back(projection);
+      } while (acceptSymbol(","));
+    }
+    if (m_pos != end) {
+      fail("FROM expected");
+    }
+  }
+
+  // the alias, or a field of the value with or without the alias
+  void parsePath(size_t& field, bool& selectsValue, std::string& name) {
+    name = expectIdentifier();
+    field = 0;
+    selectsValue = false;
+    if (!m_alias.empty() && name == m_alias) {
+      if (!acceptSymbol(".")) {
+        selectsValue = true;
+        return;
+      }
+      name = expectIdentifier();
+    } else if (isSymbol(".")) {
+      fail("unknown identifier '" + name + "'");
+    }
+    if (isSymbol(".")) {
+      fail("nested fields are not supported by local queries");
+    }
+    field = m_plan.fieldNumber(name);
+  }
+
+  std::unique_ptr<LocalQueryCondition> combine(
+      LocalQueryCondition::Op op, std::unique_ptr<LocalQueryCondition> left,
+      std::unique_ptr<LocalQueryCondition> right) {
+    std::unique_ptr<LocalQueryCondition> node(new LocalQueryCondition());
+    node->op = op;
+    node->left = std::move(left);
+    node->right = std::move(right);
+    return node;
+  }
+
+  std::unique_ptr<LocalQueryCondition> parseOr() {
+    auto condition = parseAnd();
+    while (acceptKeyword("OR")) {
+      condition = combine(LocalQueryCondition::OR, std::move(condition),
+                          parseAnd());
+    }
+    return condition;
+  }
+
+  std::unique_ptr<LocalQueryCondition> parseAnd() {
+    auto condition = parseNot();
+    while (acceptKeyword("AND")) {
+      condition = combine(LocalQueryCondition::AND, std::move(condition),
+                          parseNot());
+    }
+    return condition;
+  }
+
+  std::unique_ptr<LocalQueryCondition> parseNot() {
+    if (acceptKeyword("NOT")) {
+      return combine(LocalQueryCondition::NOT, parseNot(), nullptr);
+    }
+    if (acceptSymbol("(")) {
+      auto condition = parseOr();
+      expectSymbol(")");
+      return condition;
+    }
+    std::unique_ptr<LocalQueryCondition> comparison(new LocalQueryCondition());
+    comparison->lhs = parseOperand();
+    comparison->op = parseComparator();
+    comparison->rhs = parseOperand();
+    return comparison;
+  }
+
+  LocalQueryCondition::Op parseComparator() {
+    static const struct {
+      const char* symbol;
+      LocalQueryCondition::Op op;
+    } comparators[] = {
+        {"=", LocalQueryCondition::EQ},  {"!=", LocalQueryCondition::NE},
+        {"<>", LocalQueryCondition::NE}, {"<", LocalQueryCondition::LT},
+        {"<=", LocalQueryCondition::LE}, {">", LocalQueryCondition::GT},
+        {">=", LocalQueryCondition::GE}};
+    for (const auto& comparator : comparators) {
+      if (acceptSymbol(comparator.symbol)) {
+        return comparator.op;
+      }
+    }
+    fail("comparison operator expected");
+  }
+
+  LocalQueryOperand parseOperand() {
+    LocalQueryOperand operand;
+    const Token& token = current();
+    if (token.type == Token::STRING) {
+      operand.literal = LocalQueryValue::fromString(token.text);
+      m_pos++;
+    } else if (token.type == Token::PARAMETER) {
+      auto number = std::strtoul(token.text.c_str() + 1, nullptr, 10);
+      if (number == 0) {
+        fail("bind parameters are numbered from $1");
+      }
+      operand.kind = LocalQueryOperand::PARAMETER;
+      operand.index = number - 1;
+      m_plan.m_parameterCount = std::max(m_plan.m_parameterCount,
+                                         static_cast<size_t>(number));
+      m_pos++;
+    } else if (token.type == Token::NUMBER ||
+               (isSymbol("-") && m_tokens[m_pos + 1].type == Token::NUMBER)) {
+      bool negative = acceptSymbol("-");
+      operand.literal = parseNumber(current().text, negative);
+      m_pos++;
+    } else if (isKeyword("TRUE") || isKeyword("FALSE")) {
+      operand.literal = LocalQueryValue::fromBoolean(isKeyword("TRUE"));
+      m_pos++;
+    } else if (isKeyword("NULL")) {
+      m_pos++;
+    } else {
+      std::string name;
+      bool selectsValue;
+      parsePath(operand.index, selectsValue, name);
+      operand.kind =
+          selectsValue ? LocalQueryOperand::VALUE : LocalQueryOperand::FIELD;
+    }
+    return operand;
+  }
+
+  LocalQueryValue parseNumber(std::string text, bool negative) {
+    if (negative) {
+      text.insert(0, 1, '-');
+    }
+    char suffix = static_cast<char>(std::toupper(
+        static_cast<unsigned char>(text.back())));
+    if (suffix == 'L' || suffix == 'F' || suffix == 'D') {
+      text.pop_back();
+    }
+    char* end = nullptr;
+    if (suffix != 'F' && suffix != 'D' &&
+        text.find_first_of(".eE") == std::string::npos) {
+      auto value = std::strtoll(text.c_str(), &end, 10);
+      if (*end == '\0') {
+        return LocalQueryValue::fromInteger(value);
+      }
+    } else {
+      auto value = std::strtod(text.c_str(), &end);
+      if (*end == '\0') {
+        return LocalQueryValue::fromReal(value);
+      }
+    }
+    fail("invalid number '" + text + "'");
+  }
+
+  const std::string& m_query;
+  LocalQueryPlan& m_plan;
+  std::vector<Token> m_tokens;
+  size_t m_pos;
+  std::string m_alias;
+};
+
+LocalQueryPlan::LocalQueryPlan(const std::string& queryString)
+    : m_limit(-1), m_parameterCount(0) {
+  LocalQueryParser(queryString, *this).parse();
+}
+
+size_t LocalQueryPlan::fieldNumber(const std::string& name) {
+  auto iter = std::find(m_fields.begin(), m_fields.end(), name);
+  if (iter != m_fields.end()) {
+    return iter - m_fields.begin();
+  }
+  m_fields.push_back(name);
+  return m_fields.size() - 1;
+}
+
+void LocalQueryPlan::readFields(LocalQueryRow& row) const {
+  if (m_fields.empty()) {
+    return;
+  }
+  if (!PdxFieldExtractor::extract(row.value, m_fields, row.fields)) {
+    // fields of values that are not PDX are null
+    row.fields.assign(m_fields.size(), nullptr);
+  }
+}
+
+bool LocalQueryPlan::matches(const LocalQueryRow& row,
+                             const std::vector<LocalQueryValue>& params) const {
+  return m_condition == nullptr || m_condition->evaluate(row, params);
+}
+
+bool LocalQueryPlan::orderedBefore(const LocalQueryRow& first,
+                                   const LocalQueryRow& second) const {
+  for (const auto& ordering : m_orderings) {
+    auto firstValue = LocalQueryValue::fromCacheable(
+        ordering.selectsValue ? first.value : first.fields[ordering.field]);
+    auto secondValue = LocalQueryValue::fromCacheable(
+        ordering.selectsValue ? second.value : second.fields[ordering.field]);
+    int result = firstValue.compareTo(secondValue);
+    if (result != 0) {
+      return ordering.descending ? result > 0 : result < 0;
+    }
+  }
+  return false;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,219 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LOCALQUERYPLAN_H_
+#define GEODE_LOCALQUERYPLAN_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/CacheableKey.hpp>
+#include <geode/CacheableBuiltins.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * A value a local query compares: a field, the value of an entry, a literal or
+ * a bind parameter. Integral numbers, dates and characters are integers;
+ * floats and doubles are reals. Integers and reals compare with each other.
+ */
+class CPPCACHE_EXPORT LocalQueryValue {
+ public:
+  enum Kind { NIL, BOOLEAN, INTEGER, REAL, STRING, OBJECT };
+
+  LocalQueryValue() : m_kind(NIL), m_integer(0), m_real(0) {}
+
+  static LocalQueryValue fromCacheable(const std::shared_ptr<Cacheable>& value);
+  static LocalQueryValue fromBoolean(bool value);
+  static LocalQueryValue fromInteger(int64_t value);
+  static LocalQueryValue fromReal(double value);
+  static LocalQueryValue fromString(std::string value);
+
+  inline Kind kind() const { return m_kind; }
+
+  /** Whether the value is null. */
+  inline bool isNull() const { return m_kind == NIL; }
+
+  /** Whether <code>=</code> can match this value in a hash index. */
+  bool isHashable() const;
+
+  /** Whether <code>&lt;</code> and friends are defined for the two values. */
+  bool isOrderedWith(const LocalQueryValue& other) const;
+
+  bool equals(const LocalQueryValue& other) const;
+
+  size_t hash() const;
+
+  /**
+   * Orders any two values: by kind first (null lowest), then by value.
+   * Objects do not order among themselves.
+   */
+  int compareTo(const LocalQueryValue& other) const;
+
+ private:
+  int rank() const;
+
+  Kind m_kind;
+  int64_t m_integer;
+  double m_real;
+  std::string m_string;
+  std::shared_ptr<Cacheable> m_object;
+};
+
+/**
+ * An entry being queried, with the fields of its value the query reads.
+ */
+struct LocalQueryRow {
+  std::shared_ptr<CacheableKey> key;
+  std::shared_ptr<Cacheable> value;
+  std::vector<std::shared_ptr<Cacheable>> fields;
+};
+
+/**
+ * An operand of a comparison in the WHERE clause.
+ */
+struct LocalQueryOperand {
+  enum Kind { FIELD, VALUE, LITERAL, PARAMETER };
+
+  Kind kind = LITERAL;
+  // the field of the plan, or the parameter counting from 0
+  size_t index = 0;
+  LocalQueryValue literal;
+
+  LocalQueryValue evaluate(const LocalQueryRow& row,
+                           const std::vector<LocalQueryValue>& params) const;
+};
+
+/**
+ * A node of the WHERE clause: a comparison of two operands, or AND, OR and
+ * NOT of other conditions.
+ */
+struct LocalQueryCondition {
+  enum Op { AND, OR, NOT, EQ, NE, LT, LE, GT, GE };
+
+  Op op = EQ;
+  std::unique_ptr<LocalQueryCondition> left;
+  std::unique_ptr<LocalQueryCondition> right;
+  LocalQueryOperand lhs;
+  LocalQueryOperand rhs;
+
+  inline bool isComparison() const { return op >= EQ; }
+
+  bool evaluate(const LocalQueryRow& row,
+                const std::vector<LocalQueryValue>& params) const;
+
+  /** The comparison with its operands swapped, e.g. GT for LT. */
+  static Op reverse(Op op);
+
+  /** Applies a comparison to two values. */
+  static bool compare(Op op, const LocalQueryValue& lhs,
+                      const LocalQueryValue& rhs);
+};
+
+/**
+ * A query for the local query service, compiled from the OQL subset it
+ * supports. A plan is immutable once compiled and may be shared by threads
+ * executing the query at the same time.
+ */
+class CPPCACHE_EXPORT LocalQueryPlan {
+ public:
+  struct Projection {
+    // a field of the plan; the value of the entry if selectsValue
+    size_t field;
+    bool selectsValue;
+    std::string name;
+  };
+
+  struct Ordering {
+    size_t field;
+    bool selectsValue;
+    bool descending;
+  };
+
+  /**
+   * @throws QueryException if the query is not valid or uses OQL a local
+   *         query does not support
+   */
+  explicit LocalQueryPlan(const std::string& queryString);
+
+  inline const std::string& getRegionPath() const { return m_regionPath; }
+
+  /** The names of the fields the query reads, by field number. */
+  inline const std::vector<std::string>& getFields() const { return m_fields; }
+
+  inline const std::vector<Projection>& getProjections() const {
+    return m_projections;
+  }
+
+  /** Whether the query returns a StructSet rather than a ResultSet. */
+  inline bool selectsStruct() const { return m_projections.size() > 1; }
+
+  /** The WHERE clause; nullptr if there is none. */
+  inline const LocalQueryCondition* getCondition() const {
+    return m_condition.get();
+  }
+
+  inline const std::vector<Ordering>& getOrderings() const {
+    return m_orderings;
+  }
+
+  /** The LIMIT of the query; -1 if there is none. */
+  inline int64_t getLimit() const { return m_limit; }
+
+  /** The number of bind parameters the query refers to. */
+  inline size_t getParameterCount() const { return m_parameterCount; }
+
+  /**
+   * Reads the fields the query needs from the value of the row.
+   *
+   * @throws QueryException if a field is an array
+   */
+  void readFields(LocalQueryRow& row) const;
+
+  /** Whether the row satisfies the WHERE clause. */
+  bool matches(const LocalQueryRow& row,
+               const std::vector<LocalQueryValue>& params) const;
+
+  /** Whether the first row comes before the second in the ORDER BY. */
+  bool orderedBefore(const LocalQueryRow& first,
+                     const LocalQueryRow& second) const;
+
+ private:
+  friend class LocalQueryParser;
+
+  size_t fieldNumber(const std::string& name);
+
+  std::string m_regionPath;
+  std::vector<std::string> m_fields;
+  std::vector<Projection> m_projections;
+  std::unique_ptr<LocalQueryCondition> m_condition;
+  std::vector<Ordering> m_orderings;
+  int64_t m_limit;
+  size_t m_parameterCount;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALQUERYPLAN_H_
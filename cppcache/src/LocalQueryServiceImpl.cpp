@@ -0,0 +1,125 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <geode/ExceptionTypes.hpp>
+
+#include "LocalQueryServiceImpl.hpp"
+#include "LocalQuery.hpp"
+#include "LocalQueryIndex.hpp"
+#include "LocalRegion.hpp"
+#include "CacheImpl.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+void throwCqUnsupported() {
+  throw UnsupportedOperationException(
+      "Continuous queries are not supported by the local query service");
+}
+}  // namespace
+
+LocalQueryServiceImpl::LocalQueryServiceImpl(CacheImpl* cache)
+    : m_cache(cache) {}
+
+std::shared_ptr<Query> LocalQueryServiceImpl::newQuery(const char* querystr) {
+  if (querystr == nullptr) {
+    throw IllegalArgumentException(
+        "LocalQueryService::newQuery: query string is null");
+  }
+  return std::make_shared<LocalQuery>(querystr, m_cache);
+}
+
+std::shared_ptr<CqQuery> LocalQueryServiceImpl::newCq(
+    const char*, const char*, const std::shared_ptr<CqAttributes>&, bool) {
+  throwCqUnsupported();
+  return nullptr;
+}
+
+std::shared_ptr<CqQuery> LocalQueryServiceImpl::newCq(
+    const char*, const std::shared_ptr<CqAttributes>&, bool) {
+  throwCqUnsupported();
+  return nullptr;
+}
+
+void LocalQueryServiceImpl::closeCqs() {}
+
+QueryService::query_container_type LocalQueryServiceImpl::getCqs() {
+  return query_container_type();
+}
+
+std::shared_ptr<CqQuery> LocalQueryServiceImpl::getCq(const char*) {
+  return nullptr;
+}
+
+void LocalQueryServiceImpl::executeCqs() {}
+
+void LocalQueryServiceImpl::stopCqs() {}
+
+std::shared_ptr<CqServiceStatistics>
+LocalQueryServiceImpl::getCqServiceStatistics() {
+  throwCqUnsupported();
+  return nullptr;
+}
+
+std::shared_ptr<CacheableArrayList>
+LocalQueryServiceImpl::getAllDurableCqsFromServer() {
+  throwCqUnsupported();
+  return nullptr;
+}
+
+void LocalQueryServiceImpl::createIndex(const char* name, IndexType type,
+                                        const char* fieldName,
+                                        const char* regionPath) {
+  if (name == nullptr || fieldName == nullptr) {
+    throw IllegalArgumentException(
+        "LocalQueryService::createIndex: index name or field name is null");
+  }
+  auto region = getRegion("LocalQueryService::createIndex", regionPath);
+  region->addQueryIndex(
+      std::make_shared<LocalQueryIndex>(name, type, fieldName));
+}
+
+bool LocalQueryServiceImpl::removeIndex(const char* name,
+                                        const char* regionPath) {
+  if (name == nullptr) {
+    return false;
+  }
+  auto region = getRegion("LocalQueryService::removeIndex", regionPath);
+  return region->removeQueryIndex(name);
+}
+
+std::vector<std::string> LocalQueryServiceImpl::getIndexes(
+    const char* regionPath) {
+  auto region = getRegion("LocalQueryService::getIndexes", regionPath);
+  std::vector<std::string> names;
+  for (const auto& index : region->getQueryIndexes()) {
+    names.push_back(index->getName());
+  }
+  return names;
+}
+
+std::shared_ptr<LocalRegion> LocalQueryServiceImpl::getRegion(
+    const char* func, const char* regionPath) {
+  std::shared_ptr<Region> region;
+  m_cache->getRegion(regionPath, region);
+  auto localRegion = std::dynamic_pointer_cast<LocalRegion>(region);
+  if (localRegion == nullptr) {
+    throw IllegalArgumentException(std::string(func) + ": region " +
+                                   (regionPath != nullptr ? regionPath : "") +
+                                   " not found");
+  }
+  return localRegion;
+}
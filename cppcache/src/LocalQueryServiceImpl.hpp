@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_LOCALQUERYSERVICEIMPL_H_
+#define GEODE_LOCALQUERYSERVICEIMPL_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/LocalQueryService.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+class LocalRegion;
+
+class CPPCACHE_EXPORT LocalQueryServiceImpl : public LocalQueryService {
+ public:
+  explicit LocalQueryServiceImpl(CacheImpl* cache);
+
+  std::shared_ptr<Query> newQuery(const char* querystr) override;
+
+  std::shared_ptr<CqQuery> newCq(const char* name, const char* querystr,
+                                 const std::shared_ptr<CqAttributes>& cqAttr,
+                                 bool isDurable = false) override;
+
+  std::shared_ptr<CqQuery> newCq(const char* querystr,
+                                 const std::shared_ptr<CqAttributes>& cqAttr,
+                                 bool isDurable = false) override;
+
+  void closeCqs() override;
+
+  query_container_type getCqs() override;
+
+  std::shared_ptr<CqQuery> getCq(const char* name) override;
+
+  void executeCqs() override;
+
+  void stopCqs() override;
+
+  std::shared_ptr<CqServiceStatistics> getCqServiceStatistics() override;
+
+  std::shared_ptr<CacheableArrayList> getAllDurableCqsFromServer() override;
+
+  void createIndex(const char* name, IndexType type, const char* fieldName,
+                   const char* regionPath) override;
+
+  bool removeIndex(const char* name, const char* regionPath) override;
+
+  std::vector<std::string> getIndexes(const char* regionPath) override;
+
+ private:
+  std::shared_ptr<LocalRegion> getRegion(const char* func,
+                                         const char* regionPath);
+
+  CacheImpl* m_cache;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCALQUERYSERVICEIMPL_H_
@@ -15,7 +15,12 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include <geode/SystemProperties.hpp>
@@ -30,7 +35,11 @@
 #include "RegionExpiryHandler.hpp"
 #include "ExpiryTaskManager.hpp"
 #include "LRUEntriesMap.hpp"
+#include "CompressedEntriesMap.hpp"
+#include "RegionEntryCursorImpl.hpp"
 #include "RegionGlobalLocks.hpp"
+#include "SerializedValue.hpp"
+#include "ThreadPool.hpp"
 #include "TXState.hpp"
 #include "VersionTag.hpp"
 #include "util/bounds.hpp"
@@ -40,6 +49,31 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+// the LRU map of a region with a Compressor is wrapped
+LRUEntriesMap* lruEntriesMap(EntriesMap* entries) {
+  if (auto compressed = dynamic_cast<CompressedEntriesMap*>(entries)) {
+    entries = compressed->getEntriesMap();
+  }
+  return dynamic_cast<LRUEntriesMap*>(entries);
+}
+
+// a share of a parallel scan run on the cache thread pool
+class ScanWork : public PooledWork<int> {
+ public:
+  explicit ScanWork(const std::function<void()>& run) : m_run(run) {}
+
+ protected:
+  int execute(void) {
+    m_run();
+    return 0;
+  }
+
+ private:
+  const std::function<void()>& m_run;
+};
+}  // namespace
+
 LocalRegion::LocalRegion(const std::string& name, CacheImpl* cache,
                          const std::shared_ptr<RegionInternal>& rPtr,
                          const std::shared_ptr<RegionAttributes>& attributes,
@@ -55,6 +89,7 @@ LocalRegion::LocalRegion(const std::string& name, CacheImpl* cache,
       m_loader(nullptr),
       m_released(false),
       m_entries(nullptr),
+      m_hasQueryIndexes(false),
       m_cacheStatistics(stats),
       m_transactionEnabled(false),
       m_isPRSingleHopEnabled(false),
@@ -92,6 +127,12 @@ LocalRegion::LocalRegion(const std::string& name, CacheImpl* cache,
                                       .getStatisticsManager()
                                       ->getStatisticsFactory(),
                                   m_fullPath);
+  if (m_regionAttributes->getListenerDispatchThreads() > 0) {
+    m_listenerDispatcher.reset(new CacheListenerDispatcher(
+        m_regionAttributes->getListenerDispatchThreads(),
+        m_regionAttributes->getListenerQueueCapacity(),
+        m_regionAttributes->getListenerConflationEnabled(), m_regionStats));
+  }
   auto p =
       cache->getCache()->getPoolManager().find(getAttributes()->getPoolName());
   // m_attachedPool = p;
@@ -266,6 +307,7 @@ void LocalRegion::tombstoneOperationNoThrow(
 
   rPtr->acquireReadLock();
   m_subRegions.bind(rPtr->getName(), std::shared_ptr<Region>(rPtr));
+  m_cacheImpl->getRegionRegistry().add(rPtr);
 
   // schedule the sub region expiry if regionExpiry enabled.
   rPtr->setRegionExpiryTask();
@@ -311,8 +353,7 @@ std::shared_ptr<Cacheable> LocalRegion::get(
   std::shared_ptr<Cacheable> rptr;
   int64_t sampleStartNanos = startStatOpTime();
   GfErrType err = getNoThrow(key, rptr, aCallbackArgument);
-  updateStatOpTime(m_regionStats->getStat(), m_regionStats->getGetTimeId(),
-                   sampleStartNanos);
+  updateGetStatOpTime(sampleStartNanos);
 
   // rptr = handleReplay(err, rptr);
 
@@ -328,8 +369,7 @@ void LocalRegion::put(const std::shared_ptr<CacheableKey>& key, const std::share
   std::shared_ptr<VersionTag> versionTag;
   GfErrType err = putNoThrow(key, value, aCallbackArgument, oldValue, -1,
                              CacheEventFlags::NORMAL, versionTag);
-  updateStatOpTime(m_regionStats->getStat(), m_regionStats->getPutTimeId(),
-                   sampleStartNanos);
+  updatePutStatOpTime(sampleStartNanos);
   //  handleReplay(err, nullptr);
   GfErrTypeToException("Region::put", err);
 }
@@ -532,6 +572,241 @@ std::vector<std::shared_ptr<RegionEntry>> LocalRegion::entries(bool recursive) {
   return entries;
 }
 
+std::unique_ptr<RegionEntryCursor> LocalRegion::entryCursor() {
+  CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::entryCursor);
+
+  uint32_t segments = 0;
+  if (m_regionAttributes->getCachingEnabled()) {
+    segments = m_entries->segmentCount();
+  }
+  uint32_t nextSegment = 0;
+  return std::unique_ptr<RegionEntryCursor>(new RegionEntryCursorImpl(
+      std::static_pointer_cast<LocalRegion>(shared_from_this()),
+      [nextSegment, segments](uint32_t& segment) mutable {
+        if (nextSegment == segments) {
+          return false;
+        }
+        segment = nextSegment++;
+        return true;
+      }));
+}
+
+void LocalRegion::parallelScan(
+    const std::function<void(RegionEntryCursor&)>& scan,
+    uint32_t parallelism) {
+  uint32_t segments = 0;
+  {
+    CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::parallelScan);
+    if (m_regionAttributes->getCachingEnabled()) {
+      segments = m_entries->segmentCount();
+    }
+  }
+  if (parallelism == 0) {
+    parallelism = std::max(1u, std::thread::hardware_concurrency());
+  }
+  // each thread claims the segments it visits, so a thread that is handed
+  // small segments goes on to take more of them
+  std::atomic<uint32_t> nextSegment(0);
+  RegionEntryCursorImpl::SegmentSource claim =
+      [&nextSegment, segments](uint32_t& segment) {
+        segment = nextSegment++;
+        return segment < segments;
+      };
+
+  auto region = std::static_pointer_cast<LocalRegion>(shared_from_this());
+  std::mutex failureMutex;
+  std::exception_ptr failure;
+  std::function<void()> run = [&]() {
+    try {
+      RegionEntryCursorImpl cursor(region, claim);
+      scan(cursor);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(failureMutex);
+      if (!failure) {
+        failure = std::current_exception();
+      }
+    }
+  };
+
+  // the calling thread scans too, so the scan completes even when the
+  // pool's threads are all busy; work that starts late finds no segments
+  std::vector<std::unique_ptr<ScanWork>> works;
+  auto threadPool = m_cacheImpl->getThreadPool();
+  for (uint32_t i = 1; i < std::min(parallelism, segments); i++) {
+    works.emplace_back(new ScanWork(run));
+    threadPool->perform(works.back().get());
+  }
+  run();
+  for (const auto& work : works) {
+    work->getResult();
+  }
+  if (failure) {
+    std::rethrow_exception(failure);
+  }
+}
+
+RegionMemoryFootprint LocalRegion::getMemoryFootprint() {
+  CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::getMemoryFootprint);
+
+  RegionMemoryFootprint footprint;
+  if (m_regionAttributes->getCachingEnabled()) {
+    m_entries->addMemoryFootprint(footprint);
+  }
+  m_regionStats->setFootprint(footprint.getKeyBytes(),
+                              footprint.getValueBytes(),
+                              footprint.getTotalBytes());
+  return footprint;
+}
+
+void LocalRegion::getSegmentEntries(uint32_t segment, KeyValuePairs& result) {
+  CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::getSegmentEntries);
+  m_entries->getSegmentEntries(segment, result);
+}
+
+void LocalRegion::addQueryIndex(const std::shared_ptr<LocalQueryIndex>& index) {
+  CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::addQueryIndex);
+  if (!m_regionAttributes->getCachingEnabled()) {
+    throw IllegalArgumentException("LocalRegion::addQueryIndex: region " +
+                                   m_fullPath + " does not cache entries");
+  }
+  {
+    std::lock_guard<std::mutex> guard(m_queryIndexesMutex);
+    auto indexes =
+        std::make_shared<std::vector<std::shared_ptr<LocalQueryIndex>>>();
+    if (auto current = std::atomic_load(&m_queryIndexes)) {
+      *indexes = *current;
+    }
+    for (const auto& existing : *indexes) {
+      if (existing->getName() == index->getName()) {
+        throw IllegalArgumentException("LocalRegion::addQueryIndex: region " +
+                                       m_fullPath + " already has index " +
+                                       index->getName());
+      }
+    }
+    indexes->push_back(index);
+    std::atomic_store(
+        &m_queryIndexes,
+        std::shared_ptr<const std::vector<std::shared_ptr<LocalQueryIndex>>>(
+            indexes));
+    m_hasQueryIndexes = true;
+  }
+
+  // the index is visible to updates before it is populated, so an update
+  // racing the population indexes the key it changes itself
+  LocalQueryIndex::ValueReader reader =
+      [this](const std::shared_ptr<CacheableKey>& key) {
+        return getLocalValue(key);
+      };
+  KeyValuePairs entries;
+  for (uint32_t segment = 0; segment < m_entries->segmentCount(); segment++) {
+    entries.clear();
+    m_entries->getSegmentEntries(segment, entries);
+    for (const auto& entry : entries) {
+      index->refresh(entry.first, reader);
+    }
+  }
+}
+
+bool LocalRegion::removeQueryIndex(const std::string& name) {
+  std::lock_guard<std::mutex> guard(m_queryIndexesMutex);
+  auto current = std::atomic_load(&m_queryIndexes);
+  if (current == nullptr) {
+    return false;
+  }
+  auto indexes =
+      std::make_shared<std::vector<std::shared_ptr<LocalQueryIndex>>>();
+  for (const auto& index : *current) {
+    if (index->getName() != name) {
+      indexes->push_back(index);
+    }
+  }
+  if (indexes->size() == current->size()) {
+    return false;
+  }
+  m_hasQueryIndexes = !indexes->empty();
+  std::atomic_store(
+      &m_queryIndexes,
+      std::shared_ptr<const std::vector<std::shared_ptr<LocalQueryIndex>>>(
+          indexes));
+  return true;
+}
+
+std::vector<std::shared_ptr<LocalQueryIndex>> LocalRegion::getQueryIndexes()
+    const {
+  auto indexes = std::atomic_load(&m_queryIndexes);
+  if (indexes == nullptr) {
+    return std::vector<std::shared_ptr<LocalQueryIndex>>();
+  }
+  return *indexes;
+}
+
+void LocalRegion::getLocalEntries(
+    const std::vector<std::shared_ptr<CacheableKey>>& keys,
+    KeyValuePairs& result) {
+  CHECK_DESTROY_PENDING(TryReadGuard, LocalRegion::getLocalEntries);
+  if (!m_regionAttributes->getCachingEnabled()) {
+    return;
+  }
+  for (const auto& key : keys) {
+    if (auto value = getLocalValue(key)) {
+      result.emplace_back(key, value);
+    }
+  }
+}
+
+std::shared_ptr<Cacheable> LocalRegion::getLocalValue(
+    const std::shared_ptr<CacheableKey>& key) {
+  std::shared_ptr<MapEntryImpl> entry;
+  std::shared_ptr<Cacheable> value;
+  // unlike get(), reading an overflowed value neither brings it back into
+  // memory nor triggers eviction
+  m_entries->getEntry(key, entry, value);
+  if (value == nullptr || CacheableToken::isInvalid(value) ||
+      CacheableToken::isDestroyed(value) ||
+      CacheableToken::isTombstone(value)) {
+    return nullptr;
+  }
+  if (CacheableToken::isOverflowed(value)) {
+    return m_entries->getFromDisk(key, entry);
+  }
+  return value;
+}
+
+void LocalRegion::refreshQueryIndexes(
+    const std::shared_ptr<CacheableKey>& key) {
+  if (!m_hasQueryIndexes) {
+    return;
+  }
+  auto indexes = std::atomic_load(&m_queryIndexes);
+  if (indexes == nullptr) {
+    return;
+  }
+  LocalQueryIndex::ValueReader reader =
+      [this](const std::shared_ptr<CacheableKey>& key) {
+        return getLocalValue(key);
+      };
+  for (const auto& index : *indexes) {
+    index->refresh(key, reader);
+  }
+}
+
+void LocalRegion::refreshQueryIndexes() {
+  if (!m_hasQueryIndexes) {
+    return;
+  }
+  auto indexes = std::atomic_load(&m_queryIndexes);
+  if (indexes == nullptr) {
+    return;
+  }
+  LocalQueryIndex::ValueReader reader =
+      [this](const std::shared_ptr<CacheableKey>& key) {
+        return getLocalValue(key);
+      };
+  for (const auto& index : *indexes) {
+    index->refreshAll(reader);
+  }
+}
+
 HashMapOfCacheable LocalRegion::getAll(
     const std::vector<std::shared_ptr<CacheableKey>>& keys,
     const std::shared_ptr<Serializable>& aCallbackArgument) {
@@ -652,7 +927,7 @@ void LocalRegion::setPersistenceManager(
     std::shared_ptr<PersistenceManager>& pmPtr) {
   m_persistenceManager = pmPtr;
   // set the memberVariable of LRUEntriesMap too.
-  LRUEntriesMap* lruMap = dynamic_cast<LRUEntriesMap*>(m_entries);
+  LRUEntriesMap* lruMap = lruEntriesMap(m_entries);
   if (lruMap != nullptr) {
     lruMap->setPersistenceManager(pmPtr);
   }
@@ -705,6 +980,7 @@ LocalRegion::~LocalRegion() {
   if (!m_destroyPending) {
     release(false);
   }
+  m_listenerDispatcher = nullptr;
   m_listener = nullptr;
   m_writer = nullptr;
   m_loader = nullptr;
@@ -723,6 +999,17 @@ void LocalRegion::release(bool invokeCallbacks) {
   LOGFINE("LocalRegion::release entered for region %s", m_fullPath.c_str());
   m_released = true;
 
+  if (m_listenerDispatcher != nullptr) {
+    m_listenerDispatcher->stop();
+  }
+  {
+    std::lock_guard<std::mutex> guard(m_queryIndexesMutex);
+    m_hasQueryIndexes = false;
+    std::atomic_store(
+        &m_queryIndexes,
+        std::shared_ptr<const std::vector<std::shared_ptr<LocalQueryIndex>>>());
+  }
+
   if (m_regionStats != nullptr) {
     m_regionStats->close();
   }
@@ -960,7 +1247,7 @@ GfErrType LocalRegion::getNoThrow(
         LOGDEBUG("Region::get: returning updated value [%s] for key [%s]",
                  Utils::getCacheableString(oldValue)->asChar(),
                  Utils::getCacheableKeyString(keyPtr)->asChar());
-        value = oldValue;
+        value = toObject(oldValue);
       }
     }
     // signal no explicit removal of tracking to the RemoveTracking object
@@ -1275,6 +1562,7 @@ class DestroyActions {
         }
         return err;
       }
+      m_region.refreshQueryIndexes(key);
 
       if (oldValue != nullptr) {
         LOGDEBUG(
@@ -1284,7 +1572,8 @@ class DestroyActions {
             Utils::getCacheableString(oldValue)->asChar());
         // any cleanup required for the entry (e.g. removing from LRU list)
         if (entry != nullptr) {
-          entry->cleanup(eventFlags);
+          entry->cleanup(eventFlags,
+                         m_region.getCacheImpl()->getExpiryTaskManager());
         }
         // entry/region expiration
         if (!eventFlags.isEvictOrExpire()) {
@@ -1478,6 +1767,7 @@ class RemoveActions {
         }
         return err;
       }
+      m_region.refreshQueryIndexes(key);
       if (oldValue != nullptr) {
         LOGDEBUG(
             "Region::remove: region [%s] removed key [%s] having "
@@ -1486,7 +1776,8 @@ class RemoveActions {
             Utils::getCacheableString(oldValue)->asChar());
         // any cleanup required for the entry (e.g. removing from LRU list)
         if (entry != nullptr) {
-          entry->cleanup(eventFlags);
+          entry->cleanup(eventFlags,
+                         m_region.getCacheImpl()->getExpiryTaskManager());
         }
         // entry/region expiration
         if (!eventFlags.isEvictOrExpire()) {
@@ -1693,6 +1984,7 @@ GfErrType LocalRegion::updateNoThrow(
       if (err == GF_NOERR && newValue1 != nullptr) {
         err = m_entries->put(key, newValue1, entry, oldValue, updateCount, 0,
                              versionTag1 != nullptr ? versionTag1 : versionTag);
+        refreshQueryIndexes(key);
         if (err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
           LOGDEBUG(
               "Region::localUpdate: updateNoThrow<%s> for key [%s] failed because the cache already contains \
@@ -2162,7 +2454,10 @@ GfErrType LocalRegion::localClearNoThrow(
     LOGFINE("Cache writer prevented region clear");
     return GF_CACHEWRITER_ERROR;
   }
-  if (cachingEnabled == true) m_entries->clear();
+  if (cachingEnabled == true) {
+    m_entries->clear();
+    refreshQueryIndexes();
+  }
   if (!eventFlags.isNormal()) {
     err = invokeCacheListenerForRegionEvent(aCallbackArgument, eventFlags,
                                             AFTER_REGION_CLEAR);
@@ -2221,6 +2516,7 @@ GfErrType LocalRegion::invalidateLocal(
       } else {
         LOGDEBUG("Region::invalidate: region [%s] invalidated key [%s]",
                  getFullPath(), Utils::getCacheableKeyString(keyPtr)->asChar());
+        refreshQueryIndexes(keyPtr);
       }
       // entry/region expiration
       if (!eventFlags.isEvictOrExpire()) {
@@ -2259,6 +2555,7 @@ GfErrType LocalRegion::invalidateRegionNoThrow(
     if (!eventFlags.isEvictOrExpire()) {
       updateAccessAndModifiedTime(true);
     }
+    refreshQueryIndexes();
   }
 
   // try remote region invalidate, if any
@@ -2290,6 +2587,11 @@ GfErrType LocalRegion::invalidateRegionNoThrow(
 GfErrType LocalRegion::destroyRegionNoThrow(
     const std::shared_ptr<Serializable>& aCallbackArgument,
     bool removeFromParent, const CacheEventFlags eventFlags) {
+  // deliver the queued entry events before taking the locks, which the
+  // listener may need while handling them
+  if (m_listenerDispatcher != nullptr) {
+    m_listenerDispatcher->flush();
+  }
   // Get global locks to synchronize with failover thread.
   // TODO:  This should go into RegionGlobalLocks
   // The distMngrsLock is required before RegionGlobalLocks since failover
@@ -2383,6 +2685,9 @@ GfErrType LocalRegion::destroyRegionNoThrow(
   err = invokeCacheListenerForRegionEvent(aCallbackArgument, eventFlags,
                                           AFTER_REGION_DESTROY);
 
+  // subregions are destroyed without being removed from their parent, but
+  // each leaves the registry of full paths
+  m_cacheImpl->getRegionRegistry().remove(this);
   release(true);
   if (m_regionAttributes->getCachingEnabled()) {
     GF_SAFE_DELETE(m_entries);
@@ -2447,6 +2752,7 @@ GfErrType LocalRegion::putLocal(
     if (err != GF_NOERR) {
       return err;
     }
+    refreshQueryIndexes(key);
     LOGDEBUG("%s: region [%s] %s key [%s], value [%s]", name, getFullPath(),
              isUpdate ? "updated" : "created",
              Utils::getCacheableKeyString(key)->asChar(),
@@ -2476,6 +2782,54 @@ GfErrType LocalRegion::putLocal(
   return err;
 }
 
+void LocalRegion::putLocalBatch(const char* name, BatchPutEntries& entries,
+                                int destroyTracker) {
+  auto& cachePerfStats = m_cacheImpl->getCachePerfStats();
+  if (!m_regionAttributes->getCachingEnabled()) {
+    m_regionStats->incCreates(static_cast<int32_t>(entries.size()));
+    cachePerfStats.incCreates(static_cast<int32_t>(entries.size()));
+    return;
+  }
+
+  m_entries->putBatch(entries, destroyTracker);
+  int32_t creates = 0;
+  int32_t updates = 0;
+  for (auto& entry : entries) {
+    if (entry.err != GF_NOERR) {
+      continue;
+    }
+    refreshQueryIndexes(entry.key);
+    // entry expiration
+    if (entryExpiryEnabled()) {
+      if (entry.isUpdate &&
+          entry.entry->getExpProperties().getExpiryTaskId() != -1) {
+        updateAccessAndModifiedTimeForEntry(entry.entry, true);
+      } else {
+        registerEntryExpiryTask(entry.entry);
+      }
+    }
+    if (entry.isUpdate) {
+      ++updates;
+    } else {
+      ++creates;
+    }
+  }
+  LOGDEBUG("%s: region [%s] put %d entries, %d of them new", name,
+           getFullPath(), creates + updates, creates);
+  if (creates + updates == 0) {
+    return;
+  }
+  updateAccessAndModifiedTime(true);
+
+  // update the stats
+  m_regionStats->incPuts(updates);
+  cachePerfStats.incPuts(updates);
+  m_regionStats->setEntries(m_entries->size());
+  cachePerfStats.incEntries(creates);
+  m_regionStats->incCreates(creates);
+  cachePerfStats.incCreates(creates);
+}
+
 std::vector<std::shared_ptr<CacheableKey>> LocalRegion::keys_internal() {
   std::vector<std::shared_ptr<CacheableKey>>  keys;
 
@@ -2630,10 +2984,40 @@ GfErrType LocalRegion::invokeCacheListenerForEntryEvent(
     if (oldValue != nullptr && CacheableToken::isInvalid(oldValue)) {
       oldValue = nullptr;
     }
-    EntryEvent event(shared_from_this(), key, oldValue, newValue,
-                     aCallbackArgument, eventFlags.isNotification());
+    if (m_listenerDispatcher != nullptr) {
+      m_listenerDispatcher->dispatch(
+          key,
+          [=]() {
+            callCacheListenerForEntryEvent(key, oldValue, newValue,
+                                           aCallbackArgument, eventFlags, type,
+                                           isLocal);
+          },
+          type == AFTER_UPDATE);
+    } else {
+      err = callCacheListenerForEntryEvent(key, oldValue, newValue,
+                                           aCallbackArgument, eventFlags, type,
+                                           isLocal);
+    }
+  }
+  return err;
+}
+
+GfErrType LocalRegion::callCacheListenerForEntryEvent(
+    const std::shared_ptr<CacheableKey>& key,
+    const std::shared_ptr<Cacheable>& oldValue,
+    const std::shared_ptr<Cacheable>& newValue,
+    const std::shared_ptr<Serializable>& aCallbackArgument,
+    CacheEventFlags eventFlags, EntryEventType type, bool isLocal) {
+  GfErrType err = GF_NOERR;
+
+  // the listener may have been removed while the event was queued
+  if (m_listener != nullptr) {
     const char* eventStr = "unknown";
     try {
+      // values received serialized are deserialized only for the listener
+      EntryEvent event(shared_from_this(), key, toObject(oldValue),
+                       toObject(newValue), aCallbackArgument,
+                       eventFlags.isNotification());
       bool updateStats = true;
       /*Update the CacheWriter Stats*/
       int64_t sampleStartNanos = startStatOpTime();
@@ -2690,6 +3074,12 @@ GfErrType LocalRegion::invokeCacheListenerForEntryEvent(
   return err;
 }
 
+std::shared_ptr<Cacheable> LocalRegion::toObject(
+    const std::shared_ptr<Cacheable>& value) const {
+  return SerializedValue::toObject(value, *m_cacheImpl->getCache(),
+                                   m_regionAttributes->getPoolName());
+}
+
 GfErrType LocalRegion::invokeCacheListenerForRegionEvent(
     const std::shared_ptr<Serializable>& aCallbackArgument,
     CacheEventFlags eventFlags, RegionEventType type) {
@@ -2697,6 +3087,9 @@ GfErrType LocalRegion::invokeCacheListenerForRegionEvent(
 
   // Check if we have a local cache listener. If so, invoke and return.
   if (m_listener != nullptr) {
+    if (m_listenerDispatcher != nullptr) {
+      m_listenerDispatcher->flush();
+    }
     RegionEvent event(shared_from_this(), aCallbackArgument,
                       eventFlags.isNotification());
     const char* eventStr = "unknown";
@@ -2792,7 +3185,7 @@ uint32_t LocalRegion::adjustLruEntriesLimit(uint32_t limit) {
   setLruEntriesLimit(limit);
   if (needslru) {
     // checked in AttributesMutator already to assert that LRU was enabled..
-    LRUEntriesMap* lrumap = static_cast<LRUEntriesMap*>(m_entries);
+    LRUEntriesMap* lrumap = lruEntriesMap(m_entries);
 
     lrumap->adjustLimit(limit);
   }
@@ -3082,21 +3475,32 @@ void LocalRegion::adjustCacheWriter(const char* lib, const char* func) {
   m_writer = m_regionAttributes->getCacheWriter();
 }
 
-void LocalRegion::evict(int32_t percentage) {
+bool LocalRegion::sampleLRU(uint32_t& lastAccess, int64_t& entrySize) {
   TryReadGuard guard(m_rwLock, m_destroyPending);
-  if (m_released || m_destroyPending) return;
-  if (m_entries != nullptr) {
-    int32_t size = m_entries->size();
-    int32_t entriesToEvict = (percentage * size) / 100;
-    // only invoked from EvictionController so static_cast is always safe
-    LRUEntriesMap* lruMap = static_cast<LRUEntriesMap*>(m_entries);
-    LOGINFO("Evicting %d entries. Current entry count is %d", entriesToEvict,
-            size);
-    lruMap->processLRU(entriesToEvict);
-  }
+  if (m_released || m_destroyPending || m_entries == nullptr) return false;
+  // only invoked from EvictionController so this is always an LRU map
+  return lruEntriesMap(m_entries)->sampleLRU(lastAccess, entrySize);
+}
+
+int64_t LocalRegion::evict(int64_t bytes) {
+  TryReadGuard guard(m_rwLock, m_destroyPending);
+  if (m_released || m_destroyPending || m_entries == nullptr) return 0;
+  // only invoked from EvictionController so this is always an LRU map
+  LRUEntriesMap* lruMap = lruEntriesMap(m_entries);
+  int32_t entries = 0;
+  int64_t evicted = lruMap->evictBytes(bytes, entries);
+  if (entries > 0) {
+    LOGFINE("Evicted %d entries, %lld bytes, from region %s", entries,
+            static_cast<long long>(evicted), m_fullPath.c_str());
+    m_regionStats->incHeapLRUEvictions(entries, evicted);
+  }
+  return evicted;
 }
 void LocalRegion::invokeAfterAllEndPointDisconnected() {
   if (m_listener != nullptr) {
+    if (m_listenerDispatcher != nullptr) {
+      m_listenerDispatcher->flush();
+    }
     int64_t sampleStartNanos = startStatOpTime();
     try {
       m_listener->afterRegionDisconnected(shared_from_this());
@@ -3146,6 +3550,24 @@ void LocalRegion::updateStatOpTime(Statistics* statistics, int32_t statId,
     Utils::updateStatOpTime(statistics, statId, start);
   }
 }
+void LocalRegion::updateGetStatOpTime(int64_t start) {
+  if (m_enableTimeStatistics) {
+    auto elapsed = Utils::updateStatOpTime(m_regionStats->getStat(),
+                                           m_regionStats->getGetTimeId(),
+                                           m_regionStats->getGetLatencyId(),
+                                           start);
+    m_cacheImpl->getCachePerfStats().recordGetLatency(elapsed);
+  }
+}
+void LocalRegion::updatePutStatOpTime(int64_t start) {
+  if (m_enableTimeStatistics) {
+    auto elapsed = Utils::updateStatOpTime(m_regionStats->getStat(),
+                                           m_regionStats->getPutTimeId(),
+                                           m_regionStats->getPutLatencyId(),
+                                           start);
+    m_cacheImpl->getCachePerfStats().recordPutLatency(elapsed);
+  }
+}
 
 }  // namespace client
 }  // namespace geode
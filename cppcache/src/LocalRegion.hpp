@@ -49,11 +49,15 @@
 #include "CacheableToken.hpp"
 #include "ExpMapEntry.hpp"
 #include "TombstoneList.hpp"
+#include "CacheListenerDispatcher.hpp"
+#include "LocalQueryIndex.hpp"
 
 #include <ace/ACE.h>
 #include <ace/Hash_Map_Manager_T.h>
 #include <ace/Recursive_Thread_Mutex.h>
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include "TSSTXStateWrapper.hpp"
@@ -222,6 +226,31 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
   std::vector<std::shared_ptr<CacheableKey>> serverKeys() override;
   std::vector<std::shared_ptr<Cacheable>> values() override;
   std::vector<std::shared_ptr<RegionEntry>> entries(bool recursive) override;
+  std::unique_ptr<RegionEntryCursor> entryCursor() override;
+  void parallelScan(const std::function<void(RegionEntryCursor&)>& scan,
+                    uint32_t parallelism = 0) override;
+  RegionMemoryFootprint getMemoryFootprint() override;
+
+  /**
+   * Appends the keys and values of one segment of the entries map, for
+   * cursors that walk the region a segment at a time.
+   */
+  void getSegmentEntries(uint32_t segment, KeyValuePairs& result);
+
+  /**
+   * Adds a secondary index for local queries and populates it from the
+   * entries of the region. The index is kept up to date from then on.
+   */
+  void addQueryIndex(const std::shared_ptr<LocalQueryIndex>& index);
+  bool removeQueryIndex(const std::string& name);
+  std::vector<std::shared_ptr<LocalQueryIndex>> getQueryIndexes() const;
+
+  /**
+   * Appends the keys and values of the entries for keys that hold a valid
+   * value locally, without going to a loader or server.
+   */
+  void getLocalEntries(const std::vector<std::shared_ptr<CacheableKey>>& keys,
+                       KeyValuePairs& result);
 
   HashMapOfCacheable getAll(
       const std::vector<std::shared_ptr<CacheableKey>>& keys,
@@ -352,6 +381,13 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
                      std::shared_ptr<VersionTag> versionTag,
                      DataInput* delta = nullptr,
                      std::shared_ptr<EventId> eventId = nullptr);
+  /**
+   * put a batch of entries in local cache without update tracking or
+   * invoking any callbacks, as when loading the initial image of the region;
+   * the outcome of each put is left in its entry
+   */
+  void putLocalBatch(const char* name, BatchPutEntries& entries,
+                     int destroyTracker);
   GfErrType invalidateLocal(const char* name,
                             const std::shared_ptr<CacheableKey>& keyPtr,
                             const std::shared_ptr<Cacheable>& value,
@@ -396,7 +432,8 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
   virtual void adjustCacheWriter(const char* libpath,
                                  const char* factoryFuncName) override;
   virtual CacheImpl* getCacheImpl() const override;
-  virtual void evict(int32_t percentage) override;
+  virtual bool sampleLRU(uint32_t& lastAccess, int64_t& entrySize) override;
+  virtual int64_t evict(int64_t bytes) override;
 
   virtual void acquireGlobals(bool isFailover){};
   virtual void releaseGlobals(bool isFailover){};
@@ -497,9 +534,18 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
       const CacheEventFlags eventFlags, std::shared_ptr<VersionTag> versionTag,
       DataInput* delta = nullptr, std::shared_ptr<EventId> eventId = nullptr);
 
+  // brings the local query indexes up to date after an entry changed, or
+  // after many entries changed at once
+  void refreshQueryIndexes(const std::shared_ptr<CacheableKey>& key);
+  void refreshQueryIndexes();
+  std::shared_ptr<Cacheable> getLocalValue(
+      const std::shared_ptr<CacheableKey>& key);
+
   int64_t startStatOpTime();
   void updateStatOpTime(Statistics* m_regionStats, int32_t statId,
                         int64_t start);
+  void updateGetStatOpTime(int64_t start);
+  void updatePutStatOpTime(int64_t start);
 
   /* protected attributes */
   std::string m_name;
@@ -514,6 +560,12 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
   volatile bool m_released;
   EntriesMap* m_entries;  // map containing cache entries...
   RegionStats* m_regionStats;
+  std::unique_ptr<CacheListenerDispatcher> m_listenerDispatcher;
+  // replaced as a whole, so updates read the indexes without locking
+  std::shared_ptr<const std::vector<std::shared_ptr<LocalQueryIndex>>>
+      m_queryIndexes;
+  std::atomic<bool> m_hasQueryIndexes;
+  std::mutex m_queryIndexesMutex;
   std::shared_ptr<CacheStatistics> m_cacheStatistics;
   bool m_transactionEnabled;
   std::shared_ptr<TombstoneList> m_tombstoneList;
@@ -541,9 +593,18 @@ class CPPCACHE_EXPORT LocalRegion : public RegionInternal {
       const std::shared_ptr<Cacheable>& newValue,
       const std::shared_ptr<Serializable>& aCallbackArgument,
       CacheEventFlags eventFlags, EntryEventType type, bool isLocal = false);
+  GfErrType callCacheListenerForEntryEvent(
+      const std::shared_ptr<CacheableKey>& key,
+      const std::shared_ptr<Cacheable>& oldValue,
+      const std::shared_ptr<Cacheable>& newValue,
+      const std::shared_ptr<Serializable>& aCallbackArgument,
+      CacheEventFlags eventFlags, EntryEventType type, bool isLocal);
   GfErrType invokeCacheListenerForRegionEvent(
       const std::shared_ptr<Serializable>& aCallbackArgument,
       CacheEventFlags eventFlags, RegionEventType type);
+  // deserializes a value the entries map stores serialized
+  std::shared_ptr<Cacheable> toObject(
+      const std::shared_ptr<Cacheable>& value) const;
   // functions related to expirations.
   void updateAccessAndModifiedTimeForEntry(std::shared_ptr<MapEntryImpl>& ptr,
                                            bool modified) override;
@@ -23,13 +23,13 @@ namespace geode {
 namespace client {
 std::shared_ptr<MapEntry> MapEntry::MapEntry_NullPointer(nullptr);
 
-void EntryFactory::newMapEntry(ExpiryTaskManager* expiryTaskManager,
+void EntryFactory::newMapEntry(SlabArena* arena,
                                const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<MapEntryImpl>& result) const {
   if (m_concurrencyChecksEnabled) {
-    result = MapEntryT<VersionedMapEntryImpl, 0, 0>::create(key);
+    result = MapEntryT<VersionedMapEntryImpl, 0, 0>::create(arena, key);
   } else {
-    result = MapEntryT<MapEntryImpl, 0, 0>::create(key);
+    result = MapEntryT<MapEntryImpl, 0, 0>::create(arena, key);
   }
 }
 
@@ -33,6 +33,7 @@
 #include "ExpiryTaskManager.hpp"
 #include "RegionInternal.hpp"
 #include "CacheableToken.hpp"
+#include "SlabArena.hpp"
 #include "VersionStamp.hpp"
 
 namespace apache {
@@ -52,11 +53,10 @@ class CPPCACHE_EXPORT ExpEntryProperties {
  public:
   typedef std::chrono::system_clock::time_point time_point;
 
-  inline ExpEntryProperties(ExpiryTaskManager* expiryTaskManager)
+  inline ExpEntryProperties()
       : m_lastAccessTime(time_point()),
         m_lastModifiedTime(time_point()),
-        m_expiryTaskId(-1),
-        m_expiryTaskManager(expiryTaskManager) {
+        m_expiryTaskId(-1) {
     // The reactor always gives +ve id while scheduling.
     // -1 will indicate that an expiry task has not been scheduled
     // for this entry. // TODO confirm
@@ -85,10 +85,11 @@ class CPPCACHE_EXPORT ExpEntryProperties {
 
   inline long getExpiryTaskId() const { return m_expiryTaskId; }
 
-  inline void cancelExpiryTaskId(const std::shared_ptr<CacheableKey>& key) const {
+  inline void cancelExpiryTaskId(const std::shared_ptr<CacheableKey>& key,
+                                 ExpiryTaskManager& expiryTaskManager) const {
     LOGDEBUG("Cancelling expiration task for key [%s] with id [%d]",
              Utils::getCacheableKeyString(key)->asChar(), m_expiryTaskId);
-    m_expiryTaskManager->cancelTask(m_expiryTaskId);
+    expiryTaskManager.cancelTask(m_expiryTaskId);
   }
 
  protected:
@@ -103,7 +104,6 @@ class CPPCACHE_EXPORT ExpEntryProperties {
   std::atomic<time_point> m_lastModifiedTime;
   /** The expiry task id for this particular entry.. **/
   long m_expiryTaskId;
-  ExpiryTaskManager* m_expiryTaskManager;
 };
 
 /**
@@ -179,7 +179,8 @@ class CPPCACHE_EXPORT MapEntry {
   /**
    * Any cleanup required (e.g. removing from LRUList) for the entry.
    */
-  virtual void cleanup(const CacheEventFlags eventFlags) = 0;
+  virtual void cleanup(const CacheEventFlags eventFlags,
+                       ExpiryTaskManager& expiryTaskManager) = 0;
 
  protected:
   inline MapEntry() {}
@@ -242,7 +243,8 @@ class MapEntryImpl : public MapEntry,
         "MapEntry::getVersionStamp called for "
         "non-versioned MapEntry");
   }
-  virtual void cleanup(const CacheEventFlags eventFlags) {}
+  virtual void cleanup(const CacheEventFlags eventFlags,
+                       ExpiryTaskManager& expiryTaskManager) {}
 
  protected:
   inline explicit MapEntryImpl(bool noInit)
@@ -286,10 +288,17 @@ class CPPCACHE_EXPORT EntryFactory {
 
   virtual ~EntryFactory() {}
 
-  virtual void newMapEntry(ExpiryTaskManager* expiryTaskManager,
+  /**
+   * Creates an entry for <code>key</code>. The entry and its reference
+   * count are allocated together from <code>arena</code>.
+   */
+  virtual void newMapEntry(SlabArena* arena,
                            const std::shared_ptr<CacheableKey>& key,
                            std::shared_ptr<MapEntryImpl>& result) const;
 
+  /** Returns whether the entries created have expiry properties. */
+  virtual bool withExpiry() const { return false; }
+
  protected:
   bool m_concurrencyChecksEnabled;
 };
@@ -117,17 +117,15 @@ class MapEntryT : public TBase {
     return std::make_shared<MapEntryT>(key);
   }
 
+  // the entry and its reference count share a single block of the arena
   inline static std::shared_ptr<MapEntryT> create(
-      ExpiryTaskManager* expiryTaskManager,
-      const std::shared_ptr<CacheableKey>& key) {
-    return std::make_shared<MapEntryT>(expiryTaskManager, key);
+      SlabArena* arena, const std::shared_ptr<CacheableKey>& key) {
+    return std::allocate_shared<MapEntryT>(SlabAllocator<MapEntryT>(arena),
+                                           key);
   }
 
- protected:
+  // public for allocate_shared, which constructs through the allocator
   inline MapEntryT(const std::shared_ptr<CacheableKey>& key) : TBase(key) {}
-  inline MapEntryT(ExpiryTaskManager* expiryTaskManager,
-                   const std::shared_ptr<CacheableKey>& key)
-      : TBase(expiryTaskManager, key) {}
 
  private:
   // disabled
@@ -24,9 +24,12 @@
 #include "ThinClientPoolDM.hpp"
 #include "ThinClientRegion.hpp"
 #include "TombstoneExpiryHandler.hpp"
+#include "EntryExpiryHandler.hpp"
+#include "CacheImpl.hpp"
 #include <ace/OS.h>
 #include "ace/Time_Value.h"
 
+#include <chrono>
 #include <mutex>
 #include "util/concurrent/spinlock_mutex.hpp"
 
@@ -39,6 +42,10 @@ namespace client {
 bool MapSegment::boolVal = false;
 MapSegment::~MapSegment() {
   delete m_map;
+  delete m_nodeAllocator;
+  if (m_entryArena != nullptr) {
+    m_entryArena->release();
+  }
   // m_entryFactory will be disposed by the containing EntriesMap impl.
 }
 
@@ -46,11 +53,13 @@ void MapSegment::open(RegionInternal* region, const EntryFactory* entryFactory,
                       ExpiryTaskManager* expiryTaskManager, uint32_t size,
                       std::atomic<int32_t>* destroyTrackers,
                       bool concurrencyChecksEnabled) {
+  m_nodeAllocator = new NodeAllocator();
+  m_entryArena = new SlabArena();
   m_map = new CacheableKeyHashMap();
   uint32_t mapSize = TableOfPrimes::nextLargerPrime(size, m_primeIndex);
   LOGFINER("Initializing MapSegment with size %d (given size %d).", mapSize,
            size);
-  m_map->open(mapSize);
+  m_map->open(mapSize, nullptr, m_nodeAllocator);
   m_entryFactory = entryFactory;
   m_region = region;
   m_tombstoneList =
@@ -67,6 +76,11 @@ void MapSegment::clear() {
   m_map->unbind_all();
 }
 
+size_t MapSegment::getReservedBytes() const {
+  return m_nodeAllocator->getReservedBytes() +
+         m_entryArena->getReservedBytes();
+}
+
 int MapSegment::acquire() { return m_segmentMutex.acquire(); }
 
 int MapSegment::release() { return m_segmentMutex.release(); }
@@ -151,60 +165,116 @@ GfErrType MapSegment::put(const std::shared_ptr<CacheableKey>& key,
   GfErrType err = GF_NOERR;
   {
     std::lock_guard<spinlock_mutex> lk(m_spinlock);
-    // if size is greater than 75 percent of prime, rehash
-    uint32_t mapSize = TableOfPrimes::getPrime(m_primeIndex);
-    if (((m_map->current_size() * 75) / 100) > mapSize) {
-      rehash();
-    }
-    std::shared_ptr<MapEntry> entry;
-    int status;
-    if ((status = m_map->find(key, entry)) == -1) {
-      if (delta != nullptr) {
-        return GF_INVALID_DELTA;  // You can not apply delta when there is no
-      }
-      // entry hence ask for full object
-      isUpdate = false;
-      err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
-                       versionTag);
-    } else {
-      auto entryImpl = entry->getImplPtr();
-      std::shared_ptr<Cacheable> meOldValue;
-      entryImpl->getValueI(meOldValue);
-      // pass the version stamp
-      VersionStamp versionStamp;
-      if (m_concurrencyChecksEnabled) {
-        versionStamp = entry->getVersionStamp();
-        if (_VERSION_TAG_NULL_CHK) {
-          if (delta == nullptr) {
-            err = versionStamp.processVersionTag(m_region, key, versionTag,
-                                                 false);
-          } else {
-            err =
-                versionStamp.processVersionTag(m_region, key, versionTag, true);
-          }
+    err = unguardedPut(key, newValue, me, oldValue, updateCount,
+                       destroyTracker, isUpdate, versionTag, delta, taskid,
+                       handler);
+  }
+  if (taskid != -1) {
+    m_expiryTaskManager->cancelTask(taskid);
+    if (handler != nullptr) delete handler;
+  }
+  return err;
+}
 
-          if (err != GF_NOERR) return err;
-          versionStamp.setVersions(versionTag);
+void MapSegment::putBatch(std::vector<BatchPutEntry*>& entries,
+                          int destroyTracker) {
+  std::vector<std::pair<int64_t, TombstoneExpiryHandler*>> expiredTombstones;
+  {
+    std::lock_guard<spinlock_mutex> lk(m_spinlock);
+    reserve(static_cast<uint32_t>(m_map->current_size() + entries.size()));
+    // nothing in an empty segment can be tracked, so unless destroys are
+    // being tracked the entries are bound without looking them up first
+    bool bindNew = m_map->current_size() == 0 &&
+                   (destroyTracker <= 0 || *m_numDestroyTrackers == 0);
+    for (auto entry : entries) {
+      entry->isUpdate = true;
+      if (bindNew) {
+        std::shared_ptr<MapEntryImpl> newEntry;
+        m_entryFactory->newMapEntry(m_entryArena, entry->key, newEntry);
+        newEntry->setValueI(entry->value);
+        if (m_concurrencyChecksEnabled && entry->versionTag != nullptr) {
+          newEntry->getVersionStamp().setVersions(entry->versionTag);
+        }
+        if (m_map->bind(entry->key, newEntry) == 0) {
+          entry->entry = newEntry;
+          entry->isUpdate = false;
+          entry->err = GF_NOERR;
+          continue;
         }
       }
-      if (CacheableToken::isTombstone(meOldValue)) {
-        unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
-        err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
-                         versionTag, &versionStamp);
-        meOldValue = nullptr;
-        isUpdate = false;
-      } else if ((err = putForTrackedEntry(key, newValue, entry, entryImpl,
-                                           updateCount, versionStamp, delta)) ==
-                 GF_NOERR) {
-        me = entryImpl;
-        oldValue = meOldValue;
-        isUpdate = (meOldValue != nullptr);
+      int64_t taskid = -1;
+      TombstoneExpiryHandler* handler = nullptr;
+      entry->err = unguardedPut(entry->key, entry->value, entry->entry,
+                                entry->oldValue, -1, destroyTracker,
+                                entry->isUpdate, entry->versionTag, nullptr,
+                                taskid, handler);
+      if (taskid != -1) {
+        expiredTombstones.emplace_back(taskid, handler);
       }
     }
   }
-  if (taskid != -1) {
-    m_expiryTaskManager->cancelTask(taskid);
-    if (handler != nullptr) delete handler;
+  for (const auto& tombstone : expiredTombstones) {
+    m_expiryTaskManager->cancelTask(tombstone.first);
+    if (tombstone.second != nullptr) delete tombstone.second;
+  }
+}
+
+GfErrType MapSegment::unguardedPut(
+    const std::shared_ptr<CacheableKey>& key,
+    const std::shared_ptr<Cacheable>& newValue,
+    std::shared_ptr<MapEntryImpl>& me, std::shared_ptr<Cacheable>& oldValue,
+    int updateCount, int destroyTracker, bool& isUpdate,
+    std::shared_ptr<VersionTag> versionTag, DataInput* delta, int64_t& taskid,
+    TombstoneExpiryHandler*& handler) {
+  GfErrType err = GF_NOERR;
+  // if size is greater than 75 percent of prime, rehash
+  uint32_t mapSize = TableOfPrimes::getPrime(m_primeIndex);
+  if (((m_map->current_size() * 75) / 100) > mapSize) {
+    rehash();
+  }
+  std::shared_ptr<MapEntry> entry;
+  int status;
+  if ((status = m_map->find(key, entry)) == -1) {
+    if (delta != nullptr) {
+      return GF_INVALID_DELTA;  // You can not apply delta when there is no
+    }
+    // entry hence ask for full object
+    isUpdate = false;
+    err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+                     versionTag);
+  } else {
+    auto entryImpl = entry->getImplPtr();
+    std::shared_ptr<Cacheable> meOldValue;
+    entryImpl->getValueI(meOldValue);
+    // pass the version stamp
+    VersionStamp versionStamp;
+    if (m_concurrencyChecksEnabled) {
+      versionStamp = entry->getVersionStamp();
+      if (_VERSION_TAG_NULL_CHK) {
+        if (delta == nullptr) {
+          err = versionStamp.processVersionTag(m_region, key, versionTag,
+                                               false);
+        } else {
+          err = versionStamp.processVersionTag(m_region, key, versionTag, true);
+        }
+
+        if (err != GF_NOERR) return err;
+        versionStamp.setVersions(versionTag);
+      }
+    }
+    if (CacheableToken::isTombstone(meOldValue)) {
+      unguardedRemoveActualEntryWithoutCancelTask(key, handler, taskid);
+      err = putNoEntry(key, newValue, me, updateCount, destroyTracker,
+                       versionTag, &versionStamp);
+      meOldValue = nullptr;
+      isUpdate = false;
+    } else if ((err = putForTrackedEntry(key, newValue, entry, entryImpl,
+                                         updateCount, versionStamp, delta)) ==
+               GF_NOERR) {
+      me = entryImpl;
+      oldValue = meOldValue;
+      isUpdate = (meOldValue != nullptr);
+    }
   }
   return err;
 }
@@ -431,6 +501,24 @@ bool MapSegment::getEntry(const std::shared_ptr<CacheableKey>& key, std::shared_
   return true;
 }
 
+bool MapSegment::replaceValue(const std::shared_ptr<CacheableKey>& key,
+                              const std::shared_ptr<Cacheable>& expected,
+                              const std::shared_ptr<Cacheable>& replacement) {
+  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  std::shared_ptr<MapEntry> entry;
+  if (m_map->find(key, entry) == -1) {
+    return false;
+  }
+  auto mePtr = entry->getImplPtr();
+  std::shared_ptr<Cacheable> value;
+  mePtr->getValueI(value);
+  if (value != expected) {
+    return false;
+  }
+  mePtr->setValueI(replacement);
+  return true;
+}
+
 /**
  * @brief return true if there exists an entry for the key.
  */
@@ -487,6 +575,80 @@ void MapSegment::getEntries(std::vector<std::shared_ptr<RegionEntry>>& result) {
   }
 }
 
+/**
+ * @brief return the keys and values of all the entries in the provided list.
+ */
+void MapSegment::getKeyValues(KeyValuePairs& result) {
+  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  result.reserve(result.size() + m_map->current_size());
+  for (CacheableKeyHashMap::iterator iter = m_map->begin();
+       iter != m_map->end(); iter++) {
+    std::shared_ptr<Cacheable> valuePtr;
+    auto entryImpl = ((*iter).int_id_)->getImplPtr();
+    entryImpl->getValueI(valuePtr);
+    if (valuePtr == nullptr || CacheableToken::isTombstone(valuePtr) ||
+        CacheableToken::isDestroyed(valuePtr)) {
+      continue;
+    }
+    if (CacheableToken::isInvalid(valuePtr)) {
+      valuePtr = nullptr;
+    } else if (CacheableToken::isOverflowed(valuePtr)) {
+      valuePtr = getFromDisc((*iter).ext_id_, entryImpl);
+      entryImpl->setValueI(valuePtr);
+    }
+    result.emplace_back((*iter).ext_id_, valuePtr);
+  }
+}
+
+void MapSegment::addMemoryFootprint(RegionMemoryFootprint& footprint) {
+  // a scheduled task takes a node of the timer heap besides its handler
+  static const int64_t TIMER_NODE_BYTES =
+      sizeof(ACE_Timer_Node_T<ACE_Event_Handler*>);
+  // each tombstone also has a node in the tombstone list
+  static const int64_t TOMBSTONE_NODE_BYTES =
+      sizeof(TombstoneEntry) + 2 * sizeof(std::shared_ptr<TombstoneEntry>) +
+      2 * sizeof(void*);
+
+  bool withExpiry = m_entryFactory->withExpiry();
+  std::lock_guard<spinlock_mutex> lk(m_spinlock);
+  for (CacheableKeyHashMap::iterator iter = m_map->begin();
+       iter != m_map->end(); iter++) {
+    std::shared_ptr<Cacheable> value;
+    auto entryImpl = ((*iter).int_id_)->getImplPtr();
+    entryImpl->getValueI(value);
+    int64_t keyBytes = (*iter).ext_id_->objectSize();
+    if (CacheableToken::isTombstone(value)) {
+      ++footprint.m_tombstones;
+      footprint.m_tombstoneBytes += keyBytes + TOMBSTONE_NODE_BYTES;
+      ++footprint.m_expiryTasks;
+      footprint.m_expiryTaskBytes +=
+          sizeof(TombstoneExpiryHandler) + TIMER_NODE_BYTES;
+      continue;
+    }
+    // keys of destroyed entries still being tracked take memory all the same
+    footprint.m_keyBytes += keyBytes;
+    if (CacheableToken::isDestroyed(value)) {
+      continue;
+    }
+    ++footprint.m_entries;
+    if (value != nullptr && !CacheableToken::isToken(value)) {
+      footprint.m_valueBytes += value->objectSize();
+    }
+    if (withExpiry && entryImpl->getExpProperties().getExpiryTaskId() != -1) {
+      ++footprint.m_expiryTasks;
+      footprint.m_expiryTaskBytes +=
+          sizeof(EntryExpiryHandler) + TIMER_NODE_BYTES;
+    }
+  }
+
+  // the arenas and the bucket array of the map are sized without a walk
+  int64_t usedBytes =
+      m_nodeAllocator->getUsedBytes() + m_entryArena->getUsedBytes();
+  footprint.m_entryOverheadBytes +=
+      usedBytes + m_map->total_size() * sizeof(CacheableKeyHashMap::ENTRY);
+  footprint.m_pooledBytes += getReservedBytes() - usedBytes;
+}
+
 /**
  * @brief return all values in the provided list.
  */
@@ -534,7 +696,7 @@ int MapSegment::addTrackerForEntry(const std::shared_ptr<CacheableKey>& key,
     if (addIfAbsent) {
       std::shared_ptr<MapEntryImpl> entryImpl;
       // add a new entry with value as destroyed
-      m_entryFactory->newMapEntry(m_expiryTaskManager, key, entryImpl);
+      m_entryFactory->newMapEntry(m_entryArena, key, entryImpl);
       entryImpl->setValueI(CacheableToken::destroyed());
       entry = entryImpl;
       newEntry = entryImpl;
@@ -620,7 +782,7 @@ void MapSegment::rehash() {  // Only called from put, segment must already be
   uint32_t newMapSize = TableOfPrimes::getPrime(++m_primeIndex);
   LOGFINER("Rehashing MapSegment to size %d.", newMapSize);
   CacheableKeyHashMap* newMap = new CacheableKeyHashMap();
-  newMap->open(newMapSize);
+  newMap->open(newMapSize, nullptr, m_nodeAllocator);
 
   // copy all entries into newMap..
   for (CacheableKeyHashMap::iterator iter = m_map->begin();
@@ -635,6 +797,19 @@ void MapSegment::rehash() {  // Only called from put, segment must already be
   delete oldMap;
   m_rehashCount++;
 }
+
+void MapSegment::reserve(uint32_t size) {
+  // grow straight to the size needed rather than a prime at a time
+  uint32_t primeIndex;
+  TableOfPrimes::nextLargerPrime(
+      static_cast<uint32_t>((static_cast<uint64_t>(size) * 75) / 100),
+      primeIndex);
+  if (primeIndex > m_primeIndex) {
+    m_primeIndex = primeIndex - 1;
+    rehash();
+  }
+}
+
 std::shared_ptr<Cacheable> MapSegment::getFromDisc(
     std::shared_ptr<CacheableKey> key,
     std::shared_ptr<MapEntryImpl>& entryImpl) {
@@ -671,32 +846,37 @@ GfErrType MapSegment::putForTrackedEntry(
           return GF_INVALID_DELTA;
         }
       }
-      auto valueWithDelta = std::dynamic_pointer_cast<Delta>(oldValue);
+      // a decoded value is a private copy, so there is no need to clone it
+      auto decoded =
+          m_valueCodec != nullptr ? m_valueCodec->decode(oldValue) : oldValue;
+      auto valueWithDelta = std::dynamic_pointer_cast<Delta>(decoded);
+      if (valueWithDelta == nullptr) {
+        if (m_poolDM) m_poolDM->updateNotificationStats(false, 0);
+        return GF_INVALID_DELTA;
+      }
       std::shared_ptr<Cacheable>& newValue1 = const_cast<std::shared_ptr<Cacheable>&>(newValue);
       try {
-        if (m_region->getAttributes()->getCloningEnabled()) {
-         auto tempVal = valueWithDelta->clone();
-          ACE_Time_Value currTimeBefore = ACE_OS::gettimeofday();
-          tempVal->fromDelta(*delta);
-          if (m_poolDM) {
-            m_poolDM->updateNotificationStats(
-                true,
-                ((ACE_OS::gettimeofday() - currTimeBefore).msec()) * 1000000);
-          }
-          newValue1 = std::dynamic_pointer_cast<Serializable>(tempVal);
-          entryImpl->setValueI(newValue1);
-        } else {
-          ACE_Time_Value currTimeBefore = ACE_OS::gettimeofday();
-          valueWithDelta->fromDelta(*delta);
-          newValue1 = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
-          if (m_poolDM) {
-            m_poolDM->updateNotificationStats(
-                true,
-                ((ACE_OS::gettimeofday() - currTimeBefore).msec()) * 1000000);
-          }
-          entryImpl->setValueI(
-              std::dynamic_pointer_cast<Serializable>(valueWithDelta));
+        if (decoded == oldValue &&
+            m_region->getAttributes()->getCloningEnabled()) {
+          auto cloneStart = std::chrono::steady_clock::now();
+          valueWithDelta = valueWithDelta->clone();
+          m_region->getCacheImpl()->getCachePerfStats().incDeltaClone(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - cloneStart)
+                  .count());
+        }
+        ACE_Time_Value currTimeBefore = ACE_OS::gettimeofday();
+        valueWithDelta->fromDelta(*delta);
+        if (m_poolDM) {
+          m_poolDM->updateNotificationStats(
+              true,
+              ((ACE_OS::gettimeofday() - currTimeBefore).msec()) * 1000000);
+        }
+        newValue1 = std::dynamic_pointer_cast<Serializable>(valueWithDelta);
+        if (m_valueCodec != nullptr) {
+          newValue1 = m_valueCodec->encode(newValue1);
         }
+        entryImpl->setValueI(newValue1);
       } catch (InvalidDeltaException&) {
         return GF_INVALID_DELTA;
       }
@@ -20,6 +20,7 @@
 #ifndef GEODE_MAPSEGMENT_H_
 #define GEODE_MAPSEGMENT_H_
 
+#include <cstring>
 #include <vector>
 #include <memory>
 
@@ -28,11 +29,13 @@
 #include <geode/CacheableKey.hpp>
 #include "MapEntry.hpp"
 #include <geode/RegionEntry.hpp>
+#include <geode/RegionMemoryFootprint.hpp>
 #include "MapWithLock.hpp"
 #include "CacheableToken.hpp"
 #include <geode/Delta.hpp>
 
 #include <ace/Hash_Map_Manager.h>
+#include <ace/Malloc_Allocator.h>
 #include <ace/Functor_T.h>
 #include <ace/Null_Mutex.h>
 #include <ace/Thread_Mutex.h>
@@ -41,6 +44,7 @@
 #include <ace/config-lite.h>
 #include <ace/Versioned_Namespace.h>
 #include "TombstoneList.hpp"
+#include "SlabArena.hpp"
 #include <unordered_map>
 
 #include "util/concurrent/spinlock_mutex.hpp"
@@ -76,11 +80,99 @@ typedef ::ACE_Hash_Map_Manager_Ex<
     ::ACE_Equal_To<std::shared_ptr<CacheableKey>>, ::ACE_Null_Mutex>
     CacheableKeyHashMap;
 
+typedef std::vector<
+    std::pair<std::shared_ptr<CacheableKey>, std::shared_ptr<Cacheable>>>
+    KeyValuePairs;
+
+/**
+ * @brief an entry of a batch put into an entries map, along with the
+ * outcome of putting it.
+ */
+struct BatchPutEntry {
+  BatchPutEntry(const std::shared_ptr<CacheableKey>& key,
+                const std::shared_ptr<Cacheable>& value,
+                const std::shared_ptr<VersionTag>& versionTag)
+      : key(key),
+        value(value),
+        versionTag(versionTag),
+        isUpdate(false),
+        err(GF_NOERR) {}
+
+  std::shared_ptr<CacheableKey> key;
+  std::shared_ptr<Cacheable> value;
+  std::shared_ptr<VersionTag> versionTag;
+  std::shared_ptr<MapEntryImpl> entry;
+  std::shared_ptr<Cacheable> oldValue;
+  bool isUpdate;
+  GfErrType err;
+};
+
+typedef std::vector<BatchPutEntry> BatchPutEntries;
+
+/**
+ * @brief converts between values and the form an entries map stores them
+ * in, so that a segment can apply a delta to a stored value under its lock.
+ */
+class CPPCACHE_EXPORT ValueCodec {
+ public:
+  virtual ~ValueCodec() {}
+
+  /**
+   * @brief return the value for a stored value: a private copy, or the
+   * stored value itself if it is kept as it is.
+   */
+  virtual std::shared_ptr<Cacheable> decode(
+      const std::shared_ptr<Cacheable>& stored) const = 0;
+
+  /** @brief return the form in which a value is stored. */
+  virtual std::shared_ptr<Cacheable> encode(
+      const std::shared_ptr<Cacheable>& value) const = 0;
+};
+
 /** @brief type wrapper around the ACE map implementation. */
 class CPPCACHE_EXPORT MapSegment {
  private:
+  // hands out the nodes of the hash map from an arena; the map allocates
+  // nothing else through it
+  class NodeAllocator : public ACE_New_Allocator {
+   public:
+    NodeAllocator() : m_arena(new SlabArena()) {}
+
+    virtual ~NodeAllocator() { m_arena->release(); }
+
+    virtual void* malloc(size_t nbytes) { return m_arena->allocate(nbytes); }
+
+    virtual void* calloc(size_t nbytes, char initialValue = '\0') {
+      void* block = malloc(nbytes);
+      memset(block, initialValue, nbytes);
+      return block;
+    }
+
+    virtual void* calloc(size_t nElem, size_t elemSize,
+                         char initialValue = '\0') {
+      return calloc(nElem * elemSize, initialValue);
+    }
+
+    virtual void free(void* ptr) {
+      m_arena->deallocate(ptr, sizeof(CacheableKeyHashMap::ENTRY));
+    }
+
+    inline size_t getReservedBytes() const {
+      return m_arena->getReservedBytes();
+    }
+
+    inline size_t getUsedBytes() const { return m_arena->getUsedBytes(); }
+
+   private:
+    SlabArena* m_arena;
+  };
+
   // contain
   CacheableKeyHashMap* m_map;
+  // the nodes of m_map and the entries are carved from these; entries may
+  // outlive the segment, so the entry arena is released rather than deleted
+  NodeAllocator* m_nodeAllocator;
+  SlabArena* m_entryArena;
   // refers to object managed by the entries map...
   // does not need deletion here.
   const EntryFactory* m_entryFactory;
@@ -101,7 +193,10 @@ class CPPCACHE_EXPORT MapSegment {
 
   uint32_t m_rehashCount;
   void rehash();
+  void reserve(uint32_t size);
   std::shared_ptr<TombstoneList> m_tombstoneList;
+  // set by a map that stores values encoded; not owned
+  const ValueCodec* m_valueCodec;
 
   // increment update counter of the given entry and return true if entry
   // was rebound
@@ -168,7 +263,7 @@ class CPPCACHE_EXPORT MapSegment {
         }
       }
     }
-    m_entryFactory->newMapEntry(m_expiryTaskManager, key, newEntry);
+    m_entryFactory->newMapEntry(m_entryArena, key, newEntry);
     newEntry->setValueI(newValue);
     if (m_concurrencyChecksEnabled) {
       if (versionTag != nullptr && versionTag.get() != nullptr) {
@@ -181,6 +276,15 @@ class CPPCACHE_EXPORT MapSegment {
     return GF_NOERR;
   }
 
+  GfErrType unguardedPut(const std::shared_ptr<CacheableKey>& key,
+                         const std::shared_ptr<Cacheable>& newValue,
+                         std::shared_ptr<MapEntryImpl>& me,
+                         std::shared_ptr<Cacheable>& oldValue,
+                         int updateCount, int destroyTracker, bool& isUpdate,
+                         std::shared_ptr<VersionTag> versionTag,
+                         DataInput* delta, int64_t& taskid,
+                         TombstoneExpiryHandler*& handler);
+
   GfErrType putForTrackedEntry(const std::shared_ptr<CacheableKey>& key,
                                const std::shared_ptr<Cacheable>& newValue,
                                std::shared_ptr<MapEntry>& entry,
@@ -200,6 +304,8 @@ class CPPCACHE_EXPORT MapSegment {
  public:
   MapSegment()
       : m_map(nullptr),
+        m_nodeAllocator(nullptr),
+        m_entryArena(nullptr),
         m_entryFactory(nullptr),
         m_region(nullptr),
         m_expiryTaskManager(nullptr),
@@ -209,7 +315,8 @@ class CPPCACHE_EXPORT MapSegment {
         m_concurrencyChecksEnabled(false),
         m_numDestroyTrackers(nullptr),
         m_rehashCount(0),
-        m_tombstoneList(nullptr) {}
+        m_tombstoneList(nullptr),
+        m_valueCodec(nullptr) {}
 
   ~MapSegment();
 
@@ -229,6 +336,12 @@ class CPPCACHE_EXPORT MapSegment {
   void close();
   void clear();
 
+  /**
+   * @brief return the bytes taken by the arenas that hold the entries of
+   * this segment and the nodes of its map.
+   */
+  size_t getReservedBytes() const;
+
   /**
    * @brief put a new value in the map, failing if key already exists.
    * return error code if key already existing or something goes wrong.
@@ -251,6 +364,13 @@ class CPPCACHE_EXPORT MapSegment {
                 std::shared_ptr<VersionTag> versionTag,
                 DataInput* delta = nullptr);
 
+  /**
+   * @brief put a batch of values without update tracking, under a single
+   * acquisition of the segment lock. The outcome of each put is left in its
+   * entry.
+   */
+  void putBatch(std::vector<BatchPutEntry*>& entries, int destroyTracker);
+
   GfErrType invalidate(const std::shared_ptr<CacheableKey>& key, std::shared_ptr<MapEntryImpl>& me,
                        std::shared_ptr<Cacheable>& oldValue, std::shared_ptr<VersionTag> versionTag,
                        bool& isTokenAdded);
@@ -271,6 +391,15 @@ class CPPCACHE_EXPORT MapSegment {
                 std::shared_ptr<MapEntryImpl>& result,
                 std::shared_ptr<Cacheable>& value);
 
+  /**
+   * @brief replace the value of the entry for key with another form of the
+   * same value, if the entry still holds expected. The entry keeps its
+   * version and update count. return true if the value was replaced.
+   */
+  bool replaceValue(const std::shared_ptr<CacheableKey>& key,
+                    const std::shared_ptr<Cacheable>& expected,
+                    const std::shared_ptr<Cacheable>& replacement);
+
   /**
    * @brief return true if there exists an entry for the key.
    */
@@ -291,8 +420,26 @@ class CPPCACHE_EXPORT MapSegment {
    */
   void getValues(std::vector<std::shared_ptr<Cacheable>> & result);
 
+  /**
+   * @brief return the keys and values of all the entries in the provided
+   * list, with a nullptr value for invalid entries.
+   */
+  void getKeyValues(KeyValuePairs& result);
+
+  /**
+   * @brief add the memory held by the entries of this segment, walking
+   * them to size the keys, values, tombstones and expiry tasks.
+   */
+  void addMemoryFootprint(RegionMemoryFootprint& footprint);
+
   inline uint32_t rehashCount() { return m_rehashCount; }
 
+  /**
+   * @brief set the codec of the values stored in this segment; deltas are
+   * then applied to the decoded value, which is stored encoded again.
+   */
+  inline void setValueCodec(const ValueCodec* codec) { m_valueCodec = codec; }
+
   int addTrackerForEntry(const std::shared_ptr<CacheableKey>& key,
                          std::shared_ptr<Cacheable>& oldValue, bool addIfAbsent,
                          bool failIfPresent, bool incUpdateCount);
@@ -0,0 +1,267 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableDate.hpp>
+#include <geode/CacheableObjectArray.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/PdxInstance.hpp>
+
+#include "PdxFieldExtractor.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+std::shared_ptr<Cacheable> readField(const PdxInstance& instance,
+                                     const char* fieldName) {
+  switch (instance.getFieldType(fieldName)) {
+    case PdxFieldTypes::BOOLEAN:
+      return CacheableBoolean::create(instance.getBooleanField(fieldName));
+    case PdxFieldTypes::BYTE:
+      return CacheableByte::create(
+          static_cast<uint8_t>(instance.getByteField(fieldName)));
+    case PdxFieldTypes::CHAR:
+      return CacheableCharacter::create(instance.getCharField(fieldName));
+    case PdxFieldTypes::SHORT:
+      return CacheableInt16::create(instance.getShortField(fieldName));
+    case PdxFieldTypes::INT:
+      return CacheableInt32::create(instance.getIntField(fieldName));
+    case PdxFieldTypes::LONG:
+      return CacheableInt64::create(instance.getLongField(fieldName));
+    case PdxFieldTypes::FLOAT:
+      return CacheableFloat::create(instance.getFloatField(fieldName));
+    case PdxFieldTypes::DOUBLE:
+      return CacheableDouble::create(instance.getDoubleField(fieldName));
+    case PdxFieldTypes::DATE:
+      return instance.getCacheableDateField(fieldName);
+    case PdxFieldTypes::STRING: {
+      char* value = nullptr;
+      instance.getField(fieldName, &value);
+      if (value == nullptr) {
+        return nullptr;
+      }
+      auto result = CacheableString::create(value);
+      DataInput::freeUTFMemory(value);
+      return result;
+    }
+    case PdxFieldTypes::OBJECT:
+      return instance.getCacheableField(fieldName);
+    default:
+      throw QueryException(std::string("Field ") + fieldName +
+                           " is an array and cannot be used in a local query");
+  }
+}
+
+}  // namespace
+
+bool PdxFieldExtractor::extract(
+    const std::shared_ptr<Cacheable>& value,
+    const std::vector<std::string>& fieldNames,
+    std::vector<std::shared_ptr<Cacheable>>& fields) {
+  fields.assign(fieldNames.size(), nullptr);
+  if (auto instance = std::dynamic_pointer_cast<PdxInstance>(value)) {
+    for (size_t i = 0; i < fieldNames.size(); i++) {
+      if (instance->hasField(fieldNames[i].c_str())) {
+        fields[i] = readField(*instance, fieldNames[i].c_str());
+      }
+    }
+    return true;
+  }
+  if (auto pdxObject = std::dynamic_pointer_cast<PdxSerializable>(value)) {
+    auto extractor = std::make_shared<PdxFieldExtractor>(fieldNames, fields);
+    pdxObject->toData(extractor);
+    return true;
+  }
+  return false;
+}
+
+PdxFieldExtractor::PdxFieldExtractor(
+    const std::vector<std::string>& fieldNames,
+    std::vector<std::shared_ptr<Cacheable>>& fields)
+    : m_fieldNames(fieldNames), m_fields(fields) {}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::set(
+    const char* fieldName, const std::shared_ptr<Cacheable>& value) {
+  for (size_t i = 0; i < m_fieldNames.size(); i++) {
+    if (m_fieldNames[i] == fieldName) {
+      m_fields[i] = value;
+    }
+  }
+  return shared_from_this();
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::array(const char* fieldName) {
+  for (const auto& name : m_fieldNames) {
+    if (name == fieldName) {
+      throw QueryException(std::string("Field ") + fieldName +
+                           " is an array and cannot be used in a local query");
+    }
+  }
+  return shared_from_this();
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeChar(const char* fieldName,
+                                                        char value) {
+  return set(fieldName, CacheableCharacter::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeChar(const char* fieldName,
+                                                        char16_t value) {
+  return set(fieldName, CacheableCharacter::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeBoolean(
+    const char* fieldName, bool value) {
+  return set(fieldName, CacheableBoolean::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeByte(const char* fieldName,
+                                                        int8_t value) {
+  return set(fieldName, CacheableByte::create(static_cast<uint8_t>(value)));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeShort(const char* fieldName,
+                                                         int16_t value) {
+  return set(fieldName, CacheableInt16::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeInt(const char* fieldName,
+                                                       int32_t value) {
+  return set(fieldName, CacheableInt32::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeLong(const char* fieldName,
+                                                        int64_t value) {
+  return set(fieldName, CacheableInt64::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeFloat(const char* fieldName,
+                                                         float value) {
+  return set(fieldName, CacheableFloat::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeDouble(
+    const char* fieldName, double value) {
+  return set(fieldName, CacheableDouble::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeDate(
+    const char* fieldName, std::shared_ptr<CacheableDate> date) {
+  return set(fieldName, date);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeString(
+    const char* fieldName, const char* value) {
+  return set(fieldName,
+             value == nullptr ? nullptr : CacheableString::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeWideString(
+    const char* fieldName, const wchar_t* value) {
+  return set(fieldName,
+             value == nullptr ? nullptr : CacheableString::create(value));
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeObject(
+    const char* fieldName, std::shared_ptr<Cacheable> value) {
+  return set(fieldName, value);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeBooleanArray(
+    const char* fieldName, bool* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeWideCharArray(
+    const char* fieldName, wchar_t* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeCharArray(
+    const char* fieldName, char* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeByteArray(
+    const char* fieldName, int8_t* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeShortArray(
+    const char* fieldName, int16_t* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeIntArray(
+    const char* fieldName, int32_t* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeLongArray(
+    const char* fieldName, int64_t* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeFloatArray(
+    const char* fieldName, float* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeDoubleArray(
+    const char* fieldName, double* array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeStringArray(
+    const char* fieldName, char** array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeWideStringArray(
+    const char* fieldName, wchar_t** array, int length) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeObjectArray(
+    const char* fieldName, std::shared_ptr<CacheableObjectArray> array) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeArrayOfByteArrays(
+    const char* fieldName, int8_t** array, int arrayLength,
+    int* elementLength) {
+  return this->array(fieldName);
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::markIdentityField(
+    const char* fieldName) {
+  return shared_from_this();
+}
+
+std::shared_ptr<PdxWriter> PdxFieldExtractor::writeUnreadFields(
+    std::shared_ptr<PdxUnreadFields> unread) {
+  return shared_from_this();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXFIELDEXTRACTOR_H_
+#define GEODE_PDXFIELDEXTRACTOR_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/PdxWriter.hpp>
+#include <geode/Cacheable.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Reads named fields out of PDX values for local queries. A PdxInstance is
+ * read field by field; any other PdxSerializable writes itself to the
+ * extractor, which keeps the fields asked for and drops the rest.
+ */
+class CPPCACHE_EXPORT PdxFieldExtractor
+    : public PdxWriter,
+      public std::enable_shared_from_this<PdxFieldExtractor> {
+ public:
+  /**
+   * Sets <code>fields[i]</code> to the value of the field
+   * <code>fieldNames[i]</code>, or to nullptr when the field is null or the
+   * value has no such field.
+   *
+   * @returns false if the value is not a PDX value
+   * @throws QueryException if one of the fields is an array
+   */
+  static bool extract(const std::shared_ptr<Cacheable>& value,
+                      const std::vector<std::string>& fieldNames,
+                      std::vector<std::shared_ptr<Cacheable>>& fields);
+
+  PdxFieldExtractor(const std::vector<std::string>& fieldNames,
+                    std::vector<std::shared_ptr<Cacheable>>& fields);
+
+  virtual ~PdxFieldExtractor() {}
+
+  virtual std::shared_ptr<PdxWriter> writeChar(const char* fieldName,
+                                               char value) override;
+  virtual std::shared_ptr<PdxWriter> writeChar(const char* fieldName,
+                                               char16_t value) override;
+  virtual std::shared_ptr<PdxWriter> writeBoolean(const char* fieldName,
+                                                  bool value) override;
+  virtual std::shared_ptr<PdxWriter> writeByte(const char* fieldName,
+                                               int8_t value) override;
+  virtual std::shared_ptr<PdxWriter> writeShort(const char* fieldName,
+                                                int16_t value) override;
+  virtual std::shared_ptr<PdxWriter> writeInt(const char* fieldName,
+                                              int32_t value) override;
+  virtual std::shared_ptr<PdxWriter> writeLong(const char* fieldName,
+                                               int64_t value) override;
+  virtual std::shared_ptr<PdxWriter> writeFloat(const char* fieldName,
+                                                float value) override;
+  virtual std::shared_ptr<PdxWriter> writeDouble(const char* fieldName,
+                                                 double value) override;
+  virtual std::shared_ptr<PdxWriter> writeDate(
+      const char* fieldName, std::shared_ptr<CacheableDate> date) override;
+  virtual std::shared_ptr<PdxWriter> writeString(const char* fieldName,
+                                                 const char* value) override;
+  virtual std::shared_ptr<PdxWriter> writeWideString(
+      const char* fieldName, const wchar_t* value) override;
+  virtual std::shared_ptr<PdxWriter> writeObject(
+      const char* fieldName, std::shared_ptr<Cacheable> value) override;
+  virtual std::shared_ptr<PdxWriter> writeBooleanArray(const char* fieldName,
+                                                       bool* array,
+                                                       int length) override;
+  virtual std::shared_ptr<PdxWriter> writeWideCharArray(const char* fieldName,
+                                                        wchar_t* array,
+                                                        int length) override;
+  virtual std::shared_ptr<PdxWriter> writeCharArray(const char* fieldName,
+                                                    char* array,
+                                                    int length) override;
+  virtual std::shared_ptr<PdxWriter> writeByteArray(const char* fieldName,
+                                                    int8_t* array,
+                                                    int length) override;
+  virtual std::shared_ptr<PdxWriter> writeShortArray(const char* fieldName,
+                                                     int16_t* array,
+                                                     int length) override;
+  virtual std::shared_ptr<PdxWriter> writeIntArray(const char* fieldName,
+                                                   int32_t* array,
+                                                   int length) override;
+  virtual std::shared_ptr<PdxWriter> writeLongArray(const char* fieldName,
+                                                    int64_t* array,
+                                                    int length) override;
+  virtual std::shared_ptr<PdxWriter> writeFloatArray(const char* fieldName,
+                                                     float* array,
+                                                     int length) override;
+  virtual std::shared_ptr<PdxWriter> writeDoubleArray(const char* fieldName,
+                                                      double* array,
+                                                      int length) override;
+  virtual std::shared_ptr<PdxWriter> writeStringArray(const char* fieldName,
+                                                      char** array,
+                                                      int length) override;
+  virtual std::shared_ptr<PdxWriter> writeWideStringArray(
+      const char* fieldName, wchar_t** array, int length) override;
+  virtual std::shared_ptr<PdxWriter> writeObjectArray(
+      const char* fieldName,
+      std::shared_ptr<CacheableObjectArray> array) override;
+  virtual std::shared_ptr<PdxWriter> writeArrayOfByteArrays(
+      const char* fieldName, int8_t** array, int arrayLength,
+      int* elementLength) override;
+  virtual std::shared_ptr<PdxWriter> markIdentityField(
+      const char* fieldName) override;
+  virtual std::shared_ptr<PdxWriter> writeUnreadFields(
+      std::shared_ptr<PdxUnreadFields> unread) override;
+
+ private:
+  std::shared_ptr<PdxWriter> set(const char* fieldName,
+                                 const std::shared_ptr<Cacheable>& value);
+  std::shared_ptr<PdxWriter> array(const char* fieldName);
+
+  const std::vector<std::string>& m_fieldNames;
+  std::vector<std::shared_ptr<Cacheable>>& m_fields;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXFIELDEXTRACTOR_H_
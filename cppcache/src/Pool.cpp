@@ -48,6 +48,10 @@ int Pool::getMinConnections() const { return m_attrs->getMinConnections(); }
 
 int Pool::getMaxConnections() const { return m_attrs->getMaxConnections(); }
 
+int Pool::getConnectionWarmUpConcurrency() const {
+  return m_attrs->getConnectionWarmUpConcurrency();
+}
+
 std::chrono::milliseconds Pool::getIdleTimeout() const {
   return m_attrs->getIdleTimeout();
 }
@@ -74,6 +78,10 @@ int Pool::getSubscriptionRedundancy() const {
   return m_attrs->getSubscriptionRedundancy();
 }
 
+int Pool::getSubscriptionRecoveryConcurrency() const {
+  return m_attrs->getSubscriptionRecoveryConcurrency();
+}
+
 std::chrono::milliseconds Pool::getSubscriptionMessageTrackingTimeout() const {
   return m_attrs->getSubscriptionMessageTrackingTimeout();
 }
@@ -28,9 +28,12 @@ PoolAttributes::PoolAttributes()
       m_readTimeout(PoolFactory::DEFAULT_READ_TIMEOUT),
       m_minConns(PoolFactory::DEFAULT_MIN_CONNECTIONS),
       m_maxConns(PoolFactory::DEFAULT_MAX_CONNECTIONS),
+      m_warmUpConcurrency(PoolFactory::DEFAULT_CONNECTION_WARM_UP_CONCURRENCY),
       m_retryAttempts(PoolFactory::DEFAULT_RETRY_ATTEMPTS),
       m_statsInterval(PoolFactory::DEFAULT_STATISTIC_INTERVAL),
       m_redundancy(PoolFactory::DEFAULT_SUBSCRIPTION_REDUNDANCY),
+      m_recoveryConcurrency(
+          PoolFactory::DEFAULT_SUBSCRIPTION_RECOVERY_CONCURRENCY),
       m_msgTrackTimeout(
           PoolFactory::DEFAULT_SUBSCRIPTION_MESSAGE_TRACKING_TIMEOUT),
       m_subsAckInterval(PoolFactory::DEFAULT_SUBSCRIPTION_ACK_INTERVAL),
@@ -55,9 +58,11 @@ bool PoolAttributes::operator==(const PoolAttributes& other) const {
   if (m_readTimeout != other.m_readTimeout) return false;
   if (m_minConns != other.m_minConns) return false;
   if (m_maxConns != other.m_maxConns) return false;
+  if (m_warmUpConcurrency != other.m_warmUpConcurrency) return false;
   if (m_retryAttempts != other.m_retryAttempts) return false;
   if (m_statsInterval != other.m_statsInterval) return false;
   if (m_redundancy != other.m_redundancy) return false;
+  if (m_recoveryConcurrency != other.m_recoveryConcurrency) return false;
   if (m_msgTrackTimeout != other.m_msgTrackTimeout) return false;
   if (m_subsAckInterval != other.m_subsAckInterval) return false;
   if (m_idleTimeout != other.m_idleTimeout) return false;
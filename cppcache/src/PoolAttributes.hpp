@@ -85,6 +85,12 @@ class PoolAttributes {
 
   void setMaxConnections(int maxConnections) { m_maxConns = maxConnections; }
 
+  int getConnectionWarmUpConcurrency() const { return m_warmUpConcurrency; }
+
+  void setConnectionWarmUpConcurrency(int concurrency) {
+    m_warmUpConcurrency = concurrency;
+  }
+
   const std::chrono::milliseconds& getIdleTimeout() const {
     return m_idleTimeout;
   }
@@ -135,6 +141,14 @@ class PoolAttributes {
 
   void setSubscriptionRedundancy(int redundancy) { m_redundancy = redundancy; }
 
+  int getSubscriptionRecoveryConcurrency() const {
+    return m_recoveryConcurrency;
+  }
+
+  void setSubscriptionRecoveryConcurrency(int concurrency) {
+    m_recoveryConcurrency = concurrency;
+  }
+
   const std::chrono::milliseconds& getSubscriptionMessageTrackingTimeout()
       const {
     return m_msgTrackTimeout;
@@ -181,9 +195,11 @@ class PoolAttributes {
   std::chrono::milliseconds m_readTimeout;
   int m_minConns;
   int m_maxConns;
+  int m_warmUpConcurrency;
   int m_retryAttempts;
   std::chrono::milliseconds m_statsInterval;
   int m_redundancy;
+  int m_recoveryConcurrency;
   std::chrono::milliseconds m_msgTrackTimeout;
   std::chrono::milliseconds m_subsAckInterval;
 
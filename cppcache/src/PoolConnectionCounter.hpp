@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_POOLCONNECTIONCOUNTER_H_
+#define GEODE_POOLCONNECTIONCOUNTER_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Counts the connections of a pool. Connections are established without
+ * holding the pool lock, so a creator first reserves its place, which keeps
+ * concurrent creators within the pool's limit, and then either commits or
+ * cancels the reservation once the connect is done. Reservations do not count
+ * as established connections, so the pool is never taken to hold more
+ * connections than it has.
+ *
+ * Both counts are packed into one atomic word, established in the high half
+ * and reserved in the low half, so a reservation is checked against and
+ * taken from the same state, and a commit moves a connection from one count
+ * to the other in a single step.
+ */
+class PoolConnectionCounter {
+ public:
+  PoolConnectionCounter() : m_counts(0) {}
+
+  /**
+   * Reserves a connection if established and reserved connections together
+   * stay within <code>limit</code>.
+   */
+  bool reserve(int32_t limit) {
+    auto counts = m_counts.load();
+    do {
+      if (establishedOf(counts) + reservedOf(counts) >= limit) {
+        return false;
+      }
+    } while (!m_counts.compare_exchange_weak(counts, counts + RESERVED));
+    return true;
+  }
+
+  /** Turns a reservation into an established connection. */
+  void commit() { m_counts += ESTABLISHED - RESERVED; }
+
+  /** Gives up a reservation whose connect failed. */
+  void cancel() { m_counts -= RESERVED; }
+
+  /** Counts a connection established without a reservation. */
+  void add() { m_counts += ESTABLISHED; }
+
+  /** Stops counting <code>count</code> established connections. */
+  int32_t remove(int32_t count) {
+    return establishedOf(m_counts -= count * ESTABLISHED);
+  }
+
+  int32_t established() const { return establishedOf(m_counts); }
+
+  int32_t reserved() const { return reservedOf(m_counts); }
+
+ private:
+  static const int64_t RESERVED = 1;
+  static const int64_t ESTABLISHED = INT64_C(1) << 32;
+
+  static int32_t reservedOf(int64_t counts) {
+    return static_cast<int32_t>(counts & (ESTABLISHED - 1));
+  }
+
+  static int32_t establishedOf(int64_t counts) {
+    return static_cast<int32_t>((counts - reservedOf(counts)) / ESTABLISHED);
+  }
+
+  std::atomic<int64_t> m_counts;
+
+  // disabled
+  PoolConnectionCounter(const PoolConnectionCounter&);
+  PoolConnectionCounter& operator=(const PoolConnectionCounter&);
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_POOLCONNECTIONCOUNTER_H_
@@ -124,6 +124,15 @@ PoolFactory& PoolFactory::setMaxConnections(int maxConnections) {
   return *this;
 }
 
+PoolFactory& PoolFactory::setConnectionWarmUpConcurrency(int concurrency) {
+  if (concurrency < 1) {
+    throw std::invalid_argument("concurrency must be at least 1.");
+  }
+
+  m_attrs->setConnectionWarmUpConcurrency(concurrency);
+  return *this;
+}
+
 PoolFactory& PoolFactory::setIdleTimeout(std::chrono::milliseconds idleTimeout) {
   m_attrs->setIdleTimeout(idleTimeout);
   return *this;
@@ -196,6 +205,15 @@ PoolFactory& PoolFactory::setSubscriptionRedundancy(int redundancy) {
   return *this;
 }
 
+PoolFactory& PoolFactory::setSubscriptionRecoveryConcurrency(int concurrency) {
+  if (concurrency < 1) {
+    throw std::invalid_argument("concurrency must be at least 1.");
+  }
+
+  m_attrs->setSubscriptionRecoveryConcurrency(concurrency);
+  return *this;
+}
+
 PoolFactory& PoolFactory::setSubscriptionMessageTrackingTimeout(
     std::chrono::milliseconds messageTrackingTimeout) {
   // TODO GEODE-3136 - Is this true?
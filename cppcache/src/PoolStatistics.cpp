@@ -43,7 +43,7 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   auto statsType = factory->findType(STATS_NAME);
 
   if (statsType == nullptr) {
-    auto stats = new StatisticDescriptor*[27];
+    auto stats = new StatisticDescriptor*[35];
 
     stats[0] = factory->createIntGauge(
         "locators", "Current number of locators discovered", "locators");
@@ -132,8 +132,41 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
     stats[26] = factory->createLongCounter(
         "queryExecutionTime",
         "Total time spent while processing queryExecution", "nanoseconds");
+    stats[27] = factory->createLongHistogram(
+        "connectionWaitLatency",
+        "Distribution of the time spent waiting for a connection.",
+        "nanoseconds");
+    stats[28] = factory->createLongHistogram(
+        "queryExecutionLatency",
+        "Distribution of the time spent while processing queryExecution",
+        "nanoseconds");
+    stats[29] = factory->createLongHistogram(
+        "functionExecutionLatency",
+        "Distribution of the time spent executing functions", "nanoseconds");
+    stats[30] = factory->createIntGauge(
+        "chunkBacklog",
+        "Current number of response chunks waiting to be processed",
+        "chunks");
+    stats[31] = factory->createLongCounter(
+        "chunksProcessed",
+        "Total number of response chunks processed by the chunk handler "
+        "threads",
+        "chunks");
+    stats[32] = factory->createLongCounter(
+        "chunkProcessingTime",
+        "Total time spent processing response chunks", "nanoseconds");
+    stats[33] = factory->createIntCounter(
+        "subscriptionFailovers",
+        "Total number of times subscriptions were recovered after the primary "
+        "subscription server was lost",
+        "failovers");
+    stats[34] = factory->createLongHistogram(
+        "subscriptionFailoverLatency",
+        "Distribution of the time spent restoring a primary subscription "
+        "server and its interest and CQs",
+        "nanoseconds");
 
-    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 27);
+    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 35);
   }
   m_locatorsId = statsType->nameToId("locators");
   m_serversId = statsType->nameToId("servers");
@@ -163,6 +196,16 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
       statsType->nameToId("processedDeltaMessagesTime");
   m_queryExecutionsId = statsType->nameToId("queryExecutions");
   m_queryExecutionTimeId = statsType->nameToId("queryExecutionTime");
+  m_connectionWaitLatencyId = statsType->nameToId("connectionWaitLatency");
+  m_queryExecutionLatencyId = statsType->nameToId("queryExecutionLatency");
+  m_functionExecutionLatencyId =
+      statsType->nameToId("functionExecutionLatency");
+  m_chunkBacklogId = statsType->nameToId("chunkBacklog");
+  m_chunksProcessedId = statsType->nameToId("chunksProcessed");
+  m_chunkProcessingTimeId = statsType->nameToId("chunkProcessingTime");
+  m_subsFailoversId = statsType->nameToId("subscriptionFailovers");
+  m_subsFailoverLatencyId =
+      statsType->nameToId("subscriptionFailoverLatency");
 
   m_poolStats = factory->createAtomicStatistics(statsType, poolName.c_str());
 
@@ -193,6 +236,10 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   getStats()->setInt(m_processedDeltaMessagesTimeId, 0);
   getStats()->setInt(m_queryExecutionsId, 0);
   getStats()->setLong(m_queryExecutionTimeId, 0);
+  getStats()->setInt(m_chunkBacklogId, 0);
+  getStats()->setLong(m_chunksProcessedId, 0);
+  getStats()->setLong(m_chunkProcessingTimeId, 0);
+  getStats()->setInt(m_subsFailoversId, 0);
 }
 
 PoolStats::~PoolStats() {
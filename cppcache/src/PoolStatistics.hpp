@@ -135,6 +135,32 @@ class PoolStats {
 
   inline int32_t getQueryExecutionTimeId() { return m_queryExecutionTimeId; }
 
+  inline int32_t getConnectionWaitLatencyId() {
+    return m_connectionWaitLatencyId;
+  }
+
+  inline int32_t getQueryExecutionLatencyId() {
+    return m_queryExecutionLatencyId;
+  }
+
+  void recordFunctionExecutionLatency(int64_t value) {
+    getStats()->recordValue(m_functionExecutionLatencyId, value);
+  }
+
+  void incChunkBacklog(int32_t delta) {
+    getStats()->incInt(m_chunkBacklogId, delta);
+  }
+
+  void incChunksProcessed(int64_t processingTime) {
+    getStats()->incLong(m_chunksProcessedId, 1);
+    getStats()->incLong(m_chunkProcessingTimeId, processingTime);
+  }
+
+  void recordSubscriptionFailover(int64_t latency) {
+    getStats()->incInt(m_subsFailoversId, 1);
+    getStats()->recordValue(m_subsFailoverLatencyId, latency);
+  }
+
  private:
   // volatile apache::geode::statistics::Statistics* m_poolStats;
   apache::geode::statistics::Statistics* m_poolStats;
@@ -166,6 +192,14 @@ class PoolStats {
   int32_t m_processedDeltaMessagesTimeId;
   int32_t m_queryExecutionsId;
   int32_t m_queryExecutionTimeId;
+  int32_t m_connectionWaitLatencyId;
+  int32_t m_queryExecutionLatencyId;
+  int32_t m_functionExecutionLatencyId;
+  int32_t m_chunkBacklogId;
+  int32_t m_chunksProcessedId;
+  int32_t m_chunkProcessingTimeId;
+  int32_t m_subsFailoversId;
+  int32_t m_subsFailoverLatencyId;
 
   static constexpr const char* STATS_NAME = "PoolStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this pool";
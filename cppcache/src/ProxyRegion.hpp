@@ -469,6 +469,20 @@ class CPPCACHE_EXPORT ProxyRegion : public Region {
     throw UnsupportedOperationException("Region.entries()");
   }
 
+  virtual std::unique_ptr<RegionEntryCursor> entryCursor() override {
+    throw UnsupportedOperationException("Region.entryCursor()");
+  }
+
+  virtual void parallelScan(
+      const std::function<void(RegionEntryCursor&)>& scan,
+      uint32_t parallelism = 0) override {
+    throw UnsupportedOperationException("Region.parallelScan()");
+  }
+
+  virtual RegionMemoryFootprint getMemoryFootprint() override {
+    throw UnsupportedOperationException("Region.getMemoryFootprint()");
+  }
+
   virtual std::shared_ptr<RegionService> getRegionService() const override {
     return std::shared_ptr<RegionService>(m_proxyCache);
   }
@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Struct.hpp>
+
+#include "QueryResultStreamImpl.hpp"
+#include "DistributedSystemImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+const char* NC_Query_Stream_Thread = "NC Query Stream";
+}
+
+QueryResultStreamImpl::QueryResultStreamImpl(size_t capacity)
+    : m_capacity(capacity),
+      m_done(false),
+      m_closed(false),
+      m_read(false),
+      m_fieldCount(0) {
+  if (capacity == 0) {
+    throw IllegalArgumentException("capacity must be greater than 0.");
+  }
+}
+
+QueryResultStreamImpl::~QueryResultStreamImpl() {
+  close();
+  if (m_queryThread.joinable()) {
+    m_queryThread.join();
+  }
+}
+
+void QueryResultStreamImpl::start(std::function<void()> query) {
+  m_queryThread = std::thread([this, query]() {
+    DistributedSystemImpl::setThreadName(NC_Query_Stream_Thread);
+    try {
+      query();
+      finish(nullptr);
+    } catch (...) {
+      finish(std::current_exception());
+    }
+  });
+}
+
+bool QueryResultStreamImpl::next(std::shared_ptr<Serializable>& result) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_notEmpty.wait(lock,
+                  [this] { return !m_results.empty() || m_done || m_closed; });
+  if (!m_results.empty()) {
+    result = std::move(m_results.front());
+    m_results.pop_front();
+    m_read = true;
+    m_notFull.notify_one();
+    return true;
+  }
+  if (m_exception && !m_closed) {
+    std::rethrow_exception(m_exception);
+  }
+  return false;
+}
+
+void QueryResultStreamImpl::close() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_closed = true;
+  m_results.clear();
+  m_notFull.notify_all();
+  m_notEmpty.notify_all();
+}
+
+void QueryResultStreamImpl::setFieldNames(
+    const std::vector<std::shared_ptr<CacheableString>>& fieldNames) {
+  m_structSet =
+      std::make_shared<StructSetImpl>(CacheableVector::create(), fieldNames);
+  m_fieldCount = fieldNames.size();
+  m_fieldValues.clear();
+}
+
+void QueryResultStreamImpl::add(const std::shared_ptr<Serializable>& value) {
+  std::shared_ptr<Serializable> result = value;
+  if (m_fieldCount > 0) {
+    m_fieldValues.push_back(value);
+    if (m_fieldValues.size() < m_fieldCount) {
+      return;
+    }
+    // a row can outlive the stream and the set of a later setFieldNames
+    result = std::make_shared<Struct>(
+        std::static_pointer_cast<StructSet>(m_structSet), m_fieldValues);
+    m_fieldValues.clear();
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_notFull.wait(lock, [this] {
+    return m_results.size() < m_capacity || m_done || m_closed;
+  });
+  if (m_done || m_closed) {
+    // the stream failed or nobody reads it anymore; drain the response
+    return;
+  }
+  m_results.push_back(std::move(result));
+  m_notEmpty.notify_one();
+}
+
+void QueryResultStreamImpl::restart() {
+  m_fieldValues.clear();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_results.clear();
+  if (m_read && !m_done) {
+    m_exception = std::make_exception_ptr(IllegalStateException(
+        "Query was retried on another server after some of its results had "
+        "been read"));
+    m_done = true;
+    m_notEmpty.notify_all();
+  }
+  m_notFull.notify_all();
+}
+
+void QueryResultStreamImpl::finish(std::exception_ptr exception) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_done) {
+    m_exception = exception;
+    m_done = true;
+  }
+  m_notEmpty.notify_all();
+  m_notFull.notify_all();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,106 @@
+#pragma once
+
+#ifndef GEODE_QUERYRESULTSTREAMIMPL_H_
+#define GEODE_QUERYRESULTSTREAMIMPL_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/QueryResultStream.hpp>
+
+#include "StructSetImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * A bounded buffer between the thread receiving the chunks of a query
+ * response, which adds results, and the application thread reading them.
+ * Adding blocks while the buffer is full, which keeps the receiving thread
+ * from reading further chunks off the connection.
+ */
+class CPPCACHE_EXPORT QueryResultStreamImpl : public QueryResultStream {
+ public:
+  explicit QueryResultStreamImpl(size_t capacity);
+
+  ~QueryResultStreamImpl() override;
+
+  bool next(std::shared_ptr<Serializable>& result) override;
+
+  void close() override;
+
+  /**
+   * Runs <code>query</code> on a thread of its own; it is expected to feed
+   * this stream. Any exception it throws is handed to the reader once the
+   * results added before it have been read.
+   */
+  void start(std::function<void()> query);
+
+  /**
+   * Sets the field names of a struct set result. Values added afterwards are
+   * grouped into Struct results of that many fields.
+   */
+  void setFieldNames(
+      const std::vector<std::shared_ptr<CacheableString>>& fieldNames);
+
+  void add(const std::shared_ptr<Serializable>& value);
+
+  /**
+   * Discards the results not read yet, as the response is about to be
+   * received again from another server. Fails the stream if results have
+   * already been read since they would be handed out twice.
+   */
+  void restart();
+
+ private:
+  void finish(std::exception_ptr exception);
+
+  const size_t m_capacity;
+  std::mutex m_mutex;
+  std::condition_variable m_notEmpty;
+  std::condition_variable m_notFull;
+  std::deque<std::shared_ptr<Serializable>> m_results;
+  std::exception_ptr m_exception;
+  bool m_done;
+  bool m_closed;
+  bool m_read;
+
+  // only touched by the query thread
+  std::shared_ptr<StructSetImpl> m_structSet;
+  size_t m_fieldCount;
+  std::vector<std::shared_ptr<Serializable>> m_fieldValues;
+
+  std::thread m_queryThread;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERYRESULTSTREAMIMPL_H_
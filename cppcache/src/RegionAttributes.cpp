@@ -64,9 +64,17 @@ RegionAttributes::RegionAttributes()
       m_persistenceFactory(nullptr),
       m_persistenceProperties(nullptr),
       m_persistenceManager(nullptr),
+      m_compressor(nullptr),
+      m_compressorLibrary(nullptr),
+      m_compressorFactory(nullptr),
       m_poolName(nullptr),
       m_isClonable(false),
-      m_isConcurrencyChecksEnabled(true) {}
+      m_isConcurrencyChecksEnabled(true),
+      m_listenerDispatchThreads(0),
+      m_listenerQueueCapacity(10000),
+      m_listenerConflation(false),
+      m_storeSerialized(false),
+      m_keepDeserialized(false) {}
 
 RegionAttributes::RegionAttributes(const RegionAttributes& rhs)
     : m_regionTimeToLiveExpirationAction(
@@ -95,8 +103,14 @@ RegionAttributes::RegionAttributes(const RegionAttributes& rhs)
       m_clientNotificationEnabled(rhs.m_clientNotificationEnabled),
       m_persistenceProperties(rhs.m_persistenceProperties),
       m_persistenceManager(rhs.m_persistenceManager),
+      m_compressor(rhs.m_compressor),
       m_isClonable(rhs.m_isClonable),
-      m_isConcurrencyChecksEnabled(rhs.m_isConcurrencyChecksEnabled) {
+      m_isConcurrencyChecksEnabled(rhs.m_isConcurrencyChecksEnabled),
+      m_listenerDispatchThreads(rhs.m_listenerDispatchThreads),
+      m_listenerQueueCapacity(rhs.m_listenerQueueCapacity),
+      m_listenerConflation(rhs.m_listenerConflation),
+      m_storeSerialized(rhs.m_storeSerialized),
+      m_keepDeserialized(rhs.m_keepDeserialized) {
   if (rhs.m_cacheLoaderLibrary != nullptr) {
     size_t len = strlen(rhs.m_cacheLoaderLibrary) + 1;
     m_cacheLoaderLibrary = new char[len];
@@ -183,6 +197,8 @@ RegionAttributes::RegionAttributes(const RegionAttributes& rhs)
   } else {
     m_persistenceFactory = nullptr;
   }
+  m_compressorLibrary = Utils::copyString(rhs.m_compressorLibrary);
+  m_compressorFactory = Utils::copyString(rhs.m_compressorFactory);
 }
 
 #define RA_DELSTRING(x) \
@@ -203,6 +219,8 @@ RegionAttributes::~RegionAttributes() {
   RA_DELSTRING(m_endpoints);
   RA_DELSTRING(m_persistenceLibrary);
   RA_DELSTRING(m_persistenceFactory);
+  RA_DELSTRING(m_compressorLibrary);
+  RA_DELSTRING(m_compressorFactory);
   RA_DELSTRING(m_poolName);
 }
 
@@ -366,6 +384,25 @@ const char* RegionAttributes::getPartitionResolverLibrary() {
   return m_partitionResolverLibrary;
 }
 
+std::shared_ptr<Compressor> RegionAttributes::getCompressor() {
+  if ((m_compressor == nullptr) && (m_compressorLibrary != nullptr)) {
+    Compressor* (*funcptr)();
+    funcptr = reinterpret_cast<Compressor* (*)()>(
+        apache::geode::client::impl::getFactoryFunc(m_compressorLibrary,
+                                                    m_compressorFactory));
+    m_compressor.reset(funcptr());
+  }
+  return m_compressor;
+}
+
+const char* RegionAttributes::getCompressorLibrary() {
+  return m_compressorLibrary;
+}
+
+const char* RegionAttributes::getCompressorFactory() {
+  return m_compressorFactory;
+}
+
 const char* RegionAttributes::getEndpoints() { return m_endpoints; }
 bool RegionAttributes::getClientNotificationEnabled() const {
   return m_clientNotificationEnabled;
@@ -628,6 +665,14 @@ bool RegionAttributes::operator==(const RegionAttributes& other) const {
   if (m_isConcurrencyChecksEnabled != other.m_isConcurrencyChecksEnabled) {
     return false;
   }
+  if (0 != compareStringAttribute(m_compressorLibrary,
+                                  other.m_compressorLibrary)) {
+    return false;
+  }
+  if (0 != compareStringAttribute(m_compressorFactory,
+                                  other.m_compressorFactory)) {
+    return false;
+  }
 
   return true;
 }
@@ -677,6 +722,11 @@ void RegionAttributes::validateSerializableAttributes() {
         "persistenceManager must be set with setPersistenceManager(library, "
         "factory,config) in members of type SERVER");
   }
+  if (m_compressor != nullptr) {
+    throw IllegalStateException(
+        "Compressor must be set with setCompressor(library, factory) in "
+        "members of type SERVER");
+  }
 }
 
 void RegionAttributes::setCacheListener(const char* lib, const char* func) {
@@ -693,6 +743,13 @@ void RegionAttributes::setPartitionResolver(const char* lib, const char* func) {
   copyStringAttribute(m_partitionResolverFactory, func);
 }
 
+void RegionAttributes::setCompressor(const char* lib, const char* func) {
+  GF_R_ASSERT(lib != nullptr);
+  GF_R_ASSERT(func != nullptr);
+  copyStringAttribute(m_compressorLibrary, lib);
+  copyStringAttribute(m_compressorFactory, func);
+}
+
 void RegionAttributes::setCacheLoader(const char* lib, const char* func) {
   GF_R_ASSERT(lib != nullptr);
   GF_R_ASSERT(func != nullptr);
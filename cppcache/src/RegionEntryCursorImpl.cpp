@@ -0,0 +1,48 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RegionEntryCursorImpl.hpp"
+#include "LocalRegion.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+RegionEntryCursorImpl::RegionEntryCursorImpl(
+    const std::shared_ptr<LocalRegion>& region, SegmentSource nextSegment)
+    : m_region(region), m_nextSegment(std::move(nextSegment)), m_index(0) {}
+
+bool RegionEntryCursorImpl::next(std::shared_ptr<CacheableKey>& key,
+                                 std::shared_ptr<Cacheable>& value) {
+  while (m_index == m_entries.size()) {
+    m_entries.clear();
+    m_index = 0;
+    uint32_t segment;
+    if (!m_nextSegment(segment)) {
+      return false;
+    }
+    m_region->getSegmentEntries(segment, m_entries);
+  }
+  auto& entry = m_entries[m_index++];
+  key = std::move(entry.first);
+  value = std::move(entry.second);
+  return true;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
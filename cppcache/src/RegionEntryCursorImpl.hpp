@@ -0,0 +1,68 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_REGIONENTRYCURSORIMPL_H_
+#define GEODE_REGIONENTRYCURSORIMPL_H_
+
+#include <functional>
+#include <memory>
+
+#include <geode/RegionEntryCursor.hpp>
+
+#include "MapSegment.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class LocalRegion;
+
+/**
+ * Walks the segments of a region's entries map that it is handed out one at
+ * a time, keeping a copy of the current segment only. Cursors sharing a
+ * segment source split the region between them.
+ */
+class CPPCACHE_EXPORT RegionEntryCursorImpl : public RegionEntryCursor {
+ public:
+  /**
+   * Claims the next segment to visit; returns false once there is none
+   * left. It may be shared by cursors on several threads.
+   */
+  typedef std::function<bool(uint32_t&)> SegmentSource;
+
+  RegionEntryCursorImpl(const std::shared_ptr<LocalRegion>& region,
+                        SegmentSource nextSegment);
+
+  ~RegionEntryCursorImpl() override = default;
+
+  bool next(std::shared_ptr<CacheableKey>& key,
+            std::shared_ptr<Cacheable>& value) override;
+
+ private:
+  std::shared_ptr<LocalRegion> m_region;
+  SegmentSource m_nextSegment;
+  KeyValuePairs m_entries;
+  size_t m_index;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_REGIONENTRYCURSORIMPL_H_
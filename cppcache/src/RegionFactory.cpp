@@ -126,6 +126,18 @@ RegionFactory& RegionFactory::setPartitionResolver(const char* lib,
   return *this;
 }
 
+RegionFactory& RegionFactory::setCompressor(
+    const std::shared_ptr<Compressor>& compressor) {
+  m_attributeFactory->setCompressor(compressor);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setCompressor(const char* lib,
+                                            const char* func) {
+  m_attributeFactory->setCompressor(lib, func);
+  return *this;
+}
+
 RegionFactory& RegionFactory::setEntryIdleTimeout(
     ExpirationAction::Action action, std::chrono::seconds idleTimeout) {
   m_attributeFactory->setEntryIdleTimeout(action, idleTimeout);
@@ -212,6 +224,32 @@ RegionFactory& RegionFactory::setCloningEnabled(bool isClonable) {
   m_attributeFactory->setCloningEnabled(isClonable);
   return *this;
 }
+
+RegionFactory& RegionFactory::setListenerDispatchThreads(uint32_t threads) {
+  m_attributeFactory->setListenerDispatchThreads(threads);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setListenerQueueCapacity(uint32_t capacity) {
+  m_attributeFactory->setListenerQueueCapacity(capacity);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setListenerConflationEnabled(
+    bool conflationEnabled) {
+  m_attributeFactory->setListenerConflationEnabled(conflationEnabled);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setStoreSerialized(bool storeSerialized) {
+  m_attributeFactory->setStoreSerialized(storeSerialized);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setKeepDeserialized(bool keepDeserialized) {
+  m_attributeFactory->setKeepDeserialized(keepDeserialized);
+  return *this;
+}
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
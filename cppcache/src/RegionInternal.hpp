@@ -256,7 +256,17 @@ class RegionInternal : public Region {
   virtual RegionStats* getRegionStats() = 0;
   virtual bool cacheEnabled() = 0;
   virtual bool isDestroyed() const override = 0;
-  virtual void evict(int32_t percentage) = 0;
+  /**
+   * For heap LRU, samples the entries at the head of the LRU list: the clock
+   * tick of the least recent access among them, and the average size of an
+   * entry. Returns false if there is nothing to evict.
+   */
+  virtual bool sampleLRU(uint32_t& lastAccess, int64_t& entrySize) = 0;
+  /**
+   * Evicts least recently used entries until at least <code>bytes</code>
+   * have been freed or a batch has been evicted, returning the bytes freed.
+   */
+  virtual int64_t evict(int64_t bytes) = 0;
   virtual CacheImpl* getCacheImpl() const = 0;
   virtual std::shared_ptr<TombstoneList> getTombstoneList();
 
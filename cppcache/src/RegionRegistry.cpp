@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstring>
+#include <thread>
+
+#include "RegionRegistry.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+RegionRegistry::RegionRegistry()
+    : m_table(build(std::vector<Entry>())), m_epoch(0) {
+  m_readers[0] = 0;
+  m_readers[1] = 0;
+}
+
+RegionRegistry::~RegionRegistry() { delete m_table.load(); }
+
+std::shared_ptr<Region> RegionRegistry::find(const char* path,
+                                             size_t length) const {
+  if (length > 0 && path[0] == '/') {
+    ++path;
+    --length;
+  }
+  auto h = hash(path, length);
+
+  auto& readers = m_readers[m_epoch.load() & 1];
+  ++readers;
+  std::shared_ptr<Region> region;
+  if (auto entry = m_table.load()->find(h, path, length)) {
+    region = entry->region;
+  }
+  --readers;
+  return region;
+}
+
+void RegionRegistry::add(const std::shared_ptr<Region>& region) {
+  auto key = keyOf(region.get());
+  auto h = hash(key.data(), key.length());
+
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  std::vector<Entry> entries;
+  for (const auto& entry : m_table.load()->entries) {
+    if (entry.hash != h || entry.path != key) {
+      entries.push_back(entry);
+    }
+  }
+  entries.push_back(Entry{h, std::move(key), region});
+  publish(build(std::move(entries)));
+}
+
+void RegionRegistry::remove(const Region* region) {
+  auto key = keyOf(region);
+  auto h = hash(key.data(), key.length());
+
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  auto table = m_table.load();
+  auto found = table->find(h, key.data(), key.length());
+  if (found == nullptr || found->region.get() != region) {
+    return;
+  }
+  std::vector<Entry> entries;
+  for (const auto& entry : table->entries) {
+    if (&entry != found) {
+      entries.push_back(entry);
+    }
+  }
+  publish(build(std::move(entries)));
+}
+
+void RegionRegistry::clear() {
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  publish(build(std::vector<Entry>()));
+}
+
+void RegionRegistry::publish(Table* table) {
+  auto replaced = m_table.exchange(table);
+  // A lookup that started before the exchange may still be reading the old
+  // table, and is counted under one of the two epochs. Moving to the next
+  // epoch twice, and waiting each time for the lookups of the epoch left
+  // behind, outlasts all of them while new lookups count under the other.
+  for (int i = 0; i < 2; i++) {
+    auto& readers = m_readers[m_epoch.fetch_add(1) & 1];
+    while (readers.load() != 0) {
+      std::this_thread::yield();
+    }
+  }
+  delete replaced;
+}
+
+size_t RegionRegistry::hash(const char* path, size_t length) {
+  // FNV-1a
+  uint64_t h = 14695981039346656037ULL;
+  for (size_t i = 0; i < length; i++) {
+    h = (h ^ static_cast<uint8_t>(path[i])) * 1099511628211ULL;
+  }
+  return static_cast<size_t>(h);
+}
+
+std::string RegionRegistry::keyOf(const Region* region) {
+  const char* path = region->getFullPath();
+  return path[0] == '/' ? path + 1 : path;
+}
+
+RegionRegistry::Table* RegionRegistry::build(std::vector<Entry> entries) {
+  auto table = new Table();
+  size_t size = 8;
+  while (size < entries.size() * 2) {
+    size <<= 1;
+  }
+  table->slots.assign(size, -1);
+  table->entries = std::move(entries);
+  for (size_t i = 0; i < table->entries.size(); i++) {
+    auto slot = table->entries[i].hash & (size - 1);
+    while (table->slots[slot] != -1) {
+      slot = (slot + 1) & (size - 1);
+    }
+    table->slots[slot] = static_cast<int32_t>(i);
+  }
+  return table;
+}
+
+const RegionRegistry::Entry* RegionRegistry::Table::find(
+    size_t hash, const char* path, size_t length) const {
+  auto mask = slots.size() - 1;
+  for (auto slot = hash & mask; slots[slot] != -1; slot = (slot + 1) & mask) {
+    const auto& entry = entries[slots[slot]];
+    if (entry.hash == hash && entry.path.length() == length &&
+        std::memcmp(entry.path.data(), path, length) == 0) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,111 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef GEODE_REGIONREGISTRY_H_
+#define GEODE_REGIONREGISTRY_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/Region.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Maps the full path of every region of a cache, root or subregion, to the
+ * region, so that a region is found by its path without walking the tree.
+ *
+ * The regions are held in an immutable table that is replaced whenever a
+ * region is added or removed. Lookups neither lock nor allocate and never
+ * wait for one another or for an update; updates are serialized and free a
+ * replaced table once no lookup can still be reading it.
+ */
+class CPPCACHE_EXPORT RegionRegistry {
+ public:
+  RegionRegistry();
+
+  ~RegionRegistry();
+
+  /**
+   * Returns the region at the given path, with or without the leading '/',
+   * or nullptr if there is none.
+   */
+  std::shared_ptr<Region> find(const char* path, size_t length) const;
+
+  /** Adds the region at its full path, replacing any other at that path. */
+  void add(const std::shared_ptr<Region>& region);
+
+  /** Removes the region, if it is the one registered at its full path. */
+  void remove(const Region* region);
+
+  /** Removes all the regions. */
+  void clear();
+
+ private:
+  struct Entry {
+    size_t hash;
+    std::string path;
+    std::shared_ptr<Region> region;
+  };
+
+  struct Table {
+    std::vector<Entry> entries;
+    // indexes into entries by hash, -1 for an empty slot; the size is a power
+    // of two at least twice the number of entries
+    std::vector<int32_t> slots;
+
+    const Entry* find(size_t hash, const char* path, size_t length) const;
+  };
+
+  static size_t hash(const char* path, size_t length);
+
+  // the path without its leading '/'
+  static std::string keyOf(const Region* region);
+
+  static Table* build(std::vector<Entry> entries);
+
+  // installs the table and frees the one it replaces; called with the update
+  // lock held
+  void publish(Table* table);
+
+  std::atomic<Table*> m_table;
+  // lookups in progress, counted under the epoch in which they started
+  mutable std::atomic<int32_t> m_readers[2];
+  std::atomic<uint32_t> m_epoch;
+  std::mutex m_updateLock;
+
+  // disabled
+  RegionRegistry(const RegionRegistry&);
+  RegionRegistry& operator=(const RegionRegistry&);
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_REGIONREGISTRY_H_
@@ -39,7 +39,7 @@ RegionStats::RegionStats(StatisticsFactory* factory,
 
   if (!statsType) {
     const bool largerIsBetter = true;
-    auto stats = new StatisticDescriptor*[25];
+    auto stats = new StatisticDescriptor*[35];
     stats[0] = factory->createIntCounter(
         "creates", "The total number of cache creates for this region",
         "entries", largerIsBetter);
@@ -134,7 +134,53 @@ RegionStats::RegionStats(StatisticsFactory* factory,
         "removeAllTime",
         "Total time spent doing removeAlls operations for this region",
         "Nanoseconds", !largerIsBetter);
-    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 25);
+    stats[25] = factory->createLongHistogram(
+        "getLatency", "Distribution of get operation times for this region",
+        "Nanoseconds", !largerIsBetter);
+    stats[26] = factory->createLongHistogram(
+        "putLatency", "Distribution of put operation times for this region",
+        "Nanoseconds", !largerIsBetter);
+    stats[27] = factory->createIntGauge(
+        "cacheListenerQueueSize",
+        "The number of entry events queued for the cache listener of this "
+        "region",
+        "entries", !largerIsBetter);
+    stats[28] = factory->createIntCounter(
+        "cacheListenerEventsConflated",
+        "Total number of queued cache listener events of this region that "
+        "were replaced by a later update of the same key",
+        "entries", largerIsBetter);
+    stats[29] = factory->createIntCounter(
+        "heapLruEvictions",
+        "Total number of entries of this region evicted to keep the heap "
+        "within the heap LRU limit",
+        "entries", !largerIsBetter);
+    stats[30] = factory->createLongCounter(
+        "heapLruEvictedBytes",
+        "Total size of the entries of this region evicted to keep the heap "
+        "within the heap LRU limit",
+        "bytes", !largerIsBetter);
+    stats[31] = factory->createLongGauge(
+        "footprintKeyBytes",
+        "Size of the keys of this region when its memory footprint was last "
+        "measured",
+        "bytes", !largerIsBetter);
+    stats[32] = factory->createLongGauge(
+        "footprintValueBytes",
+        "Size of the values of this region when its memory footprint was last "
+        "measured",
+        "bytes", !largerIsBetter);
+    stats[33] = factory->createLongGauge(
+        "footprintOverheadBytes",
+        "Memory held by this region besides its keys and values when its "
+        "memory footprint was last measured",
+        "bytes", !largerIsBetter);
+    stats[34] = factory->createLongGauge(
+        "footprintTotalBytes",
+        "Memory held by this region when its memory footprint was last "
+        "measured",
+        "bytes", !largerIsBetter);
+    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 35);
   }
 
   m_destroysId = statsType->nameToId("destroys");
@@ -163,6 +209,17 @@ RegionStats::RegionStats(StatisticsFactory* factory,
       statsType->nameToId("cacheListenerCallsCompleted");
   m_ListenerCallTimeId = statsType->nameToId("cacheListenerCallTime");
   m_clearsId = statsType->nameToId("clears");
+  m_getLatencyId = statsType->nameToId("getLatency");
+  m_putLatencyId = statsType->nameToId("putLatency");
+  m_listenerQueueSizeId = statsType->nameToId("cacheListenerQueueSize");
+  m_listenerEventsConflatedId =
+      statsType->nameToId("cacheListenerEventsConflated");
+  m_heapLruEvictionsId = statsType->nameToId("heapLruEvictions");
+  m_heapLruEvictedBytesId = statsType->nameToId("heapLruEvictedBytes");
+  m_footprintKeyBytesId = statsType->nameToId("footprintKeyBytes");
+  m_footprintValueBytesId = statsType->nameToId("footprintValueBytes");
+  m_footprintOverheadBytesId = statsType->nameToId("footprintOverheadBytes");
+  m_footprintTotalBytesId = statsType->nameToId("footprintTotalBytes");
 
   m_regionStats = factory->createAtomicStatistics(
       statsType, const_cast<char*>(regionName.c_str()));
@@ -192,6 +249,14 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_regionStats->setInt(m_ListenerCallsCompletedId, 0);
   m_regionStats->setInt(m_ListenerCallTimeId, 0);
   m_regionStats->setInt(m_clearsId, 0);
+  m_regionStats->setInt(m_listenerQueueSizeId, 0);
+  m_regionStats->setInt(m_listenerEventsConflatedId, 0);
+  m_regionStats->setInt(m_heapLruEvictionsId, 0);
+  m_regionStats->setLong(m_heapLruEvictedBytesId, 0);
+  m_regionStats->setLong(m_footprintKeyBytesId, 0);
+  m_regionStats->setLong(m_footprintValueBytesId, 0);
+  m_regionStats->setLong(m_footprintOverheadBytesId, 0);
+  m_regionStats->setLong(m_footprintTotalBytesId, 0);
 }
 
 RegionStats::~RegionStats() {
@@ -46,9 +46,13 @@ class CPPCACHE_EXPORT RegionStats {
 
   inline void incDestroys() { m_regionStats->incInt(m_destroysId, 1); }
 
-  inline void incCreates() { m_regionStats->incInt(m_createsId, 1); }
+  inline void incCreates(int32_t count = 1) {
+    m_regionStats->incInt(m_createsId, count);
+  }
 
-  inline void incPuts() { m_regionStats->incInt(m_putsId, 1); }
+  inline void incPuts(int32_t count = 1) {
+    m_regionStats->incInt(m_putsId, count);
+  }
 
   inline void incGets() { m_regionStats->incInt(m_getsId, 1); }
 
@@ -86,6 +90,31 @@ class CPPCACHE_EXPORT RegionStats {
     m_regionStats->incInt(m_ListenerCallsCompletedId, 1);
   }
 
+  inline void incListenerQueueSize(int32_t delta) {
+    m_regionStats->incInt(m_listenerQueueSizeId, delta);
+  }
+
+  inline void incListenerEventsConflated() {
+    m_regionStats->incInt(m_listenerEventsConflatedId, 1);
+  }
+
+  inline void incHeapLRUEvictions(int32_t entries, int64_t bytes) {
+    m_regionStats->incInt(m_heapLruEvictionsId, entries);
+    m_regionStats->incLong(m_heapLruEvictedBytesId, bytes);
+  }
+
+  // The footprint gauges are not sampled: they hold the figures of the last
+  // Region::getMemoryFootprint() call, and stay at zero until one is made,
+  // as measuring the keys and values takes a walk of the whole region.
+  inline void setFootprint(int64_t keyBytes, int64_t valueBytes,
+                           int64_t totalBytes) {
+    m_regionStats->setLong(m_footprintKeyBytesId, keyBytes);
+    m_regionStats->setLong(m_footprintValueBytesId, valueBytes);
+    m_regionStats->setLong(m_footprintOverheadBytesId,
+                           totalBytes - keyBytes - valueBytes);
+    m_regionStats->setLong(m_footprintTotalBytesId, totalBytes);
+  }
+
   inline void incClears() { m_regionStats->incInt(m_clearsId, 1); }
 
   inline void updateGetTime() { m_regionStats->incInt(m_clearsId, 1); }
@@ -112,6 +141,10 @@ class CPPCACHE_EXPORT RegionStats {
 
   inline int32_t getClearsId() { return m_clearsId; }
 
+  inline int32_t getGetLatencyId() { return m_getLatencyId; }
+
+  inline int32_t getPutLatencyId() { return m_putLatencyId; }
+
  private:
   apache::geode::statistics::Statistics* m_regionStats;
 
@@ -140,6 +173,16 @@ class CPPCACHE_EXPORT RegionStats {
   int32_t m_ListenerCallsCompletedId;
   int32_t m_ListenerCallTimeId;
   int32_t m_clearsId;
+  int32_t m_getLatencyId;
+  int32_t m_putLatencyId;
+  int32_t m_listenerQueueSizeId;
+  int32_t m_listenerEventsConflatedId;
+  int32_t m_heapLruEvictionsId;
+  int32_t m_heapLruEvictedBytesId;
+  int32_t m_footprintKeyBytesId;
+  int32_t m_footprintValueBytesId;
+  int32_t m_footprintOverheadBytesId;
+  int32_t m_footprintTotalBytesId;
 
   static constexpr const char* STATS_NAME = "RegionStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this region";
@@ -26,6 +26,7 @@
 #include "UserAttributes.hpp"
 #include "EventId.hpp"
 #include "ThinClientPoolDM.hpp"
+#include "QueryResultStreamImpl.hpp"
 #include "util/bounds.hpp"
 
 using namespace apache::geode::client;
@@ -111,12 +112,53 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
   if (pool != nullptr && enableTimeStatistics) {
     Utils::updateStatOpTime(pool->getStats().getStats(),
                             pool->getStats().getQueryExecutionTimeId(),
+                            pool->getStats().getQueryExecutionLatencyId(),
                             sampleStartNanos);
   }
   delete resultCollector;
   return sr;
 }
 
+std::shared_ptr<QueryResultStream> RemoteQuery::stream(
+    std::chrono::milliseconds timeout, size_t capacity) {
+  return stream(nullptr, timeout, capacity);
+}
+
+std::shared_ptr<QueryResultStream> RemoteQuery::stream(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout, size_t capacity) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  auto resultStream = std::make_shared<QueryResultStreamImpl>(capacity);
+  auto query = shared_from_this();
+  auto streamPtr = resultStream.get();
+  // the stream joins the thread before it goes away
+  resultStream->start([query, streamPtr, timeout, paramList]() {
+    query->executeStream(*streamPtr, timeout, paramList);
+  });
+  return resultStream;
+}
+
+void RemoteQuery::executeStream(QueryResultStreamImpl& stream,
+                                std::chrono::milliseconds timeout,
+                                std::shared_ptr<CacheableVector> paramList) {
+  const char* func = "Query::stream";
+  GuardUserAttribures gua;
+  if (m_proxyCache != nullptr) {
+    gua.setProxyCache(m_proxyCache);
+  }
+  ThinClientPoolDM* pool = dynamic_cast<ThinClientPoolDM*>(m_tccdm);
+  if (pool != nullptr) {
+    pool->getStats().incQueryExecutionId();
+  }
+
+  TcrMessageReply reply(true, m_tccdm);
+  ChunkedQueryResponse resultCollector(reply, &stream);
+  reply.setChunkedResultHandler(&resultCollector);
+  GfErrType err = executeNoThrow(timeout, reply, func, m_tccdm, paramList);
+  GfErrTypeToException(func, err);
+  LOGFINEST("%s: streamed results of query: %s", func, m_queryString.c_str());
+}
+
 GfErrType RemoteQuery::executeNoThrow(
     std::chrono::milliseconds timeout, TcrMessageReply& reply, const char* func,
     ThinClientBaseDM* tcdm, std::shared_ptr<CacheableVector> paramList) {
@@ -41,7 +41,11 @@ namespace apache {
 namespace geode {
 namespace client {
 
-class CPPCACHE_EXPORT RemoteQuery : public Query {
+class QueryResultStreamImpl;
+
+class CPPCACHE_EXPORT RemoteQuery
+    : public Query,
+      public std::enable_shared_from_this<RemoteQuery> {
   std::string m_queryString;
 
   std::shared_ptr<RemoteQueryService> m_queryService;
@@ -67,6 +71,15 @@ class CPPCACHE_EXPORT RemoteQuery : public Query {
       std::chrono::milliseconds timeout =
           DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
 
+  std::shared_ptr<QueryResultStream> stream(
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t capacity = QueryResultStream::DEFAULT_CAPACITY) override;
+
+  std::shared_ptr<QueryResultStream> stream(
+      std::shared_ptr<CacheableVector> paramList,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t capacity = QueryResultStream::DEFAULT_CAPACITY) override;
+
   // executes a query using a given distribution manager
   // used by Region.query() and Region.getAll()
   std::shared_ptr<SelectResults> execute(
@@ -84,6 +97,12 @@ class CPPCACHE_EXPORT RemoteQuery : public Query {
   void compile() override;
 
   bool isCompiled() override;
+
+ private:
+  // runs on the stream's own thread, feeding the results into it
+  void executeStream(QueryResultStreamImpl& stream,
+                     std::chrono::milliseconds timeout,
+                     std::shared_ptr<CacheableVector> paramList);
 };
 
 }  // namespace client
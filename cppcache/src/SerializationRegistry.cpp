@@ -180,13 +180,8 @@ std::shared_ptr<Serializable> SerializationRegistry::deserialize(
     }
   }
 
-  TypeFactoryMethod createType = nullptr;
-
-  if (findinternal) {
-    theTypeMap.find2(compId, createType);
-  } else {
-    theTypeMap.find(compId, createType);
-  }
+  auto createType =
+      findinternal ? theTypeMap.find2(compId) : theTypeMap.find(compId);
 
   if (createType == nullptr) {
     if (findinternal) {
@@ -205,7 +200,7 @@ std::shared_ptr<Serializable> SerializationRegistry::deserialize(
     throw IllegalStateException("Unregistered class ID in deserialization");
   }
 
-  std::shared_ptr<Serializable> obj(createType());
+  std::shared_ptr<Serializable> obj((*createType)());
   obj->fromData(input);
   return obj;
 }
@@ -300,30 +295,132 @@ int32_t SerializationRegistry::GetEnumValue(std::shared_ptr<Pool> pool,
   return static_cast<ThinClientPoolDM*>(pool.get())->GetEnum(val);
 }
 
+TypeDispatchTable::~TypeDispatchTable() {
+  for (auto& branchSlot : m_root.slots) {
+    if (auto branch = branchSlot.load(std::memory_order_relaxed)) {
+      for (auto& twigSlot : branch->slots) {
+        if (auto twig = twigSlot.load(std::memory_order_relaxed)) {
+          for (auto& leafSlot : twig->slots) {
+            delete leafSlot.load(std::memory_order_relaxed);
+          }
+          delete twig;
+        }
+      }
+      delete branch;
+    }
+  }
+}
+
+namespace {
+
+template <typename T>
+T* getOrAddPage(std::atomic<T*>& slot) {
+  auto page = slot.load(std::memory_order_relaxed);
+  if (page == nullptr) {
+    page = new T();
+    slot.store(page, std::memory_order_release);
+  }
+  return page;
+}
+
+}  // namespace
+
+const TypeFactoryMethod* TypeDispatchTable::exchange(
+    uint32_t id, const TypeFactoryMethod* factory) {
+  auto branch = getOrAddPage(m_root.slots[id >> 24]);
+  auto twig = getOrAddPage(branch->slots[(id >> 16) & 0xff]);
+  auto leaf = getOrAddPage(twig->slots[(id >> 8) & 0xff]);
+  return leaf->slots[id & 0xff].exchange(factory, std::memory_order_acq_rel);
+}
+
+void TypeDispatchTable::clear() {
+  for (auto& branchSlot : m_root.slots) {
+    if (auto branch = branchSlot.load(std::memory_order_relaxed)) {
+      for (auto& twigSlot : branch->slots) {
+        if (auto twig = twigSlot.load(std::memory_order_relaxed)) {
+          for (auto& leafSlot : twig->slots) {
+            if (auto leaf = leafSlot.load(std::memory_order_relaxed)) {
+              for (auto& factory : leaf->slots) {
+                factory.store(nullptr, std::memory_order_release);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 void TheTypeMap::clear() {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_mapLock);
-  m_map->unbind_all();
+  {
+    std::lock_guard<std::mutex> guard(m_updateLock);
+    for (auto& builtin : m_builtins) {
+      builtin.store(nullptr, std::memory_order_release);
+    }
+    for (auto& userTypes : m_userTypes) {
+      userTypes.clear();
+    }
+    m_fixedIds.clear();
 
-  std::lock_guard<util::concurrent::spinlock_mutex> guard2(m_map2Lock);
-  m_map2->unbind_all();
+    std::lock_guard<util::concurrent::spinlock_mutex> guard2(m_otherTypesLock);
+    m_otherTypes.clear();
+  }
 
   std::lock_guard<util::concurrent::spinlock_mutex> guard3(m_pdxTypemapLock);
   m_pdxTypemap->unbind_all();
 }
 
-void TheTypeMap::find(int64_t id, TypeFactoryMethod& func) const {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_mapLock);
-  m_map->find(id, func);
+const TypeFactoryMethod* TheTypeMap::find(int64_t id) const {
+  if (id >= INT8_MIN && id <= INT8_MAX) {
+    return m_builtins[static_cast<uint8_t>(id)].load(std::memory_order_acquire);
+  }
+  auto index = userTypesIndex(id);
+  if (index >= 0) {
+    return m_userTypes[index].find(static_cast<uint32_t>(id >> 32));
+  }
+
+  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_otherTypesLock);
+  auto found = m_otherTypes.find(id);
+  return found == m_otherTypes.end() ? nullptr : found->second;
+}
+
+const TypeFactoryMethod* TheTypeMap::keep(TypeFactoryMethod func) {
+  m_factories.emplace_back(new TypeFactoryMethod(std::move(func)));
+  return m_factories.back().get();
+}
+
+const TypeFactoryMethod* TheTypeMap::exchange(
+    int64_t compId, const TypeFactoryMethod* factory) {
+  if (compId >= INT8_MIN && compId <= INT8_MAX) {
+    return m_builtins[static_cast<uint8_t>(compId)].exchange(
+        factory, std::memory_order_acq_rel);
+  }
+  auto index = userTypesIndex(compId);
+  if (index >= 0) {
+    return m_userTypes[index].exchange(static_cast<uint32_t>(compId >> 32),
+                                       factory);
+  }
+
+  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_otherTypesLock);
+  const TypeFactoryMethod* replaced = nullptr;
+  auto found = m_otherTypes.find(compId);
+  if (found != m_otherTypes.end()) {
+    replaced = found->second;
+    m_otherTypes.erase(found);
+  }
+  if (factory != nullptr) {
+    m_otherTypes.emplace(compId, factory);
+  }
+  return replaced;
 }
 
-void TheTypeMap::find2(int64_t id, TypeFactoryMethod& func) const {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_map2Lock);
-  m_map2->find(id, func);
+const TypeFactoryMethod* TheTypeMap::exchange2(
+    int64_t compId, const TypeFactoryMethod* factory) {
+  return m_fixedIds.exchange(static_cast<uint32_t>(compId), factory);
 }
 
 void TheTypeMap::bind(TypeFactoryMethod func) {
   Serializable* obj = func();
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_mapLock);
   int64_t compId = static_cast<int64_t>(obj->typeId());
   if (compId == GeodeTypeIdsImpl::CacheableUserData ||
       compId == GeodeTypeIdsImpl::CacheableUserData2 ||
@@ -331,8 +428,8 @@ void TheTypeMap::bind(TypeFactoryMethod func) {
     compId |= ((static_cast<int64_t>(obj->classId())) << 32);
   }
   delete obj;
-  int bindRes = m_map->bind(compId, func);
-  if (bindRes == 1) {
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  if (find(compId) != nullptr) {
     LOGERROR(
         "A class with "
         "ID %d is already registered.",
@@ -340,50 +437,33 @@ void TheTypeMap::bind(TypeFactoryMethod func) {
     throw IllegalStateException(
         "A class with "
         "given ID is already registered.");
-  } else if (bindRes == -1) {
-    LOGERROR(
-        "Unknown error "
-        "while adding class ID %d to map.",
-        compId);
-    throw IllegalStateException(
-        "Unknown error "
-        "while adding type to map.");
   }
+  exchange(compId, keep(std::move(func)));
 }
 
 void TheTypeMap::rebind(int64_t compId, TypeFactoryMethod func) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_mapLock);
-  int bindRes = m_map->rebind(compId, func);
-  if (bindRes == -1) {
-    LOGERROR(
-        "Unknown error "
-        "while adding class ID %d to map.",
-        compId);
-    throw IllegalStateException(
-        "Unknown error "
-        "while adding type to map.");
-  }
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  exchange(compId, keep(std::move(func)));
 }
 
 void TheTypeMap::unbind(int64_t compId) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_mapLock);
-  m_map->unbind(compId);
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  exchange(compId, nullptr);
 }
 
 void TheTypeMap::bind2(TypeFactoryMethod func) {
   Serializable* obj = func();
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_map2Lock);
   int8_t dsfid = obj->DSFID();
 
   int64_t compId = 0;
   if (dsfid == GeodeTypeIdsImpl::FixedIDShort) {
-    compId = compId = static_cast<int64_t>(obj->classId());
+    compId = static_cast<int64_t>(obj->classId());
   } else {
     compId = static_cast<int64_t>(obj->typeId());
   }
   delete obj;
-  int bindRes = m_map2->bind(compId, func);
-  if (bindRes == 1) {
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  if (find2(compId) != nullptr) {
     LOGERROR(
         "A fixed class with "
         "ID %d is already registered.",
@@ -391,25 +471,18 @@ void TheTypeMap::bind2(TypeFactoryMethod func) {
     throw IllegalStateException(
         "A fixed class with "
         "given ID is already registered.");
-  } else if (bindRes == -1) {
-    LOGERROR(
-        "Unknown error "
-        "while adding class ID %d to map2.",
-        compId);
-    throw IllegalStateException(
-        "Unknown error "
-        "while adding to map2.");
   }
+  exchange2(compId, keep(std::move(func)));
 }
 
 void TheTypeMap::rebind2(int64_t compId, TypeFactoryMethod func) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_map2Lock);
-  m_map2->rebind(compId, func);
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  exchange2(compId, keep(std::move(func)));
 }
 
 void TheTypeMap::unbind2(int64_t compId) {
-  std::lock_guard<util::concurrent::spinlock_mutex> guard(m_map2Lock);
-  m_map2->unbind(compId);
+  std::lock_guard<std::mutex> guard(m_updateLock);
+  exchange2(compId, nullptr);
 }
 
 void TheTypeMap::bindPdxType(TypeFactoryMethodPdx func) {
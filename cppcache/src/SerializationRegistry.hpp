@@ -20,8 +20,13 @@
 #ifndef GEODE_SERIALIZATIONREGISTRY_H_
 #define GEODE_SERIALIZATIONREGISTRY_H_
 
-#include <string>
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <ace/Hash_Map_Manager.h>
 #include <ace/Thread_Mutex.h>
@@ -41,45 +46,117 @@
 #include "GeodeTypeIdsImpl.hpp"
 #include "MemberListForVersionStamp.hpp"
 
-#if defined(_MACOSX)
-ACE_BEGIN_VERSIONED_NAMESPACE_DECL
-// TODO CMake check type int64_t
-template <>
-class ACE_Export ACE_Hash<int64_t> {
- public:
-  inline unsigned long operator()(int64_t t) const {
-    return static_cast<long>(t);
-  }
-};
-
-ACE_END_VERSIONED_NAMESPACE_DECL
-#endif
-
 namespace apache {
 namespace geode {
 namespace client {
 
-typedef ACE_Hash_Map_Manager<int64_t, TypeFactoryMethod, ACE_Null_Mutex>
-    IdToFactoryMap;
-
 typedef ACE_Hash_Map_Manager<std::string, TypeFactoryMethodPdx, ACE_Null_Mutex>
     StrToPdxFactoryMap;
 
+/**
+ * Maps 32-bit ids to type factories through four levels of 256 slots, so
+ * that finding a factory takes four loads and neither a lock nor a hash.
+ * Pages are added as ids are set and stay until the table goes away.
+ * Slots are set by one writer at a time, under a lock held by the owner,
+ * and are published with release stores for the lock-free readers.
+ */
+class TypeDispatchTable : private NonCopyable {
+ public:
+  TypeDispatchTable() = default;
+
+  ~TypeDispatchTable();
+
+  inline const TypeFactoryMethod* find(uint32_t id) const {
+    auto branch = m_root.slots[id >> 24].load(std::memory_order_acquire);
+    if (branch == nullptr) {
+      return nullptr;
+    }
+    auto twig =
+        branch->slots[(id >> 16) & 0xff].load(std::memory_order_acquire);
+    if (twig == nullptr) {
+      return nullptr;
+    }
+    auto leaf = twig->slots[(id >> 8) & 0xff].load(std::memory_order_acquire);
+    if (leaf == nullptr) {
+      return nullptr;
+    }
+    return leaf->slots[id & 0xff].load(std::memory_order_acquire);
+  }
+
+  /** Sets the factory for <code>id</code>, returning the one it replaces. */
+  const TypeFactoryMethod* exchange(uint32_t id,
+                                    const TypeFactoryMethod* factory);
+
+  void clear();
+
+ private:
+  template <typename T>
+  struct Page {
+    Page() {
+      for (auto& slot : slots) {
+        slot.store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    std::atomic<T*> slots[256];
+  };
+
+  typedef Page<const TypeFactoryMethod> Leaf;
+  typedef Page<Leaf> Twig;
+  typedef Page<Twig> Branch;
+
+  Page<Branch> m_root;
+};
+
+/**
+ * The factories of the registered types. Builtins are found by their type
+ * id in a dense table and fixed ids and user types through a
+ * TypeDispatchTable each, so deserializing an object takes no lock. A
+ * factory that is replaced or removed is kept until the map goes away, as
+ * a reader may still be calling it.
+ */
 class TheTypeMap : private NonCopyable {
  private:
-  IdToFactoryMap* m_map;
-  IdToFactoryMap* m_map2;  // to hold Fixed IDs since GFE 5.7.
+  // user types by class id, one table for each of CacheableUserData,
+  // CacheableUserData2 and CacheableUserData4
+  TypeDispatchTable m_userTypes[3];
+  TypeDispatchTable m_fixedIds;  // to hold Fixed IDs since GFE 5.7.
+  std::atomic<const TypeFactoryMethod*> m_builtins[256];
+  // ids added by addType that fit none of the tables above
+  std::unordered_map<int64_t, const TypeFactoryMethod*> m_otherTypes;
+  mutable util::concurrent::spinlock_mutex m_otherTypesLock;
+  std::vector<std::unique_ptr<const TypeFactoryMethod>> m_factories;
+  std::mutex m_updateLock;
   StrToPdxFactoryMap* m_pdxTypemap;
-  mutable util::concurrent::spinlock_mutex m_mapLock;
-  mutable util::concurrent::spinlock_mutex m_map2Lock;
   mutable util::concurrent::spinlock_mutex m_pdxTypemapLock;
 
+  // the index in m_userTypes of the user type kind in the low word of id,
+  // or -1
+  inline static int userTypesIndex(int64_t id) {
+    switch (static_cast<int32_t>(id)) {
+      case GeodeTypeIdsImpl::CacheableUserData:
+        return 0;
+      case GeodeTypeIdsImpl::CacheableUserData2:
+        return 1;
+      case GeodeTypeIdsImpl::CacheableUserData4:
+        return 2;
+      default:
+        return -1;
+    }
+  }
+
+  // the following are called with m_updateLock held
+  const TypeFactoryMethod* keep(TypeFactoryMethod func);
+  const TypeFactoryMethod* exchange(int64_t compId,
+                                    const TypeFactoryMethod* factory);
+  const TypeFactoryMethod* exchange2(int64_t compId,
+                                     const TypeFactoryMethod* factory);
+
  public:
   TheTypeMap() {
-    m_map = new IdToFactoryMap();
-
-    // second map to hold internal Data Serializable Fixed IDs - since GFE 5.7
-    m_map2 = new IdToFactoryMap();
+    for (auto& builtin : m_builtins) {
+      builtin.store(nullptr, std::memory_order_relaxed);
+    }
 
     // map to hold PDX types <string, funptr>.
     m_pdxTypemap = new StrToPdxFactoryMap();
@@ -88,14 +165,6 @@ class TheTypeMap : private NonCopyable {
   }
 
   virtual ~TheTypeMap() {
-    if (m_map != nullptr) {
-      delete m_map;
-    }
-
-    if (m_map2 != nullptr) {
-      delete m_map2;
-    }
-
     if (m_pdxTypemap != nullptr) {
       delete m_pdxTypemap;
     }
@@ -105,8 +174,13 @@ class TheTypeMap : private NonCopyable {
 
   void clear();
 
-  void find(int64_t id, TypeFactoryMethod& func) const;
-  void find2(int64_t id, TypeFactoryMethod& func) const;
+  /** Returns the factory of a builtin or user type, or nullptr. */
+  const TypeFactoryMethod* find(int64_t id) const;
+
+  /** Returns the factory of a fixed id type, or nullptr. */
+  inline const TypeFactoryMethod* find2(int64_t id) const {
+    return m_fixedIds.find(static_cast<uint32_t>(id));
+  }
 
   void bind(TypeFactoryMethod func);
 
@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/Cache.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "SerializedValue.hpp"
+
+using namespace apache::geode::client;
+
+std::shared_ptr<Cacheable> SerializedValue::deserialize(
+    const Cache& cache, const char* poolName) const {
+  auto input = cache.createDataInput(m_bytes.data(),
+                                     static_cast<int32_t>(m_bytes.size()));
+  input->setPoolName(poolName);
+  std::shared_ptr<Cacheable> result;
+  input->readObject(result);
+  return result;
+}
+
+std::shared_ptr<Cacheable> SerializedValue::toObject(
+    const std::shared_ptr<Cacheable>& value, const Cache& cache,
+    const char* poolName) {
+  auto serialized = std::dynamic_pointer_cast<SerializedValue>(value);
+  if (serialized == nullptr) {
+    return value;
+  }
+  return serialized->deserialize(cache, poolName);
+}
+
+void SerializedValue::toData(DataOutput& output) const {
+  throw UnsupportedOperationException(
+      "SerializedValue: serialized cache values are never serialized again");
+}
+
+void SerializedValue::fromData(DataInput& input) {
+  throw UnsupportedOperationException(
+      "SerializedValue: serialized cache values are never serialized again");
+}
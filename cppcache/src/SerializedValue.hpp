@@ -0,0 +1,77 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SERIALIZEDVALUE_H_
+#define GEODE_SERIALIZEDVALUE_H_
+
+#include <memory>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <geode/Cacheable.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+class Cache;
+
+/**
+ * @brief A value received from a server, kept as the bytes it was sent as
+ * in the cache of a region that stores values serialized. It only ever
+ * lives inside the entries map, which deserializes it when it is read.
+ */
+class CPPCACHE_EXPORT SerializedValue : public Cacheable {
+ public:
+  SerializedValue(const uint8_t* bytes, int32_t length)
+      : m_bytes(bytes, bytes + length) {}
+
+  virtual ~SerializedValue() {}
+
+  inline const std::vector<uint8_t>& getBytes() const { return m_bytes; }
+
+  /** @brief deserialize the value into a new object. */
+  std::shared_ptr<Cacheable> deserialize(const Cache& cache,
+                                         const char* poolName) const;
+
+  /**
+   * @brief return value deserialized if it is a SerializedValue, otherwise
+   * value itself.
+   */
+  static std::shared_ptr<Cacheable> toObject(
+      const std::shared_ptr<Cacheable>& value, const Cache& cache,
+      const char* poolName);
+
+  virtual void toData(DataOutput& output) const;
+
+  virtual void fromData(DataInput& input);
+
+  virtual int32_t classId() const { return 0; }
+
+  virtual uint32_t objectSize() const {
+    return static_cast<uint32_t>(sizeof(SerializedValue) + m_bytes.capacity());
+  }
+
+ private:
+  std::vector<uint8_t> m_bytes;
+};
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SERIALIZEDVALUE_H_
@@ -0,0 +1,134 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SlabArena.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+// slabs start small, since most arenas belong to small maps, and double up
+// to this many blocks
+const size_t MIN_SLAB_BLOCKS = 16;
+const size_t MAX_SLAB_BLOCKS = 4096;
+
+// rounds up so that every block in a slab stays aligned and can hold the
+// link of the free list
+inline size_t blockSizeFor(size_t size) {
+  return size == 0 ? SlabArena::ALIGNMENT
+                   : (size + SlabArena::ALIGNMENT - 1) &
+                         ~(SlabArena::ALIGNMENT - 1);
+}
+}  // namespace
+
+SlabArena::SlabArena()
+    : m_blockSize(0),
+      m_slabBlocks(MIN_SLAB_BLOCKS),
+      m_cursor(nullptr),
+      m_end(nullptr),
+      m_freeBlocks(nullptr),
+      m_reservedBytes(0),
+      m_blocksInUse(0),
+      m_heapBlocks(0),
+      m_released(false) {}
+
+SlabArena::~SlabArena() {
+  for (auto slab : m_slabs) {
+    ::operator delete(slab);
+  }
+}
+
+void* SlabArena::allocate(size_t size) {
+  size_t blockSize = blockSizeFor(size);
+  std::lock_guard<spinlock_mutex> lock(m_spinlock);
+  if (m_blockSize == 0) {
+    m_blockSize = blockSize;
+  } else if (blockSize != m_blockSize) {
+    void* block = ::operator new(size);
+    ++m_blocksInUse;
+    ++m_heapBlocks;
+    return block;
+  }
+
+  void* block;
+  if (m_freeBlocks != nullptr) {
+    block = m_freeBlocks;
+    m_freeBlocks = m_freeBlocks->next;
+  } else {
+    if (m_cursor == m_end) {
+      size_t slabSize = m_slabBlocks * m_blockSize;
+      m_cursor = static_cast<char*>(::operator new(slabSize));
+      m_end = m_cursor + slabSize;
+      m_slabs.push_back(m_cursor);
+      m_reservedBytes += slabSize;
+      if (m_slabBlocks < MAX_SLAB_BLOCKS) {
+        m_slabBlocks *= 2;
+      }
+    }
+    block = m_cursor;
+    m_cursor += m_blockSize;
+  }
+  ++m_blocksInUse;
+  return block;
+}
+
+void SlabArena::deallocate(void* block, size_t size) {
+  if (block == nullptr) {
+    return;
+  }
+  size_t blockSize = blockSizeFor(size);
+  std::unique_lock<spinlock_mutex> lock(m_spinlock);
+  if (blockSize != m_blockSize) {
+    ::operator delete(block);
+    --m_heapBlocks;
+  } else {
+    auto freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = m_freeBlocks;
+    m_freeBlocks = freeBlock;
+  }
+  --m_blocksInUse;
+  unlockAndReap(lock);
+}
+
+void SlabArena::release() {
+  std::unique_lock<spinlock_mutex> lock(m_spinlock);
+  m_released = true;
+  unlockAndReap(lock);
+}
+
+size_t SlabArena::getReservedBytes() const {
+  std::lock_guard<spinlock_mutex> lock(m_spinlock);
+  return m_reservedBytes;
+}
+
+size_t SlabArena::getUsedBytes() const {
+  std::lock_guard<spinlock_mutex> lock(m_spinlock);
+  return (m_blocksInUse - m_heapBlocks) * m_blockSize;
+}
+
+void SlabArena::unlockAndReap(std::unique_lock<spinlock_mutex>& lock) {
+  bool reap = m_released && m_blocksInUse == 0;
+  lock.unlock();
+  if (reap) {
+    delete this;
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
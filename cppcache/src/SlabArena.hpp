@@ -0,0 +1,154 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SLABARENA_H_
+#define GEODE_SLABARENA_H_
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+
+#include "util/concurrent/spinlock_mutex.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using util::concurrent::spinlock_mutex;
+
+/**
+ * Hands out blocks of a single size carved from larger slabs, so that many
+ * small objects of one kind pay neither a heap allocation each nor the
+ * heap's bookkeeping per allocation. Freed blocks are kept for reuse; the
+ * slabs are given back only when the arena goes away.
+ *
+ * The block size is set by the first allocation, and blocks of any other
+ * size come from the heap. The owner of an arena releases it rather than
+ * deleting it: the arena lives on until its last block has been freed, so
+ * objects allocated from it may outlive their owner. Blocks may be
+ * allocated and freed by any thread.
+ */
+class CPPCACHE_EXPORT SlabArena {
+ public:
+  /** The alignment of the blocks. */
+  static const size_t ALIGNMENT = alignof(void*);
+
+  SlabArena();
+
+  void* allocate(size_t size);
+
+  void deallocate(void* block, size_t size);
+
+  /** Gives up the owner's hold on the arena. */
+  void release();
+
+  /** Returns the bytes taken by the slabs, whether their blocks are used. */
+  size_t getReservedBytes() const;
+
+  /** Returns the bytes of the slab blocks handed out and not yet freed. */
+  size_t getUsedBytes() const;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  ~SlabArena();
+
+  // deletes the arena if it has been released and all its blocks freed;
+  // called with the lock held, which it releases
+  void unlockAndReap(std::unique_lock<spinlock_mutex>& lock);
+
+  size_t m_blockSize;
+  size_t m_slabBlocks;
+  char* m_cursor;
+  char* m_end;
+  FreeBlock* m_freeBlocks;
+  std::vector<char*> m_slabs;
+  size_t m_reservedBytes;
+  size_t m_blocksInUse;
+  // of the blocks in use, those of other sizes that came from the heap
+  size_t m_heapBlocks;
+  bool m_released;
+  mutable spinlock_mutex m_spinlock;
+
+  // disabled
+  SlabArena(const SlabArena&);
+  SlabArena& operator=(const SlabArena&);
+};
+
+/**
+ * A standard allocator over a SlabArena. Containers and allocate_shared
+ * allocate single objects from the arena and anything else from the heap.
+ */
+template <typename T>
+class SlabAllocator {
+ public:
+  typedef T value_type;
+
+  template <typename U>
+  struct rebind {
+    typedef SlabAllocator<U> other;
+  };
+
+  explicit SlabAllocator(SlabArena* arena) : m_arena(arena) {}
+
+  template <typename U>
+  SlabAllocator(const SlabAllocator<U>& other) : m_arena(other.m_arena) {}
+
+  T* allocate(size_t n) {
+    if (n != 1 || alignof(T) > SlabArena::ALIGNMENT) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(m_arena->allocate(sizeof(T)));
+  }
+
+  void deallocate(T* p, size_t n) {
+    if (n != 1 || alignof(T) > SlabArena::ALIGNMENT) {
+      ::operator delete(p);
+    } else {
+      m_arena->deallocate(p, sizeof(T));
+    }
+  }
+
+  template <typename U>
+  bool operator==(const SlabAllocator<U>& other) const {
+    return m_arena == other.m_arena;
+  }
+
+  template <typename U>
+  bool operator!=(const SlabAllocator<U>& other) const {
+    return m_arena != other.m_arena;
+  }
+
+ private:
+  SlabArena* m_arena;
+
+  template <typename U>
+  friend class SlabAllocator;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SLABARENA_H_
@@ -0,0 +1,183 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include <geode/StreamingResultCollector.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+using namespace apache::geode::client;
+
+StreamingResultCollector::StreamingResultCollector()
+    : m_head(new Node{nullptr, false, {nullptr}}),
+      m_pendingClears(0),
+      m_waiters(0),
+      m_ended(false) {
+  m_tail = m_head.load();
+}
+
+StreamingResultCollector::~StreamingResultCollector() noexcept {
+  while (m_tail != nullptr) {
+    auto next = m_tail->next.load();
+    delete m_tail;
+    m_tail = next;
+  }
+}
+
+std::shared_ptr<StreamingResultCollector> StreamingResultCollector::withListener(
+    Listener listener) {
+  auto collector = std::make_shared<StreamingResultCollector>();
+  collector->m_listener = std::move(listener);
+  return collector;
+}
+
+std::shared_ptr<StreamingResultCollector> StreamingResultCollector::withReducer(
+    Reducer reducer) {
+  auto collector = std::make_shared<StreamingResultCollector>();
+  collector->m_reducer = std::move(reducer);
+  return collector;
+}
+
+void StreamingResultCollector::push(Node* node) {
+  auto previous = m_head.exchange(node);
+  previous->next.store(node);
+  if (m_waiters.load() > 0) {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_condition.notify_all();
+  }
+}
+
+bool StreamingResultCollector::pop(std::shared_ptr<Cacheable>& result) {
+  while (auto next = m_tail->next.load()) {
+    // the popped node becomes the new stub
+    delete m_tail;
+    m_tail = next;
+    if (next->clear) {
+      --m_pendingClears;
+    } else if (m_pendingClears.load() > 0) {
+      // queued ahead of a clear, so it belongs to a failed attempt
+      next->result = nullptr;
+    } else {
+      result = std::move(next->result);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool StreamingResultCollector::next(std::shared_ptr<Cacheable>& result,
+                                    std::chrono::milliseconds timeout) {
+  if (m_listener || m_reducer) {
+    throw IllegalStateException(
+        "StreamingResultCollector::next: results are not queued when the "
+        "collector has a listener or reducer");
+  }
+
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!pop(result)) {
+    std::unique_lock<std::mutex> lk(m_mutex);
+    if (m_ended && m_tail->next.load() == nullptr) {
+      return false;
+    }
+    ++m_waiters;
+    bool ready = m_condition.wait_until(lk, deadline, [this] {
+      return m_ended || m_tail->next.load() != nullptr;
+    });
+    --m_waiters;
+    if (!ready) {
+      throw FunctionExecutionException(
+          "StreamingResultCollector::next: no result within the timeout");
+    }
+  }
+  return true;
+}
+
+bool StreamingResultCollector::waitForEnd(std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lk(m_mutex);
+  return m_condition.wait_for(lk, timeout, [this] { return m_ended; });
+}
+
+std::shared_ptr<CacheableVector> StreamingResultCollector::getResult(
+    std::chrono::milliseconds timeout) {
+  if (!waitForEnd(timeout)) {
+    throw FunctionExecutionException(
+        "Result is not ready, endResults callback is called before invoking "
+        "getResult() method");
+  }
+
+  auto results = CacheableVector::create();
+  if (m_reducer) {
+    std::shared_ptr<Cacheable> reduced;
+    bool hasValue = false;
+    for (auto& partial : m_partials) {
+      std::lock_guard<std::mutex> lk(partial.mutex);
+      if (partial.hasValue) {
+        reduced = hasValue ? m_reducer(reduced, partial.value) : partial.value;
+        hasValue = true;
+      }
+    }
+    if (hasValue) {
+      results->push_back(reduced);
+    }
+  } else if (!m_listener) {
+    std::shared_ptr<Cacheable> result;
+    while (pop(result)) {
+      results->push_back(result);
+    }
+  }
+  return results;
+}
+
+void StreamingResultCollector::addResult(
+    const std::shared_ptr<Cacheable>& result) {
+  if (m_listener) {
+    m_listener(result);
+  } else if (m_reducer) {
+    // each adding thread mostly sticks to its own partial result
+    auto& partial =
+        m_partials[std::hash<std::thread::id>()(std::this_thread::get_id()) %
+                   PARTIALS];
+    std::lock_guard<std::mutex> lk(partial.mutex);
+    partial.value =
+        partial.hasValue ? m_reducer(partial.value, result) : result;
+    partial.hasValue = true;
+  } else {
+    push(new Node{result, false, {nullptr}});
+  }
+}
+
+void StreamingResultCollector::endResults() {
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_ended = true;
+  }
+  m_condition.notify_all();
+}
+
+void StreamingResultCollector::clearResults() {
+  if (m_reducer) {
+    for (auto& partial : m_partials) {
+      std::lock_guard<std::mutex> lk(partial.mutex);
+      partial.value = nullptr;
+      partial.hasValue = false;
+    }
+  } else if (!m_listener) {
+    // the reading thread drops whatever is queued ahead of the marker
+    ++m_pendingClears;
+    push(new Node{nullptr, true, {nullptr}});
+  }
+}
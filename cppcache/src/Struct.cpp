@@ -35,6 +35,12 @@ Struct::Struct(StructSet* ssPtr,
   m_lastAccessIndex = 0;
 }
 
+Struct::Struct(const std::shared_ptr<StructSet>& ssPtr,
+               std::vector<std::shared_ptr<Serializable>>& fieldValues)
+    : Struct(ssPtr.get(), fieldValues) {
+  m_parentOwner = ssPtr;
+}
+
 void Struct::skipClassName(DataInput& input) {
   if (input.read() == GeodeTypeIdsImpl::Class) {
     input.read();  // ignore string type id - assuming its a normal
@@ -123,6 +129,9 @@ const std::shared_ptr<Serializable> Struct::operator[](
 }
 
 const std::shared_ptr<StructSet> Struct::getStructSet() const {
+  if (m_parentOwner != nullptr) {
+    return m_parentOwner;
+  }
   return std::shared_ptr<StructSet>(m_parent);
 }
 
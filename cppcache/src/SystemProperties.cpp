@@ -43,6 +43,8 @@ const char StatisticsSampleInterval[] = "statistic-sample-rate";
 const char StatisticsEnabled[] = "statistic-sampling-enabled";
 const char AppDomainEnabled[] = "appdomain-enabled";
 const char StatisticsArchiveFile[] = "statistic-archive-file";
+const char StatisticsMetricsFile[] = "statistic-metrics-file";
+const char StatisticsMetricsPort[] = "statistic-metrics-port";
 const char LogFilename[] = "log-file";
 const char LogLevel[] = "log-level";
 
@@ -84,8 +86,10 @@ const char SslTrustStore[] = "ssl-truststore";
 const char SslKeystorePassword[] =
     "ssl-keystore-password";  // adongre: Added for Ticket #758
 const char ThreadPoolSize[] = "max-fe-threads";
+const char BackgroundThreads[] = "max-bg-threads";
 const char SuspendedTxTimeout[] = "suspended-tx-timeout";
 const char DisableChunkHandlerThread[] = "disable-chunk-handler-thread";
+const char ChunkHandlerThreads[] = "chunk-handler-threads";
 const char OnClientDisconnectClearPdxTypeIds[] =
     "on-client-disconnect-clear-pdxType-Ids";
 const char TombstoneTimeoutInMSec[] = "tombstone-timeout";
@@ -103,6 +107,8 @@ const bool DefaultSamplingEnabled = true;
 const bool DefaultAppDomainEnabled = false;
 
 const char DefaultStatArchive[] = "statArchive.gfs";
+const char DefaultStatMetricsFile[] = "";  // not exported
+const uint16_t DefaultStatMetricsPort = 0;  // not served
 const char DefaultLogFilename[] = "";  // stdout...
 
 const apache::geode::client::Log::LogLevel DefaultLogLevel =
@@ -142,10 +148,12 @@ const char DefaultSecurityPrefix[] = "security-";
 const char DefaultSecurityClientDhAlgo[] ATTR_UNUSED = "";
 const char DefaultSecurityClientKsPath[] ATTR_UNUSED = "";
 const uint32_t DefaultThreadPoolSize = ACE_OS::num_processors() * 2;
+const uint32_t DefaultBackgroundThreads = 4;
 constexpr auto DefaultSuspendedTxTimeout = std::chrono::seconds(30);
 constexpr auto DefaultTombstoneTimeout = std::chrono::seconds(480);
 // not disable; all region api will use chunk handler thread
 const bool DefaultDisableChunkHandlerThread = false;
+const uint32_t DefaultChunkHandlerThreads = 2;
 const bool DefaultOnClientDisconnectClearPdxTypeIds = false;
 
 }  // namespace
@@ -166,6 +174,8 @@ SystemProperties::SystemProperties(
       m_statisticsEnabled(DefaultSamplingEnabled),
       m_appDomainEnabled(DefaultAppDomainEnabled),
       m_statisticsArchiveFile(nullptr),
+      m_statisticsMetricsFile(nullptr),
+      m_statisticsMetricsPort(DefaultStatMetricsPort),
       m_logFilename(nullptr),
       m_logLevel(DefaultLogLevel),
       m_sessions(0 /* setup  later in processProperty */),
@@ -203,9 +213,11 @@ SystemProperties::SystemProperties(
       m_sslKeystorePassword(nullptr),  // adongre: Added for Ticket #758
       m_conflateEvents(nullptr),
       m_threadPoolSize(DefaultThreadPoolSize),
+      m_backgroundThreads(DefaultBackgroundThreads),
       m_suspendedTxTimeout(DefaultSuspendedTxTimeout),
       m_tombstoneTimeout(DefaultTombstoneTimeout),
       m_disableChunkHandlerThread(DefaultDisableChunkHandlerThread),
+      m_chunkHandlerThreads(DefaultChunkHandlerThreads),
       m_onClientDisconnectClearPdxTypeIds(
           DefaultOnClientDisconnectClearPdxTypeIds) {
   processProperty(ConflateEvents, DefaultConflateEvents);
@@ -218,6 +230,7 @@ SystemProperties::SystemProperties(
   processProperty(SslKeystorePassword, DefaultSslKeystorePassword);
 
   processProperty(StatisticsArchiveFile, DefaultStatArchive);
+  processProperty(StatisticsMetricsFile, DefaultStatMetricsFile);
 
   processProperty(LogFilename, DefaultLogFilename);
   processProperty(CacheXMLFile, DefaultCacheXMLFile);
@@ -276,6 +289,7 @@ SystemProperties::SystemProperties(
 
 SystemProperties::~SystemProperties() {
   GF_SAFE_DELETE_ARRAY(m_statisticsArchiveFile);
+  GF_SAFE_DELETE_ARRAY(m_statisticsMetricsFile);
   GF_SAFE_DELETE_ARRAY(m_logFilename);
   GF_SAFE_DELETE_ARRAY(m_name);
   GF_SAFE_DELETE_ARRAY(m_cacheXMLFile);
@@ -317,6 +331,15 @@ void SystemProperties::processProperty(const char* property,
       throwError(
           ("SystemProperties: non-integer " + prop + "=" + value).c_str());
     }
+  } else if (prop == BackgroundThreads) {
+    char* end;
+    uint32_t si = strtoul(value, &end, 10);
+    if (!*end) {
+      m_backgroundThreads = si;
+    } else {
+      throwError(
+          ("SystemProperties: non-integer " + prop + "=" + value).c_str());
+    }
   } else if (prop == MaxSocketBufferSize) {
     char* end;
     long si = strtol(value, &end, 10);
@@ -455,6 +478,24 @@ void SystemProperties::processProperty(const char* property,
     m_statisticsArchiveFile = new char[len];
     ACE_OS::strncpy(m_statisticsArchiveFile, value, len);
 
+  } else if (prop == StatisticsMetricsFile) {
+    if (m_statisticsMetricsFile != nullptr) {
+      delete[] m_statisticsMetricsFile;
+    }
+    size_t len = strlen(value) + 1;
+    m_statisticsMetricsFile = new char[len];
+    ACE_OS::strncpy(m_statisticsMetricsFile, value, len);
+
+  } else if (prop == StatisticsMetricsPort) {
+    char* end;
+    long si = strtol(value, &end, 10);
+    if (!*end && si >= 0 && si <= 65535) {
+      m_statisticsMetricsPort = static_cast<uint16_t>(si);
+    } else {
+      throwError(("SystemProperties: invalid port " + prop + "=" + value)
+                     .c_str());
+    }
+
   } else if (prop == LogFilename) {
     if (m_logFilename != nullptr) {
       delete[] m_logFilename;
@@ -635,6 +676,16 @@ void SystemProperties::processProperty(const char* property,
     } else {
       throwError(("SystemProperties: non-boolean " + prop + "=" + val).c_str());
     }
+  } else if (prop == ChunkHandlerThreads) {
+    char* end;
+    uint32_t si = strtoul(value, &end, 10);
+    if (!*end && si > 0) {
+      m_chunkHandlerThreads = si;
+    } else {
+      throwError(
+          ("SystemProperties: non-positive integer " + prop + "=" + value)
+              .c_str());
+    }
   } else if (prop == OnClientDisconnectClearPdxTypeIds) {
     std::string val = value;
     if (val == "false") {
@@ -693,6 +744,9 @@ void SystemProperties::logSettings() {
   settings += "\n  disable-chunk-handler-thread = ";
   settings += disableChunkHandlerThread() ? "true" : "false";
 
+  settings += "\n  chunk-handler-threads = ";
+  settings += std::to_string(chunkHandlerThreads());
+
   settings += "\n  disable-shuffling-of-endpoints = ";
   settings += isEndpointShufflingDisabled() ? "true" : "false";
 
@@ -739,6 +793,9 @@ void SystemProperties::logSettings() {
   settings += "\n  max-fe-threads = ";
   settings += std::to_string(threadPoolSize());
 
+  settings += "\n  max-bg-threads = ";
+  settings += std::to_string(backgroundThreads());
+
   settings += "\n  max-socket-buffer-size = ";
   settings += std::to_string(maxSocketBufferSize());
 
@@ -783,6 +840,12 @@ void SystemProperties::logSettings() {
   settings += "\n  statistic-archive-file = ";
   settings += statisticsArchiveFile();
 
+  settings += "\n  statistic-metrics-file = ";
+  settings += statisticsMetricsFile();
+
+  settings += "\n  statistic-metrics-port = ";
+  settings += std::to_string(statisticsMetricsPort());
+
   settings += "\n  statistic-sampling-enabled = ";
   settings += statisticsEnabled() ? "true" : "false";
 
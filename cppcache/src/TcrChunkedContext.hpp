@@ -74,6 +74,13 @@ class TcrChunkedResult {
    */
   virtual void reset() = 0;
 
+  /**
+   * Whether chunks must be handled by the thread reading them off the
+   * connection rather than the chunk processor thread, for results that
+   * block while their consumer catches up.
+   */
+  virtual bool handleInReaderThread() const { return false; }
+
   void fireHandleChunk(const uint8_t* bytes, int32_t len,
                        uint8_t isLastChunkWithSecurity, const Cache* cache) {
     if (appDomainContext) {
@@ -155,6 +162,12 @@ class TcrChunkedContext {
 
   inline int32_t getLen() const { return m_len; }
 
+  inline const TcrChunkedResult* getResult() const { return m_result; }
+
+  inline bool handleInReaderThread() const {
+    return m_result->handleInReaderThread();
+  }
+
   void handleChunk(bool inSameThread) {
     if (m_bytes == nullptr) {
       // this is the last chunk for some set of chunks
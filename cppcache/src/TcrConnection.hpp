@@ -22,6 +22,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstring>
 
 #include <ace/Semaphore.h>
 
@@ -309,7 +310,40 @@ class CPPCACHE_EXPORT TcrConnection {
     }
   }
 
+  /**
+   * Encrypts <code>len</code> bytes into <code>out</code>, without allocating,
+   * and returns the number of bytes written. Without Diffie-Hellman the bytes
+   * are copied as they are.
+   */
+  int32_t encryptBytes(const uint8_t* data, int32_t len, uint8_t* out,
+                       int32_t capacity) {
+    if (m_dh != nullptr) {
+      return m_dh->encrypt(data, len, out, capacity);
+    } else {
+      return copyBytes(data, len, out, capacity);
+    }
+  }
+
+  int32_t decryptBytes(const uint8_t* data, int32_t len, uint8_t* out,
+                       int32_t capacity) {
+    if (m_dh != nullptr) {
+      return m_dh->decrypt(data, len, out, capacity);
+    } else {
+      return copyBytes(data, len, out, capacity);
+    }
+  }
+
  private:
+  static int32_t copyBytes(const uint8_t* data, int32_t len, uint8_t* out,
+                           int32_t capacity) {
+    if (len > capacity) {
+      throw IllegalArgumentException(
+          "TcrConnection: buffer too small for the bytes");
+    }
+    std::memcpy(out, data, len);
+    return len;
+  }
+
   int64_t connectionId;
   const TcrConnectionManager* m_connectionManager;
   DiffieHellman* m_dh;
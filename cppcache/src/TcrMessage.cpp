@@ -34,14 +34,197 @@
 #include "DiskStoreId.hpp"
 #include "DiskVersionTag.hpp"
 #include "CacheRegionHelper.hpp"
+#include "SerializedValue.hpp"
+#include "ThreadPool.hpp"
 #include <boost/stacktrace.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 using namespace apache::geode::client;
 static const uint32_t REGULAR_EXPRESSION =
     1;  // come from Java InterestType.REGULAR_EXPRESSION
 
 namespace {
 uint32_t g_headerLen = 17;
+
+// the entries of a putAll are encoded in batches of this many, on several
+// threads once there are enough of them to be worth it
+const size_t PUTALL_ENCODE_BATCH = 256;
+const size_t PUTALL_PARALLEL_ENCODE_MIN = 4 * PUTALL_ENCODE_BATCH;
+const size_t PUTALL_MAX_ENCODE_THREADS = 4;
+
+typedef const HashMapOfCacheable::value_type* PutAllEntry;
+
+/**
+ * Encodes the key and value parts of a batch of putAll entries into an
+ * output of its own, byte for byte as the message itself would.
+ */
+class PutAllBatchEncoder : public TcrMessage {
+ public:
+  PutAllBatchEncoder(std::unique_ptr<DataOutput> output, const Region* region) {
+    m_request = std::move(output);
+    m_region = region;
+    m_request->setPoolName(getPoolName());
+  }
+
+  void encode(const PutAllEntry* begin, const PutAllEntry* end) {
+    for (auto entry = begin; entry != end; ++entry) {
+      writeObjectPart((*entry)->first);
+      writeObjectPart((*entry)->second);
+    }
+  }
+
+  inline const DataOutput& getOutput() const { return *m_request; }
+};
+
+struct PutAllBatch {
+  std::unique_ptr<PutAllBatchEncoder> encoder;
+  std::exception_ptr failure;
+  bool done = false;
+  bool byCaller = false;
+};
+
+/**
+ * The batches of one putAll and the state the threads encoding them share.
+ * Helpers on the thread pool co-own it, so a helper the pool only starts
+ * after the putAll has been written finds nothing left to encode.
+ */
+class PutAllEncoding {
+ public:
+  PutAllEncoding(std::vector<PutAllEntry> entries, const Cache* cache,
+                 const Region* region)
+      : m_entries(std::move(entries)),
+        m_batches((m_entries.size() + PUTALL_ENCODE_BATCH - 1) /
+                  PUTALL_ENCODE_BATCH),
+        m_cache(cache),
+        m_region(region),
+        m_nextBatch(0),
+        m_encoding(0),
+        m_finished(false) {}
+
+  inline size_t batchCount() const { return m_batches.size(); }
+
+  /**
+   * Claims and encodes the next batch; returns false once all of them have
+   * been claimed.
+   */
+  bool encodeNext(size_t& index) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_nextBatch >= m_batches.size()) {
+        return false;
+      }
+      index = m_nextBatch++;
+      ++m_encoding;
+    }
+    std::unique_ptr<PutAllBatchEncoder> encoder;
+    std::exception_ptr failure;
+    try {
+      encoder.reset(
+          new PutAllBatchEncoder(m_cache->createDataOutput(), m_region));
+      auto begin = m_entries.data() + index * PUTALL_ENCODE_BATCH;
+      auto end = m_entries.data() + std::min(m_entries.size(),
+                                             (index + 1) * PUTALL_ENCODE_BATCH);
+      encoder->encode(begin, end);
+    } catch (...) {
+      failure = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_batches[index].encoder = std::move(encoder);
+      m_batches[index].failure = failure;
+      m_batches[index].done = true;
+      --m_encoding;
+    }
+    m_changed.notify_all();
+    return true;
+  }
+
+  /**
+   * Returns batch <code>index</code> once it has been encoded, encoding
+   * later ones on this thread while it waits.
+   */
+  PutAllBatch& awaitBatch(size_t index) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_batches[index].done) {
+      lock.unlock();
+      size_t claimed;
+      bool encodedOne = encodeNext(claimed);
+      lock.lock();
+      if (encodedOne) {
+        m_batches[claimed].byCaller = true;
+      } else {
+        m_changed.wait(lock, [&]() { return m_batches[index].done; });
+      }
+    }
+    return m_batches[index];
+  }
+
+  /**
+   * Encodes batches on a helper thread. Output buffers go back to a pool of
+   * the thread that frees them, so a helper frees the batches it encoded
+   * itself, once they have been appended.
+   */
+  void help() {
+    std::vector<size_t> encodedHere;
+    size_t index;
+    while (encodeNext(index)) {
+      encodedHere.push_back(index);
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_changed.wait(lock, [this]() { return m_finished; });
+    for (auto mine : encodedHere) {
+      m_batches[mine].encoder.reset();
+    }
+  }
+
+  /**
+   * Stops further batches from being claimed and waits until none is being
+   * encoded, after which the entries and the region are no longer used.
+   * Helpers that have not started are not waited for.
+   */
+  void finish() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_nextBatch = m_batches.size();
+    m_finished = true;
+    m_changed.notify_all();
+    m_changed.wait(lock, [this]() { return m_encoding == 0; });
+  }
+
+ private:
+  std::vector<PutAllEntry> m_entries;
+  std::vector<PutAllBatch> m_batches;
+  const Cache* m_cache;
+  const Region* m_region;
+  std::mutex m_mutex;
+  std::condition_variable m_changed;
+  size_t m_nextBatch;
+  size_t m_encoding;
+  bool m_finished;
+};
+
+/**
+ * Helps encode a putAll on the thread pool. The pool does not free the
+ * requests it runs, so this one deletes itself once it has run.
+ */
+class PutAllEncodeWork : public ACE_Method_Request {
+ public:
+  explicit PutAllEncodeWork(std::shared_ptr<PutAllEncoding> encoding)
+      : m_encoding(std::move(encoding)) {}
+
+  virtual int call(void) {
+    m_encoding->help();
+    delete this;
+    return 0;
+  }
+
+ private:
+  std::shared_ptr<PutAllEncoding> m_encoding;
+};
 }  // namespace
 
 // AtomicInc TcrMessage::m_transactionId = 0;
@@ -261,6 +444,30 @@ inline void TcrMessage::readObjectPart(DataInput& input, bool defaultString) {
   }
 }
 
+void TcrMessage::readSerializedObjectPart(DataInput& input) {
+  int32_t lenObj = input.readInt32();
+  auto isObj = input.read();
+  if (lenObj > 0 && isObj == 1) {
+    m_value = std::make_shared<SerializedValue>(input.currentBufferPosition(),
+                                                lenObj);
+    input.advanceCursor(lenObj);
+  } else {
+    input.rewindCursor(5);
+    readObjectPart(input);
+  }
+}
+
+bool TcrMessage::regionStoresSerialized() const {
+  std::shared_ptr<Region> region;
+  m_tcdm->getConnectionManager().getCacheImpl()->getRegion(
+      m_regionName.c_str(), region);
+  if (region == nullptr) {
+    return false;
+  }
+  auto attrs = region->getAttributes();
+  return attrs->getCachingEnabled() && attrs->getStoreSerialized();
+}
+
 void TcrMessage::readSecureObjectPart(DataInput& input, bool defaultString,
                                       bool isChunk,
                                       uint8_t isLastChunkWithSecurity) {
@@ -325,12 +532,7 @@ void TcrMessage::readUniqueIDObjectPart(DataInput& input) {
 
 int64_t TcrMessage::getConnectionId(TcrConnection* conn) {
   if (m_connectionIDBytes != nullptr) {
-   auto tmp = conn->decryptBytes(m_connectionIDBytes);
-   auto di = m_tcdm->getConnectionManager()
-                 .getCacheImpl()
-                 ->getCache()
-                 ->createDataInput(tmp->value(), tmp->length());
-   return di->readInt64();
+    return readSecurityId(*m_connectionIDBytes, conn);
   } else {
     LOGWARN("Returning 0 as internal connection ID msgtype = %d ", m_msgType);
     return 0;
@@ -340,16 +542,26 @@ int64_t TcrMessage::getConnectionId(TcrConnection* conn) {
 int64_t TcrMessage::getUniqueId(TcrConnection* conn) {
   if (m_value != nullptr) {
     auto encryptBytes = std::static_pointer_cast<CacheableBytes>(m_value);
-
-   auto tmp = conn->decryptBytes(encryptBytes);
-
-    auto di = m_tcdm->getConnectionManager().getCacheImpl()->getCache()->createDataInput(
-              tmp->value(), tmp->length());
-    return di->readInt64();
+    return readSecurityId(*encryptBytes, conn);
   }
   return 0;
 }
 
+int64_t TcrMessage::readSecurityId(const CacheableBytes& bytes,
+                                   TcrConnection* conn) {
+  // the ids are a few cipher blocks at most, so they are decrypted on the
+  // stack rather than into a new CacheableBytes and DataInput
+  uint8_t cleartext[64];
+  auto len = conn->decryptBytes(bytes.value(), bytes.length(), cleartext,
+                                sizeof(cleartext));
+  if (len < 8) {
+    throw IllegalStateException("TcrMessage: security id is too short");
+  }
+  uint64_t id;
+  readInt(cleartext, &id);
+  return static_cast<int64_t>(id);
+}
+
 inline void TcrMessage::readFailedNodePart(DataInput& input,
                                            bool defaultString) {
   int32_t lenObj = input.readInt32();
@@ -385,6 +597,11 @@ inline void TcrMessage::writeInt(uint8_t* buffer, uint32_t value) {
   *(buffer++) = static_cast<uint8_t>(value >> 8);
   *(buffer++) = static_cast<uint8_t>(value);
 }
+
+inline void TcrMessage::writeInt(uint8_t* buffer, uint64_t value) {
+  writeInt(buffer, static_cast<uint32_t>(value >> 32));
+  writeInt(buffer + 4, static_cast<uint32_t>(value));
+}
 std::shared_ptr<Serializable> TcrMessage::readCacheableString(DataInput& input,
                                                               int lenObj) {
   std::shared_ptr<Serializable> sPtr;
@@ -573,6 +790,14 @@ void TcrMessage::readInt(uint8_t* buffer, uint32_t* value) {
   *value = tmp;
 }
 
+void TcrMessage::readInt(uint8_t* buffer, uint64_t* value) {
+  uint32_t high;
+  uint32_t low;
+  readInt(buffer, &high);
+  readInt(buffer + 4, &low);
+  *value = (static_cast<uint64_t>(high) << 32) | low;
+}
+
 void TcrMessage::writeBytesOnly(const std::shared_ptr<Serializable>& se) {
   uint32_t cBufferLength = m_request->getBufferLength();
   uint8_t* startBytes = nullptr;
@@ -1215,6 +1440,9 @@ void TcrMessage::handleByteArrayResponse(
         input->readBytesOnly(m_deltaBytes, m_deltaBytesLen);
         m_delta = m_tcdm->getConnectionManager().getCacheImpl()->getCache()->createDataInput(
             m_deltaBytes, m_deltaBytesLen);
+      } else if (regionStoresSerialized()) {
+        // deserialized when the value is first read
+        readSerializedObjectPart(*input);
       } else {
         readObjectPart(*input);
       }
@@ -1230,6 +1458,11 @@ void TcrMessage::handleByteArrayResponse(
         // LOGINFO("got cq local_create/local_create");
         readCqsPart(*input);
         m_msgTypeForCq = static_cast<uint32_t>(m_msgType);
+        // CQ listeners are handed the value itself
+        m_value = SerializedValue::toObject(
+            m_value,
+            *m_tcdm->getConnectionManager().getCacheImpl()->getCache(),
+            input->getPoolName());
       }
 
       // read eventid part
@@ -2216,10 +2449,7 @@ TcrMessagePutAll::TcrMessagePutAll(
     writeObjectPart(aCallbackArgument);
   }
 
-  for (const auto& iter : map) {
-    writeObjectPart(iter.first);
-    writeObjectPart(iter.second);
-  }
+  writeEntryParts(map);
 
   if (m_messageResponseTimeout >= std::chrono::milliseconds::zero()) {
     writeMillisecondsPart(m_messageResponseTimeout);
@@ -2227,6 +2457,60 @@ TcrMessagePutAll::TcrMessagePutAll(
   writeMessageLength();
 }
 
+void TcrMessagePutAll::writeEntryParts(const HashMapOfCacheable& map) {
+  auto cache = m_request->getCache();
+  size_t threads = std::min<size_t>(PUTALL_MAX_ENCODE_THREADS,
+                                    std::thread::hardware_concurrency());
+  if (cache == nullptr || map.size() < PUTALL_PARALLEL_ENCODE_MIN ||
+      threads < 2) {
+    for (const auto& iter : map) {
+      writeObjectPart(iter.first);
+      writeObjectPart(iter.second);
+    }
+    return;
+  }
+
+  std::vector<PutAllEntry> entries;
+  entries.reserve(map.size());
+  for (const auto& iter : map) {
+    entries.push_back(&iter);
+  }
+  auto encoding =
+      std::make_shared<PutAllEncoding>(std::move(entries), cache, m_region);
+  size_t batchCount = encoding->batchCount();
+
+  try {
+    // helpers are never waited for: the ones the pool is too busy to start
+    // before this thread has encoded everything find nothing left to do
+    auto threadPool = CacheRegionHelper::getCacheImpl(cache)->getThreadPool();
+    for (size_t i = 1; i < std::min(threads, batchCount); i++) {
+      auto work = new PutAllEncodeWork(encoding);
+      if (threadPool->perform(work) == -1) {
+        delete work;
+        break;
+      }
+    }
+
+    // batches are appended in order as they complete; while the next one is
+    // still being encoded elsewhere, this thread encodes a later one
+    for (size_t index = 0; index < batchCount; index++) {
+      auto& batch = encoding->awaitBatch(index);
+      if (batch.failure) {
+        std::rethrow_exception(batch.failure);
+      }
+      const auto& output = batch.encoder->getOutput();
+      m_request->writeBytesOnly(output.getBuffer(), output.getBufferLength());
+      if (batch.byCaller) {
+        batch.encoder.reset();
+      }
+    }
+  } catch (...) {
+    encoding->finish();
+    throw;
+  }
+  encoding->finish();
+}
+
 TcrMessageRemoveAll::TcrMessageRemoveAll(
     std::unique_ptr<DataOutput> dataOutput, const Region* region,
     const std::vector<std::shared_ptr<CacheableKey>>& keys,
@@ -2626,19 +2910,11 @@ void TcrMessage::addSecurityPart(int64_t connectionId, int64_t unique_id,
   }
   m_isSecurityHeaderAdded = true;
   LOGDEBUG("addSecurityPart( , ) ");
-  auto dOutput = m_tcdm->getConnectionManager().getCacheImpl()->getCache()->createDataOutput();
-
-  dOutput->writeInt(connectionId);
-  dOutput->writeInt(unique_id);
-
-  auto bytes =
-      CacheableBytes::create(dOutput->getBuffer(), dOutput->getBufferLength());
-
-  auto encryptBytes = conn->encryptBytes(bytes);
 
-  writeObjectPart(encryptBytes);
-  writeMessageLength();
-  m_securityHeaderLength = 4 + 1 + encryptBytes->length();
+  uint8_t cleartext[16];
+  writeInt(cleartext, static_cast<uint64_t>(connectionId));
+  writeInt(cleartext + 8, static_cast<uint64_t>(unique_id));
+  writeSecurityPart(cleartext, sizeof(cleartext), conn);
   LOGDEBUG("TcrMessage addsp = %s ",
            Utils::convertBytesToString(m_request->getBuffer(),
                                        m_request->getBufferLength())
@@ -2656,24 +2932,31 @@ void TcrMessage::addSecurityPart(int64_t connectionId, TcrConnection* conn) {
   }
   m_isSecurityHeaderAdded = true;
   LOGDEBUG("TcrMessage::addSecurityPart only connid");
-  auto dOutput = m_tcdm->getConnectionManager().getCacheImpl()->getCache()->createDataOutput();
-
-  dOutput->writeInt(connectionId);
-
-  auto bytes =
-      CacheableBytes::create(dOutput->getBuffer(), dOutput->getBufferLength());
-
-  auto encryptBytes = conn->encryptBytes(bytes);
 
-  writeObjectPart(encryptBytes);
-  writeMessageLength();
-  m_securityHeaderLength = 4 + 1 + encryptBytes->length();
+  uint8_t cleartext[8];
+  writeInt(cleartext, static_cast<uint64_t>(connectionId));
+  writeSecurityPart(cleartext, sizeof(cleartext), conn);
   LOGDEBUG("TcrMessage addspCC = %s ",
            Utils::convertBytesToString(m_request->getBuffer(),
                                        m_request->getBufferLength())
                ->asChar());
 }
 
+void TcrMessage::writeSecurityPart(uint8_t* cleartext, int32_t len,
+                                   TcrConnection* conn) {
+  // the part is sent with every message of a secured connection, so it is
+  // encrypted on the stack and written as a byte array part without going
+  // through a DataOutput or CacheableBytes of its own
+  uint8_t ciphertext[64];
+  auto cipherLen =
+      conn->encryptBytes(cleartext, len, ciphertext, sizeof(ciphertext));
+  m_request->writeInt(cipherLen);
+  m_request->write(static_cast<int8_t>(0));  // isObject
+  m_request->writeBytesOnly(ciphertext, cipherLen);
+  writeMessageLength();
+  m_securityHeaderLength = 4 + 1 + cipherLen;
+}
+
 TcrMessageRequestEventValue::TcrMessageRequestEventValue(
     std::unique_ptr<DataOutput> dataOutput, std::shared_ptr<EventId> eventId) {
   m_request = std::move(dataOutput);
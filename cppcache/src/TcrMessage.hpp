@@ -60,8 +60,10 @@ class CPPCACHE_EXPORT TcrMessage {
  private:
   inline static void writeInt(uint8_t* buffer, uint16_t value);
   inline static void writeInt(uint8_t* buffer, uint32_t value);
+  inline static void writeInt(uint8_t* buffer, uint64_t value);
   inline static void readInt(uint8_t* buffer, uint16_t* value);
   inline static void readInt(uint8_t* buffer, uint32_t* value);
+  inline static void readInt(uint8_t* buffer, uint64_t* value);
 
  public:
   typedef enum {
@@ -528,6 +530,8 @@ class CPPCACHE_EXPORT TcrMessage {
   void handleSpecialFECase();
   bool m_feAnotherHop;
   void writeBytesOnly(const std::shared_ptr<Serializable>& se);
+  void writeSecurityPart(uint8_t* cleartext, int32_t len, TcrConnection* conn);
+  int64_t readSecurityId(const CacheableBytes& bytes, TcrConnection* conn);
   std::shared_ptr<Serializable> readCacheableBytes(DataInput& input,
                                                    int lenObj);
   std::shared_ptr<Serializable> readCacheableString(DataInput& input,
@@ -557,6 +561,9 @@ class CPPCACHE_EXPORT TcrMessage {
       const SerializationRegistry& serializationRegistry,
       MemberListForVersionStamp& memberListForVersionStamp);
   void readObjectPart(DataInput& input, bool defaultString = false);
+  // keeps a serialized object as a SerializedValue instead of reading it
+  void readSerializedObjectPart(DataInput& input);
+  bool regionStoresSerialized() const;
   void readFailedNodePart(DataInput& input, bool defaultString = false);
   void readCallbackObjectPart(DataInput& input, bool defaultString = false);
   void readKeyPart(DataInput& input);
@@ -950,6 +957,9 @@ class TcrMessagePutAll : public TcrMessage {
   virtual ~TcrMessagePutAll() {}
 
  private:
+  // writes the key and value parts of the entries; those of a large putAll
+  // are encoded in batches on the cache thread pool and appended in order
+  void writeEntryParts(const HashMapOfCacheable& map);
 };
 
 class TcrMessageRemoveAll : public TcrMessage {
@@ -29,7 +29,6 @@
 using namespace apache::geode::client;
 
 volatile bool ThinClientBaseDM::s_isDeltaEnabledOnServer = true;
-const char* ThinClientBaseDM::NC_ProcessChunk = "NC ProcessChunk";
 
 ThinClientBaseDM::ThinClientBaseDM(TcrConnectionManager& connManager,
                                    ThinClientRegion* theRegion)
@@ -37,7 +36,6 @@ ThinClientBaseDM::ThinClientBaseDM(TcrConnectionManager& connManager,
       m_connManager(connManager),
       m_initDone(false),
       m_clientNotification(false),
-      m_chunks(true),
       m_chunkProcessor(nullptr) {}
 
 ThinClientBaseDM::~ThinClientBaseDM() {}
@@ -204,19 +202,15 @@ void ThinClientBaseDM::failover() {
 
 void ThinClientBaseDM::queueChunk(TcrChunkedContext* chunk) {
   LOGDEBUG("ThinClientBaseDM::queueChunk");
-  const uint32_t timeout = 1;
-  if (m_chunkProcessor == nullptr) {
+  if (m_chunkProcessor == nullptr || chunk->handleInReaderThread()) {
     LOGDEBUG("ThinClientBaseDM::queueChunk2");
-    // process in same thread if no chunk processor thread
+    // process in same thread if no chunk processor thread, or if the result
+    // may block and must not hold up chunks of other responses
     chunk->handleChunk(true);
     GF_SAFE_DELETE(chunk);
-  } else if (!m_chunks.putUntil(chunk, timeout, 0)) {
+  } else if (!m_chunkProcessor->queue(chunk)) {
     LOGDEBUG("ThinClientBaseDM::queueChunk3");
-    // if put in queue fails due to whatever reason then process in same thread
-    LOGFINE(
-        "addChunkToQueue: timed out while adding to queue of "
-        "unbounded size after waiting for %d secs",
-        timeout);
+    // the processor is being stopped, so process in same thread
     chunk->handleChunk(true);
     GF_SAFE_DELETE(chunk);
   } else {
@@ -224,39 +218,21 @@ void ThinClientBaseDM::queueChunk(TcrChunkedContext* chunk) {
   }
 }
 
-// the chunk processing thread
-int ThinClientBaseDM::processChunks(volatile bool& isRunning) {
-  TcrChunkedContext* chunk;
-  LOGFINE("Starting chunk process thread for region %s",
-          (m_region != nullptr ? m_region->getFullPath() : "(null)"));
-  while (isRunning) {
-    chunk = m_chunks.getUntil(0, 100000);
-    if (chunk) {
-      chunk->handleChunk(false);
-      GF_SAFE_DELETE(chunk);
-    }
-  }
-  LOGFINE("Ending chunk process thread for region %s",
-          (m_region != nullptr ? m_region->getFullPath() : "(null)"));
-  GF_DEV_ASSERT(m_chunks.size() == 0);
-  return 0;
-}
-
-// start the chunk processing thread
+// start the chunk processing threads
 void ThinClientBaseDM::startChunkProcessor() {
   if (m_chunkProcessor == nullptr) {
-    m_chunks.open();
-    m_chunkProcessor = new Task<ThinClientBaseDM>(
-        this, &ThinClientBaseDM::processChunks, NC_ProcessChunk);
-    m_chunkProcessor->start();
+    const auto& systemProperties = m_connManager.getCacheImpl()
+                                       ->getDistributedSystem()
+                                       .getSystemProperties();
+    m_chunkProcessor = new ChunkProcessor(
+        systemProperties.chunkHandlerThreads(), getChunkStats());
   }
 }
 
-// stop the chunk processing thread
+// stop the chunk processing threads
 void ThinClientBaseDM::stopChunkProcessor() {
   if (m_chunkProcessor != nullptr) {
     m_chunkProcessor->stop();
-    m_chunks.close();
     GF_SAFE_DELETE(m_chunkProcessor);
   }
 }
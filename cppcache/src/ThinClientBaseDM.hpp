@@ -23,6 +23,7 @@
 #include <geode/geode_globals.hpp>
 #include "TcrConnectionManager.hpp"
 #include "TcrEndpoint.hpp"
+#include "ChunkProcessor.hpp"
 #include <vector>
 
 namespace apache {
@@ -34,6 +35,7 @@ namespace client {
  */
 class TcrMessage;
 class ThinClientRegion;
+class PoolStats;
 
 class ThinClientBaseDM {
  public:
@@ -172,8 +174,7 @@ class ThinClientBaseDM {
 
   ThinClientRegion* m_region;
 
-  // methods for the chunk processing thread
-  int processChunks(volatile bool& isRunning);
+  // methods for the chunk processing threads
   void startChunkProcessor();
   void stopChunkProcessor();
 
@@ -193,12 +194,13 @@ class ThinClientBaseDM {
   bool m_initDone;
   bool m_clientNotification;
 
-  Queue<TcrChunkedContext> m_chunks;
-  Task<ThinClientBaseDM>* m_chunkProcessor;
+  // the statistics the chunk processor records, if any
+  virtual PoolStats* getChunkStats() { return nullptr; }
+
+  ChunkProcessor* m_chunkProcessor;
 
  private:
   static volatile bool s_isDeltaEnabledOnServer;
-  static const char* NC_ProcessChunk;
 };
 }  // namespace client
 }  // namespace geode
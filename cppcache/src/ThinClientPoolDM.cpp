@@ -16,6 +16,8 @@
  */
 
 #include <algorithm>
+#include <chrono>
+#include <thread>
 #include <ace/INET_Addr.h>
 
 #include <geode/ResultCollector.hpp>
@@ -124,6 +126,32 @@ class GetAllWork : public PooledWork<GfErrType>,
   }
 };
 
+class ConnectionWarmUpWork : public PooledWork<int>,
+                             private NonCopyable,
+                             private NonAssignable {
+  ThinClientPoolDM* m_poolDM;
+  volatile bool& m_isRunning;
+  std::atomic<int>& m_attempts;
+
+ public:
+  ConnectionWarmUpWork(ThinClientPoolDM* poolDM, volatile bool& isRunning,
+                       std::atomic<int>& attempts)
+      : m_poolDM(poolDM), m_isRunning(isRunning), m_attempts(attempts) {}
+
+  int execute(void) {
+    try {
+      return m_poolDM->warmUpConnections(m_isRunning, m_attempts);
+    } catch (const Exception& e) {
+      LOGERROR(e.what());
+    } catch (const std::exception& e) {
+      LOGERROR(e.what());
+    } catch (...) {
+      LOGERROR("Unexpected exception while warming up connections");
+    }
+    return 0;
+  }
+};
+
 const char* ThinClientPoolDM::NC_Ping_Thread = "NC Ping Thread";
 const char* ThinClientPoolDM::NC_MC_Thread = "NC MC Thread";
 #define PRIMARY_QUEUE_NOT_AVAILABLE -2
@@ -136,22 +164,13 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
       m_poolName(name),
       m_stats(nullptr),
       m_sticky(false),
-      m_updateLocatorListSema(0),
-      m_pingSema(0),
-      m_cliCallbackSema(0),
       m_isDestroyed(false),
       m_destroyPending(false),
       m_destroyPendingHADM(false),
       m_isMultiUserMode(false),
       m_locHelper(nullptr),
-      m_poolSize(0),
       m_numRegions(0),
       m_server(0),
-      m_connSema(0),
-      m_connManageTask(nullptr),
-      m_pingTask(nullptr),
-      m_updateLocatorListTask(nullptr),
-      m_cliCallbackTask(nullptr),
       m_pingTaskId(-1),
       m_updateLocatorListTaskId(-1),
       m_connManageTaskId(-1),
@@ -212,6 +231,11 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
     m_clientMetadataService = new ClientMetadataService(this);
   }
   m_manager = new ThinClientStickyManager(this);
+
+  // connections made before the pool starts already ask for a run
+  m_connManageTask = cacheImpl->getBackgroundExecutor().createTask(
+      [this](volatile bool& isRunning) { manageConnections(isRunning); },
+      NC_MC_Thread);
 }
 
 void ThinClientPoolDM::init() {
@@ -262,9 +286,11 @@ std::shared_ptr<Properties> ThinClientPoolDM::getCredentials(TcrEndpoint* ep) {
 }
 
 void ThinClientPoolDM::startBackgroundThreads() {
-  LOGDEBUG("ThinClientPoolDM::startBackgroundThreads: Starting ping thread");
-  m_pingTask = new Task<ThinClientPoolDM>(this, &ThinClientPoolDM::pingServer,
-                                          NC_Ping_Thread);
+  auto& executor = m_connManager.getCacheImpl()->getBackgroundExecutor();
+  LOGDEBUG("ThinClientPoolDM::startBackgroundThreads: Starting ping task");
+  m_pingTask = executor.createTask(
+      [this](volatile bool& isRunning) { pingServer(isRunning); },
+      NC_Ping_Thread);
   m_pingTask->start();
 
   auto& props = m_connManager.getCacheImpl()
@@ -272,8 +298,9 @@ void ThinClientPoolDM::startBackgroundThreads() {
                     .getSystemProperties();
 
   if (props.onClientDisconnectClearPdxTypeIds() == true) {
-    m_cliCallbackTask =
-        new Task<ThinClientPoolDM>(this, &ThinClientPoolDM::cliCallback);
+    m_cliCallbackTask = executor.createTask(
+        [this](volatile bool& isRunning) { cliCallback(isRunning); },
+        NC_thread);
     m_cliCallbackTask->start();
   }
 
@@ -299,8 +326,9 @@ void ThinClientPoolDM::startBackgroundThreads() {
   long updateLocatorListInterval = getUpdateLocatorListInterval().count();
 
   if (updateLocatorListInterval > 0) {
-    m_updateLocatorListTask =
-        new Task<ThinClientPoolDM>(this, &ThinClientPoolDM::updateLocatorList);
+    m_updateLocatorListTask = executor.createTask(
+        [this](volatile bool& isRunning) { updateLocatorList(isRunning); },
+        NC_thread);
     m_updateLocatorListTask->start();
 
     updateLocatorListInterval = updateLocatorListInterval / 1000;  // seconds
@@ -322,10 +350,7 @@ void ThinClientPoolDM::startBackgroundThreads() {
 
   LOGDEBUG(
       "ThinClientPoolDM::startBackgroundThreads: Starting manageConnections "
-      "thread");
-  // Manage Connection Thread
-  m_connManageTask = new Task<ThinClientPoolDM>(
-      this, &ThinClientPoolDM::manageConnections, NC_MC_Thread);
+      "task");
   m_connManageTask->start();
 
   auto idle = getIdleTimeout();
@@ -378,18 +403,9 @@ void ThinClientPoolDM::startBackgroundThreads() {
   }
 }
 int ThinClientPoolDM::manageConnections(volatile bool& isRunning) {
-  LOGFINE("ThinClientPoolDM: starting manageConnections thread");
-
-  while (isRunning) {
-    m_connSema.acquire();
-    if (isRunning) {
-      manageConnectionsInternal(isRunning);
-      while (m_connSema.tryacquire() != -1) {
-        ;
-      }
-    }
+  if (isRunning) {
+    manageConnectionsInternal(isRunning);
   }
-  LOGFINE("ThinClientPoolDM: ending manageConnections thread");
   return 0;
 }
 
@@ -488,7 +504,8 @@ void ThinClientPoolDM::cleanStaleConnections(volatile bool& isRunning) {
               _nextIdle.sec() + 1);
   }
 
-  LOGDEBUG("Pool size is %d, pool counter is %d", size(), m_poolSize.load());
+  LOGDEBUG("Pool size is %d, pool counter is %d", size(),
+           m_poolSize.established());
 }
 void ThinClientPoolDM::cleanStickyConnections(volatile bool& isRunning) {}
 
@@ -499,29 +516,86 @@ void ThinClientPoolDM::restoreMinConnections(volatile bool& isRunning) {
 
   LOGDEBUG("Restoring minimum connection level");
 
+  int restored = warmUpPool(isRunning);
+
+  LOGDEBUG("Restored %d connections", restored);
+  LOGDEBUG("Pool size is %d, pool counter is %d", size(),
+           m_poolSize.established());
+}
+
+int ThinClientPoolDM::warmUpPool(volatile bool& isRunning) {
   int min = m_attrs->getMinConnections();
-  int limit = 2 * min;
+  int missing = min - m_poolSize.established() - m_poolSize.reserved();
+  if (missing <= 0) {
+    return 0;
+  }
 
-  std::set<ServerLocation> excludeServers;
+  // Servers refusing connections must not keep the workers busy, so all of
+  // them together give up after twice min attempts.
+  std::atomic<int> attempts(2 * min);
+  int workers = std::min(missing, m_attrs->getConnectionWarmUpConcurrency());
 
+  std::vector<std::unique_ptr<ConnectionWarmUpWork>> works;
+  auto* threadPool = m_connManager.getCacheImpl()->getThreadPool();
+  for (int i = 1; i < workers; i++) {
+    works.emplace_back(new ConnectionWarmUpWork(this, isRunning, attempts));
+    threadPool->perform(works.back().get());
+  }
+
+  // the calling thread is the last worker
+  int restored = warmUpConnections(isRunning, attempts);
+  for (const auto& work : works) {
+    restored += work->getResult();
+  }
+  return restored;
+}
+
+int ThinClientPoolDM::warmUpConnections(volatile bool& isRunning,
+                                        std::atomic<int>& attempts) {
+  int min = m_attrs->getMinConnections();
+  std::set<ServerLocation> excludeServers;
   int restored = 0;
 
-  if (m_poolSize < min) {
-    ACE_Guard<ACE_Recursive_Thread_Mutex> poolguard(m_queueLock);
-    while (m_poolSize < min && limit-- && isRunning) {
-      TcrConnection* conn = nullptr;
-      bool maxConnLimit = false;
-      createPoolConnection(conn, excludeServers, maxConnLimit);
-      if (conn) {
-        put(conn, false);
-        restored++;
-        getStats().incMinPoolSizeConnects();
-      }
+  while (isRunning && attempts-- > 0 && reservePoolConnection(min)) {
+    TcrConnection* conn = nullptr;
+    connectPoolConnection(conn, excludeServers, nullptr);
+    if (conn) {
+      put(conn, false);
+      restored++;
+      getStats().incMinPoolSizeConnects();
     }
   }
 
-  LOGDEBUG("Restored %d connections", restored);
-  LOGDEBUG("Pool size is %d, pool counter is %d", size(), m_poolSize.load());
+  return restored;
+}
+
+void ThinClientPoolDM::prewarm() {
+  if (m_isDestroyed) {
+    throw IllegalStateException("Pool has been destroyed");
+  }
+
+  volatile bool isRunning = true;
+  int restored = warmUpPool(isRunning);
+  LOGFINE("Prewarmed pool %s with %d connections", m_poolName.c_str(),
+          restored);
+
+  // connections other threads are still establishing count once they are up
+  int min = m_attrs->getMinConnections();
+  auto deadline = std::chrono::steady_clock::now() +
+                  m_connManager.getCacheImpl()
+                      ->getDistributedSystem()
+                      .getSystemProperties()
+                      .connectTimeout();
+  while (m_poolSize.established() < min && m_poolSize.reserved() > 0 &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  if (m_poolSize.established() < min) {
+    throw NotConnectedException(
+        "Pool " + m_poolName + " could open only " +
+        std::to_string(m_poolSize.established()) + " of " +
+        std::to_string(min) + " minimum connections");
+  }
 }
 
 int ThinClientPoolDM::manageConnectionsInternal(volatile bool& isRunning) {
@@ -537,7 +611,7 @@ int ThinClientPoolDM::manageConnectionsInternal(volatile bool& isRunning) {
 
     restoreMinConnections(isRunning);
 
-    getStats().setCurPoolConnections(m_poolSize);
+    getStats().setCurPoolConnections(m_poolSize.established());
   } catch (const Exception& e) {
     LOGERROR(e.what());
   } catch (const std::exception& e) {
@@ -610,7 +684,7 @@ void ThinClientPoolDM::addConnection(TcrConnection* conn) {
   ACE_Guard<ACE_Recursive_Thread_Mutex> _guard(getPoolLock());
 
   put(conn, false);
-  ++m_poolSize;
+  m_poolSize.add();
 }
 GfErrType ThinClientPoolDM::sendRequestToAllServers(
     const char* func, uint8_t getResult, std::chrono::milliseconds timeout,
@@ -752,41 +826,36 @@ const std::shared_ptr<CacheableStringArray> ThinClientPoolDM::getServers() {
   return CacheableStringArray::createNoCopy(ptrArr, size);
 }
 
+// The tasks are stopped rather than released, since a timer handler that
+// is already running may still signal them.
 void ThinClientPoolDM::stopPingThread() {
   if (m_pingTask) {
-    LOGFINE("ThinClientPoolDM::destroy(): Closing ping thread.");
-    m_pingTask->stopNoblock();
-    m_pingSema.release();
-    m_pingTask->wait();
-    GF_SAFE_DELETE(m_pingTask);
+    LOGFINE("ThinClientPoolDM::destroy(): Closing ping task.");
     if (m_pingTaskId >= 0) {
       m_connManager.getCacheImpl()->getExpiryTaskManager().cancelTask(
           m_pingTaskId);
+      m_pingTaskId = -1;
     }
+    m_pingTask->stop();
   }
 }
 
 void ThinClientPoolDM::stopUpdateLocatorListThread() {
   if (m_updateLocatorListTask) {
-    LOGFINE("ThinClientPoolDM::destroy(): Closing updateLocatorList thread.");
-    m_updateLocatorListTask->stopNoblock();
-    m_updateLocatorListSema.release();
-    m_updateLocatorListTask->wait();
-    GF_SAFE_DELETE(m_updateLocatorListTask);
+    LOGFINE("ThinClientPoolDM::destroy(): Closing updateLocatorList task.");
     if (m_updateLocatorListTaskId >= 0) {
       m_connManager.getCacheImpl()->getExpiryTaskManager().cancelTask(
           m_updateLocatorListTaskId);
+      m_updateLocatorListTaskId = -1;
     }
+    m_updateLocatorListTask->stop();
   }
 }
 
 void ThinClientPoolDM::stopCliCallbackThread() {
   if (m_cliCallbackTask) {
-    LOGFINE("ThinClientPoolDM::destroy(): Closing cliCallback thread.");
-    m_cliCallbackTask->stopNoblock();
-    m_cliCallbackSema.release();
-    m_cliCallbackTask->wait();
-    GF_SAFE_DELETE(m_cliCallbackTask);
+    LOGFINE("ThinClientPoolDM::destroy(): Closing cliCallback task.");
+    m_cliCallbackTask->stop();
   }
 }
 
@@ -809,14 +878,12 @@ void ThinClientPoolDM::destroy(bool keepAlive) {
     stopCliCallbackThread();
     LOGDEBUG("ThinClientPoolDM::destroy( ): Closing connection manager.");
     if (m_connManageTask) {
-      m_connManageTask->stopNoblock();
-      m_connSema.release();
-      m_connManageTask->wait();
-      GF_SAFE_DELETE(m_connManageTask);
       if (m_connManageTaskId >= 0) {
         m_connManager.getCacheImpl()->getExpiryTaskManager().cancelTask(
             m_connManageTaskId);
+        m_connManageTaskId = -1;
       }
+      m_connManageTask->stop();
     }
 
     LOGDEBUG("Closing PoolStatsSampler thread.");
@@ -828,7 +895,7 @@ void ThinClientPoolDM::destroy(bool keepAlive) {
     }
     // closing all the thread local connections ( sticky).
     LOGDEBUG("ThinClientPoolDM::destroy( ): closing FairQueue, pool size = %d",
-             m_poolSize.load());
+             m_poolSize.established());
     close();
     LOGDEBUG("ThinClientPoolDM::destroy( ): after close ");
 
@@ -862,8 +929,8 @@ void ThinClientPoolDM::destroy(bool keepAlive) {
     LOGDEBUG("ThinClientPoolDM::destroy( ): after close m_isDestroyed = %d ",
              m_isDestroyed);
   }
-  if (m_poolSize != 0) {
-    LOGFINE("Pool connection size is not zero %d", m_poolSize.load());
+  if (m_poolSize.established() != 0) {
+    LOGFINE("Pool connection size is not zero %d", m_poolSize.established());
   }
 }
 
@@ -1641,7 +1708,7 @@ void ThinClientPoolDM::removeEPConnections(int numConn,
 
   // Raise Semaphore for manage thread
   if (triggerManageConn) {
-    m_connSema.release();
+    m_connManageTask->signal();
   }
 }
 
@@ -1728,10 +1795,8 @@ GfErrType ThinClientPoolDM::getConnectionToAnEndPoint(std::string epNameStr,
 GfErrType ThinClientPoolDM::createPoolConnectionToAEndPoint(
     TcrConnection*& conn, TcrEndpoint* theEP, bool& maxConnLimit,
     bool appThreadrequest) {
-  ACE_Guard<ACE_Recursive_Thread_Mutex> _guard(m_queueLock);
   GfErrType error = GF_NOERR;
   conn = nullptr;
-  int min = 0;
   {
     // Check if the pool size has exceeded maximum allowed.
 
@@ -1739,15 +1804,15 @@ GfErrType ThinClientPoolDM::createPoolConnectionToAEndPoint(
     if (max == -1) {
       max = 0x7fffffff;
     }
-    min = m_attrs->getMinConnections();
+    int min = m_attrs->getMinConnections();
     max = max > min ? max : min;
 
-    if (m_poolSize >= max) {
+    if (!reservePoolConnection(max)) {
       maxConnLimit = true;
       LOGFINER(
           "ThinClientPoolDM::createPoolConnectionToAEndPoint( ): current pool "
           "size has reached limit %d, %d",
-          m_poolSize.load(), max);
+          m_poolSize.established(), max);
       return error;
     }
   }
@@ -1757,42 +1822,39 @@ GfErrType ThinClientPoolDM::createPoolConnectionToAEndPoint(
       "connection to the endpoint %s",
       theEP->name().c_str());
   // if the pool size is within limits, create a new connection.
-  error = theEP->createNewConnection(conn, false, false,
-                                     m_connManager.getCacheImpl()
-                                         ->getDistributedSystem()
-                                         .getSystemProperties()
-                                         .connectTimeout(),
-                                     false, true, appThreadrequest);
+  try {
+    error = theEP->createNewConnection(conn, false, false,
+                                       m_connManager.getCacheImpl()
+                                           ->getDistributedSystem()
+                                           .getSystemProperties()
+                                           .connectTimeout(),
+                                       false, true, appThreadrequest);
+  } catch (...) {
+    cancelPoolConnection();
+    throw;
+  }
   if (conn == nullptr || error != GF_NOERR) {
     LOGFINE("2Failed to connect to %s", theEP->name().c_str());
     if (conn != nullptr) GF_SAFE_DELETE(conn);
+    cancelPoolConnection();
   } else {
-    theEP->setConnected();
-    ++m_poolSize;
-    if (m_poolSize > min) {
-      getStats().incLoadCondConnects();
-    }
-    // Update Stats
-    getStats().incPoolConnects();
-    getStats().setCurPoolConnections(m_poolSize);
+    commitPoolConnection(theEP);
   }
-  m_connSema.release();
+  m_connManageTask->signal();
 
   return error;
 }
 
 void ThinClientPoolDM::reducePoolSize(int num) {
-  LOGFINE("removing connection %d ,  pool-size =%d", num, m_poolSize.load());
-  m_poolSize -= num;
-  if (m_poolSize <= 0) {
-    if (m_cliCallbackTask != NULL) m_cliCallbackSema.release();
+  LOGFINE("removing connection %d ,  pool-size =%d", num,
+          m_poolSize.established());
+  if (m_poolSize.remove(num) <= 0) {
+    if (m_cliCallbackTask != nullptr) m_cliCallbackTask->signal();
   }
 }
 GfErrType ThinClientPoolDM::createPoolConnection(
     TcrConnection*& conn, std::set<ServerLocation>& excludeServers,
     bool& maxConnLimit, const TcrConnection* currentserver) {
-  ACE_Guard<ACE_Recursive_Thread_Mutex> _guard(m_queueLock);
-  GfErrType error = GF_NOERR;
   int max = m_attrs->getMaxConnections();
   if (max == -1) {
     max = 0x7fffffff;
@@ -1802,20 +1864,42 @@ GfErrType ThinClientPoolDM::createPoolConnection(
   LOGDEBUG(
       "ThinClientPoolDM::createPoolConnection( ): current pool size has "
       "reached limit %d, %d, %d",
-      m_poolSize.load(), max, min);
+      m_poolSize.established(), max, min);
 
   conn = nullptr;
-  {
-    if (m_poolSize >= max) {
-      LOGDEBUG(
-          "ThinClientPoolDM::createPoolConnection( ): current pool size has "
-          "reached limit %d, %d",
-          m_poolSize.load(), max);
-      maxConnLimit = true;
-      return error;
-    }
+  if (!reservePoolConnection(max)) {
+    LOGDEBUG(
+        "ThinClientPoolDM::createPoolConnection( ): current pool size has "
+        "reached limit %d, %d",
+        m_poolSize.established(), max);
+    maxConnLimit = true;
+    return GF_NOERR;
   }
 
+  return connectPoolConnection(conn, excludeServers, currentserver);
+}
+
+bool ThinClientPoolDM::reservePoolConnection(int32_t limit) {
+  return m_poolSize.reserve(limit);
+}
+
+void ThinClientPoolDM::commitPoolConnection(TcrEndpoint* ep) {
+  ep->setConnected();
+  m_poolSize.commit();
+  if (m_poolSize.established() > m_attrs->getMinConnections()) {
+    getStats().incLoadCondConnects();
+  }
+  // Update Stats
+  getStats().incPoolConnects();
+  getStats().setCurPoolConnections(m_poolSize.established());
+}
+
+void ThinClientPoolDM::cancelPoolConnection() { m_poolSize.cancel(); }
+
+GfErrType ThinClientPoolDM::connectPoolConnection(
+    TcrConnection*& conn, std::set<ServerLocation>& excludeServers,
+    const TcrConnection* currentserver) {
+  GfErrType error = GF_NOERR;
   bool fatal = false;
   GfErrType fatalError = GF_NOERR;
 
@@ -1825,9 +1909,11 @@ GfErrType ThinClientPoolDM::createPoolConnection(
       epNameStr = selectEndpoint(excludeServers, currentserver);
     } catch (const NoAvailableLocatorsException&) {
       LOGFINE("Locator query failed");
+      cancelPoolConnection();
       return GF_CACHE_LOCATOR_EXCEPTION;
     } catch (const Exception&) {
       LOGFINE("Endpoint selection failed");
+      cancelPoolConnection();
       return GF_NOTCON;
     }
     LOGFINE("Connecting to %s", epNameStr.c_str());
@@ -1839,14 +1925,21 @@ GfErrType ThinClientPoolDM::createPoolConnection(
       LOGDEBUG("Updating existing connection: ", epNameStr.c_str());
       conn = const_cast<TcrConnection*>(currentserver);
       conn->updateCreationTime();
+      // the existing connection is already counted
+      cancelPoolConnection();
       break;
     } else {
-      error = ep->createNewConnection(conn, false, false,
-                                      m_connManager.getCacheImpl()
-                                          ->getDistributedSystem()
-                                          .getSystemProperties()
-                                          .connectTimeout(),
-                                      false);
+      try {
+        error = ep->createNewConnection(conn, false, false,
+                                        m_connManager.getCacheImpl()
+                                            ->getDistributedSystem()
+                                            .getSystemProperties()
+                                            .connectTimeout(),
+                                        false);
+      } catch (...) {
+        cancelPoolConnection();
+        throw;
+      }
     }
 
     if (conn == nullptr || error != GF_NOERR) {
@@ -1864,20 +1957,15 @@ GfErrType ThinClientPoolDM::createPoolConnection(
       if (ThinClientBaseDM::isFatalClientError(error)) {
         //  log the error string instead of error number.
         LOGFINE("Connection failed due to fatal client error %d", error);
+        cancelPoolConnection();
         return error;
       }
     } else {
-      ep->setConnected();
-      if (++m_poolSize > min) {
-        getStats().incLoadCondConnects();
-      }
-      // Update Stats
-      getStats().incPoolConnects();
-      getStats().setCurPoolConnections(m_poolSize);
+      commitPoolConnection(ep);
       break;
     }
   }
-  m_connSema.release();
+  m_connManageTask->signal();
   // if a fatal error occurred earlier and we don't have
   // a connection then return this saved error
   if (fatal && !conn && error != GF_NOERR) {
@@ -1906,6 +1994,7 @@ TcrConnection* ThinClientPoolDM::getConnectionFromQueue(
   if (enableTimeStatistics) {
     Utils::updateStatOpTime(getStats().getStats(),
                             getStats().getTotalWaitingConnTimeId(),
+                            getStats().getConnectionWaitLatencyId(),
                             sampleStartNanos);
   }
   return mp;
@@ -2122,65 +2211,44 @@ void ThinClientPoolDM::pingServerLocal() {
 }
 
 int ThinClientPoolDM::updateLocatorList(volatile bool& isRunning) {
-  LOGFINE("Starting updateLocatorList thread for pool %s", m_poolName.c_str());
-  while (isRunning) {
-    m_updateLocatorListSema.acquire();
-    if (isRunning && !m_connManager.isNetDown()) {
-      ((ThinClientLocatorHelper*)m_locHelper)
-          ->updateLocators(this->getServerGroup());
-    }
+  if (isRunning && !m_connManager.isNetDown()) {
+    ((ThinClientLocatorHelper*)m_locHelper)
+        ->updateLocators(this->getServerGroup());
   }
-  LOGFINE("Ending updateLocatorList thread for pool %s", m_poolName.c_str());
   return 0;
 }
 
 int ThinClientPoolDM::pingServer(volatile bool& isRunning) {
-  LOGFINE("Starting ping thread for pool %s", m_poolName.c_str());
-  while (isRunning) {
-    m_pingSema.acquire();
-    if (isRunning && !m_connManager.isNetDown()) {
-      pingServerLocal();
-      while (m_pingSema.tryacquire() != -1) {
-        ;
-      }
-    }
+  if (isRunning && !m_connManager.isNetDown()) {
+    pingServerLocal();
   }
-  LOGFINE("Ending ping thread for pool %s", m_poolName.c_str());
   return 0;
 }
 
 int ThinClientPoolDM::cliCallback(volatile bool& isRunning) {
-  LOGFINE("Starting cliCallback thread for pool %s", m_poolName.c_str());
-  while (isRunning) {
-    m_cliCallbackSema.acquire();
-    if (isRunning) {
-      LOGFINE("Clearing Pdx Type Registry");
-      // this call for csharp client
-      DistributedSystemImpl::CallCliCallBack(
-          *(m_connManager.getCacheImpl()->getCache()));
-      // this call for cpp client
-      m_connManager.getCacheImpl()->getPdxTypeRegistry()->clear();
-      while (m_cliCallbackSema.tryacquire() != -1) {
-        ;
-      }
-    }
+  if (isRunning) {
+    LOGFINE("Clearing Pdx Type Registry");
+    // this call for csharp client
+    DistributedSystemImpl::CallCliCallBack(
+        *(m_connManager.getCacheImpl()->getCache()));
+    // this call for cpp client
+    m_connManager.getCacheImpl()->getPdxTypeRegistry()->clear();
   }
-  LOGFINE("Ending cliCallback thread for pool %s", m_poolName.c_str());
   return 0;
 }
 
 int ThinClientPoolDM::doPing(const ACE_Time_Value&, const void*) {
-  m_pingSema.release();
+  m_pingTask->signal();
   return 0;
 }
 
 int ThinClientPoolDM::doUpdateLocatorList(const ACE_Time_Value&, const void*) {
-  m_updateLocatorListSema.release();
+  m_updateLocatorListTask->signal();
   return 0;
 }
 
 int ThinClientPoolDM::doManageConnections(const ACE_Time_Value&, const void*) {
-  m_connSema.release();
+  m_connManageTask->signal();
   return 0;
 }
 
@@ -2211,7 +2279,8 @@ bool ThinClientPoolDM::canItBeDeleted(TcrConnection* conn) {
   bool hasExpired = conn->hasExpired(load);
   bool isIdle = conn->isIdle(idle);
 
-  bool candidateForDeletion = hasExpired || (isIdle && m_poolSize > min);
+  bool candidateForDeletion =
+      hasExpired || (isIdle && m_poolSize.established() > min);
   bool canBeDeleted = false;
 
   if (conn && candidateForDeletion) {
@@ -26,11 +26,13 @@
 #include "PoolAttributes.hpp"
 #include "ThinClientLocatorHelper.hpp"
 #include "RemoteQueryService.hpp"
+#include <atomic>
 #include <memory>
 #include <set>
 #include <vector>
 #include "Task.hpp"
 #include <ace/Semaphore.h>
+#include "BackgroundExecutor.hpp"
 #include "PoolStatistics.hpp"
 #include "FairQueue.hpp"
 #include "TcrPoolEndPoint.hpp"
@@ -39,6 +41,7 @@
 #include "ExecutionImpl.hpp"
 #include "ClientMetadataService.hpp"
 #include "ThreadPool.hpp"
+#include "PoolConnectionCounter.hpp"
 #include "ThinClientStickyManager.hpp"
 #include "TXState.hpp"
 
@@ -98,6 +101,7 @@ class ThinClientPoolDM
   virtual const std::shared_ptr<CacheableStringArray> getServers();
   virtual void destroy(bool keepalive = false);
   virtual bool isDestroyed() const;
+  virtual void prewarm();
   virtual std::shared_ptr<QueryService> getQueryService();
   virtual std::shared_ptr<QueryService> getQueryServiceWithoutCheck();
   virtual bool isEndpointAttached(TcrEndpoint* ep);
@@ -139,6 +143,9 @@ class ThinClientPoolDM
                                  std::set<ServerLocation>& excludeServers,
                                  bool& maxConnLimit,
                                  const TcrConnection* currentServer = nullptr);
+  // Creates connections until the pool holds min connections, as one of
+  // several concurrent warm-up workers sharing the attempts budget.
+  int warmUpConnections(volatile bool& isRunning, std::atomic<int>& attempts);
   ThinClientLocatorHelper* getLocatorHelper() volatile {
     return (ThinClientLocatorHelper*)m_locHelper;
   }
@@ -203,12 +210,12 @@ class ThinClientPoolDM
   std::string m_poolName;
   volatile PoolStats* m_stats;
   bool m_sticky;
+
+  virtual PoolStats* getChunkStats() { return (PoolStats*)m_stats; }
+
   // PoolStats * m_stats;
   // PoolStatType* m_poolStatType;
   void netDown();
-  ACE_Semaphore m_updateLocatorListSema;
-  ACE_Semaphore m_pingSema;
-  ACE_Semaphore m_cliCallbackSema;
   volatile bool m_isDestroyed;
   volatile bool m_destroyPending;
   volatile bool m_destroyPendingHADM;
@@ -400,18 +407,17 @@ class ThinClientPoolDM
 
   volatile ThinClientLocatorHelper* m_locHelper;
 
-  std::atomic<int32_t> m_poolSize;  // Actual Size of Pool
+  PoolConnectionCounter m_poolSize;  // Actual Size of Pool
   int m_numRegions;
 
   // for selectEndpoint
   unsigned m_server;
 
-  // Manage Connection thread
-  ACE_Semaphore m_connSema;
-  Task<ThinClientPoolDM>* m_connManageTask;
-  Task<ThinClientPoolDM>* m_pingTask;
-  Task<ThinClientPoolDM>* m_updateLocatorListTask;
-  Task<ThinClientPoolDM>* m_cliCallbackTask;
+  // background work, run on the threads of the cache's BackgroundExecutor
+  std::shared_ptr<BackgroundTask> m_connManageTask;
+  std::shared_ptr<BackgroundTask> m_pingTask;
+  std::shared_ptr<BackgroundTask> m_updateLocatorListTask;
+  std::shared_ptr<BackgroundTask> m_cliCallbackTask;
   long m_pingTaskId;
   long m_updateLocatorListTaskId;
   long m_connManageTaskId;
@@ -422,6 +428,20 @@ class ThinClientPoolDM
   int manageConnectionsInternal(volatile bool& isRunning);
   void cleanStaleConnections(volatile bool& isRunning);
   void restoreMinConnections(volatile bool& isRunning);
+  // Brings the pool up to min connections using up to the warm-up concurrency
+  // workers, returning the number of connections created.
+  int warmUpPool(volatile bool& isRunning);
+  // Connections are established without holding the pool lock. A creator
+  // first reserves its place in m_poolSize, which keeps concurrent creators
+  // within the limit, and then either commits or cancels the reservation;
+  // only committed connections count as the size of the pool.
+  bool reservePoolConnection(int32_t limit);
+  void commitPoolConnection(TcrEndpoint* ep);
+  void cancelPoolConnection();
+  // Connects to the first endpoint that accepts, given a reservation.
+  GfErrType connectPoolConnection(TcrConnection*& conn,
+                                  std::set<ServerLocation>& excludeServers,
+                                  const TcrConnection* currentServer);
   std::atomic<int32_t> m_clientOps;  // Actual Size of Pool
   statistics::PoolStatsSampler* m_PoolStatsSampler;
   ClientMetadataService* m_clientMetadataService;
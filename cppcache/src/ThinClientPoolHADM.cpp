@@ -146,7 +146,7 @@ int ThinClientPoolHADM::redundancy(volatile bool& isRunning) {
   while (isRunning) {
     m_redundancySema.acquire();
     if (isRunning && !m_connManager.isNetDown()) {
-      m_redundancyManager->maintainRedundancyLevel();
+      m_redundancyManager->maintainRedundancyLevelInBackground();
       while (m_redundancySema.tryacquire() != -1) {
         ;
       }
@@ -200,19 +200,20 @@ void ThinClientPoolHADM::sendNotificationCloseMsgs() {
 
 GfErrType ThinClientPoolHADM::registerInterestAllRegions(
     TcrEndpoint* ep, const TcrMessage* request, TcrMessageReply* reply) {
-  GfErrType err = GF_NOERR;
-  GfErrType opErr = GF_NOERR;
-
   ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_regionsLock);
-  for (std::list<ThinClientRegion*>::iterator itr = m_regions.begin();
-       itr != m_regions.end(); itr++) {
-    if ((opErr = (*itr)->registerKeys(ep, request, reply)) != GF_NOERR) {
-      if (err == GF_NOERR) {
-        err = opErr;
-      }
-    }
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks;
+  tasks.reserve(m_regions.size());
+  for (const auto region : m_regions) {
+    tasks.push_back([region, ep, request, reply]() {
+      return region->registerKeys(ep, request, reply);
+    });
   }
-  return err;
+  return m_redundancyManager->runRecoveryTasks(tasks);
+}
+
+GfErrType ThinClientPoolHADM::runRecoveryTasks(
+    const std::vector<ThinClientRedundancyManager::RecoveryTask>& tasks) {
+  return m_redundancyManager->runRecoveryTasks(tasks);
 }
 
 void ThinClientPoolHADM::addRegion(ThinClientRegion* theTCR) {
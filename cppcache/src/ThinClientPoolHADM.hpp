@@ -53,6 +53,9 @@ class ThinClientPoolHADM : public ThinClientPoolDM {
                                        const TcrMessage* request,
                                        TcrMessageReply* reply);
 
+  GfErrType runRecoveryTasks(
+      const std::vector<ThinClientRedundancyManager::RecoveryTask>& tasks);
+
   virtual void destroy(bool keepAlive = false);
 
   void readyForEvents();
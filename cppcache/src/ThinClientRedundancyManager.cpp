@@ -37,9 +37,21 @@
 #include "ProxyCache.hpp"
 #include <set>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
 using namespace apache::geode::client;
 
+namespace {
+// the redundancy manager whose redundant endpoints lock this thread holds on
+// behalf of the thread that started it to recover subscriptions
+thread_local ThinClientRedundancyManager* t_recoveringFor = nullptr;
+}  // namespace
+
 const char* ThinClientRedundancyManager::NC_PerodicACK = "NC PerodicACK";
 
 ThinClientRedundancyManager::ThinClientRedundancyManager(
@@ -47,6 +59,7 @@ ThinClientRedundancyManager::ThinClientRedundancyManager(
     ThinClientPoolHADM* poolHADM, bool sentReadyForEvents,
     bool globalProcessedMarker)
     : m_globalProcessedMarker(globalProcessedMarker),
+      m_recoveringInBackground(false),
       m_IsAllEpDisCon(false),
       m_server(0),
       m_sentReadyForEvents(sentReadyForEvents),
@@ -56,7 +69,6 @@ ThinClientRedundancyManager::ThinClientRedundancyManager(
       m_theTcrConnManager(theConnManager),
       m_locators(nullptr),
       m_servers(nullptr),
-      m_periodicAckTask(nullptr),
       m_processEventIdMapTaskId(-1),
       m_nextAckInc(0),
       m_HAenabled(false) {}
@@ -122,6 +134,11 @@ GfErrType ThinClientRedundancyManager::maintainRedundancyLevel(
   int secondaryCount = 0;
   bool isPrimaryConnected = false;
   bool isPrimaryAtBack = false;
+  // a failover restores a primary after the previous one was lost
+  bool isFailover = !init && (m_IsAllEpDisCon ||
+                              (!m_redundantEndpoints.empty() &&
+                               !m_redundantEndpoints[0]->connected()));
+  auto start = std::chrono::steady_clock::now();
   // TODO: isPrimaryAtBack can be removed by simplifying
   // removeEndpointsInOrder().
 
@@ -449,6 +466,18 @@ GfErrType ThinClientRedundancyManager::maintainRedundancyLevel(
   if (m_poolHADM) {
     m_poolHADM->getStats().setSubsServers(
         static_cast<int32_t>(m_redundantEndpoints.size()));
+    if (isFailover && isPrimaryConnected) {
+      auto elapsed = std::chrono::steady_clock::now() - start;
+      m_poolHADM->getStats().recordSubscriptionFailover(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+              .count());
+      LOGINFO("Subscriptions of pool %s failed over to server %s in %lld ms",
+              m_poolHADM->getName(), m_redundantEndpoints[0]->name().c_str(),
+              static_cast<long long>(
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                      elapsed)
+                      .count()));
+    }
   }
 
   if (isRedundancySatisfied) {
@@ -489,6 +518,103 @@ GfErrType ThinClientRedundancyManager::maintainRedundancyLevel(
   }
 }
 
+GfErrType ThinClientRedundancyManager::maintainRedundancyLevelInBackground() {
+  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_redundantEndpointsLock);
+  m_recoveringInBackground = true;
+  GfErrType err = GF_NOERR;
+  try {
+    err = maintainRedundancyLevel();
+  } catch (...) {
+    m_recoveringInBackground = false;
+    throw;
+  }
+  m_recoveringInBackground = false;
+  return err;
+}
+
+GfErrType ThinClientRedundancyManager::runRecoveryTasks(
+    const std::vector<RecoveryTask>& tasks) {
+  size_t threads = 1;
+  if (m_recoveringInBackground) {
+    threads = std::min(tasks.size(), getRecoveryConcurrency());
+  }
+
+  GfErrType err = GF_NOERR;
+  if (threads < 2) {
+    for (const auto& task : tasks) {
+      GfErrType opErr = task();
+      if (err == GF_NOERR) {
+        err = opErr;
+      }
+    }
+    return err;
+  }
+
+  // each thread claims the next task until all have been claimed
+  std::atomic<size_t> nextTask(0);
+  std::mutex mutex;
+  std::exception_ptr failure;
+  auto run = [&]() {
+    try {
+      for (size_t i = nextTask++; i < tasks.size(); i = nextTask++) {
+        GfErrType opErr = tasks[i]();
+        if (opErr != GF_NOERR) {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (err == GF_NOERR) {
+            err = opErr;
+          }
+        }
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!failure) {
+        failure = std::current_exception();
+      }
+      nextTask = tasks.size();
+    }
+  };
+
+  std::vector<std::thread> helpers;
+  for (size_t i = 1; i < threads; i++) {
+    try {
+      helpers.emplace_back([this, &run]() {
+        t_recoveringFor = this;
+        run();
+      });
+    } catch (const std::system_error&) {
+      // the threads already started share the work
+      break;
+    }
+  }
+  run();
+  for (auto& helper : helpers) {
+    helper.join();
+  }
+  if (failure) {
+    std::rethrow_exception(failure);
+  }
+  return err;
+}
+
+size_t ThinClientRedundancyManager::getRecoveryConcurrency() const {
+  if (m_poolHADM == nullptr) {
+    return 1;
+  }
+  return static_cast<size_t>(m_poolHADM->getSubscriptionRecoveryConcurrency());
+}
+
+void ThinClientRedundancyManager::acquireRedundancyLock() {
+  if (t_recoveringFor != this) {
+    m_redundantEndpointsLock.acquire_read();
+  }
+}
+
+void ThinClientRedundancyManager::releaseRedundancyLock() {
+  if (t_recoveringFor != this) {
+    m_redundantEndpointsLock.release();
+  }
+}
+
 void ThinClientRedundancyManager::removeEndpointsInOrder(
     std::vector<TcrEndpoint*>& destVector,
     const std::vector<TcrEndpoint*>& srcVector) {
@@ -717,11 +843,9 @@ void ThinClientRedundancyManager::close() {
     if (m_processEventIdMapTaskId >= 0) {
       m_theTcrConnManager->getCacheImpl()->getExpiryTaskManager().cancelTask(
           m_processEventIdMapTaskId);
+      m_processEventIdMapTaskId = -1;
     }
-    m_periodicAckTask->stopNoblock();
-    m_periodicAckSema.release();
-    m_periodicAckTask->wait();
-    GF_SAFE_DELETE(m_periodicAckTask);
+    m_periodicAckTask->stop();
   }
 
   ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_redundantEndpointsLock);
@@ -1153,19 +1277,13 @@ void ThinClientRedundancyManager::readyForEvents() {
 
 int ThinClientRedundancyManager::processEventIdMap(const ACE_Time_Value&,
                                                    const void*) {
-  m_periodicAckSema.release();
+  m_periodicAckTask->signal();
   return 0;
 }
 
 int ThinClientRedundancyManager::periodicAck(volatile bool& isRunning) {
-  while (isRunning) {
-    m_periodicAckSema.acquire();
-    if (isRunning) {
-      doPeriodicAck();
-      while (m_periodicAckSema.tryacquire() != -1) {
-        ;
-      }
-    }
+  if (isRunning) {
+    doPeriodicAck();
   }
   return 0;
 }
@@ -1239,8 +1357,10 @@ void ThinClientRedundancyManager::doPeriodicAck() {
 }
 
 void ThinClientRedundancyManager::startPeriodicAck() {
-  m_periodicAckTask = new Task<ThinClientRedundancyManager>(
-      this, &ThinClientRedundancyManager::periodicAck, NC_PerodicACK);
+  m_periodicAckTask =
+      m_theTcrConnManager->getCacheImpl()->getBackgroundExecutor().createTask(
+          [this](volatile bool& isRunning) { periodicAck(isRunning); },
+          NC_PerodicACK);
   m_periodicAckTask->start();
   const auto& props = m_theTcrConnManager->getCacheImpl()
                           ->getDistributedSystem()
@@ -20,14 +20,17 @@
 #ifndef GEODE_THINCLIENTREDUNDANCYMANAGER_H_
 #define GEODE_THINCLIENTREDUNDANCYMANAGER_H_
 
+#include <functional>
 #include <set>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "TcrMessage.hpp"
 #include "TcrEndpoint.hpp"
 #include "ServerLocation.hpp"
 #include "EventIdMap.hpp"
+#include "BackgroundExecutor.hpp"
 
 namespace apache {
 namespace geode {
@@ -40,12 +43,28 @@ class ThinClientPoolHADM;
 
 class ThinClientRedundancyManager {
  public:
+  /** Recovers part of the subscriptions of the pool on a server. */
+  typedef std::function<GfErrType()> RecoveryTask;
+
   bool m_globalProcessedMarker;
 
   GfErrType maintainRedundancyLevel(bool init = false,
                                     const TcrMessage* request = nullptr,
                                     TcrMessageReply* reply = nullptr,
                                     ThinClientRegion* region = nullptr);
+  /**
+   * Maintains the redundancy level on behalf of the pool's redundancy thread.
+   * That thread holds no region or CQ lock, so the subscriptions of a new
+   * server are recovered on up to subscription-recovery-concurrency threads.
+   */
+  GfErrType maintainRedundancyLevelInBackground();
+  /**
+   * Runs the tasks and returns the first error any of them reported. While
+   * maintainRedundancyLevelInBackground() recovers a server, they are shared
+   * between this thread and helper threads, which act under the redundancy
+   * lock this thread holds.
+   */
+  GfErrType runRecoveryTasks(const std::vector<RecoveryTask>& tasks);
   void initialize(int redundancyLevel);
   void close();
   void sendNotificationCloseMsgs();
@@ -55,6 +74,7 @@ class ThinClientRedundancyManager {
                               ThinClientPoolHADM* poolHADM = nullptr,
                               bool sentReadyForEvents = false,
                               bool globalProcessedMarker = false);
+  virtual ~ThinClientRedundancyManager() {}
   GfErrType sendSyncRequestRegisterInterest(TcrMessage& request,
                                             TcrMessageReply& reply,
                                             bool attemptFailover,
@@ -68,8 +88,8 @@ class ThinClientRedundancyManager {
   void startPeriodicAck();
   bool checkDupAndAdd(std::shared_ptr<EventId> eventid);
   void netDown();
-  void acquireRedundancyLock() { m_redundantEndpointsLock.acquire_read(); }
-  void releaseRedundancyLock() { m_redundantEndpointsLock.release(); }
+  void acquireRedundancyLock();
+  void releaseRedundancyLock();
   volatile bool allEndPointDiscon() { return m_IsAllEpDisCon; }
   void removeCallbackConnection(TcrEndpoint*);
 
@@ -80,6 +100,12 @@ class ThinClientRedundancyManager {
   GfErrType sendRequestToPrimary(TcrMessage& request, TcrMessageReply& reply);
   bool isSentReadyForEvents() const { return m_sentReadyForEvents; }
 
+ protected:
+  /** The number of threads recovery tasks may run on in the background. */
+  virtual size_t getRecoveryConcurrency() const;
+
+  bool m_recoveringInBackground;
+
  private:
   // for selectServers
   volatile bool m_IsAllEpDisCon;
@@ -121,8 +147,7 @@ class ThinClientRedundancyManager {
 
   inline bool isDurable();
   int processEventIdMap(const ACE_Time_Value&, const void*);
-  Task<ThinClientRedundancyManager>* m_periodicAckTask;
-  ACE_Semaphore m_periodicAckSema;
+  std::shared_ptr<BackgroundTask> m_periodicAckTask;
   long m_processEventIdMapTaskId;  // periodic check eventid map for notify ack
                                    // and/or expiry
   int periodicAck(volatile bool& isRunning);
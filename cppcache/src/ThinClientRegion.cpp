@@ -35,6 +35,7 @@
 #include "RegionGlobalLocks.hpp"
 #include "ReadWriteLock.hpp"
 #include "RemoteQuery.hpp"
+#include "QueryResultStreamImpl.hpp"
 #include "GeodeTypeIdsImpl.hpp"
 #include "AutoDelete.hpp"
 #include "UserAttributes.hpp"
@@ -2314,14 +2315,12 @@ GfErrType ThinClientRegion::registerKeysNoThrow(
   ACE_Recursive_Thread_Mutex responseLock;
   TcrChunkedResult* resultCollector = nullptr;
   if (interestPolicy.ordinal == InterestResultPolicy::KEYS_VALUES.ordinal) {
-    auto values = std::make_shared<HashMapOfCacheable>();
-    auto exceptions = std::make_shared<HashMapOfException>();
     MapOfUpdateCounters trackers;
     int32_t destroyTracker = 1;
     if (needToCreateRC) {
-      resultCollector = (new ChunkedGetAllResponse(
-          request, this, &keys, values, exceptions, nullptr, trackers,
-          destroyTracker, true, responseLock));
+      resultCollector = (new ChunkedInitialImageResponse(
+          request, this, &keys, nullptr, trackers, destroyTracker,
+          responseLock));
       reply->setChunkedResultHandler(resultCollector);
     }
   } else {
@@ -2490,8 +2489,6 @@ GfErrType ThinClientRegion::registerRegexNoThrow(
   ACE_Recursive_Thread_Mutex responseLock;
   if (reply == nullptr) {
     TcrMessageReply replyLocal(true, m_tcrdm);
-    auto values = std::make_shared<HashMapOfCacheable>();
-    auto exceptions = std::make_shared<HashMapOfException>();
 
     reply = &replyLocal;
     if (interestPolicy.ordinal == InterestResultPolicy::KEYS_VALUES.ordinal) {
@@ -2503,9 +2500,9 @@ GfErrType ThinClientRegion::registerRegexNoThrow(
                 new std::vector<std::shared_ptr<CacheableKey>>());
       }
       // need to check
-      getAllResultCollector = (new ChunkedGetAllResponse(
-          request, this, nullptr, values, exceptions, resultKeys, trackers,
-          destroyTracker, true, responseLock));
+      getAllResultCollector = (new ChunkedInitialImageResponse(
+          request, this, nullptr, resultKeys, trackers, destroyTracker,
+          responseLock));
       reply->setChunkedResultHandler(getAllResultCollector);
       isRCCreatedLocally = true;
     } else {
@@ -3364,8 +3361,7 @@ void ThinClientRegion::txPut(
   GfErrType err = putNoThrowTX(key, value, aCallbackArgument, oldValue, -1,
                                CacheEventFlags::NORMAL, versionTag);
 
-  updateStatOpTime(m_regionStats->getStat(), m_regionStats->getPutTimeId(),
-                   sampleStartNanos);
+  updatePutStatOpTime(sampleStartNanos);
   GfErrTypeToException("Region::putTX", err);
 }
 
@@ -3431,10 +3427,23 @@ void ChunkedKeySetResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
 }
 
 void ChunkedQueryResponse::reset() {
-  m_queryResults->clear();
+  if (m_stream != nullptr) {
+    m_stream->restart();
+  } else {
+    m_queryResults->clear();
+  }
   m_structFieldNames.clear();
 }
 
+void ChunkedQueryResponse::addResult(
+    const std::shared_ptr<Serializable>& value) {
+  if (m_stream != nullptr) {
+    m_stream->add(value);
+  } else {
+    m_queryResults->push_back(value);
+  }
+}
+
 void ChunkedQueryResponse::readObjectPartList(DataInput& input,
                                               bool isResultSet) {
   if (input.readBoolean()) {
@@ -3453,7 +3462,7 @@ void ChunkedQueryResponse::readObjectPartList(DataInput& input,
       if (isResultSet) {
         std::shared_ptr<Cacheable> value;
         input.readObject(value);
-        m_queryResults->push_back(value);
+        addResult(value);
       } else {
         auto arrayType = input.read();
         if (arrayType == GeodeTypeIdsImpl::FixedIDByte) {
@@ -3504,7 +3513,7 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     partLen = input->readInt32();
     input->read();
     auto intVal = input->readObject<CacheableInt32>(true);
-    m_queryResults->push_back(intVal);
+    addResult(intVal);
 
     // TODO:
     m_msg.readSecureObjectPart(*input, false, true, isLastChunkWithSecurity);
@@ -3546,6 +3555,9 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
         m_structFieldNames.push_back(sptr);
       }
     }
+    if (!skip && m_stream != nullptr) {
+      m_stream->setFieldNames(m_structFieldNames);
+    }
   }
 
   // skip the remaining part
@@ -3575,14 +3587,14 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
       std::shared_ptr<Serializable> value;
       if (isResultSet) {
         input->readObject(value);
-        m_queryResults->push_back(value);
+        addResult(value);
       } else {
         input->read();
         int32_t arraySize2 = input->readArrayLen();
         skipClass(*input);
         for (int32_t index = 0; index < arraySize2; ++index) {
           input->readObject(value);
-          m_queryResults->push_back(value);
+          addResult(value);
         }
       }
     }
@@ -3811,6 +3823,186 @@ void ChunkedGetAllResponse::add(const ChunkedGetAllResponse* other) {
   }
 }
 
+namespace {
+
+// loads a pending chunk of an initial image on a thread of the pool
+class InitialImageChunkWork : public ACE_Method_Request {
+ public:
+  explicit InitialImageChunkWork(
+      std::shared_ptr<ChunkedInitialImageResponse::PendingChunks> pending)
+      : m_pending(std::move(pending)) {}
+
+  virtual int call() {
+    ChunkedInitialImageResponse::loadNextChunk(m_pending);
+    // nothing waits for the work itself
+    delete this;
+    return 0;
+  }
+
+ private:
+  std::shared_ptr<ChunkedInitialImageResponse::PendingChunks> m_pending;
+};
+
+}  // namespace
+
+ChunkedInitialImageResponse::ChunkedInitialImageResponse(
+    TcrMessage& msg, ThinClientRegion* region,
+    const std::vector<std::shared_ptr<CacheableKey>>* keys,
+    const std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>>&
+        resultKeys,
+    MapOfUpdateCounters& trackerMap, int32_t destroyTracker,
+    ACE_Recursive_Thread_Mutex& responseLock)
+    : ChunkedGetAllResponse(msg, region, keys, nullptr, nullptr, resultKeys,
+                            trackerMap, destroyTracker, true, responseLock),
+      m_cache(nullptr),
+      m_pending(std::make_shared<PendingChunks>()) {
+  m_pending->loading = 0;
+  m_pending->response = this;
+  m_pending->appDomainContext.reset(createAppDomainContext());
+}
+
+ChunkedInitialImageResponse::~ChunkedInitialImageResponse() {
+  waitForChunks();
+}
+
+void ChunkedInitialImageResponse::handleChunk(const uint8_t* chunk,
+                                              int32_t chunkLen,
+                                              uint8_t isLastChunkWithSecurity,
+                                              const Cache* cache) {
+  m_cache = cache;
+  auto input = cache->createDataInput(chunk, chunkLen);
+  input->setPoolName(m_msg.getPoolName());
+  uint32_t partLen;
+  if (TcrMessageHelper::readChunkPartHeader(
+          m_msg, *input, GeodeTypeIdsImpl::FixedIDByte,
+          GeodeTypeIdsImpl::VersionedObjectPartList,
+          "ChunkedInitialImageResponse", partLen,
+          isLastChunkWithSecurity) != TcrMessageHelper::OBJECT) {
+    // encountered an exception part, so return without reading more
+    m_msg.readSecureObjectPart(*input, false, true, isLastChunkWithSecurity);
+    return;
+  }
+
+  // the part list follows the two bytes of its type; without keys of its
+  // own its values belong to the keys requested, so it is loaded in order
+  int32_t listLen = static_cast<int32_t>(partLen) - 2;
+  auto threadPool = m_region->getCacheImpl()->getThreadPool();
+  if (listLen <= 0 || listLen > input->getBytesRemaining() ||
+      (m_keys != nullptr &&
+       (input->currentBufferPosition()[0] & 0x01) == 0) ||
+      threadPool == nullptr) {
+    waitForChunks();
+    loadChunk(*input, &m_keysOffset);
+  } else {
+    const uint8_t* list = input->currentBufferPosition();
+    {
+      std::lock_guard<std::mutex> lock(m_pending->mutex);
+      m_pending->chunks.emplace_back(list, list + listLen);
+    }
+    input->advanceCursor(listLen);
+    threadPool->perform(new InitialImageChunkWork(m_pending));
+  }
+
+  m_msg.readSecureObjectPart(*input, false, true, isLastChunkWithSecurity);
+}
+
+void ChunkedInitialImageResponse::reset() {
+  waitForChunks();
+  ChunkedGetAllResponse::reset();
+}
+
+void ChunkedInitialImageResponse::finalize(bool inSameThread) {
+  waitForChunks();
+  ChunkedGetAllResponse::finalize(inSameThread);
+}
+
+bool ChunkedInitialImageResponse::loadNextChunk(
+    const std::shared_ptr<PendingChunks>& pending) {
+  std::vector<uint8_t> chunk;
+  {
+    std::lock_guard<std::mutex> lock(pending->mutex);
+    if (pending->chunks.empty()) {
+      return false;
+    }
+    chunk = std::move(pending->chunks.front());
+    pending->chunks.pop_front();
+    ++pending->loading;
+  }
+
+  // the response waits for the chunks it has handed out before it goes
+  auto response = pending->response;
+  auto load = [response, &chunk]() {
+    auto input = response->m_cache->createDataInput(
+        chunk.data(), static_cast<int32_t>(chunk.size()));
+    input->setPoolName(response->m_msg.getPoolName());
+    response->loadChunk(*input, nullptr);
+  };
+  std::shared_ptr<Exception> failure;
+  try {
+    if (pending->appDomainContext) {
+      pending->appDomainContext->run(load);
+    } else {
+      load();
+    }
+  } catch (Exception& ex) {
+    LOGERROR("Loading a chunk of the initial image failed: %s: %s",
+             ex.getName(), ex.what());
+    failure = std::make_shared<Exception>(ex);
+  } catch (std::exception& ex) {
+    LOGERROR("Loading a chunk of the initial image failed: %s", ex.what());
+    failure = std::make_shared<UnknownException>(
+        std::string("Loading a chunk of the initial image failed: ") +
+        ex.what());
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(pending->mutex);
+    --pending->loading;
+    if (failure != nullptr && pending->failure == nullptr) {
+      pending->failure = failure;
+    }
+  }
+  pending->loaded.notify_all();
+  return true;
+}
+
+void ChunkedInitialImageResponse::loadChunk(DataInput& input,
+                                            uint32_t* keysOffset) {
+  // each chunk gathers its keys on its own, so loading chunks at once only
+  // contends when the keys are handed back
+  ACE_Recursive_Thread_Mutex chunkLock;
+  std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> chunkKeys;
+  if (m_resultKeys != nullptr) {
+    chunkKeys = std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
+  }
+  VersionedCacheableObjectPartList objectList(
+      m_keys, keysOffset, nullptr, nullptr, chunkKeys, m_region, &m_trackerMap,
+      m_destroyTracker, true, m_dsmemId, chunkLock);
+  objectList.setBatchPut(true);
+  objectList.fromData(input);
+
+  if (chunkKeys != nullptr && !chunkKeys->empty()) {
+    ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_responseLock);
+    m_resultKeys->insert(m_resultKeys->end(), chunkKeys->begin(),
+                         chunkKeys->end());
+  }
+}
+
+void ChunkedInitialImageResponse::waitForChunks() {
+  // load what is still pending here rather than wait for pool threads that
+  // may all be busy
+  while (loadNextChunk(m_pending)) {
+  }
+  std::unique_lock<std::mutex> lock(m_pending->mutex);
+  m_pending->loaded.wait(lock, [this] { return m_pending->loading == 0; });
+  if (m_pending->failure != nullptr) {
+    if (!exceptionOccurred()) {
+      setException(m_pending->failure);
+    }
+    m_pending->failure = nullptr;
+  }
+}
+
 void ChunkedPutAllResponse::reset() {
   if (m_list != nullptr && m_list->size() > 0) {
     m_list->getVersionedTagptr().clear();
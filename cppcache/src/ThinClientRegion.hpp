@@ -20,11 +20,15 @@
 #ifndef GEODE_THINCLIENTREGION_H_
 #define GEODE_THINCLIENTREGION_H_
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <unordered_map>
 
 #include <ace/Task.h>
 
 #include <geode/ResultCollector.hpp>
+#include <geode/StreamingResultCollector.hpp>
 
 #include "LocalRegion.hpp"
 #include "TcrMessage.hpp"
@@ -44,6 +48,7 @@ namespace geode {
 namespace client {
 
 class ThinClientBaseDM;
+class QueryResultStreamImpl;
 
 /**
  * @class ThinClientRegion ThinClientRegion.hpp
@@ -426,8 +431,10 @@ class ChunkedQueryResponse : public TcrChunkedResult {
   TcrMessage& m_msg;
   std::shared_ptr<CacheableVector> m_queryResults;
   std::vector<std::shared_ptr<CacheableString>> m_structFieldNames;
+  QueryResultStreamImpl* m_stream;
 
   void skipClass(DataInput& input);
+  void addResult(const std::shared_ptr<Serializable>& value);
 
   // disabled
   ChunkedQueryResponse(const ChunkedQueryResponse&);
@@ -437,7 +444,16 @@ class ChunkedQueryResponse : public TcrChunkedResult {
   inline ChunkedQueryResponse(TcrMessage& msg)
       : TcrChunkedResult(),
         m_msg(msg),
-        m_queryResults(CacheableVector::create()) {}
+        m_queryResults(CacheableVector::create()),
+        m_stream(nullptr) {}
+
+  /**
+   * Hands the results to <code>stream</code> instead of collecting them. The
+   * chunks are then handled by the thread reading them so that a full stream
+   * holds off reading the rest of the response.
+   */
+  inline ChunkedQueryResponse(TcrMessage& msg, QueryResultStreamImpl* stream)
+      : TcrChunkedResult(), m_msg(msg), m_stream(stream) {}
 
   inline const std::shared_ptr<CacheableVector>& getQueryResults() const {
     return m_queryResults;
@@ -450,6 +466,7 @@ class ChunkedQueryResponse : public TcrChunkedResult {
   virtual void handleChunk(const uint8_t* chunk, int32_t chunkLen,
                            uint8_t isLastChunkWithSecurity, const Cache* cache);
   virtual void reset();
+  virtual bool handleInReaderThread() const { return m_stream != nullptr; }
 
   void readObjectPartList(DataInput& input, bool isResultSet);
 };
@@ -484,7 +501,11 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
         m_msg(msg),
         m_getResult(getResult),
         m_rc(rc),
-        m_resultCollectorLock(resultCollectorLock) {}
+        // a streaming collector is safe to add to concurrently
+        m_resultCollectorLock(
+            std::dynamic_pointer_cast<StreamingResultCollector>(rc)
+                ? nullptr
+                : resultCollectorLock) {}
 
   /* inline const std::shared_ptr<CacheableVector>&
    getFunctionExecutionResults() const
@@ -509,7 +530,7 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
  *
  */
 class ChunkedGetAllResponse : public TcrChunkedResult {
- private:
+ protected:
   TcrMessage& m_msg;
   ThinClientRegion* m_region;
   const std::vector<std::shared_ptr<CacheableKey>> * m_keys;
@@ -521,6 +542,8 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   bool m_addToLocalCache;
   uint32_t m_keysOffset;
   ACE_Recursive_Thread_Mutex& m_responseLock;
+
+ private:
   // disabled
   ChunkedGetAllResponse(const ChunkedGetAllResponse&);
   ChunkedGetAllResponse& operator=(const ChunkedGetAllResponse&);
@@ -561,6 +584,57 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   ACE_Recursive_Thread_Mutex& getResponseLock() { return m_responseLock; }
 };
 
+/**
+ * Handle each chunk of the initial image sent for a register interest with
+ * the KEYS_VALUES policy. The entries of a chunk are put into the region in
+ * one batch, a segment at a time, and chunks are deserialized and put on the
+ * threads of the cache's thread pool while the chunk processor thread goes
+ * on to the next chunk. Values are not collected.
+ */
+class ChunkedInitialImageResponse : public ChunkedGetAllResponse {
+ public:
+  ChunkedInitialImageResponse(
+      TcrMessage& msg, ThinClientRegion* region,
+      const std::vector<std::shared_ptr<CacheableKey>>* keys,
+      const std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>>&
+          resultKeys,
+      MapOfUpdateCounters& trackerMap, int32_t destroyTracker,
+      ACE_Recursive_Thread_Mutex& responseLock);
+
+  virtual ~ChunkedInitialImageResponse();
+
+  virtual void handleChunk(const uint8_t* chunk, int32_t chunkLen,
+                           uint8_t isLastChunkWithSecurity, const Cache* cache);
+  virtual void reset();
+  virtual void finalize(bool inSameThread);
+
+  // the chunks waiting to be loaded, shared with the pool threads that load
+  // them, which may only get to run once the response is gone
+  struct PendingChunks {
+    std::mutex mutex;
+    std::condition_variable loaded;
+    std::deque<std::vector<uint8_t>> chunks;
+    uint32_t loading;
+    std::shared_ptr<Exception> failure;
+    ChunkedInitialImageResponse* response;
+    std::unique_ptr<AppDomainContext> appDomainContext;
+  };
+
+  /** Loads a pending chunk, if any; returns false if there was none. */
+  static bool loadNextChunk(const std::shared_ptr<PendingChunks>& pending);
+
+ private:
+  void loadChunk(DataInput& input, uint32_t* keysOffset);
+  void waitForChunks();
+
+  const Cache* m_cache;
+  std::shared_ptr<PendingChunks> m_pending;
+
+  // disabled
+  ChunkedInitialImageResponse(const ChunkedInitialImageResponse&);
+  ChunkedInitialImageResponse& operator=(const ChunkedInitialImageResponse&);
+};
+
 /**
  * Handle each chunk of the chunked putAll response.
  */
@@ -43,6 +43,7 @@ VersionStamp& TrackedMapEntry::getVersionStamp() {
   throw FatalInternalException(
       "MapEntry::getVersionStamp for TrackedMapEntry is not applicable");
 }
-void TrackedMapEntry::cleanup(const CacheEventFlags eventFlags) {
-  m_entry->cleanup(eventFlags);
+void TrackedMapEntry::cleanup(const CacheEventFlags eventFlags,
+                              ExpiryTaskManager& expiryTaskManager) {
+  m_entry->cleanup(eventFlags, expiryTaskManager);
 }
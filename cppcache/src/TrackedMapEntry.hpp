@@ -70,7 +70,8 @@ class TrackedMapEntry : public MapEntry {
   virtual LRUEntryProperties& getLRUProperties();
   virtual ExpEntryProperties& getExpProperties();
   virtual VersionStamp& getVersionStamp();
-  virtual void cleanup(const CacheEventFlags eventFlags);
+  virtual void cleanup(const CacheEventFlags eventFlags,
+                       ExpiryTaskManager& expiryTaskManager);
 
  private:
   std::shared_ptr<MapEntryImpl> m_entry;
@@ -223,6 +223,15 @@ void Utils::updateStatOpTime(statistics::Statistics* m_regionStats, int32_t stat
   m_regionStats->incLong(statId, startStatOpTime() - start);
 }
 
+int64_t Utils::updateStatOpTime(statistics::Statistics* statistics,
+                                int32_t statId, int32_t histogramId,
+                                int64_t start) {
+  auto elapsed = startStatOpTime() - start;
+  statistics->incLong(statId, elapsed);
+  statistics->recordValue(histogramId, elapsed);
+  return elapsed;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
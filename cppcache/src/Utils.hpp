@@ -176,6 +176,12 @@ class CPPCACHE_EXPORT Utils {
   static void updateStatOpTime(statistics::Statistics* m_regionStats,
                                int32_t statId, int64_t start);
 
+  // Adds the time elapsed since start to the time statistic statId, records
+  // it in the latency histogram histogramId and returns it.
+  static int64_t updateStatOpTime(statistics::Statistics* statistics,
+                                  int32_t statId, int32_t histogramId,
+                                  int64_t start);
+
   static void parseEndpointNamesString(
       const char* endpoints, std::unordered_set<std::string>& endpointNames);
   static void parseEndpointString(const char* endpoints, std::string& host,
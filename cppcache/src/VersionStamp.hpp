@@ -47,7 +47,8 @@ class CPPCACHE_EXPORT VersionStamp {
         m_regionVersionHighBytes(rhs.m_regionVersionHighBytes),
         m_regionVersionLowBytes(rhs.m_regionVersionLowBytes) {}
 
-  virtual ~VersionStamp() {}
+  // not virtual, so that versioned entries do not pay for another vptr
+  ~VersionStamp() {}
   void setVersions(std::shared_ptr<VersionTag> versionTag);
   void setVersions(VersionStamp& versionStamp);
   int32_t getEntryVersion() const;
@@ -253,6 +253,10 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
     std::shared_ptr<CacheableKey> key;
     std::shared_ptr<VersionTag> versionTag;
     std::shared_ptr<Cacheable> value;
+    BatchPutEntries batch;
+    if (m_addToLocalCache && m_batchPut) {
+      batch.reserve(len);
+    }
 
     for (int32_t index = 0; index < len; ++index) {
       if (m_keys != nullptr && !m_hasKeys) {
@@ -269,7 +273,9 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
       value = iter == m_values->end() ? nullptr : iter->second;
       if (m_byteArray[index] != 3) {  // 3 - key not found on server
         std::shared_ptr<Cacheable> oldValue;
-        if (m_addToLocalCache) {
+        if (m_addToLocalCache && m_batchPut) {
+          batch.emplace_back(key, value, m_versionTags[index]);
+        } else if (m_addToLocalCache) {
           int updateCount = -1;
           versionTag = m_versionTags[index];
 
@@ -296,6 +302,15 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
         }
       }
     }
+    if (!batch.empty()) {
+      m_region->putLocalBatch("getAll", batch, m_destroyTracker);
+      for (const auto& entry : batch) {
+        if (entry.err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
+          // replace the value with higher version tag
+          (*m_values)[entry.key] = entry.oldValue;
+        }
+      }
+    }
   }
   if (m_keysOffset != nullptr) *m_keysOffset += len;
   if (valuesNULL) m_values = nullptr;
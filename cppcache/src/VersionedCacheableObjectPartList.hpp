@@ -55,6 +55,8 @@ class VersionedCacheableObjectPartList : public CacheableObjectPartList {
   uint16_t m_endpointMemId;
   std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>> > m_tempKeys;
   ACE_Recursive_Thread_Mutex& m_responseLock;
+  // whether the values are put into the region in one batch
+  bool m_batchPut = false;
 
   static const uint8_t FLAG_NULL_TAG;
   static const uint8_t FLAG_FULL_TAG;
@@ -158,6 +160,13 @@ class VersionedCacheableObjectPartList : public CacheableObjectPartList {
 
   inline uint16_t getEndpointMemId() { return m_endpointMemId; }
 
+  /**
+   * Have the values added to the local cache put into the region in one
+   * batch per part list, without update tracking, as for the initial image
+   * of a register interest.
+   */
+  inline void setBatchPut(bool batchPut) { m_batchPut = batchPut; }
+
   std::vector<std::shared_ptr<VersionTag>>& getVersionedTagptr() { return m_versionTags; }
 
   void setVersionedTagptr(std::vector<std::shared_ptr<VersionTag>>& versionTags) {
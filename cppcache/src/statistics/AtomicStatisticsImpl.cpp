@@ -94,6 +94,7 @@ AtomicStatisticsImpl::AtomicStatisticsImpl(StatisticsType* typeArg,
     int32_t intCount = statsType->getIntStatCount();
     int32_t longCount = statsType->getLongStatCount();
     int32_t doubleCount = statsType->getDoubleStatCount();
+    int32_t histogramCount = statsType->getHistogramStatCount();
 
     if (intCount > 0) {
       intStorage = new std::atomic<int32_t>[ intCount ];
@@ -121,6 +122,11 @@ AtomicStatisticsImpl::AtomicStatisticsImpl(StatisticsType* typeArg,
     } else {
       doubleStorage = nullptr;
     }
+    if (histogramCount > 0) {
+      histogramStorage = new Histogram[histogramCount];
+    } else {
+      histogramStorage = nullptr;
+    }
   } catch (...) {
     statsType = nullptr;  // Will be deleted by the class who calls this ctor
   }
@@ -141,6 +147,10 @@ AtomicStatisticsImpl::~AtomicStatisticsImpl() {
       delete[] doubleStorage;
       doubleStorage = nullptr;
     }
+    if (histogramStorage != nullptr) {
+      delete[] histogramStorage;
+      histogramStorage = nullptr;
+    }
   } catch (...) {
   }
 }
@@ -250,6 +260,8 @@ int64_t AtomicStatisticsImpl::_getRawBits(StatisticDescriptor* statDscp) {
       int64_t* temp = reinterpret_cast<int64_t*>(&value);
       return *temp;
     }
+    case HISTOGRAM_TYPE:
+      return getHistogram(stat->getId())->getCount();
     default:
       return 0;
       /*throw RuntimeException("unexpected stat descriptor type code: " +
@@ -521,6 +533,50 @@ double AtomicStatisticsImpl::incDouble(int32_t id, double delta) {
   }
 }
 
+////////////////////////  record() Methods  ////////////////////////
+
+Histogram* AtomicStatisticsImpl::getHistogram(int32_t offset) {
+  if (offset < 0 || offset >= statsType->getHistogramStatCount()) {
+    char s[128] = {'\0'};
+    ACE_OS::snprintf(
+        s, 128,
+        "getHistogram:The id (%d) of the Statistic Descriptor is not valid ",
+        offset);
+    throw IllegalArgumentException(s);
+  }
+  return &histogramStorage[offset];
+}
+
+void AtomicStatisticsImpl::recordValue(StatisticDescriptor* descriptor,
+                                       int64_t value) {
+  recordValue(getHistogramId(descriptor), value);
+}
+
+void AtomicStatisticsImpl::recordValue(int32_t id, int64_t value) {
+  if (isOpen()) {
+    getHistogram(id)->recordValue(value);
+  }
+}
+
+int64_t AtomicStatisticsImpl::getHistogramCount(int32_t id) {
+  if (isOpen()) {
+    return getHistogram(id)->getCount();
+  } else {
+    return 0;
+  }
+}
+
+int64_t AtomicStatisticsImpl::getHistogramPercentile(int32_t id,
+                                                     double fraction) {
+  if (isOpen()) {
+    HistogramSnapshot snapshot;
+    getHistogram(id)->snapshot(snapshot);
+    return snapshot.getValueAtPercentile(fraction);
+  } else {
+    return 0;
+  }
+}
+
 int32_t AtomicStatisticsImpl::getIntId(StatisticDescriptor* descriptor) {
   StatisticDescriptorImpl* realDescriptor =
       dynamic_cast<StatisticDescriptorImpl*>(descriptor);
@@ -539,6 +595,12 @@ int32_t AtomicStatisticsImpl::getDoubleId(StatisticDescriptor* descriptor) {
   return realDescriptor->checkDouble();
 }
 
+int32_t AtomicStatisticsImpl::getHistogramId(StatisticDescriptor* descriptor) {
+  StatisticDescriptorImpl* realDescriptor =
+      dynamic_cast<StatisticDescriptorImpl*>(descriptor);
+  return realDescriptor->checkHistogram();
+}
+
 }  // namespace statistics
 }  // namespace geode
 }  // namespace apache
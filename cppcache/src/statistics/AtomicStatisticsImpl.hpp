@@ -26,6 +26,7 @@
 
 #include <geode/statistics/Statistics.hpp>
 #include "StatisticsTypeImpl.hpp"
+#include "Histogram.hpp"
 #include <geode/statistics/StatisticsFactory.hpp>
 #include <string>
 
@@ -75,6 +76,9 @@ class AtomicStatisticsImpl : public Statistics, private NonCopyable {
   /** An array containing the values of the double statistics */
   std::atomic<double>* doubleStorage;
 
+  /** An array containing the histogram statistics */
+  Histogram* histogramStorage;
+
   ///////////////////////Private Methods//////////////////////////
   bool isOpen();
 
@@ -84,6 +88,8 @@ class AtomicStatisticsImpl : public Statistics, private NonCopyable {
 
   int32_t getDoubleId(StatisticDescriptor* descriptor);
 
+  int32_t getHistogramId(StatisticDescriptor* descriptor);
+
   //////////////////////  Static private Methods  //////////////////////
 
   int64_t calcNumericId(StatisticsFactory* system, int64_t userValue);
@@ -203,6 +209,23 @@ class AtomicStatisticsImpl : public Statistics, private NonCopyable {
 
   double incDouble(int32_t id, double delta);
 
+  ////////////////////////  record() Methods  ////////////////////////
+
+  void recordValue(int32_t id, int64_t value);
+
+  void recordValue(StatisticDescriptor* descriptor, int64_t value);
+
+  int64_t getHistogramCount(int32_t id);
+
+  int64_t getHistogramPercentile(int32_t id, double fraction);
+
+  /**
+   * Returns the storage of the histogram statistic at the given offset.
+   * @throws IllegalArgumentException
+   *         If the offset is invalid.
+   */
+  Histogram* getHistogram(int32_t offset);
+
  protected:
   void _setInt(int32_t offset, int32_t value);
 
@@ -243,3 +243,10 @@ StatisticDescriptor* GeodeStatisticsFactory::createDoubleGauge(
   return StatisticDescriptorImpl::createDoubleGauge(name, description, units,
                                                     largerBetter);
 }
+
+StatisticDescriptor* GeodeStatisticsFactory::createLongHistogram(
+    const char* name, const char* description, const char* units,
+    bool largerBetter) {
+  return StatisticDescriptorImpl::createLongHistogram(name, description, units,
+                                                      largerBetter);
+}
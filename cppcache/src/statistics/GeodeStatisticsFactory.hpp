@@ -120,6 +120,11 @@ class GeodeStatisticsFactory : public StatisticsFactory {
                                          const char* description,
                                          const char* units, bool largerBetter);
 
+  StatisticDescriptor* createLongHistogram(const char* name,
+                                           const char* description,
+                                           const char* units,
+                                           bool largerBetter);
+
   /** Return the first instance that matches the type, or nullptr */
   Statistics* findFirstStatisticsByType(StatisticsType* type);
 };
@@ -0,0 +1,187 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Histogram.hpp"
+#include "AtomicStatisticsImpl.hpp"
+#include "OsStatisticsImpl.hpp"
+#include "StatisticDescriptorImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+namespace {
+
+int32_t highestBit(uint64_t value) {
+  int32_t bit = 0;
+  if (value >> 32) {
+    value >>= 32;
+    bit += 32;
+  }
+  if (value >> 16) {
+    value >>= 16;
+    bit += 16;
+  }
+  if (value >> 8) {
+    value >>= 8;
+    bit += 8;
+  }
+  if (value >> 4) {
+    value >>= 4;
+    bit += 4;
+  }
+  if (value >> 2) {
+    value >>= 2;
+    bit += 2;
+  }
+  if (value >> 1) {
+    bit += 1;
+  }
+  return bit;
+}
+
+}  // namespace
+
+HistogramSnapshot::HistogramSnapshot()
+    : m_counts(Histogram::BUCKET_COUNT, 0), m_count(0), m_sum(0), m_max(0) {}
+
+int64_t HistogramSnapshot::getValueAtPercentile(double fraction) const {
+  if (m_count == 0) {
+    return 0;
+  }
+  fraction = std::min(std::max(fraction, 0.0), 1.0);
+  auto rank = static_cast<int64_t>(std::ceil(fraction * m_count));
+  if (rank < 1) {
+    rank = 1;
+  }
+  int64_t seen = 0;
+  for (int32_t i = 0; i < Histogram::BUCKET_COUNT; i++) {
+    seen += m_counts[i];
+    if (seen >= rank) {
+      return std::min(Histogram::bucketUpperBound(i), m_max);
+    }
+  }
+  return m_max;
+}
+
+HistogramSnapshot HistogramSnapshot::delta(
+    const HistogramSnapshot& previous) const {
+  HistogramSnapshot result;
+  int32_t highest = -1;
+  for (int32_t i = 0; i < Histogram::BUCKET_COUNT; i++) {
+    auto count = m_counts[i] - previous.m_counts[i];
+    if (count > 0) {
+      result.m_counts[i] = count;
+      result.m_count += count;
+      highest = i;
+    }
+  }
+  result.m_sum = m_sum - previous.m_sum;
+  if (highest >= 0) {
+    result.m_max = std::min(Histogram::bucketUpperBound(highest), m_max);
+  }
+  return result;
+}
+
+Histogram::Histogram() { reset(); }
+
+void Histogram::recordValue(int64_t value) {
+  if (value < 0) {
+    value = 0;
+  }
+  m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_sum.fetch_add(value, std::memory_order_relaxed);
+  auto max = m_max.load(std::memory_order_relaxed);
+  while (value > max &&
+         !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+  }
+}
+
+void Histogram::snapshot(HistogramSnapshot& snapshot) const {
+  snapshot.m_count = 0;
+  for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+    auto count = m_buckets[i].load(std::memory_order_relaxed);
+    snapshot.m_counts[i] = count;
+    snapshot.m_count += count;
+  }
+  snapshot.m_sum = m_sum.load(std::memory_order_relaxed);
+  snapshot.m_max = m_max.load(std::memory_order_relaxed);
+}
+
+void Histogram::reset() {
+  for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+    m_buckets[i].store(0, std::memory_order_relaxed);
+  }
+  m_count.store(0, std::memory_order_relaxed);
+  m_sum.store(0, std::memory_order_relaxed);
+  m_max.store(0, std::memory_order_relaxed);
+}
+
+int32_t Histogram::bucketIndex(int64_t value) {
+  if (value < SUB_BUCKET_COUNT) {
+    return value < 0 ? 0 : static_cast<int32_t>(value);
+  }
+  if (value >= (static_cast<int64_t>(1) << MAX_VALUE_BITS)) {
+    return BUCKET_COUNT - 1;
+  }
+  auto bit = highestBit(static_cast<uint64_t>(value));
+  auto subBucket = static_cast<int32_t>((value >> (bit - SUB_BUCKET_BITS)) &
+                                        (SUB_BUCKET_COUNT - 1));
+  return (bit - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket;
+}
+
+int64_t Histogram::bucketLowerBound(int32_t index) {
+  if (index < SUB_BUCKET_COUNT) {
+    return index;
+  }
+  auto group = index / SUB_BUCKET_COUNT;
+  auto subBucket = index % SUB_BUCKET_COUNT;
+  return static_cast<int64_t>(SUB_BUCKET_COUNT + subBucket) << (group - 1);
+}
+
+int64_t Histogram::bucketUpperBound(int32_t index) {
+  if (index < SUB_BUCKET_COUNT) {
+    return index;
+  }
+  auto group = index / SUB_BUCKET_COUNT;
+  return bucketLowerBound(index) + (static_cast<int64_t>(1) << (group - 1)) -
+         1;
+}
+
+Histogram* Histogram::forStatistic(Statistics* statistics,
+                                   StatisticDescriptor* descriptor) {
+  auto descriptorImpl = dynamic_cast<StatisticDescriptorImpl*>(descriptor);
+  if (descriptorImpl == nullptr ||
+      descriptorImpl->getTypeCode() != HISTOGRAM_TYPE) {
+    return nullptr;
+  }
+  if (auto atomicStats = dynamic_cast<AtomicStatisticsImpl*>(statistics)) {
+    return atomicStats->getHistogram(descriptorImpl->getId());
+  }
+  if (auto osStats = dynamic_cast<OsStatisticsImpl*>(statistics)) {
+    return osStats->getHistogram(descriptorImpl->getId());
+  }
+  return nullptr;
+}
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,165 @@
+#pragma once
+
+#ifndef GEODE_STATISTICS_HISTOGRAM_H_
+#define GEODE_STATISTICS_HISTOGRAM_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+
+/** @file
+ */
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+class Statistics;
+class StatisticDescriptor;
+
+/**
+ * A point in time copy of the bucket counts of a {@link Histogram}.
+ * Snapshots can be subtracted from each other to get the distribution of
+ * the values recorded during an interval.
+ */
+class CPPCACHE_EXPORT HistogramSnapshot {
+ public:
+  HistogramSnapshot();
+
+  /**
+   * Returns the total number of values recorded.
+   */
+  int64_t getCount() const { return m_count; }
+
+  /**
+   * Returns the sum of all values recorded.
+   */
+  int64_t getSum() const { return m_sum; }
+
+  /**
+   * Returns the largest value recorded, or 0 if none were.
+   */
+  int64_t getMax() const { return m_max; }
+
+  /**
+   * Returns the value below which the given fraction (0.0 - 1.0) of the
+   * recorded values fall. The result is the upper bound of the bucket that
+   * holds the requested rank, capped at the largest recorded value.
+   */
+  int64_t getValueAtPercentile(double fraction) const;
+
+  /**
+   * Returns the distribution of the values recorded since
+   * <code>previous</code> was taken. The max of the result is the upper
+   * bound of its highest non empty bucket.
+   */
+  HistogramSnapshot delta(const HistogramSnapshot& previous) const;
+
+  const std::vector<int64_t>& getCounts() const { return m_counts; }
+
+ private:
+  std::vector<int64_t> m_counts;
+  int64_t m_count;
+  int64_t m_sum;
+  int64_t m_max;
+
+  friend class Histogram;
+};
+
+/**
+ * A lock free, fixed memory, log-linear histogram of non negative 64 bit
+ * values, typically latencies in nanoseconds.
+ *
+ * Values are grouped by their highest set bit and each power of two range is
+ * split into SUB_BUCKET_COUNT linear sub buckets, so the relative error of a
+ * reported value is bounded by 1 / SUB_BUCKET_COUNT. Values at or above
+ * 2^MAX_VALUE_BITS are counted in the last bucket.
+ */
+class CPPCACHE_EXPORT Histogram {
+ public:
+  static const int32_t SUB_BUCKET_BITS = 3;
+  static const int32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+  static const int32_t MAX_VALUE_BITS = 40;
+  static const int32_t BUCKET_COUNT =
+      (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+  Histogram();
+  Histogram(const Histogram&) = delete;
+  Histogram& operator=(const Histogram&) = delete;
+
+  /**
+   * Records one occurrence of <code>value</code>. Negative values are
+   * recorded as zero.
+   */
+  void recordValue(int64_t value);
+
+  /**
+   * Returns the number of values recorded so far.
+   */
+  int64_t getCount() const { return m_count.load(std::memory_order_relaxed); }
+
+  /**
+   * Copies the current state into <code>snapshot</code>. Concurrent
+   * recording may make the copy slightly inconsistent across buckets; the
+   * count of the snapshot is always the sum of its buckets.
+   */
+  void snapshot(HistogramSnapshot& snapshot) const;
+
+  /**
+   * Resets all buckets to zero.
+   */
+  void reset();
+
+  /**
+   * Returns the index of the bucket that counts <code>value</code>.
+   */
+  static int32_t bucketIndex(int64_t value);
+
+  /**
+   * Returns the smallest value counted by the bucket at <code>index</code>.
+   */
+  static int64_t bucketLowerBound(int32_t index);
+
+  /**
+   * Returns the largest value counted by the bucket at <code>index</code>.
+   */
+  static int64_t bucketUpperBound(int32_t index);
+
+  /**
+   * Returns the histogram storage that <code>statistics</code> keeps for the
+   * given histogram descriptor, or nullptr if it has none.
+   */
+  static Histogram* forStatistic(Statistics* statistics,
+                                 StatisticDescriptor* descriptor);
+
+ private:
+  std::atomic<int64_t> m_buckets[BUCKET_COUNT];
+  std::atomic<int64_t> m_count;
+  std::atomic<int64_t> m_sum;
+  std::atomic<int64_t> m_max;
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_HISTOGRAM_H_
@@ -33,6 +33,7 @@
 #include "HostStatSampler.hpp"
 #include "HostStatHelper.hpp"
 #include "StatArchiveWriter.hpp"
+#include "StatArchiveFile.hpp"
 #include <geode/DistributedSystem.hpp>
 #include <geode/SystemProperties.hpp>
 #include "util/Log.hpp"
@@ -63,14 +64,27 @@ typedef std::vector<std::pair<std::string, int64_t> > g_fileInfo;
 
 using namespace apache::geode::statistics::globals;
 
+/**
+ * Removes the compressed archive extension from filename, if it has one.
+ */
+static bool stripCompressedExt(std::string& filename) {
+  if (!StatArchiveFile::isCompressedName(filename)) return false;
+  filename.resize(filename.length() -
+                  strlen(StatArchiveFile::COMPRESSED_EXT));
+  return true;
+}
+
 // extern "C" {
 
 int selector(const dirent* d) {
   std::string inputname(d->d_name);
   std::string filebasename = ACE::basename(
       apache::geode::statistics::globals::g_statFileWithExt.c_str());
-  size_t actualHyphenPos = filebasename.find_last_of('.');
   if (strcmp(filebasename.c_str(), d->d_name) == 0) return 1;
+  if (stripCompressedExt(filebasename) && !stripCompressedExt(inputname)) {
+    return 0;
+  }
+  size_t actualHyphenPos = filebasename.find_last_of('.');
   size_t fileExtPos = inputname.find_last_of('.');
   std::string extName = inputname.substr(fileExtPos + 1, inputname.length());
   if (strcmp(extName.c_str(), "gfs") != 0) return 0;
@@ -146,6 +160,13 @@ HostStatSampler::HostStatSampler(const char* filePath,
   m_pid = ACE_OS::getpid();
   m_statMngr = statMngr;
   m_archiveFileName = filePath;
+  m_compressArchive = stripCompressedExt(m_archiveFileName);
+  if (m_compressArchive && !StatArchiveFile::isCompressionSupported()) {
+    LOGWARN(
+        "Statistics archive compression is not supported by this build; "
+        "writing an uncompressed archive");
+    m_compressArchive = false;
+  }
   g_statFile = filePath;
   m_sampleRate = sampleIntervalMs;
   rollIndex = 0;
@@ -210,6 +231,7 @@ HostStatSampler::HostStatSampler(const char* filePath,
       for (int i = 0; i < sds.length(); i++) {
         // std::string strname = ACE::basename(resultArray[i]->d_name);
         std::string strname = ACE::basename(sds[i]->d_name);
+        stripCompressedExt(strname);
         size_t fileExtPos = strname.find_last_of('.', strname.length());
         if (fileExtPos != std::string::npos) {
           std::string tempname = strname.substr(0, fileExtPos);
@@ -254,7 +276,7 @@ HostStatSampler::HostStatSampler(const char* filePath,
 
 std::string HostStatSampler::initStatFileWithExt() {
   std::string archivefilename = createArchiveFileName();
-  archivefilename = chkForGFSExt(archivefilename);
+  archivefilename = chkForArchiveExt(archivefilename);
   return archivefilename;
 }
 
@@ -372,7 +394,7 @@ void HostStatSampler::changeArchive(std::string filename) {
     m_stopRequested = true;
     return;
   }
-  filename = chkForGFSExt(filename);
+  filename = chkForArchiveExt(filename);
   if (m_archiver != nullptr) {
     g_previoussamplesize = m_archiver->getSampleSize();
     m_archiver->closeFile();
@@ -434,6 +456,15 @@ std::string HostStatSampler::chkForGFSExt(std::string filename) {
   }
 }
 
+std::string HostStatSampler::chkForArchiveExt(std::string filename) {
+  stripCompressedExt(filename);
+  filename = chkForGFSExt(filename);
+  if (m_compressArchive) {
+    filename += StatArchiveFile::COMPRESSED_EXT;
+  }
+  return filename;
+}
+
 int32_t HostStatSampler::rollArchive(std::string filename) {
   FILE* fpExist = fopen(filename.c_str(), "r");
   if (fpExist == nullptr) {
@@ -464,6 +495,12 @@ int32_t HostStatSampler::rollArchive(std::string filename) {
   int32_t baselen = static_cast<int32_t>(statsbasename.length());
   int32_t posOfExt = static_cast<int32_t>(statsbasename.find_last_of(
       gfsFileExtAfter, static_cast<int32_t>(baselen)));
+  if (m_compressArchive && posOfExt > 0 &&
+      StatArchiveFile::isCompressedName(statsbasename)) {
+    // keep the compressed extension together with the gfs one
+    posOfExt = static_cast<int32_t>(
+        statsbasename.find_last_of(gfsFileExtAfter, posOfExt - 1));
+  }
   if (posOfExt == -1) {
     // throw IllegalArgument;
   } else {
@@ -214,6 +214,7 @@ class CPPCACHE_EXPORT HostStatSampler : public ACE_Task_Base,
   std::chrono::seconds m_durableTimeout;
 
   std::string m_archiveFileName;
+  bool m_compressArchive;
   int64_t m_archiveFileSizeLimit;
   int64_t m_archiveDiskSpaceLimit;
   std::chrono::milliseconds m_sampleRate;
@@ -239,6 +240,11 @@ class CPPCACHE_EXPORT HostStatSampler : public ACE_Task_Base,
    * If it is not there it adds and then returns the new filename.
    */
   std::string chkForGFSExt(std::string filename);
+  /**
+   * Like chkForGFSExt but also adds the compressed extension when the
+   * archive is compressed.
+   */
+  std::string chkForArchiveExt(std::string filename);
 
   /**
    * Initialize any special sampler stats. Like ProcessStats, HostStats
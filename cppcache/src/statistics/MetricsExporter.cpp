@@ -0,0 +1,322 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+#include <ace/INET_Addr.h>
+#include <ace/OS.h>
+#include <ace/SOCK_Acceptor.h>
+#include <ace/SOCK_Stream.h>
+
+#include <geode/Exception.hpp>
+
+#include "MetricsExporter.hpp"
+#include "StatisticsManager.hpp"
+#include "DistributedSystemImpl.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+using apache::geode::client::DistributedSystemImpl;
+using apache::geode::client::Exception;
+
+const char* MetricsExporter::NC_Metrics_Thread = "NC Metrics";
+
+namespace {
+
+const char* const CONTENT_TYPE =
+    "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+std::string metricName(const std::string& name) {
+  std::string result(name);
+  for (auto& c : result) {
+    if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+          (c >= '0' && c <= '9') || c == '_')) {
+      c = '_';
+    }
+  }
+  return result;
+}
+
+std::string escape(const std::string& text, bool escapeQuotes) {
+  std::string result;
+  result.reserve(text.length());
+  for (auto c : text) {
+    if (c == '\\') {
+      result += "\\\\";
+    } else if (c == '\n') {
+      result += "\\n";
+    } else if (c == '"' && escapeQuotes) {
+      result += "\\\"";
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+std::string formatValue(double value) {
+  if (std::isnan(value)) {
+    return "NaN";
+  } else if (std::isinf(value)) {
+    return value > 0 ? "+Inf" : "-Inf";
+  }
+  char buffer[32];
+  if (value == std::floor(value) && std::fabs(value) < 9007199254740992.0) {
+    ACE_OS::snprintf(buffer, sizeof(buffer), "%lld",
+                     static_cast<long long>(value));
+  } else {
+    // use the shortest form that still reads back as the same value
+    ACE_OS::snprintf(buffer, sizeof(buffer), "%.15g", value);
+    if (std::strtod(buffer, nullptr) != value) {
+      ACE_OS::snprintf(buffer, sizeof(buffer), "%.17g", value);
+    }
+  }
+  return buffer;
+}
+
+void writeSample(std::string& out, const std::string& name,
+                 const std::string& labels, double value) {
+  out += name;
+  out += '{';
+  out += labels;
+  out += "} ";
+  out += formatValue(value);
+  out += '\n';
+}
+
+}  // namespace
+
+MetricsExporter::MetricsExporter(StatisticsManager* statMngr,
+                                 const std::string& fileName, uint16_t port,
+                                 std::chrono::milliseconds interval)
+    : m_statMngr(statMngr),
+      m_fileName(fileName),
+      m_port(port),
+      m_interval(interval),
+      m_stopRequested(false) {}
+
+MetricsExporter::~MetricsExporter() { stop(); }
+
+void MetricsExporter::start() {
+  if (!m_fileName.empty()) {
+    m_fileThread = std::thread(&MetricsExporter::writeFileLoop, this);
+  }
+  if (m_port != 0) {
+    m_listenerThread = std::thread(&MetricsExporter::listenLoop, this);
+  }
+}
+
+void MetricsExporter::stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopRequested = true;
+  }
+  m_cond.notify_all();
+  if (m_fileThread.joinable()) {
+    m_fileThread.join();
+  }
+  if (m_listenerThread.joinable()) {
+    m_listenerThread.join();
+  }
+}
+
+std::string MetricsExporter::render(const StatisticsSnapshot& snapshot) {
+  // A metric family must be contiguous, so group the instances by type
+  // while keeping the types in the order they first appear.
+  typedef std::vector<const StatisticsSnapshot::Instance*> InstanceList;
+  std::vector<std::string> typeNames;
+  std::unordered_map<std::string, InstanceList> instancesByType;
+  for (const auto& instance : snapshot.getInstances()) {
+    auto& instances = instancesByType[instance.getTypeName()];
+    if (instances.empty()) {
+      typeNames.push_back(instance.getTypeName());
+    }
+    instances.push_back(&instance);
+  }
+
+  std::string out;
+  for (const auto& typeName : typeNames) {
+    const auto& instances = instancesByType[typeName];
+    std::vector<std::string> labels;
+    for (const auto instance : instances) {
+      labels.push_back("text_id=\"" + escape(instance->getTextId(), true) +
+                       "\",numeric_id=\"" +
+                       std::to_string(instance->getNumericId()) + "\"");
+    }
+
+    const auto& descriptors = instances.front()->getValues();
+    for (size_t i = 0; i < descriptors.size(); i++) {
+      const auto& descriptor = descriptors[i];
+      auto name = "geode_" + metricName(typeName) + "_" +
+                  metricName(descriptor.getName());
+      out += "# TYPE " + name;
+      switch (descriptor.getKind()) {
+        case StatisticsSnapshot::Value::COUNTER:
+          out += " counter\n";
+          break;
+        case StatisticsSnapshot::Value::HISTOGRAM:
+          out += " summary\n";
+          break;
+        default:
+          out += " gauge\n";
+          break;
+      }
+      if (!descriptor.getDescription().empty()) {
+        out += "# HELP " + name + " " +
+               escape(descriptor.getDescription(), false) + "\n";
+      }
+
+      for (size_t j = 0; j < instances.size(); j++) {
+        const auto& values = instances[j]->getValues();
+        if (i >= values.size()) {
+          continue;
+        }
+        const auto& value = values[i];
+        switch (value.getKind()) {
+          case StatisticsSnapshot::Value::COUNTER:
+            writeSample(out, name + "_total", labels[j], value.getValue());
+            break;
+          case StatisticsSnapshot::Value::HISTOGRAM:
+            for (const auto& percentile : value.getPercentiles()) {
+              writeSample(out, name,
+                          labels[j] + ",quantile=\"" +
+                              formatValue(percentile.first) + "\"",
+                          percentile.second);
+            }
+            writeSample(out, name + "_sum", labels[j], value.getSum());
+            writeSample(out, name + "_count", labels[j], value.getValue());
+            break;
+          default:
+            writeSample(out, name, labels[j], value.getValue());
+            break;
+        }
+      }
+    }
+  }
+  out += "# EOF\n";
+  return out;
+}
+
+void MetricsExporter::writeFileLoop() {
+  DistributedSystemImpl::setThreadName(NC_Metrics_Thread);
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stopRequested) {
+    lock.unlock();
+    try {
+      writeFile();
+    } catch (const Exception& e) {
+      LOGERROR("Exception writing the metrics file %s: %s: %s",
+               m_fileName.c_str(), e.getName(), e.what());
+    } catch (const std::exception& e) {
+      LOGERROR("Exception writing the metrics file %s: %s",
+               m_fileName.c_str(), e.what());
+    }
+    lock.lock();
+    m_cond.wait_for(lock, m_interval,
+                    [this] { return m_stopRequested.load(); });
+  }
+}
+
+void MetricsExporter::writeFile() {
+  auto text = render(m_statMngr->takeSnapshot(nullptr));
+  auto tempFileName = m_fileName + ".tmp";
+  FILE* fp = fopen(tempFileName.c_str(), "wb");
+  if (fp == nullptr) {
+    LOGERROR("Could not open the metrics file %s", tempFileName.c_str());
+    return;
+  }
+  bool written = fwrite(text.data(), 1, text.length(), fp) == text.length();
+  if (fclose(fp) != 0 || !written) {
+    LOGERROR("Could not write into the metrics file %s",
+             tempFileName.c_str());
+    return;
+  }
+  if (ACE_OS::rename(tempFileName.c_str(), m_fileName.c_str()) != 0) {
+    LOGERROR("Could not rename the metrics file %s to %s",
+             tempFileName.c_str(), m_fileName.c_str());
+  }
+}
+
+void MetricsExporter::listenLoop() {
+  DistributedSystemImpl::setThreadName(NC_Metrics_Thread);
+  ACE_INET_Addr addr(m_port, "127.0.0.1");
+  ACE_SOCK_Acceptor acceptor;
+  if (acceptor.open(addr, 1) == -1) {
+    int32_t lastError = ACE_OS::last_error();
+    LOGERROR("Could not listen for metrics requests on port %d: %s", m_port,
+             ACE_OS::strerror(lastError));
+    return;
+  }
+  LOGINFO("Serving metrics on http://127.0.0.1:%d/metrics", m_port);
+
+  while (!m_stopRequested) {
+    ACE_SOCK_Stream stream;
+    // wake up regularly to notice a stop request
+    ACE_Time_Value acceptTimeout(1);
+    if (acceptor.accept(stream, nullptr, &acceptTimeout) == -1) {
+      continue;
+    }
+
+    // Only the request line matters, the rest of the request is ignored.
+    std::string request;
+    char buffer[1024];
+    ACE_Time_Value readTimeout(5);
+    while (request.find("\r\n\r\n") == std::string::npos &&
+           request.length() < 8192) {
+      auto len = stream.recv(buffer, sizeof(buffer), &readTimeout);
+      if (len <= 0) {
+        break;
+      }
+      request.append(buffer, len);
+    }
+
+    std::string response;
+    if (request.compare(0, 4, "GET ") == 0) {
+      std::string body;
+      try {
+        body = render(m_statMngr->takeSnapshot(nullptr));
+      } catch (const Exception& e) {
+        LOGERROR("Exception rendering metrics: %s: %s", e.getName(),
+                 e.what());
+      }
+      response = "HTTP/1.1 200 OK\r\nContent-Type: ";
+      response += CONTENT_TYPE;
+      response += "\r\nContent-Length: " + std::to_string(body.length());
+      response += "\r\nConnection: close\r\n\r\n";
+      response += body;
+    } else {
+      response =
+          "HTTP/1.1 405 Method Not Allowed\r\nAllow: GET\r\n"
+          "Content-Length: 0\r\nConnection: close\r\n\r\n";
+    }
+    ACE_Time_Value writeTimeout(5);
+    stream.send_n(response.data(), response.length(), &writeTimeout);
+    stream.close();
+  }
+  acceptor.close();
+}
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
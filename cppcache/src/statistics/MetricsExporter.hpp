@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef GEODE_STATISTICS_METRICSEXPORTER_H_
+#define GEODE_STATISTICS_METRICSEXPORTER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <geode/geode_globals.hpp>
+#include <geode/statistics/StatisticsSnapshot.hpp>
+#include <NonCopyable.hpp>
+
+/** @file
+ */
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+using apache::geode::client::NonAssignable;
+using apache::geode::client::NonCopyable;
+
+class StatisticsManager;
+
+/**
+ * Publishes snapshots of all statistics in the OpenMetrics text format.
+ *
+ * If a file name is given the file is rewritten every interval; it is
+ * written to a temporary file first and renamed, so readers never see a
+ * partial exposition. If a port is given an HTTP listener bound to the
+ * loopback interface serves a fresh exposition to every request.
+ */
+class CPPCACHE_EXPORT MetricsExporter : private NonCopyable,
+                                        private NonAssignable {
+ public:
+  MetricsExporter(StatisticsManager* statMngr, const std::string& fileName,
+                  uint16_t port, std::chrono::milliseconds interval);
+  ~MetricsExporter();
+
+  /**
+   * Starts the threads that write the file and serve the listener.
+   */
+  void start();
+
+  /**
+   * Stops the threads and waits for them to exit.
+   */
+  void stop();
+
+  /**
+   * Renders <code>snapshot</code> in the OpenMetrics text format.
+   *
+   * Each statistic becomes a metric family named
+   * geode_&lt;type&gt;_&lt;statistic&gt; with one sample per statistics
+   * instance, labelled with its text and numeric ids. Counters are exposed
+   * as counters, other values as gauges and histograms as summaries.
+   */
+  static std::string render(const StatisticsSnapshot& snapshot);
+
+ private:
+  void writeFileLoop();
+  void writeFile();
+  void listenLoop();
+
+  StatisticsManager* m_statMngr;
+  std::string m_fileName;
+  uint16_t m_port;
+  std::chrono::milliseconds m_interval;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::atomic<bool> m_stopRequested;
+  std::thread m_fileThread;
+  std::thread m_listenerThread;
+
+  static const char* NC_Metrics_Thread;
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_METRICSEXPORTER_H_
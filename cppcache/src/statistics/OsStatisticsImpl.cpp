@@ -89,11 +89,13 @@ OsStatisticsImpl::OsStatisticsImpl(StatisticsType* typeArg,
   doubleStorage = (double*)0;
   intStorage = (int32_t*)0;
   longStorage = (int64_t*)0;
+  histogramStorage = nullptr;
 
   if (statsType != nullptr) {
     int32_t intCount = statsType->getIntStatCount();
     int32_t longCount = statsType->getLongStatCount();
     int32_t doubleCount = statsType->getDoubleStatCount();
+    int32_t histogramCount = statsType->getHistogramStatCount();
     if (intCount > 0) {
       intStorage = new int32_t[intCount];
       for (int32_t i = 0; i < intCount; i++) {
@@ -118,6 +120,9 @@ OsStatisticsImpl::OsStatisticsImpl(StatisticsType* typeArg,
     } else {
       doubleStorage = nullptr;
     }
+    if (histogramCount > 0) {
+      histogramStorage = new Histogram[histogramCount];
+    }
   }  // if(statsType == nullptr)
 }
 
@@ -136,6 +141,10 @@ OsStatisticsImpl::~OsStatisticsImpl() {
       delete[] doubleStorage;
       doubleStorage = nullptr;
     }
+    if (histogramStorage != nullptr) {
+      delete[] histogramStorage;
+      histogramStorage = nullptr;
+    }
   } catch (...) {
     LOGERROR("Exception in ~OsStatisticsImpl");
   }
@@ -258,6 +267,8 @@ int64_t OsStatisticsImpl::_getRawBits(StatisticDescriptor* statDscp) {
       int64_t* temp = reinterpret_cast<int64_t*>(&value);
       return *temp;
     }
+    case HISTOGRAM_TYPE:
+      return getHistogram(stat->getId())->getCount();
 
     default:
       return 0;
@@ -514,6 +525,50 @@ double OsStatisticsImpl::incDouble(int32_t id, double delta) {
 }
 /////////////////////////// GET ID /////////////////////////////////////////
 
+////////////////////////  record() Methods  ////////////////////////
+
+Histogram* OsStatisticsImpl::getHistogram(int32_t offset) {
+  if (offset < 0 || offset >= statsType->getHistogramStatCount()) {
+    char s[128] = {'\0'};
+    ACE_OS::snprintf(
+        s, 128,
+        "getHistogram:The id (%d) of the Statistic Descriptor is not valid ",
+        offset);
+    throw IllegalArgumentException(s);
+  }
+  return &histogramStorage[offset];
+}
+
+void OsStatisticsImpl::recordValue(StatisticDescriptor* descriptor,
+                                   int64_t value) {
+  recordValue(getHistogramId(descriptor), value);
+}
+
+void OsStatisticsImpl::recordValue(int32_t id, int64_t value) {
+  if (isOpen()) {
+    getHistogram(id)->recordValue(value);
+  }
+}
+
+int64_t OsStatisticsImpl::getHistogramCount(int32_t id) {
+  if (isOpen()) {
+    return getHistogram(id)->getCount();
+  } else {
+    return 0;
+  }
+}
+
+int64_t OsStatisticsImpl::getHistogramPercentile(int32_t id,
+                                                 double fraction) {
+  if (isOpen()) {
+    HistogramSnapshot snapshot;
+    getHistogram(id)->snapshot(snapshot);
+    return snapshot.getValueAtPercentile(fraction);
+  } else {
+    return 0;
+  }
+}
+
 int32_t OsStatisticsImpl::getIntId(StatisticDescriptor* descriptor) {
   StatisticDescriptorImpl* realDescriptor =
       dynamic_cast<StatisticDescriptorImpl*>(descriptor);
@@ -531,3 +586,9 @@ int32_t OsStatisticsImpl::getDoubleId(StatisticDescriptor* descriptor) {
       dynamic_cast<StatisticDescriptorImpl*>(descriptor);
   return realDescriptor->checkDouble();
 }
+
+int32_t OsStatisticsImpl::getHistogramId(StatisticDescriptor* descriptor) {
+  StatisticDescriptorImpl* realDescriptor =
+      dynamic_cast<StatisticDescriptorImpl*>(descriptor);
+  return realDescriptor->checkHistogram();
+}
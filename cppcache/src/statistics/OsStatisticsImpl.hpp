@@ -22,6 +22,7 @@
 
 #include <geode/statistics/Statistics.hpp>
 #include "StatisticsTypeImpl.hpp"
+#include "Histogram.hpp"
 #include <geode/statistics/StatisticsFactory.hpp>
 #include <NonCopyable.hpp>
 
@@ -84,6 +85,9 @@ class OsStatisticsImpl : public Statistics,
   /** An array containing the values of the double statistics */
   double* doubleStorage;
 
+  /** An array containing the histogram statistics */
+  Histogram* histogramStorage;
+
   ///////////////////////Private Methods//////////////////////////
   bool isOpen();
 
@@ -93,6 +97,8 @@ class OsStatisticsImpl : public Statistics,
 
   int32_t getDoubleId(StatisticDescriptor* descriptor);
 
+  int32_t getHistogramId(StatisticDescriptor* descriptor);
+
   //////////////////////  Static private Methods  //////////////////////
 
   static int64_t calcNumericId(StatisticsFactory* system, int64_t userValue);
@@ -211,6 +217,23 @@ class OsStatisticsImpl : public Statistics,
 
   double incDouble(int32_t id, double delta);
 
+  ////////////////////////  record() Methods  ////////////////////////
+
+  void recordValue(int32_t id, int64_t value);
+
+  void recordValue(StatisticDescriptor* descriptor, int64_t value);
+
+  int64_t getHistogramCount(int32_t id);
+
+  int64_t getHistogramPercentile(int32_t id, double fraction);
+
+  /**
+   * Returns the storage of the histogram statistic at the given offset.
+   * @throws IllegalArgumentException
+   *         If the offset is invalid.
+   */
+  Histogram* getHistogram(int32_t offset);
+
   ////////////////////////  store() Methods  ///////////////////////
  protected:
   /**
@@ -0,0 +1,289 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+
+#include <cstring>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "StatArchiveFile.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+using apache::geode::client::GeodeIOException;
+using apache::geode::client::IllegalArgumentException;
+using apache::geode::client::NullPointerException;
+using std::chrono::steady_clock;
+
+const char* StatArchiveFile::COMPRESSED_EXT = ".gz";
+const std::chrono::seconds StatArchiveFile::COMPRESSED_BLOCK_MAX_AGE(10);
+
+StatArchiveFile::StatArchiveFile(const std::string& filename,
+                                 size_t maxQueuedBytes)
+    : m_filename(filename),
+      m_fp(nullptr),
+      m_compressed(isCompressedName(filename)),
+      m_maxQueuedBytes(maxQueuedBytes),
+      m_flushRequested(false),
+      m_closing(false),
+      m_fileBytes(0),
+      m_queuedBytes(0),
+      m_failed(false),
+      m_dropping(false),
+      m_droppedWrites(0) {
+  if (m_compressed && !isCompressionSupported()) {
+    m_filename.erase(m_filename.length() - std::strlen(COMPRESSED_EXT));
+    LOGWARN(
+        "Statistics archive compression is not supported by this build; "
+        "writing an uncompressed archive to %s",
+        m_filename.c_str());
+    m_compressed = false;
+  }
+  m_fp = fopen(m_filename.c_str(), "a+b");
+  if (m_fp == nullptr) {
+    std::string s("error in opening archive file for writing");
+    throw NullPointerException(s.c_str());
+  }
+  m_thread = std::thread(&StatArchiveFile::run, this);
+}
+
+StatArchiveFile::~StatArchiveFile() { close(); }
+
+void StatArchiveFile::write(const uint8_t* buffer, size_t length) {
+  throwIfFailed();
+  if (length == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_dropping) {
+    if (m_queuedBytes == 0) {
+      throw GeodeIOException(
+          "Statistics samples were dropped while the statistics file fell "
+          "behind");
+    }
+  } else if (m_queuedBytes + length > m_maxQueuedBytes) {
+    LOGWARN(
+        "Dropping statistics samples: %lld bytes are still waiting to be "
+        "written to %s",
+        static_cast<long long>(m_queuedBytes), m_filename.c_str());
+    m_dropping = true;
+  }
+  if (m_dropping) {
+    ++m_droppedWrites;
+    return;
+  }
+  m_pending.insert(m_pending.end(), buffer, buffer + length);
+  m_queuedBytes += length;
+}
+
+void StatArchiveFile::flush() {
+  throwIfFailed();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_flushRequested = true;
+  }
+  m_cond.notify_one();
+}
+
+void StatArchiveFile::close() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_closing) {
+      return;
+    }
+    m_closing = true;
+  }
+  m_cond.notify_one();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+  if (m_fp != nullptr) {
+    fclose(m_fp);
+    m_fp = nullptr;
+  }
+}
+
+int64_t StatArchiveFile::getBytesWritten() const {
+  return m_fileBytes + m_queuedBytes;
+}
+
+bool StatArchiveFile::isCompressedName(const std::string& filename) {
+  static const size_t extLength = std::strlen(COMPRESSED_EXT);
+  return filename.length() > extLength &&
+         filename.compare(filename.length() - extLength, extLength,
+                          COMPRESSED_EXT) == 0;
+}
+
+bool StatArchiveFile::isCompressionSupported() {
+#ifdef HAVE_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+void StatArchiveFile::run() {
+  std::vector<uint8_t> block;
+  auto blockStart = steady_clock::now();
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_cond.wait(lock, [this] { return m_flushRequested || m_closing; });
+    bool closing = m_closing;
+    m_flushRequested = false;
+    if (!m_pending.empty()) {
+      if (block.empty()) {
+        blockStart = steady_clock::now();
+      }
+      block.insert(block.end(), m_pending.begin(), m_pending.end());
+      m_pending.clear();
+    }
+    if (!block.empty() &&
+        (closing || !m_compressed || block.size() >= COMPRESSED_BLOCK_SIZE ||
+         steady_clock::now() - blockStart >= COMPRESSED_BLOCK_MAX_AGE)) {
+      lock.unlock();
+      writeBlock(block);
+      m_queuedBytes -= block.size();
+      block.clear();
+      lock.lock();
+    }
+    if (closing) {
+      break;
+    }
+  }
+}
+
+void StatArchiveFile::writeBlock(const std::vector<uint8_t>& block) {
+  if (m_failed) {
+    return;
+  }
+  const uint8_t* data = block.data();
+  size_t length = block.size();
+
+#ifdef HAVE_ZLIB
+  std::vector<uint8_t> compressed;
+  if (m_compressed) {
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    // 16 added to the window bits selects a gzip header and trailer.
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      LOGERROR("Could not compress the statistics file");
+      m_failed = true;
+      return;
+    }
+    compressed.resize(deflateBound(&stream, static_cast<uLong>(length)));
+    stream.next_in = const_cast<Bytef*>(data);
+    stream.avail_in = static_cast<uInt>(length);
+    stream.next_out = compressed.data();
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    int result = deflate(&stream, Z_FINISH);
+    size_t compressedLength = stream.total_out;
+    deflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+      LOGERROR("Could not compress the statistics file");
+      m_failed = true;
+      return;
+    }
+    data = compressed.data();
+    length = compressedLength;
+  }
+#endif
+
+  if (fwrite(data, sizeof(uint8_t), length, m_fp) != length) {
+    LOGERROR("Could not write into the statistics file");
+    m_failed = true;
+    return;
+  }
+  if (fflush(m_fp) != 0) {
+    LOGERROR("Could not flush into the statistics file");
+    m_failed = true;
+    return;
+  }
+  m_fileBytes += length;
+}
+
+void StatArchiveFile::throwIfFailed() {
+  if (m_failed) {
+    throw GeodeIOException("Could not write into the statistics file");
+  }
+}
+
+void StatArchiveFile::decode(const std::string& archiveFile,
+                             const std::string& outputFile) {
+  FILE* out = fopen(outputFile.c_str(), "wb");
+  if (out == nullptr) {
+    throw GeodeIOException("Could not open the decoded statistics file");
+  }
+  uint8_t buffer[64 * 1024];
+  bool failed = false;
+
+#ifdef HAVE_ZLIB
+  // gzread also passes through files that are not compressed and continues
+  // across the concatenated members of a compressed archive.
+  gzFile in = gzopen(archiveFile.c_str(), "rb");
+  if (in == nullptr) {
+    fclose(out);
+    throw GeodeIOException("Could not open the statistics file");
+  }
+  int length;
+  while ((length = gzread(in, buffer, sizeof(buffer))) > 0) {
+    if (fwrite(buffer, 1, length, out) != static_cast<size_t>(length)) {
+      failed = true;
+      break;
+    }
+  }
+  if (length < 0) {
+    failed = true;
+  }
+  gzclose(in);
+#else
+  if (isCompressedName(archiveFile)) {
+    fclose(out);
+    throw IllegalArgumentException(
+        "statistics archive compression is not supported by this build");
+  }
+  FILE* in = fopen(archiveFile.c_str(), "rb");
+  if (in == nullptr) {
+    fclose(out);
+    throw GeodeIOException("Could not open the statistics file");
+  }
+  size_t length;
+  while ((length = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+    if (fwrite(buffer, 1, length, out) != length) {
+      failed = true;
+      break;
+    }
+  }
+  fclose(in);
+#endif
+
+  if (fclose(out) != 0 || failed) {
+    throw GeodeIOException("Could not decode the statistics file");
+  }
+}
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,174 @@
+#pragma once
+
+#ifndef GEODE_STATISTICS_STATARCHIVEFILE_H_
+#define GEODE_STATISTICS_STATARCHIVEFILE_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geode/geode_globals.hpp>
+#include <NonCopyable.hpp>
+
+/** @file
+ */
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+using apache::geode::client::NonAssignable;
+using apache::geode::client::NonCopyable;
+
+/**
+ * The file a statistics archive is written to. Bytes handed to this class are
+ * queued and written by a background thread so the sampler never waits on
+ * the disk.
+ *
+ * If the file name ends with COMPRESSED_EXT the archive is gzip compressed.
+ * Samples are collected into blocks of about COMPRESSED_BLOCK_SIZE bytes and
+ * each block is written as a complete gzip member, so a file cut short by a
+ * crash still decodes up to its last block. The result is a plain
+ * concatenated gzip stream that gzip, gfsh and VSD can read directly.
+ *
+ * At most a fixed number of bytes are queued. If the disk falls that far
+ * behind, further samples are dropped and counted instead. Each sample holds
+ * deltas against the ones before it, so the archive can not go on after a
+ * gap: once the queue has been written out, write() throws and the sampler
+ * starts a new archive.
+ */
+class CPPCACHE_EXPORT StatArchiveFile : private NonCopyable,
+                                        private NonAssignable {
+ public:
+  static const char* COMPRESSED_EXT;
+  static const size_t COMPRESSED_BLOCK_SIZE = 64 * 1024;
+  /**
+   * Longest time a partially filled compressed block is held back.
+   */
+  static const std::chrono::seconds COMPRESSED_BLOCK_MAX_AGE;
+  /**
+   * Default limit of the bytes queued and not yet written.
+   */
+  static const size_t DEFAULT_MAX_QUEUED_BYTES = 16 * 1024 * 1024;
+
+  /**
+   * Opens <code>filename</code> for appending and starts the writer thread.
+   * If the name asks for compression and the library was built without
+   * zlib, a warning is logged and a plain archive is written to the name
+   * without COMPRESSED_EXT.
+   * @throws NullPointerException if the file can not be opened.
+   */
+  explicit StatArchiveFile(const std::string& filename,
+                           size_t maxQueuedBytes = DEFAULT_MAX_QUEUED_BYTES);
+  ~StatArchiveFile();
+
+  /**
+   * Queues <code>length</code> bytes for writing. Only copies the bytes, or
+   * drops them if the queue is full.
+   * @throws GeodeIOException if an earlier write to the file failed, or if
+   * samples were dropped and the queue has since been written out.
+   */
+  void write(const uint8_t* buffer, size_t length);
+
+  /**
+   * Asks the writer thread to write out everything queued so far. An
+   * uncompressed archive is written and flushed at once; a compressed one
+   * waits until its block is full or COMPRESSED_BLOCK_MAX_AGE has passed.
+   * @throws GeodeIOException if an earlier write to the file failed.
+   */
+  void flush();
+
+  /**
+   * Writes out everything queued, stops the writer thread and closes the
+   * file. Errors are logged, never thrown.
+   */
+  void close();
+
+  /**
+   * Returns the number of bytes written to the file plus the number of
+   * bytes still queued. Compressed blocks count with their compressed size.
+   */
+  int64_t getBytesWritten() const;
+
+  /**
+   * Returns the number of writes dropped because the queue was full.
+   */
+  int64_t getDroppedWrites() const { return m_droppedWrites; }
+
+  bool isCompressed() const { return m_compressed; }
+
+  /**
+   * Returns the name of the file actually written.
+   */
+  const std::string& getFilename() const { return m_filename; }
+
+  /**
+   * Returns true if <code>filename</code> asks for a compressed archive.
+   */
+  static bool isCompressedName(const std::string& filename);
+
+  /**
+   * Returns true if this library was built with compression support.
+   */
+  static bool isCompressionSupported();
+
+  /**
+   * Decodes the archive in <code>archiveFile</code>, compressed or not, and
+   * writes the plain archive to <code>outputFile</code>.
+   * @throws GeodeIOException if either file can not be read or written.
+   */
+  static void decode(const std::string& archiveFile,
+                     const std::string& outputFile);
+
+ private:
+  void run();
+  void writeBlock(const std::vector<uint8_t>& block);
+  void throwIfFailed();
+
+  std::string m_filename;
+  FILE* m_fp;
+  bool m_compressed;
+  size_t m_maxQueuedBytes;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::vector<uint8_t> m_pending;
+  bool m_flushRequested;
+  bool m_closing;
+  std::thread m_thread;
+
+  std::atomic<int64_t> m_fileBytes;
+  std::atomic<int64_t> m_queuedBytes;
+  std::atomic<bool> m_failed;
+  bool m_dropping;
+  std::atomic<int64_t> m_droppedWrites;
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_STATARCHIVEFILE_H_
@@ -37,6 +37,15 @@ using std::chrono::duration_cast;
 using std::chrono::milliseconds;
 using std::chrono::nanoseconds;
 
+/**
+ * Names and percentiles of the long values a histogram is archived as. The
+ * count is cumulative, the others describe the sample interval.
+ */
+static const char *HISTOGRAM_VALUE_SUFFIXES[HISTOGRAM_ARCHIVED_VALUES] = {
+    "Count", "Max", "P50", "P90", "P99", "P999"};
+static const double HISTOGRAM_VALUE_PERCENTILES[HISTOGRAM_ARCHIVED_VALUES] = {
+    0.0, 1.0, 0.5, 0.9, 0.99, 0.999};
+
 // Constructor and Member functions of StatDataOutput class
 
 StatDataOutput::StatDataOutput(std::string filename, Cache *cache) {
@@ -50,21 +59,17 @@ StatDataOutput::StatDataOutput(std::string filename, Cache *cache) {
   outFile = filename;
   closed = false;
   bytesWritten = 0;
-  m_fp = fopen(outFile.c_str(), "a+b");
-  if (m_fp == nullptr) {
-    std::string s("error in opening archive file for writing");
-    throw NullPointerException(s.c_str());
-  }
+  m_file = std::unique_ptr<StatArchiveFile>(new StatArchiveFile(outFile));
 }
 
-StatDataOutput::~StatDataOutput() {
-  if (!closed && m_fp != nullptr) {
-    fclose(m_fp);
-  }
-}
+StatDataOutput::~StatDataOutput() {}
 
 int64_t StatDataOutput::getBytesWritten() { return this->bytesWritten; }
 
+int64_t StatDataOutput::getFileBytesWritten() {
+  return m_file == nullptr ? 0 : m_file->getBytesWritten();
+}
+
 void StatDataOutput::flush() {
   const uint8_t *buffBegin = dataBuffer->getBuffer();
   if (buffBegin == nullptr) {
@@ -76,20 +81,9 @@ void StatDataOutput::flush() {
     std::string s("undefined stat data buffer end");
     throw NullPointerException(s.c_str());
   }
-  int32_t sizeOfUInt8 = sizeof(uint8_t);
-  int32_t len = static_cast<int32_t>(buffEnd - buffBegin);
-
-  if (len > 0) {
-    if (fwrite(buffBegin, sizeOfUInt8, len, m_fp) != static_cast<size_t>(len)) {
-      LOGERROR("Could not write into the statistics file");
-      throw GeodeIOException("Could not write into the statistics file");
-    }
-  }
-  int rVal = fflush(m_fp);
-  if (rVal != 0) {
-    LOGERROR("Could not flush into the statistics file");
-    throw GeodeIOException("Could not flush into the statistics file");
-  }
+  auto len = static_cast<size_t>(buffEnd - buffBegin);
+  m_file->write(buffBegin, len);
+  m_file->flush();
 }
 
 void StatDataOutput::resetBuffer() {
@@ -132,17 +126,12 @@ void StatDataOutput::writeUTF(std::wstring s) {
 }
 
 void StatDataOutput::close() {
-  fclose(m_fp);
-  m_fp = nullptr;
+  m_file->close();
   closed = true;
 }
 
 void StatDataOutput::openFile(std::string filename, int64_t size) {
-  m_fp = fopen(filename.c_str(), "a+b");
-  if (m_fp == nullptr) {
-    std::string s("error in opening archive file for writing");
-    throw NullPointerException(s.c_str());
-  }
+  m_file = std::unique_ptr<StatArchiveFile>(new StatArchiveFile(filename));
   closed = false;
   bytesWritten = size;
 }
@@ -159,12 +148,29 @@ ResourceType::ResourceType(int32_t idArg, StatisticsType *typeArg) {
   this->stats = typeImpl->getStatistics();
   int32_t desc = typeImpl->getDescriptorsCount();
   this->numOfDescriptors = desc;
+  this->numOfArchivedValues = 0;
+  this->numOfHistograms = 0;
+  for (int32_t i = 0; i < desc; i++) {
+    StatisticDescriptorImpl *sdImpl = (StatisticDescriptorImpl *)stats[i];
+    if (sdImpl->getTypeCode() == HISTOGRAM_TYPE) {
+      this->numOfArchivedValues += HISTOGRAM_ARCHIVED_VALUES;
+      this->numOfHistograms++;
+    } else {
+      this->numOfArchivedValues++;
+    }
+  }
 }
 
 int32_t ResourceType::getId() { return this->id; }
 
 int32_t ResourceType::getNumOfDescriptors() { return this->numOfDescriptors; }
 
+int32_t ResourceType::getNumOfArchivedValues() {
+  return this->numOfArchivedValues;
+}
+
+int32_t ResourceType::getNumOfHistograms() { return this->numOfHistograms; }
+
 StatisticDescriptor **ResourceType::getStats() { return this->stats; }
 
 // Constructor and Member functions of ResourceInst class
@@ -175,13 +181,15 @@ ResourceInst::ResourceInst(int32_t idArg, Statistics *resourceArg,
   this->resource = resourceArg;
   this->type = typeArg;
   this->dataOut = dataOutArg;
-  int32_t cnt = type->getNumOfDescriptors();
+  int32_t cnt = type->getNumOfArchivedValues();
   archivedStatValues = new int64_t[cnt];
   // initialize to zero
   for (int32_t i = 0; i < cnt; i++) {
     archivedStatValues[i] = 0;
   }
-  numOfDescps = cnt;
+  archivedHistograms.resize(type->getNumOfHistograms());
+  numOfDescps = type->getNumOfDescriptors();
+  numOfArchivedValues = cnt;
   firstTime = true;
 }
 
@@ -210,17 +218,18 @@ void ResourceInst::writeSample() {
     firstTime = false;
     checkForChange = false;
   }
+  int32_t offset = 0;
   for (int32_t i = 0; i < numOfDescps; i++) {
-    int64_t value = getStatValue(stats[i]);
-    if (!checkForChange || value != archivedStatValues[i]) {
-      int64_t delta = value - archivedStatValues[i];
-      archivedStatValues[i] = value;
-      if (!wroteInstId) {
-        wroteInstId = true;
-        writeResourceInst(this->dataOut, this->id);
+    StatisticDescriptorImpl *sdImpl = (StatisticDescriptorImpl *)stats[i];
+    if (sdImpl->getTypeCode() == HISTOGRAM_TYPE) {
+      int64_t values[HISTOGRAM_ARCHIVED_VALUES];
+      getHistogramValues(stats[i], values);
+      for (int32_t j = 0; j < HISTOGRAM_ARCHIVED_VALUES; j++) {
+        writeValue(offset++, stats[i], values[j], checkForChange, wroteInstId);
       }
-      this->dataOut->writeByte(i);
-      writeStatValue(stats[i], delta);
+    } else {
+      writeValue(offset++, stats[i], getStatValue(stats[i]), checkForChange,
+                 wroteInstId);
     }
   }
   if (wroteInstId) {
@@ -228,6 +237,39 @@ void ResourceInst::writeSample() {
   }
 }
 
+void ResourceInst::writeValue(int32_t offset, StatisticDescriptor *sd,
+                              int64_t value, bool checkForChange,
+                              bool &wroteInstId) {
+  if (!checkForChange || value != archivedStatValues[offset]) {
+    int64_t delta = value - archivedStatValues[offset];
+    archivedStatValues[offset] = value;
+    if (!wroteInstId) {
+      wroteInstId = true;
+      writeResourceInst(this->dataOut, this->id);
+    }
+    this->dataOut->writeByte(offset);
+    writeStatValue(sd, delta);
+  }
+}
+
+void ResourceInst::getHistogramValues(StatisticDescriptor *sd,
+                                      int64_t *values) {
+  HistogramSnapshot current;
+  Histogram *histogram = Histogram::forStatistic(this->resource, sd);
+  if (histogram != nullptr) {
+    histogram->snapshot(current);
+  }
+  HistogramSnapshot &previous = archivedHistograms[sd->getId()];
+  HistogramSnapshot interval = current.delta(previous);
+  previous = current;
+
+  values[0] = current.getCount();
+  values[1] = interval.getMax();
+  for (int32_t j = 2; j < HISTOGRAM_ARCHIVED_VALUES; j++) {
+    values[j] = interval.getValueAtPercentile(HISTOGRAM_VALUE_PERCENTILES[j]);
+  }
+}
+
 void ResourceInst::writeStatValue(StatisticDescriptor *sd, int64_t v) {
   StatisticDescriptorImpl *sdImpl = (StatisticDescriptorImpl *)sd;
   if (sdImpl == nullptr) {
@@ -240,6 +282,7 @@ void ResourceInst::writeStatValue(StatisticDescriptor *sd, int64_t v) {
     case LONG_TYPE:
     //   case GF_FIELDTYPE_FLOAT:
     case DOUBLE_TYPE:
+    case HISTOGRAM_TYPE:
       writeCompactValue(v);
       break;
     default:
@@ -320,7 +363,6 @@ StatArchiveWriter::StatArchiveWriter(std::string outfile,
   resourceInstId = 0;
   statResourcesModCount = 0;
   archiveFile = outfile;
-  bytesWrittenToFile = 0;
 
   /* adongre
    * CID 28982: Uninitialized scalar field (UNINIT_CTOR)
@@ -394,7 +436,9 @@ StatArchiveWriter::~StatArchiveWriter() {
   }
 }
 
-int64_t StatArchiveWriter::bytesWritten() { return bytesWrittenToFile; }
+int64_t StatArchiveWriter::bytesWritten() {
+  return dataBuffer->getFileBytesWritten();
+}
 
 int64_t StatArchiveWriter::getSampleSize() { return m_samplesize; }
 
@@ -456,7 +500,6 @@ void StatArchiveWriter::openFile(std::string filename) {
 
 void StatArchiveWriter::flush() {
   this->dataBuffer->flush();
-  bytesWrittenToFile += dataBuffer->getBytesWritten();
   this->dataBuffer->resetBuffer();
   /*
     // have to figure out the problem with this code.
@@ -586,15 +629,31 @@ ResourceType *StatArchiveWriter::getResourceType(Statistics *s) {
     this->dataBuffer->writeString(type->getDescription());
     StatisticDescriptor **stats = rt->getStats();
     int32_t descCnt = rt->getNumOfDescriptors();
-    this->dataBuffer->writeShort(static_cast<int16_t>(descCnt));
+    this->dataBuffer->writeShort(
+        static_cast<int16_t>(rt->getNumOfArchivedValues()));
     for (int32_t i = 0; i < descCnt; i++) {
       std::string statsName = stats[i]->getName();
-      this->dataBuffer->writeString(statsName);
       StatisticDescriptorImpl *sdImpl = (StatisticDescriptorImpl *)stats[i];
       if (sdImpl == nullptr) {
         std::string err("could not down cast to StatisticDescriptorImpl");
         throw NullPointerException(err.c_str());
       }
+      if (sdImpl->getTypeCode() == HISTOGRAM_TYPE) {
+        // archive readers only know scalar values so write one long per
+        // summary value of the histogram
+        for (int32_t j = 0; j < HISTOGRAM_ARCHIVED_VALUES; j++) {
+          this->dataBuffer->writeString(statsName +
+                                        HISTOGRAM_VALUE_SUFFIXES[j]);
+          this->dataBuffer->writeByte(static_cast<int8_t>(LONG_TYPE));
+          this->dataBuffer->writeBoolean(j == 0);
+          this->dataBuffer->writeBoolean(stats[i]->isLargerBetter());
+          this->dataBuffer->writeString(j == 0 ? "operations"
+                                               : stats[i]->getUnit());
+          this->dataBuffer->writeString(stats[i]->getDescription());
+        }
+        continue;
+      }
+      this->dataBuffer->writeString(statsName);
       this->dataBuffer->writeByte(static_cast<int8_t>(sdImpl->getTypeCode()));
       this->dataBuffer->writeBoolean(stats[i]->isCounter());
       this->dataBuffer->writeBoolean(stats[i]->isLargerBetter());
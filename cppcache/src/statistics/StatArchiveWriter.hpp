@@ -22,6 +22,7 @@
 
 #include <map>
 #include <list>
+#include <vector>
 #include <geode/geode_globals.hpp>
 #include <geode/ExceptionTypes.hpp>
 #include <geode/Cache.hpp>
@@ -36,6 +37,8 @@
 #include <NonCopyable.hpp>
 #include <chrono>
 #include "SerializationRegistry.hpp"
+#include "Histogram.hpp"
+#include "StatArchiveFile.hpp"
 
 using namespace apache::geode::client;
 /**
@@ -79,7 +82,7 @@ using std::chrono::steady_clock;
 
 class CPPCACHE_EXPORT StatDataOutput {
  public:
-  StatDataOutput(Cache *cache) : bytesWritten(0), m_fp(nullptr), closed(false) {
+  StatDataOutput(Cache *cache) : bytesWritten(0), closed(false) {
     dataBuffer = cache->createDataOutput();
   }
   StatDataOutput(std::string, Cache *cache);
@@ -90,7 +93,12 @@ class CPPCACHE_EXPORT StatDataOutput {
    */
   int64_t getBytesWritten();
   /**
-   * Writes the buffer into the outfile.
+   * Returns the number of bytes handed to the outfile so far, compressed
+   * where the outfile is compressed.
+   */
+  int64_t getFileBytesWritten();
+  /**
+   * Hands the buffer to the outfile, which writes it in the background.
    */
   void flush();
   /**
@@ -138,7 +146,7 @@ class CPPCACHE_EXPORT StatDataOutput {
   int64_t bytesWritten;
   std::unique_ptr<DataOutput> dataBuffer;
   std::string outFile;
-  FILE *m_fp;
+  std::unique_ptr<StatArchiveFile> m_file;
   bool closed;
   friend class StatArchiveWriter;
 };
@@ -150,11 +158,19 @@ class CPPCACHE_EXPORT ResourceType : private NonCopyable,
   int32_t getId();
   StatisticDescriptor **getStats();
   int32_t getNumOfDescriptors();
+  /**
+   * Returns the number of values archived per sample. A histogram descriptor
+   * accounts for HISTOGRAM_ARCHIVED_VALUES of them.
+   */
+  int32_t getNumOfArchivedValues();
+  int32_t getNumOfHistograms();
 
  private:
   int32_t id;
   StatisticDescriptor **stats;
   int32_t numOfDescriptors;
+  int32_t numOfArchivedValues;
+  int32_t numOfHistograms;
 };
 
 /* adongre
@@ -182,18 +198,26 @@ class CPPCACHE_EXPORT ResourceInst : private NonCopyable,
   int64_t getStatValue(StatisticDescriptor *f);
   void writeSample();
   void writeStatValue(StatisticDescriptor *s, int64_t v);
+  void getHistogramValues(StatisticDescriptor *s, int64_t *values);
   void writeCompactValue(int64_t v);
   void writeResourceInst(StatDataOutput *, int32_t);
 
  private:
+  void writeValue(int32_t offset, StatisticDescriptor *s, int64_t value,
+                  bool checkForChange, bool &wroteInstId);
+
   int32_t id;
   Statistics *resource;
   ResourceType *type;
   /* This will contain the previous values of the descriptors */
   int64_t *archivedStatValues;
+  /* The histogram contents at the previous sample, indexed by histogram id */
+  std::vector<HistogramSnapshot> archivedHistograms;
   StatDataOutput *dataOut;
   /* Number of descriptors this resource instnace has */
   int32_t numOfDescps;
+  /* Number of values archived for this resource instance */
+  int32_t numOfArchivedValues;
   /* To know whether the instance has come for the first time */
   bool firstTime;
 };
@@ -212,7 +236,6 @@ class CPPCACHE_EXPORT StatArchiveWriter {
   int32_t resourceTypeId;
   int32_t resourceInstId;
   int32_t statResourcesModCount;
-  int64_t bytesWrittenToFile;
   int64_t m_samplesize;
   std::string archiveFile;
   std::map<Statistics *, ResourceInst *> resourceInstMap;
@@ -234,7 +257,7 @@ class CPPCACHE_EXPORT StatArchiveWriter {
   ~StatArchiveWriter();
   /**
    * Returns the number of bytes written so far to this archive.
-   * This does not take compression into account.
+   * This takes compression into account.
    */
   int64_t bytesWritten();
   /**
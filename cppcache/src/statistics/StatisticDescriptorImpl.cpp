@@ -24,6 +24,7 @@ using namespace apache::geode::statistics;
 const char* StatisticDescriptorImpl::IntTypeName = "int_t";
 const char* StatisticDescriptorImpl::LongTypeName = "Long";
 const char* StatisticDescriptorImpl::DoubleTypeName = "Float";
+const char* StatisticDescriptorImpl::HistogramTypeName = "Histogram";
 
 /**
  * Describes an individual statistic whose value is updated by an
@@ -143,6 +144,19 @@ StatisticDescriptor* StatisticDescriptorImpl::createDoubleGauge(
   return sdi;
 }
 
+StatisticDescriptor* StatisticDescriptorImpl::createLongHistogram(
+    const char* name, const char* description, const char* units,
+    bool isLargerBetter) {
+  FieldType fieldType = HISTOGRAM_TYPE;
+  StatisticDescriptorImpl* sdi = new StatisticDescriptorImpl(
+      name, fieldType, description, units, false, isLargerBetter);
+  if (sdi == nullptr) {
+    throw OutOfMemoryException(
+        "StatisticDescriptorImpl::createLongHistogram: out of memory");
+  }
+  return sdi;
+}
+
 /////////////////////// StatisticDescriptor(Base class)
 /// Methods///////////////////////////
 
@@ -164,6 +178,8 @@ const char* StatisticDescriptorImpl::getTypeCodeName(FieldType code) {
       return LongTypeName;
     case DOUBLE_TYPE:
       return DoubleTypeName;
+    case HISTOGRAM_TYPE:
+      return HistogramTypeName;
     default: {
       char buf[20];
       ACE_OS::snprintf(buf, 20, "%d", code);
@@ -187,6 +203,8 @@ int32_t StatisticDescriptorImpl::getTypeCodeBits(FieldType code) {
       return 64;
     case DOUBLE_TYPE:
       return 64;
+    case HISTOGRAM_TYPE:
+      return 64;
     default:
       std::string temp(getTypeCodeName(code));
       std::string s = "Unknown type code: " + temp;
@@ -257,3 +275,16 @@ int32_t StatisticDescriptorImpl::checkDouble() {
   }
   return id;
 }
+
+int32_t StatisticDescriptorImpl::checkHistogram() {
+  if (descriptorType != HISTOGRAM_TYPE) {
+    std::string sb;
+    std::string typeCode(getTypeCodeName(getTypeCode()));
+
+    sb = "The statistic " + name;
+    sb += " is of type " + typeCode;
+    sb += " and it was expected to be a histogram";
+    throw IllegalArgumentException(sb.c_str());
+  }
+  return id;
+}
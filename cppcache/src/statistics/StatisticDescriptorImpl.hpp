@@ -31,7 +31,16 @@ namespace apache {
 namespace geode {
 namespace statistics {
 
-typedef enum { INT_TYPE = 5, LONG_TYPE = 6, DOUBLE_TYPE = 8 } FieldType;
+/**
+ * The type codes of the values a statistic may hold. HISTOGRAM_TYPE is only
+ * used in memory; archives record a histogram as a group of long values.
+ */
+typedef enum {
+  INT_TYPE = 5,
+  LONG_TYPE = 6,
+  DOUBLE_TYPE = 8,
+  HISTOGRAM_TYPE = 64
+} FieldType;
 
 /**
  * Describes an individual statistic whose value is updated by an
@@ -78,7 +87,8 @@ class StatisticDescriptorImpl : public StatisticDescriptor {
    *        The type of the statistic.  This must be either
    *        <code>FieldType::INT_TYPE</code>, <code>FieldType::LONG_TYPE</code>,
    * or
-   *        <code>FieldType::DOUBLE_TYPE</code>.
+   *        <code>FieldType::DOUBLE_TYPE</code> or
+   *        <code>FieldType::HISTOGRAM_TYPE</code>.
    * @param description
    *        A description of the statistic (for example, <code>"The
    *        number of database lookups"</code>
@@ -122,7 +132,7 @@ class StatisticDescriptorImpl : public StatisticDescriptor {
   /**
    * Returns the number of bits needed to represent a value of the given type
    * Currently the supported types and their values are int_t :32 , Long :64,
-   * Double:64
+   * Double:64, Histogram:64
    * @throws IllegalArgumentException
    *         <code>code</code> is an unknown type
    */
@@ -190,6 +200,16 @@ class StatisticDescriptorImpl : public StatisticDescriptor {
                                                 const char* units,
                                                 bool isLargerBetter);
 
+  /**
+   * Creates a descriptor of Histogram type
+   * whose value is a distribution of long samples
+   * @throws OutOfMemoryException
+   */
+  static StatisticDescriptor* createLongHistogram(const char* name,
+                                                  const char* description,
+                                                  const char* units,
+                                                  bool isLargerBetter);
+
   /////////////////  StatisticDescriptor(Base class) Methods
   ///////////////////////
 
@@ -244,10 +264,18 @@ s
    */
   int32_t checkDouble();
 
+  /**
+   *  Checks whether the descriptor is of type histogram and returns the id if
+   *  it is
+   *  @throws IllegalArgumentException
+   */
+  int32_t checkHistogram();
+
  private:
   static const char* IntTypeName;
   static const char* LongTypeName;
   static const char* DoubleTypeName;
+  static const char* HistogramTypeName;
 
 };  // class
 
@@ -27,8 +27,11 @@
 #include "util/Log.hpp"
 #include "GeodeStatisticsFactory.hpp"
 #include <string>
+#include <unordered_map>
 #include "AtomicStatisticsImpl.hpp"
 #include "OsStatisticsImpl.hpp"
+#include "Histogram.hpp"
+#include "StatisticDescriptorImpl.hpp"
 
 using namespace apache::geode::client;
 using namespace apache::geode::statistics;
@@ -70,7 +73,8 @@ void StatisticsManager::forceSample() {
 
 StatisticsManager::~StatisticsManager() {
   try {
-    // Stop the sampler
+    // Stop the exporter and the sampler
+    m_metricsExporter.reset();
     closeSampler();
 
     // List should be empty if close() is called on each Stats object
@@ -115,6 +119,123 @@ ACE_Recursive_Thread_Mutex& StatisticsManager::getListMutex() {
   return m_statsListLock;
 }
 
+StatisticsSnapshot StatisticsManager::takeSnapshot(
+    const StatisticsSnapshot* previous) {
+  static const double PERCENTILES[] = {0.5, 0.9, 0.99, 0.999};
+
+  StatisticsSnapshot snapshot;
+  snapshot.m_timestamp = std::chrono::system_clock::now();
+  snapshot.m_steadyTimestamp = std::chrono::steady_clock::now();
+  if (previous != nullptr) {
+    snapshot.m_interval = snapshot.m_steadyTimestamp -
+                          previous->m_steadyTimestamp;
+  }
+
+  {
+    ACE_Guard<ACE_Recursive_Thread_Mutex> guard(m_statsListLock);
+    snapshot.m_instances.reserve(m_statsList.size());
+    HistogramSnapshot histogramSnapshot;
+    for (auto stats : m_statsList) {
+      if (stats == nullptr || stats->isClosed()) {
+        continue;
+      }
+      auto type = stats->getType();
+      snapshot.m_instances.push_back(StatisticsSnapshot::Instance());
+      auto& instance = snapshot.m_instances.back();
+      instance.m_typeName = type->getName();
+      instance.m_textId = stats->getTextId();
+      instance.m_numericId = stats->getNumericId();
+      instance.m_uniqueId = stats->getUniqueId();
+
+      auto descriptors = type->getStatistics();
+      auto count = type->getDescriptorsCount();
+      instance.m_values.resize(count);
+      for (int32_t i = 0; i < count; i++) {
+        auto descriptor =
+            dynamic_cast<StatisticDescriptorImpl*>(descriptors[i]);
+        auto& value = instance.m_values[i];
+        value.m_name = descriptor->getName();
+        value.m_description = descriptor->getDescription();
+        value.m_unit = descriptor->getUnit();
+        value.m_kind = descriptor->isCounter()
+                           ? StatisticsSnapshot::Value::COUNTER
+                           : StatisticsSnapshot::Value::GAUGE;
+        value.m_sum = 0;
+        switch (descriptor->getTypeCode()) {
+          case INT_TYPE:
+            value.m_value = stats->getInt(descriptor);
+            break;
+          case LONG_TYPE:
+            value.m_value = static_cast<double>(stats->getLong(descriptor));
+            break;
+          case DOUBLE_TYPE:
+            value.m_value = stats->getDouble(descriptor);
+            break;
+          case HISTOGRAM_TYPE: {
+            value.m_kind = StatisticsSnapshot::Value::HISTOGRAM;
+            value.m_value = 0;
+            auto histogram = Histogram::forStatistic(stats, descriptor);
+            if (histogram != nullptr) {
+              histogram->snapshot(histogramSnapshot);
+              value.m_value =
+                  static_cast<double>(histogramSnapshot.getCount());
+              value.m_sum = static_cast<double>(histogramSnapshot.getSum());
+              for (auto fraction : PERCENTILES) {
+                auto percentile =
+                    histogramSnapshot.getValueAtPercentile(fraction);
+                value.m_percentiles.push_back(
+                    std::make_pair(fraction, static_cast<double>(percentile)));
+              }
+            }
+            break;
+          }
+          default:
+            value.m_value = 0;
+            break;
+        }
+        value.m_delta = value.m_value;
+      }
+    }
+  }
+
+  if (previous != nullptr) {
+    std::unordered_map<int64_t, const StatisticsSnapshot::Instance*>
+        previousInstances;
+    for (const auto& instance : previous->m_instances) {
+      previousInstances[instance.m_uniqueId] = &instance;
+    }
+    for (auto& instance : snapshot.m_instances) {
+      auto found = previousInstances.find(instance.m_uniqueId);
+      if (found == previousInstances.end() ||
+          found->second->m_values.size() != instance.m_values.size()) {
+        continue;
+      }
+      for (size_t i = 0; i < instance.m_values.size(); i++) {
+        instance.m_values[i].m_delta -= found->second->m_values[i].m_value;
+      }
+    }
+  }
+  return snapshot;
+}
+
+StatisticsSnapshot StatisticsManager::getSnapshot() {
+  std::lock_guard<std::mutex> lock(m_lastSnapshotMutex);
+  auto snapshot = takeSnapshot(m_lastSnapshot.get());
+  m_lastSnapshot =
+      std::unique_ptr<StatisticsSnapshot>(new StatisticsSnapshot(snapshot));
+  return snapshot;
+}
+
+void StatisticsManager::startMetricsExporter(const std::string& fileName,
+                                             uint16_t port) {
+  if (m_metricsExporter != nullptr || (fileName.empty() && port == 0)) {
+    return;
+  }
+  m_metricsExporter = std::unique_ptr<MetricsExporter>(
+      new MetricsExporter(this, fileName, port, m_sampleIntervalMs));
+  m_metricsExporter->start();
+}
+
 void StatisticsManager::closeSampler() {
   if (m_sampler != nullptr) {
     m_sampler->stop();
@@ -21,16 +21,19 @@
 #define GEODE_STATISTICS_STATISTICSMANAGER_H_
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <geode/geode_globals.hpp>
 #include <geode/statistics/Statistics.hpp>
+#include <geode/statistics/StatisticsSnapshot.hpp>
 #include <geode/ExceptionTypes.hpp>
 
 #include "HostStatSampler.hpp"
 #include "StatisticsTypeImpl.hpp"
 #include "AdminRegion.hpp"
 #include "GeodeStatisticsFactory.hpp"
+#include "MetricsExporter.hpp"
 
 namespace apache {
 namespace geode {
@@ -63,6 +66,12 @@ class StatisticsManager {
 
   std::unique_ptr<GeodeStatisticsFactory> m_statisticsFactory;
 
+  std::unique_ptr<MetricsExporter> m_metricsExporter;
+
+  // Snapshot the deltas of getSnapshot are computed against
+  std::unique_ptr<StatisticsSnapshot> m_lastSnapshot;
+  std::mutex m_lastSnapshotMutex;
+
   void closeSampler();
 
  public:
@@ -109,6 +118,25 @@ class StatisticsManager {
     return m_statisticsFactory.get();
   }
 
+  /**
+   * Returns a snapshot of all open statistics with the deltas since
+   * <code>previous</code>, which may be nullptr.
+   */
+  StatisticsSnapshot takeSnapshot(const StatisticsSnapshot* previous);
+
+  /**
+   * Returns a snapshot of all open statistics with the deltas since the
+   * previous call of this method.
+   */
+  StatisticsSnapshot getSnapshot();
+
+  /**
+   * Starts exporting snapshots in the OpenMetrics format to
+   * <code>fileName</code> every sample interval and/or to a listener on
+   * the loopback <code>port</code>. Does nothing if neither is given.
+   */
+  void startMetricsExporter(const std::string& fileName, uint16_t port);
+
 };  // class
 
 }  // namespace statistics
@@ -77,6 +77,7 @@ StatisticsTypeImpl::StatisticsTypeImpl(const char* nameArg,
   int32_t intCount = 0;
   int32_t longCount = 0;
   int32_t doubleCount = 0;
+  int32_t histogramCount = 0;
   for (int32_t i = 0; i < this->statsLength; i++) {
     // Concrete class required to set the ids only.
     StatisticDescriptorImpl* sd =
@@ -99,6 +100,9 @@ StatisticsTypeImpl::StatisticsTypeImpl(const char* nameArg,
       } else if (sd->getTypeCode() == DOUBLE_TYPE) {
         sd->setId(doubleCount);
         doubleCount++;
+      } else if (sd->getTypeCode() == HISTOGRAM_TYPE) {
+        sd->setId(histogramCount);
+        histogramCount++;
       }
       std::string str = stats[i]->getName();
       StatisticsDescMap::iterator iterFind = statsDescMap.find(str);
@@ -116,6 +120,23 @@ StatisticsTypeImpl::StatisticsTypeImpl(const char* nameArg,
   this->intStatCount = intCount;
   this->longStatCount = longCount;
   this->doubleStatCount = doubleCount;
+  this->histogramStatCount = histogramCount;
+
+  // Each histogram is archived as a group of long values.
+  int32_t archivedCount =
+      statsLength + histogramCount * (HISTOGRAM_ARCHIVED_VALUES - 1);
+  if (archivedCount > MAX_DESCRIPTORS_PER_TYPE) {
+    char buffer[100];
+    ACE_OS::snprintf(buffer, 100, "%d", archivedCount);
+    std::string temp(buffer);
+    std::string s = "The archived descriptor count " + temp +
+                    " of the histogram statistics exceeds the maximum which "
+                    "is ";
+    ACE_OS::snprintf(buffer, 100, "%d", MAX_DESCRIPTORS_PER_TYPE);
+    std::string buf(buffer);
+    s += buf + ".";
+    throw IllegalArgumentException(s.c_str());
+  }
 }
 
 ///////////////////////////////Dtor/////////////////////////
@@ -180,6 +201,13 @@ int32_t StatisticsTypeImpl::getLongStatCount() { return longStatCount; }
  */
 int32_t StatisticsTypeImpl::getDoubleStatCount() { return doubleStatCount; }
 
+/**
+ * Gets the number of statistics that are histograms.
+ */
+int32_t StatisticsTypeImpl::getHistogramStatCount() {
+  return histogramStatCount;
+}
+
 /**
  * Gets the total number of statistic descriptors.
  */
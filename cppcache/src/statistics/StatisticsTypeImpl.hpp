@@ -53,6 +53,7 @@ class StatisticsTypeImpl : public StatisticsType {
   int32_t longStatCount;  // Contains the number of long statistics in this type.
   int32_t
       doubleStatCount;  // Contains the number of double statistics in this type
+  int32_t histogramStatCount;  // Contains the number of histogram statistics
 
  public:
   StatisticsTypeImpl(const char* name, const char* description,
@@ -89,6 +90,11 @@ class StatisticsTypeImpl : public StatisticsType {
    */
   int32_t getDoubleStatCount();
 
+  /*
+   * Gets the number of statistics that are histograms.
+   */
+  int32_t getHistogramStatCount();
+
   /*
    * Gets the total number of statistic descriptors in the Type
    */
@@ -42,6 +42,9 @@ namespace statistics {
 
 #define MAX_DESCRIPTORS_PER_TYPE 254
 
+/* count, max, p50, p90, p99 and p999 of the sample interval */
+#define HISTOGRAM_ARCHIVED_VALUES 6
+
 typedef enum {
 
   GFS_OSTYPE_LINUX = 0,
@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * gfstatdecode: writes a statistics archive, gzip compressed or not, out as a
+ * plain .gfs archive for tools that only read uncompressed archives.
+ */
+
+#include <cstdio>
+#include <exception>
+#include <string>
+
+#include "statistics/StatArchiveFile.hpp"
+
+using apache::geode::statistics::StatArchiveFile;
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::fprintf(stderr, "Usage: %s <archive.gfs[.gz]> <output.gfs>\n",
+                 argv[0]);
+    return 2;
+  }
+  std::string archiveFile(argv[1]);
+  std::string outputFile(argv[2]);
+  if (StatArchiveFile::isCompressedName(archiveFile) &&
+      !StatArchiveFile::isCompressionSupported()) {
+    std::fprintf(stderr,
+                 "%s: this build can not read compressed archives\n",
+                 argv[0]);
+    return 1;
+  }
+  try {
+    StatArchiveFile::decode(archiveFile, outputFile);
+  } catch (const std::exception& ex) {
+    std::fprintf(stderr, "%s: %s: %s\n", argv[0], archiveFile.c_str(),
+                 ex.what());
+    return 1;
+  }
+  return 0;
+}
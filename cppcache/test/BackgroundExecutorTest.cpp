@@ -0,0 +1,135 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BackgroundExecutor.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+void waitFor(const std::function<bool()>& condition) {
+  for (int i = 0; i < 1000 && !condition(); i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+}
+
+}  // namespace
+
+TEST(BackgroundExecutorTest, SignalBeforeStartRunsOnceStarted) {
+  BackgroundExecutor executor(2);
+  std::atomic<int> runs(0);
+  auto task = executor.createTask([&runs](volatile bool&) { ++runs; }, "t");
+  task->signal();
+  task->signal();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(0, runs.load());
+
+  task->start();
+  waitFor([&runs] { return runs.load() == 1; });
+  task->stop();
+  EXPECT_EQ(1, runs.load());
+}
+
+TEST(BackgroundExecutorTest, TaskNeverRunsConcurrentlyWithItself) {
+  BackgroundExecutor executor(4);
+  std::atomic<int> running(0);
+  std::atomic<int> overlaps(0);
+  std::atomic<int> runs(0);
+  auto task = executor.createTask(
+      [&](volatile bool&) {
+        if (++running > 1) {
+          ++overlaps;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        --running;
+        ++runs;
+      },
+      "t");
+  task->start();
+  for (int i = 0; i < 200; i++) {
+    task->signal();
+  }
+  waitFor([&runs] { return runs.load() > 0; });
+  task->stop();
+  EXPECT_EQ(0, overlaps.load());
+  // signals arriving while a run is queued or in progress are coalesced
+  EXPECT_LT(runs.load(), 200);
+}
+
+TEST(BackgroundExecutorTest, StopWaitsForRunAndPreventsFurtherRuns) {
+  BackgroundExecutor executor(1);
+  std::atomic<bool> entered(false);
+  std::atomic<bool> finished(false);
+  std::atomic<int> runs(0);
+  auto task = executor.createTask(
+      [&](volatile bool& isRunning) {
+        ++runs;
+        entered = true;
+        while (isRunning) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        finished = true;
+      },
+      "t");
+  task->start();
+  task->signal();
+  waitFor([&entered] { return entered.load(); });
+  ASSERT_TRUE(entered.load());
+
+  task->stop();
+  EXPECT_TRUE(finished.load());
+  task->signal();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(1, runs.load());
+}
+
+TEST(BackgroundExecutorTest, UsesNoMoreThanMaxThreads) {
+  BackgroundExecutor executor(2);
+  std::atomic<int> running(0);
+  std::atomic<int> maxRunning(0);
+  std::atomic<int> runs(0);
+  std::vector<std::shared_ptr<BackgroundTask>> tasks;
+  for (int i = 0; i < 8; i++) {
+    tasks.push_back(executor.createTask(
+        [&](volatile bool&) {
+          int now = ++running;
+          int seen = maxRunning.load();
+          while (now > seen && !maxRunning.compare_exchange_weak(seen, now)) {
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          --running;
+          ++runs;
+        },
+        "t"));
+    tasks.back()->start();
+    tasks.back()->signal();
+  }
+  waitFor([&runs] { return runs.load() == 8; });
+  executor.stop();
+  EXPECT_EQ(8, runs.load());
+  EXPECT_LE(maxRunning.load(), 2);
+  EXPECT_GT(maxRunning.load(), 0);
+}
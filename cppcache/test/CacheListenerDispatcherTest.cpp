@@ -0,0 +1,125 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "CacheListenerDispatcher.hpp"
+
+using namespace apache::geode::client;
+
+TEST(CacheListenerDispatcherTest, DeliversEventsOfAKeyInOrder) {
+  CacheListenerDispatcher dispatcher(4, 16, false, nullptr);
+  std::mutex mutex;
+  std::map<int32_t, std::vector<int32_t>> delivered;
+  for (int32_t i = 0; i < 1000; i++) {
+    auto key = CacheableInt32::create(i % 10);
+    dispatcher.dispatch(key,
+                        [&mutex, &delivered, i]() {
+                          std::lock_guard<std::mutex> lock(mutex);
+                          delivered[i % 10].push_back(i);
+                        },
+                        true);
+  }
+  dispatcher.flush();
+
+  ASSERT_EQ(10, delivered.size());
+  for (const auto& events : delivered) {
+    ASSERT_EQ(100, events.second.size());
+    for (size_t i = 1; i < events.second.size(); i++) {
+      EXPECT_LT(events.second[i - 1], events.second[i]);
+    }
+  }
+}
+
+TEST(CacheListenerDispatcherTest, ConflatesQueuedUpdates) {
+  CacheListenerDispatcher dispatcher(1, 16, true, nullptr);
+  std::atomic<bool> blocked(true);
+  std::vector<int32_t> delivered;
+  dispatcher.dispatch(CacheableInt32::create(-1),
+                      [&blocked]() {
+                        while (blocked) {
+                          std::this_thread::yield();
+                        }
+                      },
+                      false);
+  auto key = CacheableInt32::create(1);
+  for (int32_t i = 0; i < 5; i++) {
+    dispatcher.dispatch(key, [&delivered, i]() { delivered.push_back(i); },
+                        true);
+  }
+  // a destroy is never conflated, nor may an update overtake it
+  dispatcher.dispatch(key, [&delivered]() { delivered.push_back(-1); }, false);
+  dispatcher.dispatch(key, [&delivered]() { delivered.push_back(5); }, true);
+  blocked = false;
+  dispatcher.flush();
+
+  EXPECT_EQ((std::vector<int32_t>{4, -1, 5}), delivered);
+}
+
+TEST(CacheListenerDispatcherTest, BoundsTheQueue) {
+  CacheListenerDispatcher dispatcher(1, 2, false, nullptr);
+  std::atomic<bool> blocked(true);
+  std::atomic<int32_t> dispatched(0);
+  auto key = CacheableInt32::create(1);
+  std::thread producer([&]() {
+    dispatcher.dispatch(key,
+                        [&blocked]() {
+                          while (blocked) {
+                            std::this_thread::yield();
+                          }
+                        },
+                        false);
+    for (int32_t i = 0; i < 10; i++) {
+      dispatcher.dispatch(key, []() {}, false);
+      ++dispatched;
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  // the blocked call plus a full queue of two
+  EXPECT_EQ(2, dispatched.load());
+  blocked = false;
+  producer.join();
+  dispatcher.flush();
+  EXPECT_EQ(10, dispatched.load());
+}
+
+TEST(CacheListenerDispatcherTest, ListenerMayDispatchAndFlush) {
+  CacheListenerDispatcher dispatcher(1, 1, false, nullptr);
+  std::atomic<int32_t> delivered(0);
+  auto key = CacheableInt32::create(1);
+  dispatcher.dispatch(key,
+                      [&]() {
+                        // neither waits for the thread running this call
+                        for (int32_t i = 0; i < 3; i++) {
+                          dispatcher.dispatch(key, [&]() { ++delivered; },
+                                              false);
+                        }
+                        dispatcher.flush();
+                      },
+                      false);
+  dispatcher.flush();
+  EXPECT_EQ(3, delivered.load());
+}
@@ -0,0 +1,93 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ChunkProcessor.hpp"
+#include "TcrChunkedContext.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class RecordingResult : public TcrChunkedResult {
+ public:
+  RecordingResult() : finalized(false) {}
+
+  virtual void reset() override {}
+
+  virtual void finalize(bool inSameThread) override { finalized = true; }
+
+  std::vector<int32_t> seen;
+  std::atomic<bool> finalized;
+
+ protected:
+  virtual void handleChunk(const uint8_t* bytes, int32_t len,
+                           uint8_t isLastChunkWithSecurity,
+                           const Cache* cache) override {
+    int32_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+    seen.push_back(value);
+  }
+};
+
+TcrChunkedContext* newChunk(RecordingResult& result, int32_t value) {
+  auto bytes = new uint8_t[sizeof(value)];
+  std::memcpy(bytes, &value, sizeof(value));
+  return new TcrChunkedContext(bytes, sizeof(value), &result, 0, nullptr);
+}
+
+}  // namespace
+
+TEST(ChunkProcessorTest, KeepsTheChunksOfAResponseInOrder) {
+  std::vector<RecordingResult> results(8);
+  {
+    ChunkProcessor processor(4, nullptr);
+    for (int32_t i = 0; i < 1000; i++) {
+      for (auto& result : results) {
+        ASSERT_TRUE(processor.queue(newChunk(result, i)));
+      }
+    }
+    for (auto& result : results) {
+      ASSERT_TRUE(processor.queue(
+          new TcrChunkedContext(nullptr, 0, &result, 0, nullptr)));
+    }
+  }
+
+  for (auto& result : results) {
+    ASSERT_EQ(1000, result.seen.size());
+    for (int32_t i = 0; i < 1000; i++) {
+      EXPECT_EQ(i, result.seen[i]);
+    }
+    EXPECT_TRUE(result.finalized);
+  }
+}
+
+TEST(ChunkProcessorTest, RefusesChunksOnceStopped) {
+  RecordingResult result;
+  ChunkProcessor processor(2, nullptr);
+  processor.stop();
+  auto chunk = newChunk(result, 1);
+  EXPECT_FALSE(processor.queue(chunk));
+  delete chunk;
+  EXPECT_TRUE(result.seen.empty());
+}
@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/DeflateCompressor.hpp>
+#include <geode/Delta.hpp>
+#include <geode/RegionFactory.hpp>
+
+#include "CompressedEntriesMap.hpp"
+#include "LocalRegion.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class Counter : public Cacheable, public CopyableDelta<Counter> {
+ public:
+  Counter() : CopyableDelta<Counter>(nullptr), m_value(0) {}
+
+  explicit Counter(int32_t value)
+      : CopyableDelta<Counter>(nullptr), m_value(value) {}
+
+  Counter(const Counter& other)
+      : Cacheable(), CopyableDelta<Counter>(other), m_value(other.m_value) {}
+
+  void toData(DataOutput& output) const override { output.writeInt(m_value); }
+
+  void fromData(DataInput& input) override { m_value = input.readInt32(); }
+
+  int32_t classId() const override { return 0x31; }
+
+  bool hasDelta() override { return true; }
+
+  void toDelta(DataOutput& output) const override {}
+
+  // the delta is an amount to add
+  void fromDelta(DataInput& input) override { m_value += input.readInt32(); }
+
+  static Serializable* create() { return new Counter(); }
+
+  int32_t m_value;
+};
+
+class CompressedEntriesMapTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_cache = CacheFactory::createCacheFactory()
+                  ->set("log-level", "none")
+                  ->create();
+    m_cache->getTypeRegistry().registerType(Counter::create);
+    m_region = m_cache->createRegionFactory(RegionShortcut::LOCAL)
+                   .setCompressor(std::make_shared<DeflateCompressor>())
+                   .create("compressed");
+    auto localRegion = dynamic_cast<LocalRegion*>(m_region.get());
+    ASSERT_NE(nullptr, localRegion);
+    m_entries =
+        dynamic_cast<CompressedEntriesMap*>(localRegion->getEntryMap());
+    ASSERT_NE(nullptr, m_entries);
+  }
+
+  void TearDown() override { m_cache->close(); }
+
+  // apply a delta of amount to the value of key, as a notification would
+  GfErrType applyDelta(const std::shared_ptr<CacheableKey>& key,
+                       int32_t amount) {
+    auto output = m_cache->createDataOutput();
+    output->writeInt(amount);
+    auto input = m_cache->createDataInput(output->getBuffer(),
+                                          output->getBufferLength());
+    std::shared_ptr<Cacheable> newValue;
+    std::shared_ptr<MapEntryImpl> me;
+    std::shared_ptr<Cacheable> oldValue;
+    bool isUpdate = false;
+    return m_entries->put(key, newValue, me, oldValue, -1, 0, nullptr,
+                          isUpdate, input.get());
+  }
+
+  std::shared_ptr<Cache> m_cache;
+  std::shared_ptr<Region> m_region;
+  CompressedEntriesMap* m_entries;
+};
+
+}  // namespace
+
+TEST_F(CompressedEntriesMapTest, AppliesDeltaToCompressedValue) {
+  auto key = CacheableString::create("counter");
+  m_region->put(key, std::make_shared<Counter>(1));
+
+  ASSERT_EQ(GF_NOERR, applyDelta(key, 2));
+
+  std::shared_ptr<MapEntryImpl> me;
+  std::shared_ptr<Cacheable> stored;
+  m_entries->getEntriesMap()->getEntry(key, me, stored);
+  EXPECT_NE(nullptr, std::dynamic_pointer_cast<CompressedValue>(stored));
+  auto value = std::dynamic_pointer_cast<Counter>(m_region->get(key));
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ(3, value->m_value);
+}
+
+TEST_F(CompressedEntriesMapTest, ConcurrentDeltasToOneKeyAreNotLost) {
+  auto key = CacheableString::create("counter");
+  m_region->put(key, std::make_shared<Counter>(0));
+
+  const int deltasPerThread = 500;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 2; t++) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < deltasPerThread; i++) {
+        EXPECT_EQ(GF_NOERR, applyDelta(key, 1));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto value = std::dynamic_pointer_cast<Counter>(m_region->get(key));
+  ASSERT_NE(nullptr, value);
+  EXPECT_EQ(2 * deltasPerThread, value->m_value);
+}
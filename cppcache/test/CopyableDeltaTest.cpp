@@ -0,0 +1,60 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Delta.hpp>
+
+using namespace apache::geode::client;
+
+namespace {
+
+class Counters : public CopyableDelta<Counters> {
+ public:
+  Counters() : CopyableDelta<Counters>(nullptr), m_copies(0) {}
+
+  Counters(const Counters& other)
+      : CopyableDelta<Counters>(other),
+        m_values(other.m_values),
+        m_copies(other.m_copies + 1) {}
+
+  bool hasDelta() override { return true; }
+  void toDelta(DataOutput&) const override {}
+  void fromDelta(DataInput&) override {}
+
+  std::vector<int32_t> m_values;
+  int m_copies;
+};
+
+}  // namespace
+
+TEST(CopyableDeltaTest, ClonesWithTheCopyConstructor) {
+  auto original = std::make_shared<Counters>();
+  original->m_values = {1, 2, 3};
+
+  auto clone = std::dynamic_pointer_cast<Counters>(original->clone());
+  ASSERT_NE(nullptr, clone);
+  EXPECT_NE(original.get(), clone.get());
+  EXPECT_EQ(1, clone->m_copies);
+  EXPECT_EQ(original->m_values, clone->m_values);
+
+  clone->m_values.push_back(4);
+  EXPECT_EQ(3, original->m_values.size());
+}
@@ -0,0 +1,84 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/DeflateCompressor.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+using namespace apache::geode::client;
+
+namespace {
+std::unique_ptr<DeflateCompressor> createCompressor() {
+  try {
+    return std::unique_ptr<DeflateCompressor>(new DeflateCompressor());
+  } catch (UnsupportedOperationException&) {
+    // built without zlib
+    return nullptr;
+  }
+}
+}  // namespace
+
+TEST(DeflateCompressorTest, RoundTripsAndShrinksRepetitiveValues) {
+  auto compressor = createCompressor();
+  if (compressor == nullptr) {
+    return;
+  }
+  std::vector<uint8_t> value;
+  for (int i = 0; i < 4096; i++) {
+    value.push_back(static_cast<uint8_t>("{\"field\":\"value\"}"[i % 17]));
+  }
+  auto compressed = compressor->compress(value.data(), value.size());
+  EXPECT_LT(compressed.size(), value.size() / 4);
+  EXPECT_EQ(value,
+            compressor->decompress(compressed.data(), compressed.size()));
+}
+
+TEST(DeflateCompressorTest, RoundTripsEmptyValue) {
+  auto compressor = createCompressor();
+  if (compressor == nullptr) {
+    return;
+  }
+  auto compressed = compressor->compress(nullptr, 0);
+  EXPECT_TRUE(
+      compressor->decompress(compressed.data(), compressed.size()).empty());
+}
+
+TEST(DeflateCompressorTest, RejectsCorruptValue) {
+  auto compressor = createCompressor();
+  if (compressor == nullptr) {
+    return;
+  }
+  std::vector<uint8_t> value(100, 7);
+  auto compressed = compressor->compress(value.data(), value.size());
+  compressed.resize(compressed.size() / 2);
+  EXPECT_THROW(compressor->decompress(compressed.data(), compressed.size()),
+               IllegalArgumentException);
+  EXPECT_THROW(compressor->decompress(compressed.data(), 2),
+               IllegalArgumentException);
+}
+
+TEST(DeflateCompressorTest, RejectsInvalidLevel) {
+  if (createCompressor() == nullptr) {
+    return;
+  }
+  EXPECT_THROW(DeflateCompressor(0), IllegalArgumentException);
+  EXPECT_THROW(DeflateCompressor(10), IllegalArgumentException);
+}
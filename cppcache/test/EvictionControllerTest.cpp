@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "EvictionController.hpp"
+
+using apache::geode::client::EvictionController;
+
+namespace {
+
+EvictionController::Candidate candidate(uint32_t lastAccess,
+                                        int64_t entrySize) {
+  return EvictionController::Candidate{nullptr, lastAccess, entrySize};
+}
+
+}  // namespace
+
+TEST(EvictionControllerTest, SelectsOldestOfEqualSizes) {
+  std::vector<EvictionController::Candidate> candidates{
+      candidate(90, 100), candidate(40, 100), candidate(70, 100)};
+  EXPECT_EQ(1u, EvictionController::selectVictim(candidates, 100));
+}
+
+TEST(EvictionControllerTest, SelectsLargestOfEqualAges) {
+  std::vector<EvictionController::Candidate> candidates{
+      candidate(50, 100), candidate(50, 300), candidate(50, 200)};
+  EXPECT_EQ(1u, EvictionController::selectVictim(candidates, 100));
+}
+
+TEST(EvictionControllerTest, WeighsAgeBySize) {
+  // ages 51 and 11: 51 * 100 is less than 11 * 1000
+  std::vector<EvictionController::Candidate> candidates{
+      candidate(50, 100), candidate(90, 1000)};
+  EXPECT_EQ(1u, EvictionController::selectVictim(candidates, 100));
+
+  // ages 91 and 11: 91 * 100 is more than 11 * 800
+  candidates = {candidate(10, 100), candidate(90, 800)};
+  EXPECT_EQ(0u, EvictionController::selectVictim(candidates, 100));
+}
+
+TEST(EvictionControllerTest, CountsAgeAcrossClockWrapAround) {
+  // the first was last used 21 ticks ago, before the clock wrapped; the
+  // second 2 ticks ago
+  std::vector<EvictionController::Candidate> candidates{
+      candidate(0xFFFFFFF0u, 100), candidate(3, 100)};
+  EXPECT_EQ(0u, EvictionController::selectVictim(candidates, 5));
+}
+
+TEST(EvictionControllerTest, SelectsEntriesAccessedThisTick) {
+  // entries just used still have an age, so size decides
+  std::vector<EvictionController::Candidate> candidates{
+      candidate(100, 10), candidate(100, 20)};
+  EXPECT_EQ(1u, EvictionController::selectVictim(candidates, 100));
+}
@@ -0,0 +1,87 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "statistics/Histogram.hpp"
+
+using apache::geode::statistics::Histogram;
+using apache::geode::statistics::HistogramSnapshot;
+
+TEST(HistogramTest, BucketsCoverEveryValue) {
+  for (int32_t i = 0; i < Histogram::BUCKET_COUNT; i++) {
+    auto lower = Histogram::bucketLowerBound(i);
+    auto upper = Histogram::bucketUpperBound(i);
+    EXPECT_LE(lower, upper);
+    EXPECT_EQ(i, Histogram::bucketIndex(lower));
+    EXPECT_EQ(i, Histogram::bucketIndex(upper));
+    if (i + 1 < Histogram::BUCKET_COUNT) {
+      EXPECT_EQ(upper + 1, Histogram::bucketLowerBound(i + 1));
+    }
+  }
+}
+
+TEST(HistogramTest, RelativeErrorIsBounded) {
+  for (int64_t value = 1; value < (int64_t(1) << 39); value = value * 3 + 1) {
+    auto upper = Histogram::bucketUpperBound(Histogram::bucketIndex(value));
+    EXPECT_LE(static_cast<double>(upper - value) / value,
+              1.0 / Histogram::SUB_BUCKET_COUNT);
+  }
+}
+
+TEST(HistogramTest, LargeAndNegativeValuesAreClamped) {
+  EXPECT_EQ(0, Histogram::bucketIndex(-5));
+  EXPECT_EQ(Histogram::BUCKET_COUNT - 1,
+            Histogram::bucketIndex(std::numeric_limits<int64_t>::max()));
+}
+
+TEST(HistogramTest, PercentilesOfUniformValues) {
+  Histogram histogram;
+  for (int64_t value = 1; value <= 1000; value++) {
+    histogram.recordValue(value * 1000);
+  }
+  HistogramSnapshot snapshot;
+  histogram.snapshot(snapshot);
+
+  EXPECT_EQ(1000, snapshot.getCount());
+  EXPECT_EQ(1000000, snapshot.getMax());
+  EXPECT_EQ(500500000, snapshot.getSum());
+  EXPECT_NEAR(500000, snapshot.getValueAtPercentile(0.5), 500000 / 8);
+  EXPECT_NEAR(990000, snapshot.getValueAtPercentile(0.99), 990000 / 8);
+  EXPECT_EQ(1000000, snapshot.getValueAtPercentile(1.0));
+}
+
+TEST(HistogramTest, DeltaOnlyHasIntervalValues) {
+  Histogram histogram;
+  histogram.recordValue(1000000);
+  HistogramSnapshot previous;
+  histogram.snapshot(previous);
+
+  histogram.recordValue(10);
+  histogram.recordValue(12);
+  HistogramSnapshot current;
+  histogram.snapshot(current);
+
+  auto interval = current.delta(previous);
+  EXPECT_EQ(2, interval.getCount());
+  EXPECT_EQ(22, interval.getSum());
+  EXPECT_LE(12, interval.getMax());
+  EXPECT_GT(1000, interval.getMax());
+  EXPECT_EQ(0, HistogramSnapshot().getValueAtPercentile(0.99));
+}
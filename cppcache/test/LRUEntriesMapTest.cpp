@@ -0,0 +1,120 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/RegionFactory.hpp>
+
+#include "EvictionController.hpp"
+#include "LRUEntriesMap.hpp"
+#include "LocalRegion.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class LRUEntriesMapTest : public ::testing::Test {
+ protected:
+  static const int32_t VALUE_BYTES = 1000;
+
+  void SetUp() override {
+    // a limit well above what the tests put, so only they evict
+    m_cache = CacheFactory::createCacheFactory()
+                  ->set("log-level", "none")
+                  ->set("heap-lru-limit", "64")
+                  ->create();
+    m_region =
+        m_cache->createRegionFactory(RegionShortcut::LOCAL).create("heap");
+    auto localRegion = dynamic_cast<LocalRegion*>(m_region.get());
+    ASSERT_NE(nullptr, localRegion);
+    m_entries = dynamic_cast<LRUEntriesMap*>(localRegion->getEntryMap());
+    ASSERT_NE(nullptr, m_entries);
+  }
+
+  void TearDown() override { m_cache->close(); }
+
+  void putEntries(int32_t count) {
+    std::vector<uint8_t> bytes(VALUE_BYTES, 0x5a);
+    for (int32_t i = 0; i < count; i++) {
+      m_region->put(CacheableInt32::create(i),
+                    CacheableBytes::create(bytes.data(), VALUE_BYTES));
+    }
+  }
+
+  std::shared_ptr<Cache> m_cache;
+  std::shared_ptr<Region> m_region;
+  LRUEntriesMap* m_entries;
+};
+
+const int32_t LRUEntriesMapTest::VALUE_BYTES;
+
+}  // namespace
+
+TEST_F(LRUEntriesMapTest, EvictBytesStopsAtBatchLimit) {
+  putEntries(100);
+  auto mapSize = m_entries->getCurrentMapSize();
+
+  int32_t entries = 0;
+  auto freed = m_entries->evictBytes(mapSize, entries);
+
+  EXPECT_EQ(EvictionController::EVICTION_BATCH, entries);
+  EXPECT_EQ(100u - EvictionController::EVICTION_BATCH, m_entries->size());
+  EXPECT_GE(freed, int64_t(EvictionController::EVICTION_BATCH) * VALUE_BYTES);
+  EXPECT_LT(freed, mapSize);
+}
+
+TEST_F(LRUEntriesMapTest, EvictBytesStopsOnceTargetIsFreed) {
+  putEntries(100);
+
+  // each entry takes a little more than its value, so freeing two and a
+  // half values takes three entries
+  int32_t entries = 0;
+  auto freed = m_entries->evictBytes(VALUE_BYTES * 5 / 2, entries);
+
+  EXPECT_EQ(3, entries);
+  EXPECT_EQ(97u, m_entries->size());
+  EXPECT_GE(freed, VALUE_BYTES * 5 / 2);
+  EXPECT_LT(freed, VALUE_BYTES * 4);
+}
+
+TEST_F(LRUEntriesMapTest, EvictBytesStopsWhenMapIsEmpty) {
+  putEntries(3);
+
+  int32_t entries = 0;
+  m_entries->evictBytes(VALUE_BYTES * 100, entries);
+
+  EXPECT_EQ(3, entries);
+  EXPECT_EQ(0u, m_entries->size());
+  uint32_t lastAccess;
+  int64_t entrySize;
+  EXPECT_FALSE(m_entries->sampleLRU(lastAccess, entrySize));
+}
+
+TEST_F(LRUEntriesMapTest, SampleLRUReportsAverageEntrySize) {
+  putEntries(10);
+
+  uint32_t lastAccess = 0;
+  int64_t entrySize = 0;
+  ASSERT_TRUE(m_entries->sampleLRU(lastAccess, entrySize));
+  EXPECT_GE(entrySize, VALUE_BYTES);
+  EXPECT_LT(entrySize, VALUE_BYTES * 2);
+}
@@ -0,0 +1,133 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "LRUList.cpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class TestEntry {
+ public:
+  LRUEntryProperties& getLRUProperties() { return m_lruProperties; }
+
+ private:
+  LRUEntryProperties m_lruProperties;
+};
+
+class TestEntryFactory {
+ public:
+  static TestEntry* create(std::nullptr_t) { return new TestEntry(); }
+};
+
+typedef LRUList<TestEntry, TestEntryFactory> TestLRUList;
+
+class LRUListTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<TestEntry> append(uint32_t lastAccess,
+                                    bool evicted = false) {
+    auto entry = std::make_shared<TestEntry>();
+    entry->getLRUProperties().setLastAccess(lastAccess);
+    if (evicted) {
+      entry->getLRUProperties().setEvicted();
+    }
+    m_list.appendEntry(entry);
+    return entry;
+  }
+
+  TestLRUList m_list;
+};
+
+}  // namespace
+
+TEST_F(LRUListTest, SampleHeadOfEmptyListFindsNothing) {
+  uint32_t lastAccess = 0;
+  EXPECT_FALSE(m_list.sampleHead(lastAccess, 8));
+}
+
+TEST_F(LRUListTest, SampleHeadFindsLeastRecentAccess) {
+  append(5);
+  append(3);
+  append(9);
+
+  uint32_t lastAccess = 0;
+  ASSERT_TRUE(m_list.sampleHead(lastAccess, 8));
+  EXPECT_EQ(3u, lastAccess);
+}
+
+TEST_F(LRUListTest, SampleHeadLooksAtGivenNumberOfEntries) {
+  for (uint32_t tick = 10; tick > 0; tick--) {
+    append(tick);
+  }
+
+  uint32_t lastAccess = 0;
+  ASSERT_TRUE(m_list.sampleHead(lastAccess, 3));
+  EXPECT_EQ(8u, lastAccess);
+}
+
+TEST_F(LRUListTest, SampleHeadSkipsEvictedEntries) {
+  append(1, true);
+  append(2, true);
+  append(7);
+  append(6);
+
+  uint32_t lastAccess = 0;
+  ASSERT_TRUE(m_list.sampleHead(lastAccess, 1));
+  EXPECT_EQ(7u, lastAccess);
+}
+
+TEST_F(LRUListTest, SampleHeadGivesUpOnLongEvictedRun) {
+  // the visits are bounded to four per sample
+  for (int i = 0; i < 8; i++) {
+    append(1, true);
+  }
+  append(2);
+
+  uint32_t lastAccess = 0;
+  EXPECT_FALSE(m_list.sampleHead(lastAccess, 2));
+  EXPECT_TRUE(m_list.sampleHead(lastAccess, 3));
+  EXPECT_EQ(2u, lastAccess);
+}
+
+TEST_F(LRUListTest, SampleHeadOrdersTicksAcrossWrapAround) {
+  // 5 was stamped after the clock wrapped, so the older access is the
+  // larger tick
+  append(5);
+  append(0xFFFFFFF0u);
+  append(2);
+
+  uint32_t lastAccess = 0;
+  ASSERT_TRUE(m_list.sampleHead(lastAccess, 8));
+  EXPECT_EQ(0xFFFFFFF0u, lastAccess);
+}
+
+TEST_F(LRUListTest, GetLRUEntryDropsEvictedEntries) {
+  append(1, true);
+  auto live = append(2);
+
+  std::shared_ptr<TestEntry> entry;
+  m_list.getLRUEntry(entry);
+  EXPECT_EQ(live, entry);
+  uint32_t lastAccess = 0;
+  EXPECT_FALSE(m_list.sampleHead(lastAccess, 8));
+}
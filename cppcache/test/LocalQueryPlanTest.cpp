@@ -0,0 +1,112 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+#include "LocalQueryPlan.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+LocalQueryRow rowOf(std::shared_ptr<Cacheable> value) {
+  LocalQueryRow row;
+  row.value = value;
+  return row;
+}
+}  // namespace
+
+TEST(LocalQueryPlanTest, ParsesProjectionsConditionOrderingAndLimit) {
+  LocalQueryPlan plan(
+      "SELECT p.id, name AS n FROM /root/portfolios p "
+      "WHERE p.id > $1 AND (status = 'active' OR NOT p.id <> 3) "
+      "ORDER BY p.id DESC LIMIT 10");
+  EXPECT_EQ("/root/portfolios", plan.getRegionPath());
+  ASSERT_EQ(2, plan.getProjections().size());
+  EXPECT_TRUE(plan.selectsStruct());
+  EXPECT_EQ("id", plan.getProjections()[0].name);
+  EXPECT_EQ("n", plan.getProjections()[1].name);
+  EXPECT_EQ(3, plan.getFields().size());
+  ASSERT_NE(nullptr, plan.getCondition());
+  EXPECT_EQ(LocalQueryCondition::AND, plan.getCondition()->op);
+  ASSERT_EQ(1, plan.getOrderings().size());
+  EXPECT_TRUE(plan.getOrderings()[0].descending);
+  EXPECT_EQ(10, plan.getLimit());
+  EXPECT_EQ(1, plan.getParameterCount());
+}
+
+TEST(LocalQueryPlanTest, SelectsTheValueItself) {
+  LocalQueryPlan plan("select * from /r");
+  ASSERT_EQ(1, plan.getProjections().size());
+  EXPECT_TRUE(plan.getProjections()[0].selectsValue);
+  EXPECT_FALSE(plan.selectsStruct());
+  EXPECT_EQ(nullptr, plan.getCondition());
+  EXPECT_EQ(-1, plan.getLimit());
+}
+
+TEST(LocalQueryPlanTest, RejectsUnsupportedQueries) {
+  EXPECT_THROW(LocalQueryPlan("SELECT DISTINCT * FROM /r"), QueryException);
+  EXPECT_THROW(LocalQueryPlan("SELECT * FROM /r, /s"), QueryException);
+  EXPECT_THROW(LocalQueryPlan("SELECT * FROM /r r WHERE r.a.b = 1"),
+               QueryException);
+  EXPECT_THROW(LocalQueryPlan("SELECT * FROM /r WHERE s = 'open"),
+               QueryException);
+  EXPECT_THROW(LocalQueryPlan("SELECT * /r"), QueryException);
+}
+
+TEST(LocalQueryPlanTest, EvaluatesConditionsOnTheValue) {
+  LocalQueryPlan plan(
+      "SELECT * FROM /r r WHERE r >= 3 AND r < 7.5 AND NOT r = 5");
+  std::vector<LocalQueryValue> params;
+  std::vector<int32_t> matched;
+  for (int32_t i = 0; i < 10; i++) {
+    if (plan.matches(rowOf(CacheableInt32::create(i)), params)) {
+      matched.push_back(i);
+    }
+  }
+  EXPECT_EQ((std::vector<int32_t>{3, 4, 6, 7}), matched);
+  EXPECT_FALSE(plan.matches(rowOf(CacheableString::create("4")), params));
+}
+
+TEST(LocalQueryPlanTest, BindsParameters) {
+  LocalQueryPlan plan("SELECT * FROM /r r WHERE r = $1 OR r = $2");
+  std::vector<LocalQueryValue> params = {LocalQueryValue::fromString("a"),
+                                         LocalQueryValue::fromInteger(2)};
+  EXPECT_TRUE(plan.matches(rowOf(CacheableString::create("a")), params));
+  EXPECT_TRUE(plan.matches(rowOf(CacheableInt64::create(2)), params));
+  EXPECT_FALSE(plan.matches(rowOf(CacheableString::create("b")), params));
+}
+
+TEST(LocalQueryPlanTest, ComparesValuesAcrossNumericTypes) {
+  auto one = LocalQueryValue::fromInteger(1);
+  auto oneReal = LocalQueryValue::fromReal(1.0);
+  EXPECT_TRUE(one.equals(oneReal));
+  EXPECT_EQ(one.hash(), oneReal.hash());
+  EXPECT_LT(one.compareTo(LocalQueryValue::fromReal(1.5)), 0);
+  EXPECT_LT(LocalQueryValue().compareTo(one), 0);
+  EXPECT_FALSE(one.isOrderedWith(LocalQueryValue::fromString("1")));
+}
+
+TEST(LocalQueryPlanTest, OrdersRowsByTheOrderByClause) {
+  LocalQueryPlan plan("SELECT * FROM /r r ORDER BY r DESC");
+  EXPECT_TRUE(plan.orderedBefore(rowOf(CacheableInt32::create(2)),
+                                 rowOf(CacheableInt32::create(1))));
+  EXPECT_FALSE(plan.orderedBefore(rowOf(CacheableInt32::create(1)),
+                                  rowOf(CacheableInt32::create(2))));
+}
@@ -0,0 +1,132 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "PoolConnectionCounter.hpp"
+
+using apache::geode::client::PoolConnectionCounter;
+
+TEST(PoolConnectionCounterTest, ReservesUpToTheLimit) {
+  PoolConnectionCounter counter;
+  EXPECT_TRUE(counter.reserve(2));
+  EXPECT_TRUE(counter.reserve(2));
+  EXPECT_FALSE(counter.reserve(2));
+  EXPECT_EQ(2, counter.reserved());
+  EXPECT_EQ(0, counter.established());
+}
+
+TEST(PoolConnectionCounterTest, CancelFreesTheReservation) {
+  PoolConnectionCounter counter;
+  ASSERT_TRUE(counter.reserve(1));
+  EXPECT_FALSE(counter.reserve(1));
+  counter.cancel();
+  EXPECT_EQ(0, counter.reserved());
+  EXPECT_EQ(0, counter.established());
+  EXPECT_TRUE(counter.reserve(1));
+}
+
+TEST(PoolConnectionCounterTest, CommitEstablishesTheReservation) {
+  PoolConnectionCounter counter;
+  ASSERT_TRUE(counter.reserve(2));
+  counter.commit();
+  EXPECT_EQ(0, counter.reserved());
+  EXPECT_EQ(1, counter.established());
+  EXPECT_TRUE(counter.reserve(2));
+  EXPECT_FALSE(counter.reserve(2));
+}
+
+TEST(PoolConnectionCounterTest, AddAndRemoveEstablishedConnections) {
+  PoolConnectionCounter counter;
+  counter.add();
+  counter.add();
+  EXPECT_FALSE(counter.reserve(2));
+  EXPECT_EQ(1, counter.remove(1));
+  EXPECT_TRUE(counter.reserve(2));
+  EXPECT_EQ(1, counter.established());
+  EXPECT_EQ(0, counter.remove(1));
+}
+
+TEST(PoolConnectionCounterTest, ConcurrentReservationsStayWithinTheLimit) {
+  const int32_t limit = 8;
+  PoolConnectionCounter counter;
+  std::atomic<int32_t> held(0);
+  std::atomic<int32_t> peak(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < 10000; i++) {
+        if (!counter.reserve(limit)) {
+          continue;
+        }
+        auto total = ++held;
+        auto seen = peak.load();
+        while (total > seen && !peak.compare_exchange_weak(seen, total)) {
+        }
+        --held;
+        if ((i + t) % 2 == 0) {
+          counter.commit();
+          counter.remove(1);
+        } else {
+          counter.cancel();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(peak, limit);
+  EXPECT_EQ(0, counter.reserved());
+  EXPECT_EQ(0, counter.established());
+}
+
+TEST(PoolConnectionCounterTest, CommittedConnectionsStayWithinTheLimit) {
+  const int32_t limit = 4;
+  PoolConnectionCounter counter;
+  std::atomic<int32_t> held(0);
+  std::atomic<int32_t> peak(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < 10000; i++) {
+        if (!counter.reserve(limit)) {
+          continue;
+        }
+        auto total = ++held;
+        auto seen = peak.load();
+        while (total > seen && !peak.compare_exchange_weak(seen, total)) {
+        }
+        // the connection stays established while other threads reserve
+        counter.commit();
+        std::this_thread::yield();
+        --held;
+        counter.remove(1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(peak, limit);
+  EXPECT_EQ(0, counter.reserved());
+  EXPECT_EQ(0, counter.established());
+}
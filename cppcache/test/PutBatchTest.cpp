@@ -0,0 +1,206 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/RegionFactory.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "EntriesMap.hpp"
+#include "LocalRegion.hpp"
+#include "VersionTag.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class PutBatchTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_cache = CacheFactory::createCacheFactory()
+                  ->set("log-level", "none")
+                  ->create();
+  }
+
+  void TearDown() override { m_cache->close(); }
+
+  LocalRegion* createRegion(const char* name, bool concurrencyChecks,
+                            uint8_t concurrencyLevel = 16) {
+    m_regions.push_back(
+        m_cache->createRegionFactory(RegionShortcut::LOCAL)
+            .setConcurrencyChecksEnabled(concurrencyChecks)
+            .setConcurrencyLevel(concurrencyLevel)
+            .create(name));
+    return dynamic_cast<LocalRegion*>(m_regions.back().get());
+  }
+
+  static std::shared_ptr<CacheableKey> key(int32_t i) {
+    return CacheableInt32::create(i);
+  }
+
+  static std::shared_ptr<Cacheable> get(LocalRegion* region, int32_t i) {
+    return static_cast<Region*>(region)->get(key(i));
+  }
+
+  static int32_t intValue(const std::shared_ptr<Serializable>& value) {
+    return std::dynamic_pointer_cast<CacheableInt32>(value)->value();
+  }
+
+  static void addEntry(BatchPutEntries& batch, int32_t i, int32_t value,
+                       const std::shared_ptr<VersionTag>& tag = nullptr) {
+    batch.emplace_back(key(i), CacheableInt32::create(value), tag);
+  }
+
+  std::shared_ptr<VersionTag> versionTag(int32_t entryVersion,
+                                         int32_t regionVersion) {
+    auto members = CacheRegionHelper::getCacheImpl(m_cache.get())
+                       ->getMemberListForVersionStamp();
+    return std::make_shared<VersionTag>(entryVersion, 0, regionVersion, 1, 0,
+                                        *members);
+  }
+
+  std::shared_ptr<Cache> m_cache;
+  std::vector<std::shared_ptr<Region>> m_regions;
+};
+
+}  // namespace
+
+TEST_F(PutBatchTest, PutsNewKeysAsCreates) {
+  auto region = createRegion("creates", false);
+  BatchPutEntries batch;
+  for (int32_t i = 0; i < 100; i++) {
+    addEntry(batch, i, i * 10);
+  }
+
+  region->putLocalBatch("test", batch, -1);
+
+  for (const auto& entry : batch) {
+    EXPECT_EQ(GF_NOERR, entry.err);
+    EXPECT_FALSE(entry.isUpdate);
+    EXPECT_NE(nullptr, entry.entry);
+    EXPECT_EQ(nullptr, entry.oldValue);
+  }
+  EXPECT_EQ(100u, region->getEntryMap()->size());
+  for (int32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(i * 10, intValue(get(region, i)));
+  }
+}
+
+TEST_F(PutBatchTest, PutsExistingKeysAsUpdates) {
+  auto region = createRegion("updates", false);
+  for (int32_t i = 0; i < 50; i++) {
+    region->put(key(i), CacheableInt32::create(i));
+  }
+  BatchPutEntries batch;
+  for (int32_t i = 0; i < 100; i++) {
+    addEntry(batch, i, -i);
+  }
+
+  region->putLocalBatch("test", batch, -1);
+
+  for (int32_t i = 0; i < 100; i++) {
+    const auto& entry = batch[i];
+    EXPECT_EQ(GF_NOERR, entry.err);
+    EXPECT_EQ(i < 50, entry.isUpdate) << "key " << i;
+    if (i < 50) {
+      EXPECT_EQ(i, intValue(entry.oldValue));
+    }
+    EXPECT_EQ(-i, intValue(get(region, i)));
+  }
+  EXPECT_EQ(100u, region->getEntryMap()->size());
+}
+
+TEST_F(PutBatchTest, RepeatedKeyInEmptySegmentIsAnUpdate) {
+  auto region = createRegion("repeated", false, 1);
+  BatchPutEntries batch;
+  addEntry(batch, 1, 1);
+  addEntry(batch, 1, 2);
+
+  region->putLocalBatch("test", batch, -1);
+
+  EXPECT_FALSE(batch[0].isUpdate);
+  EXPECT_TRUE(batch[1].isUpdate);
+  EXPECT_EQ(1, intValue(batch[1].oldValue));
+  EXPECT_EQ(2, intValue(get(region, 1)));
+  EXPECT_EQ(1u, region->getEntryMap()->size());
+}
+
+TEST_F(PutBatchTest, AppliesVersionTagsWithConcurrencyChecks) {
+  // one segment, so the second batch goes through a segment holding entries
+  auto region = createRegion("versioned", true, 1);
+  BatchPutEntries first;
+  addEntry(first, 1, 1, versionTag(3, 11));
+  region->putLocalBatch("test", first, -1);
+
+  BatchPutEntries second;
+  addEntry(second, 2, 2, versionTag(5, 12));
+  region->putLocalBatch("test", second, -1);
+
+  ASSERT_EQ(GF_NOERR, first[0].err);
+  ASSERT_EQ(GF_NOERR, second[0].err);
+  EXPECT_EQ(3, first[0].entry->getVersionStamp().getEntryVersion());
+  EXPECT_EQ(11, first[0].entry->getVersionStamp().getRegionVersion());
+  EXPECT_EQ(5, second[0].entry->getVersionStamp().getEntryVersion());
+  EXPECT_EQ(12, second[0].entry->getVersionStamp().getRegionVersion());
+}
+
+TEST_F(PutBatchTest, DoesNotReplaceTrackedEntry) {
+  auto region = createRegion("tracked", false, 1);
+  auto entries = region->getEntryMap();
+  std::shared_ptr<Cacheable> oldValue;
+  int updateCount =
+      entries->addTrackerForEntry(key(1), oldValue, true, false, true);
+
+  BatchPutEntries batch;
+  addEntry(batch, 1, 1);
+  region->putLocalBatch("test", batch, -1);
+  ASSERT_EQ(GF_NOERR, batch[0].err);
+
+  // the tracked operation sees that the batch updated the entry
+  std::shared_ptr<MapEntryImpl> me;
+  EXPECT_EQ(GF_CACHE_ENTRY_UPDATED,
+            entries->put(key(1), CacheableInt32::create(2), me, oldValue,
+                         updateCount, 0, nullptr));
+  EXPECT_EQ(1, intValue(get(region, 1)));
+}
+
+TEST_F(PutBatchTest, DoesNotRecreateEntryDestroyedWhileTracked) {
+  auto region = createRegion("destroyed", false, 1);
+  auto entries = region->getEntryMap();
+  MapOfUpdateCounters updateCounters;
+  int destroyTracker = entries->addTrackerForAllEntries(updateCounters, true);
+  std::shared_ptr<Cacheable> oldValue;
+  std::shared_ptr<MapEntryImpl> me;
+  EXPECT_EQ(GF_CACHE_ENTRY_NOT_FOUND,
+            entries->remove(key(1), oldValue, me, -1, nullptr, false));
+
+  BatchPutEntries batch;
+  addEntry(batch, 1, 1);
+  addEntry(batch, 2, 2);
+  region->putLocalBatch("test", batch, destroyTracker);
+  entries->removeDestroyTracking();
+
+  EXPECT_EQ(GF_CACHE_ENTRY_UPDATED, batch[0].err);
+  EXPECT_FALSE(region->containsKey(key(1)));
+  EXPECT_EQ(GF_NOERR, batch[1].err);
+  EXPECT_EQ(2, intValue(get(region, 2)));
+}
@@ -0,0 +1,149 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/Struct.hpp>
+
+#include "QueryResultStreamImpl.hpp"
+
+using namespace apache::geode::client;
+
+TEST(QueryResultStreamTest, HandsOutResultsInOrderWithBoundedBuffer) {
+  QueryResultStreamImpl stream(2);
+  std::atomic<int> added(0);
+  stream.start([&stream, &added]() {
+    for (int32_t i = 0; i < 100; i++) {
+      stream.add(CacheableInt32::create(i));
+      ++added;
+    }
+  });
+
+  std::shared_ptr<Serializable> result;
+  for (int32_t i = 0; i < 100; i++) {
+    ASSERT_TRUE(stream.next(result));
+    EXPECT_EQ(i, std::dynamic_pointer_cast<CacheableInt32>(result)->value());
+    // the producer can run at most the buffer plus one blocked add ahead
+    EXPECT_LE(added.load(), i + 1 + 2);
+  }
+  EXPECT_FALSE(stream.next(result));
+}
+
+TEST(QueryResultStreamTest, ThrowsQueryFailureAfterEarlierResults) {
+  QueryResultStreamImpl stream(8);
+  stream.start([&stream]() {
+    stream.add(CacheableInt32::create(1));
+    throw QueryException("query failed");
+  });
+
+  std::shared_ptr<Serializable> result;
+  EXPECT_TRUE(stream.next(result));
+  EXPECT_THROW(stream.next(result), QueryException);
+}
+
+TEST(QueryResultStreamTest, GroupsStructFields) {
+  QueryResultStreamImpl stream(8);
+  stream.start([&stream]() {
+    std::vector<std::shared_ptr<CacheableString>> fieldNames = {
+        CacheableString::create("id"), CacheableString::create("name")};
+    stream.setFieldNames(fieldNames);
+    stream.add(CacheableInt32::create(1));
+    stream.add(CacheableString::create("one"));
+    stream.add(CacheableInt32::create(2));
+    stream.add(CacheableString::create("two"));
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  auto first = std::dynamic_pointer_cast<Struct>(result);
+  ASSERT_NE(nullptr, first);
+  EXPECT_EQ(2, first->length());
+  EXPECT_STREQ("one", std::dynamic_pointer_cast<CacheableString>(
+                          (*first)["name"])->asChar());
+  ASSERT_TRUE(stream.next(result));
+  EXPECT_FALSE(stream.next(result));
+}
+
+TEST(QueryResultStreamTest, StructsOutliveTheStreamAndItsFieldNames) {
+  std::shared_ptr<Struct> first;
+  std::shared_ptr<Struct> second;
+  {
+    QueryResultStreamImpl stream(8);
+    stream.start([&stream]() {
+      stream.setFieldNames({CacheableString::create("id")});
+      stream.add(CacheableInt32::create(1));
+      // a retry on another server sets the field names again
+      stream.setFieldNames({CacheableString::create("key")});
+      stream.add(CacheableInt32::create(2));
+    });
+
+    std::shared_ptr<Serializable> result;
+    ASSERT_TRUE(stream.next(result));
+    first = std::dynamic_pointer_cast<Struct>(result);
+    ASSERT_TRUE(stream.next(result));
+    second = std::dynamic_pointer_cast<Struct>(result);
+    EXPECT_FALSE(stream.next(result));
+  }
+
+  ASSERT_NE(nullptr, first);
+  ASSERT_NE(nullptr, second);
+  EXPECT_EQ("id", first->getFieldName(0));
+  EXPECT_EQ(1, std::dynamic_pointer_cast<CacheableInt32>((*first)["id"])
+                   ->value());
+  EXPECT_EQ("key", second->getFieldName(0));
+  EXPECT_EQ(2, std::dynamic_pointer_cast<CacheableInt32>((*second)["key"])
+                   ->value());
+}
+
+TEST(QueryResultStreamTest, RestartDiscardsUnreadResults) {
+  QueryResultStreamImpl stream(8);
+  stream.start([&stream]() {
+    stream.add(CacheableInt32::create(1));
+    stream.restart();
+    stream.add(CacheableInt32::create(2));
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  // nothing was read before the restart unless the reader won the race, in
+  // which case the stream fails rather than hand out a result twice
+  auto value = std::dynamic_pointer_cast<CacheableInt32>(result)->value();
+  if (value == 2) {
+    EXPECT_FALSE(stream.next(result));
+  } else {
+    EXPECT_THROW(stream.next(result), IllegalStateException);
+  }
+}
+
+TEST(QueryResultStreamTest, CloseUnblocksTheProducer) {
+  QueryResultStreamImpl stream(1);
+  stream.start([&stream]() {
+    for (int32_t i = 0; i < 1000; i++) {
+      stream.add(CacheableInt32::create(i));
+    }
+  });
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  stream.close();
+  EXPECT_FALSE(stream.next(result));
+}
@@ -0,0 +1,153 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/RegionEntryCursor.hpp>
+#include <geode/RegionFactory.hpp>
+
+using namespace apache::geode::client;
+
+namespace {
+
+class RegionEntryCursorTest : public ::testing::Test {
+ protected:
+  static const int32_t ENTRIES = 1000;
+
+  void SetUp() override {
+    m_cache = CacheFactory::createCacheFactory()
+                  ->set("log-level", "none")
+                  ->create();
+    m_region = m_cache->createRegionFactory(RegionShortcut::LOCAL)
+                   .setConcurrencyLevel(16)
+                   .create("scanned");
+    for (int32_t i = 0; i < ENTRIES; i++) {
+      m_region->put(CacheableInt32::create(i), CacheableInt32::create(i));
+    }
+  }
+
+  void TearDown() override { m_cache->close(); }
+
+  static int32_t intValue(const std::shared_ptr<Serializable>& value) {
+    return std::dynamic_pointer_cast<CacheableInt32>(value)->value();
+  }
+
+  void expectEachEntryOnce(const std::map<int32_t, int>& visits) {
+    EXPECT_EQ(static_cast<size_t>(ENTRIES), visits.size());
+    for (const auto& visit : visits) {
+      EXPECT_EQ(1, visit.second) << "key " << visit.first;
+    }
+  }
+
+  std::shared_ptr<Cache> m_cache;
+  std::shared_ptr<Region> m_region;
+};
+
+const int32_t RegionEntryCursorTest::ENTRIES;
+
+}  // namespace
+
+TEST_F(RegionEntryCursorTest, CursorVisitsEveryEntryOnce) {
+  std::map<int32_t, int> visits;
+  auto cursor = m_region->entryCursor();
+  std::shared_ptr<CacheableKey> key;
+  std::shared_ptr<Cacheable> value;
+  while (cursor->next(key, value)) {
+    EXPECT_EQ(intValue(key), intValue(value));
+    visits[intValue(key)]++;
+  }
+  EXPECT_FALSE(cursor->next(key, value));
+  expectEachEntryOnce(visits);
+}
+
+TEST_F(RegionEntryCursorTest, CursorOverEmptyRegionHasNoEntries) {
+  auto region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL).create("empty");
+  auto cursor = region->entryCursor();
+  std::shared_ptr<CacheableKey> key;
+  std::shared_ptr<Cacheable> value;
+  EXPECT_FALSE(cursor->next(key, value));
+}
+
+TEST_F(RegionEntryCursorTest, ParallelScanSplitsEntriesAcrossCursors) {
+  std::mutex mutex;
+  std::map<int32_t, int> visits;
+  std::atomic<int> scans(0);
+  m_region->parallelScan(
+      [&](RegionEntryCursor& cursor) {
+        ++scans;
+        std::shared_ptr<CacheableKey> key;
+        std::shared_ptr<Cacheable> value;
+        while (cursor.next(key, value)) {
+          std::lock_guard<std::mutex> lock(mutex);
+          visits[intValue(key)]++;
+        }
+      },
+      4);
+  EXPECT_GE(scans, 1);
+  EXPECT_LE(scans, 4);
+  expectEachEntryOnce(visits);
+}
+
+TEST_F(RegionEntryCursorTest, ParallelScanRethrowsScanException) {
+  EXPECT_THROW(m_region->parallelScan(
+                   [](RegionEntryCursor&) {
+                     throw std::runtime_error("scan failed");
+                   },
+                   4),
+               std::runtime_error);
+}
+
+TEST_F(RegionEntryCursorTest, ForEachEntryVisitsEveryEntry) {
+  std::mutex mutex;
+  std::map<int32_t, int> visits;
+  m_region->forEachEntry(
+      [&](const std::shared_ptr<CacheableKey>& key,
+          const std::shared_ptr<Cacheable>& value) {
+        EXPECT_EQ(intValue(key), intValue(value));
+        std::lock_guard<std::mutex> lock(mutex);
+        visits[intValue(key)]++;
+      },
+      4);
+  expectEachEntryOnce(visits);
+}
+
+TEST_F(RegionEntryCursorTest, ReduceEntriesFoldsAllValues) {
+  auto sum = m_region->reduceEntries(
+      int64_t(0),
+      [](int64_t partial, const std::shared_ptr<CacheableKey>&,
+         const std::shared_ptr<Cacheable>& value) {
+        return partial + intValue(value);
+      },
+      [](int64_t result, int64_t partial) { return result + partial; }, 4);
+  EXPECT_EQ(int64_t(ENTRIES) * (ENTRIES - 1) / 2, sum);
+
+  auto count = m_region->reduceEntries(
+      0,
+      [](int partial, const std::shared_ptr<CacheableKey>&,
+         const std::shared_ptr<Cacheable>&) { return partial + 1; },
+      [](int result, int partial) { return result + partial; }, 1);
+  EXPECT_EQ(ENTRIES, count);
+}
@@ -0,0 +1,166 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionMemoryFootprint.hpp>
+#include <geode/statistics/Statistics.hpp>
+
+#include "LocalRegion.hpp"
+#include "RegionStats.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class RegionMemoryFootprintTest : public ::testing::Test {
+ protected:
+  static const int32_t ENTRIES = 100;
+  static const int32_t VALUE_BYTES = 1000;
+
+  void SetUp() override {
+    m_cache = CacheFactory::createCacheFactory()
+                  ->set("log-level", "none")
+                  ->create();
+  }
+
+  void TearDown() override { m_cache->close(); }
+
+  void putEntries(const std::shared_ptr<Region>& region) {
+    std::vector<uint8_t> bytes(VALUE_BYTES, 0x5a);
+    for (int32_t i = 0; i < ENTRIES; i++) {
+      region->put(CacheableInt32::create(i),
+                  CacheableBytes::create(bytes.data(), VALUE_BYTES));
+    }
+  }
+
+  static int64_t keyBytes() { return CacheableInt32::create(0)->objectSize(); }
+
+  static int64_t valueBytes() {
+    std::vector<uint8_t> bytes(VALUE_BYTES, 0x5a);
+    return CacheableBytes::create(bytes.data(), VALUE_BYTES)->objectSize();
+  }
+
+  std::shared_ptr<Cache> m_cache;
+};
+
+const int32_t RegionMemoryFootprintTest::ENTRIES;
+const int32_t RegionMemoryFootprintTest::VALUE_BYTES;
+
+}  // namespace
+
+TEST_F(RegionMemoryFootprintTest, EmptyRegionHasNoEntries) {
+  auto region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL).create("empty");
+
+  auto footprint = region->getMemoryFootprint();
+
+  EXPECT_EQ(0, footprint.getEntryCount());
+  EXPECT_EQ(0, footprint.getKeyBytes());
+  EXPECT_EQ(0, footprint.getValueBytes());
+  EXPECT_EQ(0, footprint.getTombstoneCount());
+  EXPECT_EQ(0, footprint.getExpiryTaskCount());
+  EXPECT_EQ(0, footprint.getLRUListBytes());
+  EXPECT_EQ(0, footprint.getHeapLRUEstimateBytes());
+}
+
+TEST_F(RegionMemoryFootprintTest, WalkSizesKeysAndValues) {
+  auto region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL).create("walked");
+  putEntries(region);
+
+  auto footprint = region->getMemoryFootprint();
+
+  EXPECT_EQ(ENTRIES, footprint.getEntryCount());
+  EXPECT_EQ(ENTRIES * keyBytes(), footprint.getKeyBytes());
+  EXPECT_EQ(ENTRIES * valueBytes(), footprint.getValueBytes());
+  EXPECT_GT(footprint.getEntryOverheadBytes(), 0);
+  EXPECT_GE(footprint.getPooledBytes(), 0);
+  EXPECT_EQ(footprint.getKeyBytes() + footprint.getValueBytes() +
+                footprint.getEntryOverheadBytes() +
+                footprint.getTombstoneBytes() +
+                footprint.getExpiryTaskBytes() +
+                footprint.getLRUListBytes() + footprint.getPooledBytes(),
+            footprint.getTotalBytes());
+}
+
+TEST_F(RegionMemoryFootprintTest, WalkSkipsDestroyedEntries) {
+  auto region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL).create("destroyed");
+  putEntries(region);
+  for (int32_t i = 0; i < ENTRIES / 2; i++) {
+    region->localDestroy(CacheableInt32::create(i));
+  }
+
+  auto footprint = region->getMemoryFootprint();
+
+  EXPECT_EQ(ENTRIES / 2, footprint.getEntryCount());
+  EXPECT_EQ(ENTRIES / 2 * valueBytes(), footprint.getValueBytes());
+}
+
+TEST_F(RegionMemoryFootprintTest, WalkCountsExpiryTasks) {
+  auto region = m_cache->createRegionFactory(RegionShortcut::LOCAL)
+                    .setEntryTimeToLive(ExpirationAction::LOCAL_DESTROY,
+                                        std::chrono::seconds(3600))
+                    .create("expiring");
+  putEntries(region);
+
+  auto footprint = region->getMemoryFootprint();
+
+  EXPECT_EQ(ENTRIES, footprint.getExpiryTaskCount());
+  EXPECT_GT(footprint.getExpiryTaskBytes(), 0);
+}
+
+TEST_F(RegionMemoryFootprintTest, CountsLRUListNodes) {
+  auto region = m_cache->createRegionFactory(RegionShortcut::LOCAL)
+                    .setLruEntriesLimit(2 * ENTRIES)
+                    .create("lru");
+  putEntries(region);
+
+  auto footprint = region->getMemoryFootprint();
+
+  EXPECT_EQ(ENTRIES, footprint.getEntryCount());
+  EXPECT_GT(footprint.getLRUListBytes(), 0);
+}
+
+TEST_F(RegionMemoryFootprintTest, PublishesGaugesWhenMeasured) {
+  auto region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL).create("gauges");
+  putEntries(region);
+  auto stats = dynamic_cast<LocalRegion*>(region.get())
+                   ->getRegionStats()
+                   ->getStat();
+  char totalName[] = "footprintTotalBytes";
+  char keyName[] = "footprintKeyBytes";
+  char valueName[] = "footprintValueBytes";
+
+  // the gauges are only set by a measurement
+  EXPECT_EQ(0, stats->getLong(totalName));
+
+  auto footprint = region->getMemoryFootprint();
+
+  EXPECT_EQ(footprint.getTotalBytes(), stats->getLong(totalName));
+  EXPECT_EQ(footprint.getKeyBytes(), stats->getLong(keyName));
+  EXPECT_EQ(footprint.getValueBytes(), stats->getLong(valueName));
+}
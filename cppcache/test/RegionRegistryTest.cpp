@@ -0,0 +1,181 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/RegionFactory.hpp>
+
+#include "RegionRegistry.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class RegionRegistryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_cache = CacheFactory::createCacheFactory()
+                  ->set("log-level", "none")
+                  ->create();
+  }
+
+  void TearDown() override { m_cache->close(); }
+
+  std::shared_ptr<Region> createRegion(const char* name) {
+    return m_cache->createRegionFactory(RegionShortcut::LOCAL).create(name);
+  }
+
+  std::shared_ptr<Region> find(const char* path) const {
+    return m_registry.find(path, std::strlen(path));
+  }
+
+  std::shared_ptr<Cache> m_cache;
+  RegionRegistry m_registry;
+};
+
+}  // namespace
+
+TEST_F(RegionRegistryTest, FindsRegionsWithAndWithoutLeadingSlash) {
+  auto root = createRegion("root");
+  auto sub = root->createSubregion("sub", root->getAttributes());
+  m_registry.add(root);
+  m_registry.add(sub);
+
+  EXPECT_EQ(root, find("/root"));
+  EXPECT_EQ(root, find("root"));
+  EXPECT_EQ(sub, find("/root/sub"));
+  EXPECT_EQ(sub, find("root/sub"));
+  EXPECT_EQ(nullptr, find("/sub"));
+  EXPECT_EQ(nullptr, find("/root/"));
+  EXPECT_EQ(nullptr, find("/"));
+  EXPECT_EQ(nullptr, find(""));
+}
+
+TEST_F(RegionRegistryTest, FindsByLengthNotTerminator) {
+  auto root = createRegion("root");
+  m_registry.add(root);
+
+  const char* path = "/root/sub";
+  EXPECT_EQ(root, m_registry.find(path, 5));
+  EXPECT_EQ(nullptr, m_registry.find(path, 4));
+}
+
+TEST_F(RegionRegistryTest, AddReplacesRegionAtSamePath) {
+  auto first = createRegion("replaced");
+  m_registry.add(first);
+  first->localDestroyRegion();
+  auto second = createRegion("replaced");
+
+  m_registry.add(second);
+
+  EXPECT_EQ(second, find("/replaced"));
+  // the replaced region no longer holds the path
+  m_registry.remove(first.get());
+  EXPECT_EQ(second, find("/replaced"));
+}
+
+TEST_F(RegionRegistryTest, RemoveIgnoresRegionItDoesNotHold) {
+  auto held = createRegion("held");
+  auto other = createRegion("other");
+  m_registry.add(held);
+
+  m_registry.remove(other.get());
+  EXPECT_EQ(held, find("/held"));
+
+  m_registry.remove(held.get());
+  EXPECT_EQ(nullptr, find("/held"));
+  m_registry.remove(held.get());
+  EXPECT_EQ(nullptr, find("/held"));
+}
+
+TEST_F(RegionRegistryTest, ClearRemovesAllRegions) {
+  std::vector<std::shared_ptr<Region>> regions;
+  for (int i = 0; i < 20; i++) {
+    regions.push_back(createRegion(("region" + std::to_string(i)).c_str()));
+    m_registry.add(regions.back());
+  }
+  EXPECT_EQ(regions[7], find("/region7"));
+
+  m_registry.clear();
+
+  for (int i = 0; i < 20; i++) {
+    EXPECT_EQ(nullptr, find(("/region" + std::to_string(i)).c_str()));
+  }
+  m_registry.add(regions[3]);
+  EXPECT_EQ(regions[3], find("/region3"));
+}
+
+TEST_F(RegionRegistryTest, ConcurrentFindsSeeConsistentTables) {
+  std::vector<std::shared_ptr<Region>> stable;
+  for (int i = 0; i < 50; i++) {
+    stable.push_back(createRegion(("stable" + std::to_string(i)).c_str()));
+    m_registry.add(stable.back());
+  }
+  std::vector<std::shared_ptr<Region>> churn;
+  for (int i = 0; i < 10; i++) {
+    churn.push_back(createRegion(("churn" + std::to_string(i)).c_str()));
+  }
+
+  std::atomic<bool> done(false);
+  // a stable region must always be found, and a churning one is either
+  // missing or found as itself
+  std::atomic<int> misses(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.emplace_back([&, t]() {
+      int i = t;
+      while (!done) {
+        auto path = "/stable" + std::to_string(i % 50);
+        if (m_registry.find(path.data(), path.length()) != stable[i % 50]) {
+          ++misses;
+        }
+        auto churnPath = "churn" + std::to_string(i % 10);
+        auto found = m_registry.find(churnPath.data(), churnPath.length());
+        if (found != nullptr && found != churn[i % 10]) {
+          ++misses;
+        }
+        i++;
+      }
+    });
+  }
+
+  for (int round = 0; round < 200; round++) {
+    for (const auto& region : churn) {
+      m_registry.add(region);
+    }
+    for (const auto& region : churn) {
+      m_registry.remove(region.get());
+    }
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(0, misses);
+  for (int i = 0; i < 50; i++) {
+    EXPECT_EQ(stable[i], find(("/stable" + std::to_string(i)).c_str()));
+  }
+  EXPECT_EQ(nullptr, find("/churn0"));
+}
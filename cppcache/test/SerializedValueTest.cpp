@@ -0,0 +1,212 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheFactory.hpp>
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/DataOutput.hpp>
+#include <geode/DeflateCompressor.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/RegionFactory.hpp>
+
+#include "CompressedEntriesMap.hpp"
+#include "LocalRegion.hpp"
+#include "MapSegment.hpp"
+#include "SerializedValue.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class SerializedValueTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_cache = CacheFactory::createCacheFactory()
+                  ->set("log-level", "none")
+                  ->create();
+  }
+
+  void TearDown() override { m_cache->close(); }
+
+  // the value as it would arrive in a subscription update
+  std::shared_ptr<SerializedValue> serialize(
+      const std::shared_ptr<Cacheable>& value) {
+    auto output = m_cache->createDataOutput();
+    output->writeObject(value);
+    return std::make_shared<SerializedValue>(
+        output->getBuffer(), static_cast<int32_t>(output->getBufferLength()));
+  }
+
+  CompressedEntriesMap* entriesOf(const std::shared_ptr<Region>& region) {
+    auto localRegion = dynamic_cast<LocalRegion*>(region.get());
+    EXPECT_NE(nullptr, localRegion);
+    return dynamic_cast<CompressedEntriesMap*>(localRegion->getEntryMap());
+  }
+
+  // store value in the map as the subscription channel does
+  void putStored(CompressedEntriesMap* entries,
+                 const std::shared_ptr<CacheableKey>& key,
+                 const std::shared_ptr<Cacheable>& value) {
+    std::shared_ptr<MapEntryImpl> me;
+    std::shared_ptr<Cacheable> oldValue;
+    ASSERT_EQ(GF_NOERR,
+              entries->put(key, value, me, oldValue, -1, 0, nullptr));
+  }
+
+  static std::shared_ptr<Cacheable> stored(
+      CompressedEntriesMap* entries, const std::shared_ptr<CacheableKey>& key) {
+    std::shared_ptr<MapEntryImpl> me;
+    std::shared_ptr<Cacheable> value;
+    entries->getEntriesMap()->getEntry(key, me, value);
+    return value;
+  }
+
+  static std::string toString(const std::shared_ptr<Cacheable>& value) {
+    auto string = std::dynamic_pointer_cast<CacheableString>(value);
+    EXPECT_NE(nullptr, string);
+    return string == nullptr ? "" : string->asChar();
+  }
+
+  std::shared_ptr<Cache> m_cache;
+};
+
+}  // namespace
+
+TEST_F(SerializedValueTest, DeserializeRoundTrips) {
+  auto value = serialize(CacheableString::create("a subscription value"));
+  EXPECT_EQ("a subscription value",
+            toString(value->deserialize(*m_cache, nullptr)));
+
+  auto number = std::dynamic_pointer_cast<CacheableInt32>(
+      serialize(CacheableInt32::create(-42))->deserialize(*m_cache, nullptr));
+  ASSERT_NE(nullptr, number);
+  EXPECT_EQ(-42, number->value());
+}
+
+TEST_F(SerializedValueTest, ToObjectDeserializesOnlySerializedValues) {
+  auto plain = CacheableString::create("plain");
+  EXPECT_EQ(plain, SerializedValue::toObject(plain, *m_cache, nullptr));
+  EXPECT_EQ(nullptr, SerializedValue::toObject(nullptr, *m_cache, nullptr));
+
+  auto value = SerializedValue::toObject(serialize(plain), *m_cache, nullptr);
+  EXPECT_NE(plain, value);
+  EXPECT_EQ("plain", toString(value));
+}
+
+TEST_F(SerializedValueTest, ObjectSizeCountsTheBytes) {
+  auto small = serialize(CacheableString::create("x"));
+  std::string text(1000, 'x');
+  auto large = serialize(CacheableString::create(text.c_str()));
+
+  EXPECT_GE(small->objectSize(),
+            sizeof(SerializedValue) + small->getBytes().size());
+  EXPECT_GE(large->objectSize(),
+            sizeof(SerializedValue) + large->getBytes().size());
+  EXPECT_GE(large->objectSize() - small->objectSize(), 999u);
+}
+
+TEST_F(SerializedValueTest, IsNeverSerializedAgain) {
+  auto value = serialize(CacheableString::create("value"));
+  auto output = m_cache->createDataOutput();
+  EXPECT_THROW(value->toData(*output), UnsupportedOperationException);
+}
+
+TEST_F(SerializedValueTest, RegionStoresSerializedAndDeserializesOnRead) {
+  std::shared_ptr<Region> region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL)
+          .setStoreSerialized(true)
+          .create("serialized");
+  auto entries = entriesOf(region);
+  ASSERT_NE(nullptr, entries);
+  auto key = CacheableString::create("key");
+
+  putStored(entries, key, serialize(CacheableString::create("value")));
+
+  EXPECT_EQ("value", toString(region->get(key)));
+  EXPECT_EQ("value", toString(region->getEntry(key)->getValue()));
+  // without keep-deserialized every read deserializes again
+  EXPECT_NE(nullptr,
+            std::dynamic_pointer_cast<SerializedValue>(stored(entries, key)));
+}
+
+TEST_F(SerializedValueTest, CompressesSerializedBytesAsTheyAre) {
+  std::shared_ptr<Region> region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL)
+          .setStoreSerialized(true)
+          .setCompressor(std::make_shared<DeflateCompressor>())
+          .create("compressed");
+  auto entries = entriesOf(region);
+  ASSERT_NE(nullptr, entries);
+  auto key = CacheableString::create("key");
+
+  std::string text(1000, 'v');
+  putStored(entries, key, serialize(CacheableString::create(text.c_str())));
+
+  auto value = stored(entries, key);
+  EXPECT_NE(nullptr, std::dynamic_pointer_cast<CompressedValue>(value));
+  EXPECT_LT(value->objectSize(), 1000u);
+  EXPECT_EQ(text, toString(region->get(key)));
+}
+
+TEST_F(SerializedValueTest, KeepDeserializedReplacesStoredBytesOnFirstGet) {
+  std::shared_ptr<Region> region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL)
+          .setStoreSerialized(true)
+          .setKeepDeserialized(true)
+          .create("kept");
+  auto entries = entriesOf(region);
+  ASSERT_NE(nullptr, entries);
+  auto key = CacheableString::create("key");
+  putStored(entries, key, serialize(CacheableString::create("value")));
+
+  auto first = region->get(key);
+
+  EXPECT_EQ("value", toString(first));
+  EXPECT_EQ(first, stored(entries, key));
+  EXPECT_EQ(first, region->get(key));
+}
+
+TEST_F(SerializedValueTest, ReplaceValueSkipsAnEntryThatChanged) {
+  std::shared_ptr<Region> region =
+      m_cache->createRegionFactory(RegionShortcut::LOCAL)
+          .setStoreSerialized(true)
+          .create("replaced");
+  auto entries = entriesOf(region);
+  ASSERT_NE(nullptr, entries);
+  auto key = CacheableString::create("key");
+  auto original = serialize(CacheableString::create("original"));
+  putStored(entries, key, original);
+  auto segment = entries->getEntriesMap()->segmentFor(key);
+
+  // an update arrived after the get read the original bytes
+  auto update = serialize(CacheableString::create("update"));
+  putStored(entries, key, update);
+  EXPECT_FALSE(segment->replaceValue(
+      key, original, original->deserialize(*m_cache, nullptr)));
+  EXPECT_EQ(update, stored(entries, key));
+
+  auto deserialized = update->deserialize(*m_cache, nullptr);
+  EXPECT_TRUE(segment->replaceValue(key, update, deserialized));
+  EXPECT_EQ(deserialized, stored(entries, key));
+  EXPECT_FALSE(segment->replaceValue(CacheableString::create("missing"),
+                                     update, deserialized));
+}
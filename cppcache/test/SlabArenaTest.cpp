@@ -0,0 +1,108 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "SlabArena.hpp"
+
+using namespace apache::geode::client;
+
+TEST(SlabArenaTest, ReusesFreedBlocks) {
+  auto arena = new SlabArena();
+  void* first = arena->allocate(40);
+  void* second = arena->allocate(40);
+  EXPECT_NE(first, second);
+  auto reservedBytes = arena->getReservedBytes();
+  EXPECT_GE(reservedBytes, 80u);
+
+  arena->deallocate(first, 40);
+  EXPECT_EQ(first, arena->allocate(40));
+  EXPECT_EQ(reservedBytes, arena->getReservedBytes());
+
+  arena->deallocate(first, 40);
+  arena->deallocate(second, 40);
+  arena->release();
+}
+
+TEST(SlabArenaTest, OtherSizesComeFromTheHeap) {
+  auto arena = new SlabArena();
+  void* block = arena->allocate(24);
+  auto reservedBytes = arena->getReservedBytes();
+  void* larger = arena->allocate(4096);
+  EXPECT_EQ(reservedBytes, arena->getReservedBytes());
+  arena->deallocate(larger, 4096);
+  arena->deallocate(block, 24);
+  arena->release();
+}
+
+TEST(SlabArenaTest, CountsUsedSlabBlocksOnly) {
+  auto arena = new SlabArena();
+  void* first = arena->allocate(40);
+  void* second = arena->allocate(40);
+  void* larger = arena->allocate(4096);
+  auto usedBytes = arena->getUsedBytes();
+  EXPECT_GE(usedBytes, 80u);
+  EXPECT_LE(usedBytes, arena->getReservedBytes());
+
+  arena->deallocate(larger, 4096);
+  EXPECT_EQ(usedBytes, arena->getUsedBytes());
+  arena->deallocate(first, 40);
+  EXPECT_EQ(usedBytes / 2, arena->getUsedBytes());
+  arena->deallocate(second, 40);
+  EXPECT_EQ(0u, arena->getUsedBytes());
+  arena->release();
+}
+
+TEST(SlabArenaTest, SharedObjectsOutliveTheRelease) {
+  auto arena = new SlabArena();
+  auto value = std::allocate_shared<std::string>(
+      SlabAllocator<std::string>(arena), "outlives the owner");
+  arena->release();
+  EXPECT_EQ("outlives the owner", *value);
+  // the arena goes with the last of its blocks
+  value.reset();
+}
+
+TEST(SlabArenaTest, BlocksMayBeFreedByAnyThread) {
+  auto arena = new SlabArena();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([arena] {
+      std::vector<std::shared_ptr<int64_t>> values;
+      for (int64_t i = 0; i < 10000; i++) {
+        values.push_back(std::allocate_shared<int64_t>(
+            SlabAllocator<int64_t>(arena), i));
+      }
+      std::set<int64_t*> distinct;
+      for (int64_t i = 0; i < 10000; i++) {
+        EXPECT_EQ(i, *values[i]);
+        distinct.insert(values[i].get());
+      }
+      EXPECT_EQ(10000u, distinct.size());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  arena->release();
+}
@@ -0,0 +1,137 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "statistics/StatArchiveFile.hpp"
+
+using apache::geode::client::GeodeIOException;
+using apache::geode::statistics::StatArchiveFile;
+
+namespace {
+
+std::vector<uint8_t> readFile(const std::string& filename) {
+  std::ifstream in(filename, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(in),
+                              std::istreambuf_iterator<char>());
+}
+
+std::vector<uint8_t> writeSamples(const std::string& filename) {
+  std::remove(filename.c_str());
+  std::vector<uint8_t> expected;
+  StatArchiveFile file(filename);
+  for (int32_t sample = 0; sample < 2000; sample++) {
+    std::vector<uint8_t> bytes;
+    for (int32_t i = 0; i < 100; i++) {
+      bytes.push_back(static_cast<uint8_t>((sample + i) % 7));
+    }
+    file.write(bytes.data(), bytes.size());
+    file.flush();
+    expected.insert(expected.end(), bytes.begin(), bytes.end());
+  }
+  file.close();
+  EXPECT_EQ(static_cast<int64_t>(readFile(filename).size()),
+            file.getBytesWritten());
+  return expected;
+}
+
+}  // namespace
+
+TEST(StatArchiveFileTest, CompressedNames) {
+  EXPECT_TRUE(StatArchiveFile::isCompressedName("stats.gfs.gz"));
+  EXPECT_FALSE(StatArchiveFile::isCompressedName("stats.gfs"));
+  EXPECT_FALSE(StatArchiveFile::isCompressedName(".gz"));
+}
+
+TEST(StatArchiveFileTest, UncompressedArchiveIsWrittenAsIs) {
+  std::string filename("StatArchiveFileTest.gfs");
+  auto expected = writeSamples(filename);
+  EXPECT_EQ(expected, readFile(filename));
+  std::remove(filename.c_str());
+}
+
+TEST(StatArchiveFileTest, CompressedArchiveDecodes) {
+  if (!StatArchiveFile::isCompressionSupported()) {
+    return;
+  }
+  std::string filename("StatArchiveFileTest.gfs.gz");
+  std::string decoded("StatArchiveFileTest-decoded.gfs");
+  auto expected = writeSamples(filename);
+
+  // 2000 samples span several blocks, each a gzip member of its own.
+  EXPECT_LT(readFile(filename).size(), expected.size() / 4);
+  StatArchiveFile::decode(filename, decoded);
+  EXPECT_EQ(expected, readFile(decoded));
+  std::remove(filename.c_str());
+  std::remove(decoded.c_str());
+}
+
+TEST(StatArchiveFileTest, CompressedNameWithoutZlibWritesPlainArchive) {
+  if (StatArchiveFile::isCompressionSupported()) {
+    return;
+  }
+  std::string filename("StatArchiveFileTest-plain.gfs");
+  std::remove(filename.c_str());
+  std::vector<uint8_t> sample(100, 1);
+  {
+    StatArchiveFile file(filename + StatArchiveFile::COMPRESSED_EXT);
+    EXPECT_FALSE(file.isCompressed());
+    EXPECT_EQ(filename, file.getFilename());
+    file.write(sample.data(), sample.size());
+    file.close();
+  }
+  EXPECT_EQ(sample, readFile(filename));
+  std::remove(filename.c_str());
+}
+
+TEST(StatArchiveFileTest, DropsSamplesBeyondTheQueueLimit) {
+  std::string filename("StatArchiveFileTest-dropped.gfs");
+  std::remove(filename.c_str());
+  std::vector<uint8_t> sample(600, 1);
+  StatArchiveFile file(filename, 1000);
+
+  // nothing is written until a flush, so the second sample overflows
+  file.write(sample.data(), sample.size());
+  file.write(sample.data(), sample.size());
+  file.write(sample.data(), 10);
+  EXPECT_EQ(2, file.getDroppedWrites());
+
+  // once the queue is written out the archive can not be continued
+  file.flush();
+  bool thrown = false;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!thrown && std::chrono::steady_clock::now() < deadline) {
+    try {
+      file.write(sample.data(), 1);
+    } catch (const GeodeIOException&) {
+      thrown = true;
+    }
+  }
+  EXPECT_TRUE(thrown);
+  file.close();
+  EXPECT_EQ(sample.size(), readFile(filename).size());
+  std::remove(filename.c_str());
+}
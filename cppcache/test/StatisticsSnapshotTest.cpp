@@ -0,0 +1,105 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "statistics/MetricsExporter.hpp"
+#include "statistics/StatisticsManager.hpp"
+
+using apache::geode::statistics::MetricsExporter;
+using apache::geode::statistics::StatisticDescriptor;
+using apache::geode::statistics::StatisticsManager;
+using apache::geode::statistics::StatisticsSnapshot;
+
+namespace {
+
+const StatisticsSnapshot::Instance* findInstance(
+    const StatisticsSnapshot& snapshot, const std::string& typeName) {
+  for (const auto& instance : snapshot.getInstances()) {
+    if (instance.getTypeName() == typeName) {
+      return &instance;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(StatisticsSnapshotTest, SnapshotsHaveDeltasAndRenderAsOpenMetrics) {
+  StatisticsManager manager("statArchive.gfs", std::chrono::seconds(1), false,
+                            nullptr, "", std::chrono::seconds(0));
+  auto factory = manager.getStatisticsFactory();
+  StatisticDescriptor* descriptors[] = {
+      factory->createIntCounter("puts", "Number of puts", "operations", true),
+      factory->createLongGauge("entries", "Number of entries", "entries",
+                               true),
+      factory->createLongHistogram("putLatency", "Latency of puts",
+                                   "nanoseconds", false)};
+  auto type = factory->createType("SnapshotTestStats", "Snapshot test stats",
+                                  descriptors, 3);
+  auto stats = factory->createAtomicStatistics(type, "region \"A\"", 7);
+  auto putsId = stats->nameToId("puts");
+  auto entriesId = stats->nameToId("entries");
+  auto latencyId = stats->nameToId("putLatency");
+
+  stats->incInt(putsId, 5);
+  stats->setLong(entriesId, 3);
+  stats->recordValue(latencyId, 100);
+  auto first = manager.getSnapshot();
+  auto instance = findInstance(first, "SnapshotTestStats");
+  ASSERT_NE(nullptr, instance);
+  ASSERT_EQ(3u, instance->getValues().size());
+  EXPECT_EQ(5, instance->getValues()[0].getValue());
+  EXPECT_EQ(5, instance->getValues()[0].getDelta());
+  EXPECT_EQ(StatisticsSnapshot::Value::COUNTER,
+            instance->getValues()[0].getKind());
+  EXPECT_EQ(StatisticsSnapshot::Value::GAUGE,
+            instance->getValues()[1].getKind());
+  EXPECT_EQ(1, instance->getValues()[2].getValue());
+  EXPECT_EQ(100, instance->getValues()[2].getSum());
+
+  stats->incInt(putsId, 2);
+  stats->setLong(entriesId, 1);
+  auto second = manager.getSnapshot();
+  instance = findInstance(second, "SnapshotTestStats");
+  ASSERT_NE(nullptr, instance);
+  EXPECT_EQ(7, instance->getValues()[0].getValue());
+  EXPECT_EQ(2, instance->getValues()[0].getDelta());
+  EXPECT_EQ(-2, instance->getValues()[1].getDelta());
+  EXPECT_EQ(0, instance->getValues()[2].getDelta());
+
+  auto text = MetricsExporter::render(second);
+  const std::string labels = "{text_id=\"region \\\"A\\\"\",numeric_id=\"7\"}";
+  EXPECT_NE(std::string::npos,
+            text.find("# TYPE geode_SnapshotTestStats_puts counter\n"
+                      "# HELP geode_SnapshotTestStats_puts Number of puts\n"
+                      "geode_SnapshotTestStats_puts_total" +
+                      labels + " 7\n"));
+  EXPECT_NE(std::string::npos,
+            text.find("geode_SnapshotTestStats_entries" + labels + " 1\n"));
+  EXPECT_NE(std::string::npos,
+            text.find("# TYPE geode_SnapshotTestStats_putLatency summary\n"));
+  EXPECT_NE(std::string::npos,
+            text.find("geode_SnapshotTestStats_putLatency_count" + labels +
+                      " 1\n"));
+  EXPECT_EQ("# EOF\n", text.substr(text.length() - 6));
+
+  stats->close();
+}
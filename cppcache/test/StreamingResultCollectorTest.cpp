@@ -0,0 +1,133 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/StreamingResultCollector.hpp>
+
+using namespace apache::geode::client;
+
+namespace {
+int32_t valueOf(const std::shared_ptr<Cacheable>& result) {
+  return std::dynamic_pointer_cast<CacheableInt32>(result)->value();
+}
+}  // namespace
+
+TEST(StreamingResultCollectorTest, NextReadsResultsFromSeveralProducers) {
+  StreamingResultCollector rc;
+  std::vector<std::thread> producers;
+  for (int32_t p = 0; p < 4; p++) {
+    producers.emplace_back([&rc, p]() {
+      for (int32_t i = 0; i < 1000; i++) {
+        rc.addResult(CacheableInt32::create(p * 1000 + i));
+      }
+    });
+  }
+  std::thread ender([&rc, &producers]() {
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    rc.endResults();
+  });
+
+  std::vector<bool> seen(4000, false);
+  std::shared_ptr<Cacheable> result;
+  int32_t count = 0;
+  while (rc.next(result)) {
+    auto value = valueOf(result);
+    EXPECT_FALSE(seen[value]);
+    seen[value] = true;
+    count++;
+  }
+  ender.join();
+  EXPECT_EQ(4000, count);
+  EXPECT_EQ(0, rc.getResult()->size());
+}
+
+TEST(StreamingResultCollectorTest, GetResultReturnsUnreadResults) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+  rc.addResult(CacheableInt32::create(2));
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+  EXPECT_EQ(1, valueOf(result));
+  rc.endResults();
+  auto results = rc.getResult();
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ(2, valueOf((*results)[0]));
+}
+
+TEST(StreamingResultCollectorTest, ClearDiscardsQueuedResults) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+  rc.clearResults();
+  rc.addResult(CacheableInt32::create(2));
+  rc.endResults();
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+  EXPECT_EQ(2, valueOf(result));
+  EXPECT_FALSE(rc.next(result));
+}
+
+TEST(StreamingResultCollectorTest, NextTimesOut) {
+  StreamingResultCollector rc;
+  std::shared_ptr<Cacheable> result;
+  EXPECT_THROW(rc.next(result, std::chrono::milliseconds(10)),
+               FunctionExecutionException);
+}
+
+TEST(StreamingResultCollectorTest, ListenerSeesEachResult) {
+  std::atomic<int32_t> sum(0);
+  auto rc = StreamingResultCollector::withListener(
+      [&sum](const std::shared_ptr<Cacheable>& result) {
+        sum += valueOf(result);
+      });
+  rc->addResult(CacheableInt32::create(3));
+  rc->addResult(CacheableInt32::create(4));
+  EXPECT_EQ(7, sum.load());
+  rc->endResults();
+  EXPECT_EQ(0, rc->getResult()->size());
+  std::shared_ptr<Cacheable> result;
+  EXPECT_THROW(rc->next(result), IllegalStateException);
+}
+
+TEST(StreamingResultCollectorTest, ReducerCombinesResultsOfAllThreads) {
+  auto rc = StreamingResultCollector::withReducer(
+      [](const std::shared_ptr<Cacheable>& a,
+         const std::shared_ptr<Cacheable>& b) -> std::shared_ptr<Cacheable> {
+        return CacheableInt32::create(valueOf(a) + valueOf(b));
+      });
+  std::vector<std::thread> producers;
+  for (int32_t p = 0; p < 4; p++) {
+    producers.emplace_back([&rc]() {
+      for (int32_t i = 1; i <= 100; i++) {
+        rc->addResult(CacheableInt32::create(i));
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  rc->endResults();
+  auto results = rc->getResult();
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ(4 * 5050, valueOf((*results)[0]));
+}
@@ -21,6 +21,7 @@
 
 #include <geode/CqState.hpp>
 #include <geode/CacheFactory.hpp>
+#include <geode/RegionFactory.hpp>
 #include <TcrMessage.hpp>
 #include "ByteArrayFixture.hpp"
 
@@ -713,4 +714,51 @@ TEST_F(TcrMessageTest, testConstructorEXECUTECQ_WITH_IR_MSG_TYPE) {
       testMessage);
 }
 
+TEST_F(TcrMessageTest, parallelPutAllEncodingMatchesSequential) {
+  auto cache = CacheFactory::createCacheFactory()
+                   ->set("log-level", "none")
+                   ->create();
+  auto region = cache->createRegionFactory(RegionShortcut::LOCAL)
+                    .create("putAllRegion");
+
+  HashMapOfCacheable map;
+  for (int32_t i = 0; i < 2048; i++) {
+    map.emplace(CacheableInt32::create(i),
+                CacheableString::create(("value" + std::to_string(i)).c_str()));
+  }
+
+  // an output without a cache is encoded sequentially, one of the cache in
+  // batches on its thread pool
+  TcrMessagePutAll sequential(
+      std::unique_ptr<DataOutputUnderTest>(new DataOutputUnderTest()),
+      region.get(), map, std::chrono::milliseconds(-1),
+      static_cast<ThinClientBaseDM *>(nullptr), nullptr);
+  TcrMessagePutAll parallel(cache->createDataOutput(), region.get(), map,
+                            std::chrono::milliseconds(-1),
+                            static_cast<ThinClientBaseDM *>(nullptr), nullptr);
+
+  ASSERT_EQ(sequential.getMsgLength(), parallel.getMsgLength());
+
+  // the event id parts differ by sequence number, so compare from the first
+  // entry part, after the header and the region, event id, flags and count
+  auto data = reinterpret_cast<const uint8_t *>(sequential.getMsgData());
+  std::size_t offset = 17;
+  for (int part = 0; part < 5; part++) {
+    uint32_t length = (static_cast<uint32_t>(data[offset]) << 24) |
+                      (static_cast<uint32_t>(data[offset + 1]) << 16) |
+                      (static_cast<uint32_t>(data[offset + 2]) << 8) |
+                      static_cast<uint32_t>(data[offset + 3]);
+    offset += 5 + length;
+  }
+  ASSERT_LT(offset, static_cast<std::size_t>(sequential.getMsgLength()));
+
+  std::string sequentialEntries(sequential.getMsgData() + offset,
+                                sequential.getMsgLength() - offset);
+  std::string parallelEntries(parallel.getMsgData() + offset,
+                              parallel.getMsgLength() - offset);
+  EXPECT_TRUE(sequentialEntries == parallelEntries);
+
+  cache->close();
+}
+
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,239 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ThinClientRedundancyManager.hpp"
+
+using namespace apache::geode::client;
+
+namespace {
+
+class RecoveringRedundancyManager : public ThinClientRedundancyManager {
+ public:
+  RecoveringRedundancyManager(size_t concurrency, bool inBackground)
+      : ThinClientRedundancyManager(nullptr), m_concurrency(concurrency) {
+    m_recoveringInBackground = inBackground;
+  }
+
+ protected:
+  size_t getRecoveryConcurrency() const override { return m_concurrency; }
+
+ private:
+  size_t m_concurrency;
+};
+
+// lets tasks wait, up to a bound, until a number of them run at once
+class Rendezvous {
+ public:
+  explicit Rendezvous(size_t parties) : m_parties(parties), m_arrived(0) {}
+
+  bool arriveAndWait() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_arrived++;
+    m_changed.notify_all();
+    return m_changed.wait_for(lock, std::chrono::seconds(10),
+                              [this]() { return m_arrived >= m_parties; });
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_changed;
+  size_t m_parties;
+  size_t m_arrived;
+};
+
+}  // namespace
+
+TEST(ThinClientRedundancyManagerTest, RunsTasksInOrderWhenNotInBackground) {
+  RecoveringRedundancyManager manager(4, false);
+  std::vector<int> order;
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks;
+  for (int i = 0; i < 8; i++) {
+    tasks.push_back([&order, i]() {
+      order.push_back(i);
+      return GF_NOERR;
+    });
+  }
+
+  EXPECT_EQ(GF_NOERR, manager.runRecoveryTasks(tasks));
+
+  EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}), order);
+}
+
+TEST(ThinClientRedundancyManagerTest, RunsTasksOnCallerWhenNotInBackground) {
+  RecoveringRedundancyManager manager(4, false);
+  auto caller = std::this_thread::get_id();
+  std::atomic<int> elsewhere(0);
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks(
+      8, [&]() {
+        if (std::this_thread::get_id() != caller) {
+          elsewhere++;
+        }
+        return GF_NOERR;
+      });
+
+  EXPECT_EQ(GF_NOERR, manager.runRecoveryTasks(tasks));
+
+  EXPECT_EQ(0, elsewhere);
+}
+
+TEST(ThinClientRedundancyManagerTest, RunsTasksInParallelInBackground) {
+  RecoveringRedundancyManager manager(3, true);
+  Rendezvous rendezvous(3);
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  std::atomic<int> met(0);
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks(3, [&]() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      threads.insert(std::this_thread::get_id());
+    }
+    if (rendezvous.arriveAndWait()) {
+      met++;
+    }
+    return GF_NOERR;
+  });
+
+  EXPECT_EQ(GF_NOERR, manager.runRecoveryTasks(tasks));
+
+  EXPECT_EQ(3, met);
+  EXPECT_EQ(3u, threads.size());
+}
+
+TEST(ThinClientRedundancyManagerTest, ConcurrencyOfOneStaysOnCaller) {
+  RecoveringRedundancyManager manager(1, true);
+  auto caller = std::this_thread::get_id();
+  std::atomic<int> elsewhere(0);
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks(
+      8, [&]() {
+        if (std::this_thread::get_id() != caller) {
+          elsewhere++;
+        }
+        return GF_NOERR;
+      });
+
+  EXPECT_EQ(GF_NOERR, manager.runRecoveryTasks(tasks));
+
+  EXPECT_EQ(0, elsewhere);
+}
+
+TEST(ThinClientRedundancyManagerTest, ReturnsFirstError) {
+  RecoveringRedundancyManager manager(4, false);
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks{
+      []() { return GF_NOERR; }, []() { return GF_TIMOUT; },
+      []() { return GF_NOTCON; }, []() { return GF_NOERR; }};
+
+  EXPECT_EQ(GF_TIMOUT, manager.runRecoveryTasks(tasks));
+}
+
+TEST(ThinClientRedundancyManagerTest, ReturnsErrorOfAnyTaskInBackground) {
+  RecoveringRedundancyManager manager(4, true);
+  std::atomic<int> ran(0);
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks;
+  for (int i = 0; i < 16; i++) {
+    tasks.push_back([&ran, i]() {
+      ran++;
+      return i == 11 ? GF_NOTCON : GF_NOERR;
+    });
+  }
+
+  EXPECT_EQ(GF_NOTCON, manager.runRecoveryTasks(tasks));
+  EXPECT_EQ(16, ran);
+}
+
+TEST(ThinClientRedundancyManagerTest, RethrowsOnceHelpersAreJoined) {
+  RecoveringRedundancyManager manager(3, true);
+  Rendezvous rendezvous(3);
+  std::atomic<int> running(0);
+  std::atomic<int> thrown(0);
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks(3, [&]() {
+    running++;
+    rendezvous.arriveAndWait();
+    // one task fails at once while the others are still busy
+    if (thrown++ == 0) {
+      running--;
+      throw std::runtime_error("recovery failed");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    running--;
+    return GF_NOERR;
+  });
+
+  EXPECT_THROW(manager.runRecoveryTasks(tasks), std::runtime_error);
+
+  EXPECT_EQ(0, running);
+  EXPECT_EQ(3, thrown);
+}
+
+TEST(ThinClientRedundancyManagerTest, HelpersActUnderTheCallersLock) {
+  RecoveringRedundancyManager manager(3, true);
+  Rendezvous rendezvous(3);
+  auto caller = std::this_thread::get_id();
+  std::atomic<int> helpers(0);
+  std::atomic<int> lockFree(0);
+  std::vector<ThinClientRedundancyManager::RecoveryTask> tasks(3, [&]() {
+    rendezvous.arriveAndWait();
+    if (std::this_thread::get_id() == caller) {
+      return GF_NOERR;
+    }
+    helpers++;
+    // a helper neither takes the lock nor releases it, so another thread
+    // can still acquire it meanwhile
+    manager.acquireRedundancyLock();
+    std::thread other([&]() {
+      if (manager.getRedundancyLock().tryacquire() == 0) {
+        lockFree++;
+        manager.getRedundancyLock().release();
+      }
+    });
+    other.join();
+    manager.releaseRedundancyLock();
+    return GF_NOERR;
+  });
+
+  EXPECT_EQ(GF_NOERR, manager.runRecoveryTasks(tasks));
+
+  EXPECT_EQ(2, helpers);
+  EXPECT_EQ(2, lockFree);
+}
+
+TEST(ThinClientRedundancyManagerTest, CallerTakesTheLockOutsideRecovery) {
+  RecoveringRedundancyManager manager(3, false);
+  std::atomic<int> lockFree(0);
+
+  manager.acquireRedundancyLock();
+  std::thread other([&]() {
+    if (manager.getRedundancyLock().tryacquire() == 0) {
+      lockFree++;
+      manager.getRedundancyLock().release();
+    }
+  });
+  other.join();
+  manager.releaseRedundancyLock();
+
+  EXPECT_EQ(0, lockFree);
+}
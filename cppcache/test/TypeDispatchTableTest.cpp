@@ -0,0 +1,53 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "SerializationRegistry.hpp"
+
+using namespace apache::geode::client;
+
+TEST(TypeDispatchTableTest, FindsWhatWasSet) {
+  TypeDispatchTable table;
+  TypeFactoryMethod first = []() -> Serializable* { return nullptr; };
+  TypeFactoryMethod second = []() -> Serializable* { return nullptr; };
+
+  EXPECT_EQ(nullptr, table.find(0));
+  EXPECT_EQ(nullptr, table.exchange(0, &first));
+  EXPECT_EQ(nullptr, table.exchange(0xfffffff0, &second));
+  EXPECT_EQ(&first, table.find(0));
+  EXPECT_EQ(&second, table.find(0xfffffff0));
+  EXPECT_EQ(nullptr, table.find(1));
+  EXPECT_EQ(nullptr, table.find(0x00010000));
+  EXPECT_EQ(nullptr, table.find(0xfffffff1));
+}
+
+TEST(TypeDispatchTableTest, ExchangeReturnsTheReplacedFactory) {
+  TypeDispatchTable table;
+  TypeFactoryMethod first = []() -> Serializable* { return nullptr; };
+  TypeFactoryMethod second = []() -> Serializable* { return nullptr; };
+
+  table.exchange(2133, &first);
+  EXPECT_EQ(&first, table.exchange(2133, &second));
+  EXPECT_EQ(&second, table.find(2133));
+  EXPECT_EQ(&second, table.exchange(2133, nullptr));
+  EXPECT_EQ(nullptr, table.find(2133));
+
+  table.exchange(7, &first);
+  table.clear();
+  EXPECT_EQ(nullptr, table.find(7));
+}
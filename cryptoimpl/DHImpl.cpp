@@ -189,6 +189,8 @@ void gf_clearDhKeys(void *dhCtx) {
     dhimpl->m_pubKeyOther = NULL;
   }
 
+  dhimpl->freeCipherContexts();
+
   memset(dhimpl->m_key, 0, 128);
 
   // EVP_cleanup();
@@ -281,6 +283,9 @@ void gf_computeSharedSecret(void *dhCtx) {
       DH_compute_key(dhimpl->m_key, dhimpl->m_pubKeyOther, dhimpl->m_dh);
   LOGDH("DHcomputeKey ret %d : Compute err(%d): %s", ret, ERR_get_error(),
         ERR_error_string(ERR_get_error(), NULL));
+
+  // the key schedule is set up once here rather than for every message
+  dhimpl->initCipherContexts();
 }
 
 int DHImpl::setSkAlgo(const char *skalgo) {
@@ -353,140 +358,167 @@ const EVP_CIPHER *DHImpl::getCipherFunc() {
   }
 }
 
-unsigned char *gf_encryptDH(void *dhCtx, const unsigned char *cleartext,
-                            int len, int *retLen) {
-  DHImpl *dhimpl = reinterpret_cast<DHImpl *>(dhCtx);
+const unsigned char *DHImpl::getIv() const {
+  if (m_skAlgo == "DESede") {
+    return m_key + 24;
+  }
+  return m_key + (m_keySize > 128 ? m_keySize / 8 : 16);
+}
 
-  // Validation
-  if (cleartext == NULL || len < 1 || retLen == NULL) {
-    return NULL;
+bool DHImpl::initCipherContexts() {
+  freeCipherContexts();
+
+  const EVP_CIPHER *cipherFunc = getCipherFunc();
+  if (cipherFunc == NULL) {
+    return false;
   }
 
-  LOGDH(" DH: gf_encryptDH using sk algo: %s, Keysize: %d",
-        dhimpl->m_skAlgo.c_str(), dhimpl->m_keySize);
+  m_encryptCtx = EVP_CIPHER_CTX_new();
+  m_decryptCtx = EVP_CIPHER_CTX_new();
+  EVP_CIPHER_CTX *contexts[] = {m_decryptCtx, m_encryptCtx};
+  for (int enc = 0; enc < 2; enc++) {
+    EVP_CIPHER_CTX *ctx = contexts[enc];
+    int ret = -123;
+    if (m_skAlgo == "Blowfish") {
+      // the key length has to be set before the key
+      int keySize = m_keySize > 128 ? m_keySize / 8 : 16;
+      ret = EVP_CipherInit_ex(ctx, cipherFunc, NULL, NULL, NULL, enc);
+      LOGDH("DHinit: init BF ret %d", ret);
+      EVP_CIPHER_CTX_set_key_length(ctx, keySize);
+      LOGDH("DHinit: BF keysize is %d", keySize);
+      ret = EVP_CipherInit_ex(ctx, NULL, NULL, m_key, getIv(), enc);
+    } else {
+      ret = EVP_CipherInit_ex(ctx, cipherFunc, NULL, m_key, getIv(), enc);
+    }
+    LOGDH(" DHinit: init ret %d", ret);
+    if (ret != 1) {
+      freeCipherContexts();
+      return false;
+    }
+  }
+  return true;
+}
 
-  unsigned char *ciphertext =
-      new unsigned char[len + 50];  // give enough room for padding
-  int outlen, tmplen;
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
-
-  int ret = -123;
-
-  const EVP_CIPHER *cipherFunc = dhimpl->getCipherFunc();
-
-  // init openssl cipher context
-  if (dhimpl->m_skAlgo == "AES") {
-    int keySize = dhimpl->m_keySize > 128 ? dhimpl->m_keySize / 8 : 16;
-    ret = EVP_EncryptInit_ex(ctx, cipherFunc, NULL,
-                             (unsigned char *)dhimpl->m_key,
-                             (unsigned char *)dhimpl->m_key + keySize);
-  } else if (dhimpl->m_skAlgo == "Blowfish") {
-    int keySize = dhimpl->m_keySize > 128 ? dhimpl->m_keySize / 8 : 16;
-    ret = EVP_EncryptInit_ex(ctx, cipherFunc, NULL, NULL,
-                             (unsigned char *)dhimpl->m_key + keySize);
-    LOGDH("DHencrypt: init BF ret %d", ret);
-    EVP_CIPHER_CTX_set_key_length(ctx, keySize);
-    LOGDH("DHencrypt: BF keysize is %d", keySize);
-    ret = EVP_EncryptInit_ex(ctx, NULL, NULL, (unsigned char *)dhimpl->m_key,
-                             NULL);
-  } else if (dhimpl->m_skAlgo == "DESede") {
-    ret = EVP_EncryptInit_ex(ctx, cipherFunc, NULL,
-                             (unsigned char *)dhimpl->m_key,
-                             (unsigned char *)dhimpl->m_key + 24);
-  }
-
-  LOGDH(" DHencrypt: init ret %d", ret);
-
-  if (!EVP_EncryptUpdate(ctx, ciphertext, &outlen, cleartext, len)) {
-    LOGDH(" DHencrypt: enc update ret NULL");
-    return NULL;
+void DHImpl::freeCipherContexts() {
+  if (m_encryptCtx != NULL) {
+    EVP_CIPHER_CTX_free(m_encryptCtx);
+    m_encryptCtx = NULL;
   }
-  /* Buffer passed to EVP_EncryptFinal() must be after data just
-   * encrypted to avoid overwriting it.
-   */
-  tmplen = 0;
+  if (m_decryptCtx != NULL) {
+    EVP_CIPHER_CTX_free(m_decryptCtx);
+    m_decryptCtx = NULL;
+  }
+}
 
-  if (!EVP_EncryptFinal_ex(ctx, ciphertext + outlen, &tmplen)) {
-    LOGDH("DHencrypt: enc final ret NULL");
-    return NULL;
+// Runs one message through a cipher context keyed by initCipherContexts.
+// Returns the length written to out, or -1.
+static int cipherDH(DHImpl *dhimpl, EVP_CIPHER_CTX *ctx,
+                    const unsigned char *in, int len, unsigned char *out,
+                    int capacity) {
+  // keep the key schedule, only start over from the IV
+  if (!EVP_CipherInit_ex(ctx, NULL, NULL, NULL, dhimpl->getIv(), -1)) {
+    LOGDH(" DHcipher: init ret NULL");
+    return -1;
+  }
+
+  if (capacity < len + EVP_CIPHER_CTX_block_size(ctx)) {
+    LOGDH(" DHcipher: output buffer of %d too small for %d", capacity, len);
+    return -1;
+  }
+
+  int outlen = 0;
+  if (!EVP_CipherUpdate(ctx, out, &outlen, in, len)) {
+    LOGDH(" DHcipher: update ret NULL");
+    return -1;
+  }
+  /* Buffer passed to EVP_CipherFinal() must be after data just
+   * processed to avoid overwriting it.
+   */
+  int tmplen = 0;
+  if (!EVP_CipherFinal_ex(ctx, out + outlen, &tmplen)) {
+    LOGDH(" DHcipher: final ret NULL");
+    return -1;
   }
 
   outlen += tmplen;
+  LOGDH(" DHcipher: in len is %d, out len is %d", len, outlen);
+  return outlen;
+}
 
-  EVP_CIPHER_CTX_free(ctx);
+int gf_encryptDHInto(void *dhCtx, const unsigned char *cleartext, int len,
+                     unsigned char *ciphertext, int capacity) {
+  DHImpl *dhimpl = reinterpret_cast<DHImpl *>(dhCtx);
 
-  LOGDH("DHencrypt: in len is %d, out len is %d", len, outlen);
+  // Validation
+  if (cleartext == NULL || len < 1 || ciphertext == NULL) {
+    return -1;
+  }
 
-  *retLen = outlen;
-  return ciphertext;
+  LOGDH(" DH: gf_encryptDH using sk algo: %s, Keysize: %d",
+        dhimpl->m_skAlgo.c_str(), dhimpl->m_keySize);
+
+  if (dhimpl->m_encryptCtx == NULL && !dhimpl->initCipherContexts()) {
+    return -1;
+  }
+  return cipherDH(dhimpl, dhimpl->m_encryptCtx, cleartext, len, ciphertext,
+                  capacity);
 }
 
-unsigned char *gf_decryptDH(void *dhCtx, const unsigned char *cleartext,
-                            int len, int *retLen) {
+int gf_decryptDHInto(void *dhCtx, const unsigned char *ciphertext, int len,
+                     unsigned char *cleartext, int capacity) {
   DHImpl *dhimpl = reinterpret_cast<DHImpl *>(dhCtx);
 
   // Validation
-  if (cleartext == NULL || len < 1 || retLen == NULL) {
-    return NULL;
+  if (ciphertext == NULL || len < 1 || cleartext == NULL) {
+    return -1;
   }
 
-  LOGDH(" DH: gf_encryptDH using sk algo: %s, Keysize: %d",
+  LOGDH(" DH: gf_decryptDH using sk algo: %s, Keysize: %d",
         dhimpl->m_skAlgo.c_str(), dhimpl->m_keySize);
 
-  unsigned char *ciphertext =
-      new unsigned char[len + 50];  // give enough room for padding
-  int outlen, tmplen;
-  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
-
-  int ret = -123;
-
-  const EVP_CIPHER *cipherFunc = dhimpl->getCipherFunc();
-
-  // init openssl cipher context
-  if (dhimpl->m_skAlgo == "AES") {
-    int keySize = dhimpl->m_keySize > 128 ? dhimpl->m_keySize / 8 : 16;
-    ret = EVP_DecryptInit_ex(ctx, cipherFunc, NULL,
-                             (unsigned char *)dhimpl->m_key,
-                             (unsigned char *)dhimpl->m_key + keySize);
-  } else if (dhimpl->m_skAlgo == "Blowfish") {
-    int keySize = dhimpl->m_keySize > 128 ? dhimpl->m_keySize / 8 : 16;
-    ret = EVP_DecryptInit_ex(ctx, cipherFunc, NULL, NULL,
-                             (unsigned char *)dhimpl->m_key + keySize);
-    LOGDH("DHencrypt: init BF ret %d", ret);
-    EVP_CIPHER_CTX_set_key_length(ctx, keySize);
-    LOGDH("DHencrypt: BF keysize is %d", keySize);
-    ret = EVP_DecryptInit_ex(ctx, NULL, NULL, (unsigned char *)dhimpl->m_key,
-                             NULL);
-  } else if (dhimpl->m_skAlgo == "DESede") {
-    ret = EVP_DecryptInit_ex(ctx, cipherFunc, NULL,
-                             (unsigned char *)dhimpl->m_key,
-                             (unsigned char *)dhimpl->m_key + 24);
-  }
-
-  LOGDH(" DHencrypt: init ret %d", ret);
-
-  if (!EVP_DecryptUpdate(ctx, ciphertext, &outlen, cleartext, len)) {
-    LOGDH(" DHencrypt: enc update ret NULL");
+  if (dhimpl->m_decryptCtx == NULL && !dhimpl->initCipherContexts()) {
+    return -1;
+  }
+  return cipherDH(dhimpl, dhimpl->m_decryptCtx, ciphertext, len, cleartext,
+                  capacity);
+}
+
+unsigned char *gf_encryptDH(void *dhCtx, const unsigned char *cleartext,
+                            int len, int *retLen) {
+  // Validation
+  if (cleartext == NULL || len < 1 || retLen == NULL) {
     return NULL;
   }
-  /* Buffer passed to EVP_EncryptFinal() must be after data just
-   * encrypted to avoid overwriting it.
-   */
-  tmplen = 0;
 
-  if (!EVP_DecryptFinal_ex(ctx, ciphertext + outlen, &tmplen)) {
-    LOGDH("DHencrypt: enc final ret NULL");
+  unsigned char *ciphertext =
+      new unsigned char[len + 50];  // give enough room for padding
+  int outlen = gf_encryptDHInto(dhCtx, cleartext, len, ciphertext, len + 50);
+  if (outlen < 0) {
+    delete[] ciphertext;
     return NULL;
   }
 
-  outlen += tmplen;
+  *retLen = outlen;
+  return ciphertext;
+}
 
-  EVP_CIPHER_CTX_free(ctx);
+unsigned char *gf_decryptDH(void *dhCtx, const unsigned char *cleartext,
+                            int len, int *retLen) {
+  // Validation
+  if (cleartext == NULL || len < 1 || retLen == NULL) {
+    return NULL;
+  }
 
-  LOGDH("DHencrypt: in len is %d, out len is %d", len, outlen);
+  unsigned char *plaintext =
+      new unsigned char[len + 50];  // give enough room for padding
+  int outlen = gf_decryptDHInto(dhCtx, cleartext, len, plaintext, len + 50);
+  if (outlen < 0) {
+    delete[] plaintext;
+    return NULL;
+  }
 
   *retLen = outlen;
-  return ciphertext;
+  return plaintext;
 }
 
 // std::shared_ptr<CacheableBytes> decrypt(const uint8_t * ciphertext, int len)
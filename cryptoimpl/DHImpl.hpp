@@ -22,6 +22,7 @@
 
 #include <openssl/dh.h>
 #include <openssl/asn1t.h>
+#include <openssl/evp.h>
 #include <openssl/x509.h>
 #include <string>
 #include <vector>
@@ -67,6 +68,12 @@ CPPCACHE_EXPORT unsigned char* gf_encryptDH(void* dhCtx,
 CPPCACHE_EXPORT unsigned char* gf_decryptDH(void* dhCtx,
                                             const unsigned char* cleartext,
                                             int len, int* retLen);
+CPPCACHE_EXPORT int gf_encryptDHInto(void* dhCtx,
+                                     const unsigned char* cleartext, int len,
+                                     unsigned char* ciphertext, int capacity);
+CPPCACHE_EXPORT int gf_decryptDHInto(void* dhCtx,
+                                     const unsigned char* ciphertext, int len,
+                                     unsigned char* cleartext, int capacity);
 CPPCACHE_EXPORT bool gf_verifyDH(void* dhCtx, const char* subject,
                                  const unsigned char* challenge,
                                  int challengeLen,
@@ -82,11 +89,22 @@ class DHImpl {
   BIGNUM* m_pubKeyOther;
   unsigned char m_key[128];
   std::vector<X509*> m_serverCerts;
+  // cipher contexts keyed with the shared secret, reset for each message
+  EVP_CIPHER_CTX* m_encryptCtx;
+  EVP_CIPHER_CTX* m_decryptCtx;
 
   const EVP_CIPHER* getCipherFunc();
   int setSkAlgo(const char* skalgo);
+  const unsigned char* getIv() const;
+  bool initCipherContexts();
+  void freeCipherContexts();
 
-  DHImpl() : m_dh(NULL), m_keySize(0), m_pubKeyOther(NULL) {
+  DHImpl()
+      : m_dh(NULL),
+        m_keySize(0),
+        m_pubKeyOther(NULL),
+        m_encryptCtx(NULL),
+        m_decryptCtx(NULL) {
     /* adongre
      * CID 28924: Uninitialized scalar field (UNINIT_CTOR)
      */